@@ -0,0 +1,112 @@
+; ModuleID = 'TestBasic.CoreMath'
+source_filename = "TestBasic.CoreMath"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+declare void @printI32(i32)
+
+; Function Attrs: nounwind readnone willreturn
+define i32 @MathLib.CoreMath.subtract(i32 %0, i32 %1) #0 !dbg !4 {
+entry:
+  %a.addr = alloca i32, align 4, !dbg !12
+  store i32 %0, ptr %a.addr, align 4, !dbg !12
+  call void @llvm.dbg.declare(metadata ptr %a.addr, metadata !10, metadata !DIExpression()), !dbg !13
+  %b.addr = alloca i32, align 4, !dbg !12
+  store i32 %1, ptr %b.addr, align 4, !dbg !12
+  call void @llvm.dbg.declare(metadata ptr %b.addr, metadata !11, metadata !DIExpression()), !dbg !14
+  %a = load i32, ptr %a.addr, align 4, !dbg !15
+  %b = load i32, ptr %b.addr, align 4, !dbg !15
+  %sub = sub nsw i32 %a, %b, !dbg !15
+  ret i32 %sub, !dbg !15
+}
+
+; Function Attrs: nounwind readnone willreturn
+define i32 @MathLib.CoreMath.add(i32 %0, i32 %1) #0 !dbg !16 {
+entry:
+  %a.addr = alloca i32, align 4, !dbg !20
+  store i32 %0, ptr %a.addr, align 4, !dbg !20
+  call void @llvm.dbg.declare(metadata ptr %a.addr, metadata !18, metadata !DIExpression()), !dbg !21
+  %b.addr = alloca i32, align 4, !dbg !20
+  store i32 %1, ptr %b.addr, align 4, !dbg !20
+  call void @llvm.dbg.declare(metadata ptr %b.addr, metadata !19, metadata !DIExpression()), !dbg !22
+  %a = load i32, ptr %a.addr, align 4, !dbg !23
+  %b = load i32, ptr %b.addr, align 4, !dbg !23
+  %add = add nsw i32 %a, %b, !dbg !23
+  ret i32 %add, !dbg !23
+}
+
+; Function Attrs: nounwind readnone willreturn
+define i32 @MathLib.CoreMath.multiply(i32 %0, i32 %1) #0 !dbg !24 {
+entry:
+  %a.addr = alloca i32, align 4, !dbg !28
+  store i32 %0, ptr %a.addr, align 4, !dbg !28
+  call void @llvm.dbg.declare(metadata ptr %a.addr, metadata !26, metadata !DIExpression()), !dbg !29
+  %b.addr = alloca i32, align 4, !dbg !28
+  store i32 %1, ptr %b.addr, align 4, !dbg !28
+  call void @llvm.dbg.declare(metadata ptr %b.addr, metadata !27, metadata !DIExpression()), !dbg !30
+  %a = load i32, ptr %a.addr, align 4, !dbg !31
+  %b = load i32, ptr %b.addr, align 4, !dbg !31
+  %mul = mul nsw i32 %a, %b, !dbg !31
+  ret i32 %mul, !dbg !31
+}
+
+; Function Attrs: nounwind readnone willreturn
+define internal fastcc i32 @internal_helper(i32 %0) #0 !dbg !32 {
+entry:
+  %x.addr = alloca i32, align 4, !dbg !37
+  store i32 %0, ptr %x.addr, align 4, !dbg !37
+  call void @llvm.dbg.declare(metadata ptr %x.addr, metadata !36, metadata !DIExpression()), !dbg !38
+  %x = load i32, ptr %x.addr, align 4, !dbg !39
+  %mul = mul nsw i32 %x, 2, !dbg !39
+  ret i32 %mul, !dbg !39
+}
+
+; Function Attrs: nofree nosync nounwind readnone speculatable willreturn
+declare void @llvm.dbg.declare(metadata, metadata, metadata) #1
+
+attributes #0 = { nounwind readnone willreturn }
+attributes #1 = { nofree nosync nounwind readnone speculatable willreturn }
+
+!llvm.dbg.cu = !{!0}
+!llvm.module.flags = !{!2, !3}
+
+!0 = distinct !DICompileUnit(language: DW_LANG_C, file: !1, producer: "ShiroC Compiler\00", isOptimized: false, runtimeVersion: 0, emissionKind: FullDebug, splitDebugInlining: false)
+!1 = !DIFile(filename: "CoreMath", directory: ".")
+!2 = !{i32 2, !"Dwarf Version", i32 4}
+!3 = !{i32 2, !"Debug Info Version", i32 3}
+!4 = distinct !DISubprogram(name: "subtract", linkageName: "subtract", scope: !5, file: !5, line: 7, type: !6, scopeLine: 7, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !9)
+!5 = !DIFile(filename: "math.shiro", directory: "src/tests/st/dependencies/test1_basic/../math-utils/src/core")
+!6 = !DISubroutineType(types: !7)
+!7 = !{!8, !8, !8}
+!8 = !DIBasicType(name: "i32", size: 32, encoding: DW_ATE_signed)
+!9 = !{!10, !11}
+!10 = !DILocalVariable(name: "a", arg: 1, scope: !4, file: !5, line: 7, type: !8)
+!11 = !DILocalVariable(name: "b", arg: 2, scope: !4, file: !5, line: 7, type: !8)
+!12 = !DILocation(line: 7, column: 8, scope: !4)
+!13 = !DILocation(line: 7, column: 20, scope: !4)
+!14 = !DILocation(line: 7, column: 28, scope: !4)
+!15 = !DILocation(line: 8, column: 12, scope: !4)
+!16 = distinct !DISubprogram(name: "add", linkageName: "add", scope: !5, file: !5, line: 3, type: !6, scopeLine: 3, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !17)
+!17 = !{!18, !19}
+!18 = !DILocalVariable(name: "a", arg: 1, scope: !16, file: !5, line: 3, type: !8)
+!19 = !DILocalVariable(name: "b", arg: 2, scope: !16, file: !5, line: 3, type: !8)
+!20 = !DILocation(line: 3, column: 8, scope: !16)
+!21 = !DILocation(line: 3, column: 15, scope: !16)
+!22 = !DILocation(line: 3, column: 23, scope: !16)
+!23 = !DILocation(line: 4, column: 12, scope: !16)
+!24 = distinct !DISubprogram(name: "multiply", linkageName: "multiply", scope: !5, file: !5, line: 11, type: !6, scopeLine: 11, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !25)
+!25 = !{!26, !27}
+!26 = !DILocalVariable(name: "a", arg: 1, scope: !24, file: !5, line: 11, type: !8)
+!27 = !DILocalVariable(name: "b", arg: 2, scope: !24, file: !5, line: 11, type: !8)
+!28 = !DILocation(line: 11, column: 8, scope: !24)
+!29 = !DILocation(line: 11, column: 20, scope: !24)
+!30 = !DILocation(line: 11, column: 28, scope: !24)
+!31 = !DILocation(line: 12, column: 12, scope: !24)
+!32 = distinct !DISubprogram(name: "internal_helper", linkageName: "internal_helper", scope: !5, file: !5, line: 16, type: !33, scopeLine: 16, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !35)
+!33 = !DISubroutineType(types: !34)
+!34 = !{!8, !8}
+!35 = !{!36}
+!36 = !DILocalVariable(name: "x", arg: 1, scope: !32, file: !5, line: 16, type: !8)
+!37 = !DILocation(line: 16, column: 1, scope: !32)
+!38 = !DILocation(line: 16, column: 20, scope: !32)
+!39 = !DILocation(line: 17, column: 12, scope: !32)
@@ -0,0 +1,94 @@
+; ModuleID = 'TestBasic.Main'
+source_filename = "TestBasic.Main"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+declare void @printI32(i32)
+
+; Function Attrs: nounwind
+declare i32 @MathLib.CoreMath.subtract(i32, i32) #0
+
+; Function Attrs: nounwind
+declare i32 @MathLib.CoreMath.add(i32, i32) #0
+
+; Function Attrs: nounwind
+declare i32 @MathLib.CoreMath.multiply(i32, i32) #0
+
+; Function Attrs: nounwind
+define i32 @main() #0 !dbg !4 {
+entry:
+  %result = alloca i32, align 4
+  call void @llvm.dbg.declare(metadata ptr %result, metadata !10, metadata !DIExpression()), !dbg !11
+  %call = call i32 @MathLib.CoreMath.add(i32 5, i32 10), !dbg !12
+  store i32 %call, ptr %result, align 4, !dbg !12
+  %result1 = load i32, ptr %result, align 4, !dbg !13
+  %ne = icmp ne i32 %result1, 15, !dbg !13
+  br i1 %ne, label %if.then, label %if.else, !dbg !13
+
+if.then:                                          ; preds = %entry
+  ret i32 1, !dbg !14
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !14
+
+if.join:                                          ; preds = %if.else
+  %call2 = call i32 @MathLib.CoreMath.subtract(i32 20, i32 8), !dbg !15
+  store i32 %call2, ptr %result, align 4, !dbg !15
+  %result3 = load i32, ptr %result, align 4, !dbg !16
+  %ne4 = icmp ne i32 %result3, 12, !dbg !16
+  br i1 %ne4, label %if.then5, label %if.else6, !dbg !16
+
+if.then5:                                         ; preds = %if.join
+  ret i32 2, !dbg !17
+
+if.else6:                                         ; preds = %if.join
+  br label %if.join7, !dbg !17
+
+if.join7:                                         ; preds = %if.else6
+  %call8 = call i32 @MathLib.CoreMath.multiply(i32 3, i32 7), !dbg !18
+  store i32 %call8, ptr %result, align 4, !dbg !18
+  %result9 = load i32, ptr %result, align 4, !dbg !19
+  %ne10 = icmp ne i32 %result9, 21, !dbg !19
+  br i1 %ne10, label %if.then11, label %if.else12, !dbg !19
+
+if.then11:                                        ; preds = %if.join7
+  ret i32 3, !dbg !20
+
+if.else12:                                        ; preds = %if.join7
+  br label %if.join13, !dbg !20
+
+if.join13:                                        ; preds = %if.else12
+  ret i32 0, !dbg !21
+}
+
+; Function Attrs: nofree nosync nounwind readnone speculatable willreturn
+declare void @llvm.dbg.declare(metadata, metadata, metadata) #1
+
+attributes #0 = { nounwind }
+attributes #1 = { nofree nosync nounwind readnone speculatable willreturn }
+
+!llvm.dbg.cu = !{!0}
+!llvm.module.flags = !{!2, !3}
+
+!0 = distinct !DICompileUnit(language: DW_LANG_C, file: !1, producer: "ShiroC Compiler\00", isOptimized: false, runtimeVersion: 0, emissionKind: FullDebug, splitDebugInlining: false)
+!1 = !DIFile(filename: "Main", directory: ".")
+!2 = !{i32 2, !"Dwarf Version", i32 4}
+!3 = !{i32 2, !"Debug Info Version", i32 3}
+!4 = distinct !DISubprogram(name: "main", linkageName: "main", scope: !5, file: !5, line: 5, type: !6, scopeLine: 5, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !9)
+!5 = !DIFile(filename: "main.shiro", directory: "src/tests/st/dependencies/test1_basic/src/app")
+!6 = !DISubroutineType(types: !7)
+!7 = !{!8}
+!8 = !DIBasicType(name: "i32", size: 32, encoding: DW_ATE_signed)
+!9 = !{!10}
+!10 = !DILocalVariable(name: "result", scope: !4, file: !5, line: 7, type: !8)
+!11 = !DILocation(line: 7, column: 5, scope: !4)
+!12 = !DILocation(line: 7, column: 18, scope: !4)
+!13 = !DILocation(line: 8, column: 9, scope: !4)
+!14 = !DILocation(line: 9, column: 9, scope: !4)
+!15 = !DILocation(line: 12, column: 14, scope: !4)
+!16 = !DILocation(line: 13, column: 9, scope: !4)
+!17 = !DILocation(line: 14, column: 9, scope: !4)
+!18 = !DILocation(line: 17, column: 14, scope: !4)
+!19 = !DILocation(line: 18, column: 9, scope: !4)
+!20 = !DILocation(line: 19, column: 9, scope: !4)
+!21 = !DILocation(line: 22, column: 5, scope: !4)
@@ -0,0 +1,870 @@
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// Number formatting: integers are written two digits at a time from a table of digit pairs, doubles with the fewest
+// digits that read back as the same value, computed with the Ryu algorithm (Ulf Adams, PLDI 2018). Every function
+// returns the number of bytes written to out, which has to have room for SHIRO_FORMAT_MAX_LENGTH bytes.
+enum { SHIRO_FORMAT_MAX_LENGTH = 32 };
+
+static const char DIGIT_PAIRS[] =
+    "00010203040506070809101112131415161718192021222324"
+    "25262728293031323334353637383940414243444546474849"
+    "50515253545556575859606162636465666768697071727374"
+    "75767778798081828384858687888990919293949596979899";
+
+static uint32_t decimal_length(uint64_t value)
+{
+    for (uint32_t length = 1;; length += 4)
+    {
+        if (value < 10)
+            return length;
+        if (value < 100)
+            return length + 1;
+        if (value < 1000)
+            return length + 2;
+        if (value < 10000)
+            return length + 3;
+        value /= 10000;
+    }
+}
+
+// Write the digits of value backwards from end
+static void write_digits(uint64_t value, uint8_t* end)
+{
+    while (value >= 100)
+    {
+        uint64_t rest = value / 100;
+        end -= 2;
+        memcpy(end, DIGIT_PAIRS + 2 * (value - 100 * rest), 2);
+        value = rest;
+    }
+    if (value >= 10)
+        memcpy(end - 2, DIGIT_PAIRS + 2 * value, 2);
+    else
+        end[-1] = (uint8_t)('0' + value);
+}
+
+size_t shiro_format_u64(uint64_t value, uint8_t* out)
+{
+    uint32_t length = decimal_length(value);
+    write_digits(value, out + length);
+    return length;
+}
+
+size_t shiro_format_i64(int64_t value, uint8_t* out)
+{
+    if (value >= 0)
+        return shiro_format_u64((uint64_t)value, out);
+    out[0] = '-';
+    return 1 + shiro_format_u64(0 - (uint64_t)value, out + 1);
+}
+
+// Ryu needs 5^i and 2^k / 5^i, scaled to 125 bits, for every decimal exponent of a double. Only every 26th entry is
+// stored; the others are derived from it and a power of 5 that fits 64 bits, and corrected by the 2 bits per entry in
+// the offset tables.
+enum { POW5_TABLE_SIZE = 26, POW5_BITCOUNT = 125, POW5_INV_BITCOUNT = 125 };
+
+static const uint64_t POW5_TABLE[26] = {
+    1u, 5u, 25u, 125u,
+    625u, 3125u, 15625u, 78125u,
+    390625u, 1953125u, 9765625u, 48828125u,
+    244140625u, 1220703125u, 6103515625u, 30517578125u,
+    152587890625u, 762939453125u, 3814697265625u, 19073486328125u,
+    95367431640625u, 476837158203125u, 2384185791015625u, 11920928955078125u,
+    59604644775390625u, 298023223876953125u,
+};
+static const uint64_t POW5_SPLIT[13][2] = {
+    { 0x0000000000000000u, 0x1000000000000000u }, { 0x0000000000000000u, 0x14adf4b7320334b9u },
+    { 0x0e549208b31adb10u, 0x1aba4714957d300du }, { 0x6dc6ad264d8f0866u, 0x1145b7e285bf98f5u },
+    { 0xeb1dbd923d8596cau, 0x1652efdc6018a1fcu }, { 0xb4c1b80b22ae923cu, 0x1cda62055b2d9d83u },
+    { 0x5bb28b4e8f7e4c30u, 0x12a5568b9f52f416u }, { 0xf08aed437682d4fbu, 0x1819651531f9e78fu },
+    { 0xb4ee134ad99bf150u, 0x1f25c186a6f04c28u }, { 0x16499ecb70c25f03u, 0x1420eb449c8842e6u },
+    { 0x85a56ead360865b0u, 0x1a03fde214caf085u }, { 0x093db1d57999890bu, 0x10cfeb353a97dad8u },
+    { 0xcf38bb735e3f36acu, 0x15baaf44fa52673eu },
+};
+static const uint32_t POW5_SPLIT_OFFSETS[21] = {
+    0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, 0x40000000u, 0x59695995u,
+    0x55545555u, 0x56555515u, 0x41150504u, 0x40555410u, 0x44555145u, 0x44504540u,
+    0x45555550u, 0x40004000u, 0x96440440u, 0x55565565u, 0x54454045u, 0x40154151u,
+    0x55559155u, 0x51405555u, 0x00000105u,
+};
+static const uint64_t POW5_INV_SPLIT[15][2] = {
+    { 0x0000000000000001u, 0x2000000000000000u }, { 0x52a6c95fc0655034u, 0x18c240c4aecb13bbu },
+    { 0x7ca8d50071dfc806u, 0x1327fc58da0f6ff5u }, { 0x6520247d3556476eu, 0x1da48ce468e7c702u },
+    { 0x6139cdd76802e6e9u, 0x16ef5b40c2fc7779u }, { 0xf951a7ff43de8c79u, 0x11bebdf578b2f391u },
+    { 0x7be8bee8d6e957e8u, 0x1b758d848fac54b0u }, { 0x8bd3f9e999a423eau, 0x153eda614071a3b7u },
+    { 0x0848f973cb3ee3ceu, 0x10701bd527b4978cu }, { 0x153285ebb9efbfa2u, 0x196fbb9bb44db44du },
+    { 0xadeee7f86c07b696u, 0x13ae3591f5b4d936u }, { 0x4d686a4eaf182222u, 0x1e74404f3daada91u },
+    { 0x98c0a106e09ebd9fu, 0x17900ea4fda7c257u }, { 0x8f20e37371497d0eu, 0x123b140576d820b2u },
+    { 0xb043138134743d85u, 0x1c35f4275f7a29adu },
+};
+static const uint32_t POW5_INV_SPLIT_OFFSETS[22] = {
+    0x54544554u, 0x04055545u, 0x10041000u, 0x00400414u, 0x40010000u, 0x41155555u,
+    0x00000454u, 0x00010044u, 0x40000000u, 0x44000041u, 0x50454450u, 0x55550054u,
+    0x51655554u, 0x40004000u, 0x01000001u, 0x00010500u, 0x51515411u, 0x05555554u,
+    0x50411500u, 0x40040000u, 0x05040110u, 0x00000000u,
+};
+
+typedef unsigned __int128 uint128_t;
+
+// ceil(log2(5^e)) for e > 0, 1 for e = 0
+static int32_t pow5_bits(int32_t e)
+{
+    return (int32_t)(((uint32_t)e * 1217359) >> 19) + 1;
+}
+
+// floor(log10(2^e))
+static uint32_t log10_pow2(int32_t e)
+{
+    return ((uint32_t)e * 78913) >> 18;
+}
+
+// floor(log10(5^e))
+static uint32_t log10_pow5(int32_t e)
+{
+    return ((uint32_t)e * 732923) >> 20;
+}
+
+static void compute_pow5(uint32_t i, uint64_t result[2])
+{
+    uint32_t base = i / POW5_TABLE_SIZE;
+    uint32_t base2 = base * POW5_TABLE_SIZE;
+    const uint64_t* mul = POW5_SPLIT[base];
+    if (i == base2)
+    {
+        result[0] = mul[0];
+        result[1] = mul[1];
+        return;
+    }
+    uint64_t m = POW5_TABLE[i - base2];
+    uint128_t b0 = (uint128_t)m * mul[0];
+    uint128_t b2 = (uint128_t)m * mul[1];
+    uint32_t delta = (uint32_t)(pow5_bits((int32_t)i) - pow5_bits((int32_t)base2));
+    uint128_t sum = (b0 >> delta) + (b2 << (64 - delta)) + ((POW5_SPLIT_OFFSETS[i / 16] >> ((i % 16) << 1)) & 3);
+    result[0] = (uint64_t)sum;
+    result[1] = (uint64_t)(sum >> 64);
+}
+
+static void compute_inv_pow5(uint32_t i, uint64_t result[2])
+{
+    uint32_t base = (i + POW5_TABLE_SIZE - 1) / POW5_TABLE_SIZE;
+    uint32_t base2 = base * POW5_TABLE_SIZE;
+    const uint64_t* mul = POW5_INV_SPLIT[base];
+    if (i == base2)
+    {
+        result[0] = mul[0];
+        result[1] = mul[1];
+        return;
+    }
+    uint64_t m = POW5_TABLE[base2 - i];
+    uint128_t b0 = (uint128_t)m * (mul[0] - 1);
+    uint128_t b2 = (uint128_t)m * mul[1];
+    uint32_t delta = (uint32_t)(pow5_bits((int32_t)base2) - pow5_bits((int32_t)i));
+    uint128_t sum = ((b0 >> delta) + (b2 << (64 - delta))) + 1 +
+        ((POW5_INV_SPLIT_OFFSETS[i / 16] >> ((i % 16) << 1)) & 3);
+    result[0] = (uint64_t)sum;
+    result[1] = (uint64_t)(sum >> 64);
+}
+
+static uint64_t mul_shift(uint64_t m, const uint64_t mul[2], int32_t shift)
+{
+    uint128_t b0 = (uint128_t)m * mul[0];
+    uint128_t b2 = (uint128_t)m * mul[1];
+    return (uint64_t)(((b0 >> 64) + b2) >> (shift - 64));
+}
+
+static bool multiple_of_pow5(uint64_t value, uint32_t p)
+{
+    uint32_t count = 0;
+    while (value % 5 == 0)
+    {
+        value /= 5;
+        ++count;
+    }
+    return count >= p;
+}
+
+static bool multiple_of_pow2(uint64_t value, uint32_t p)
+{
+    return (value & ((1ull << p) - 1)) == 0;
+}
+
+// A finite, non-zero double as digits * 10^exponent, with the fewest digits that still round to the same double and,
+// among those, the closest to it
+typedef struct decimal_double
+{
+    uint64_t digits;
+    int32_t exponent;
+} decimal_double_t;
+
+static decimal_double_t shortest_decimal(uint64_t ieee_mantissa, uint32_t ieee_exponent)
+{
+    // Work on 4 * m2 * 2^e2, so that the halfway points to the neighboring doubles are integers as well
+    int32_t e2;
+    uint64_t m2;
+    if (ieee_exponent == 0)
+    {
+        e2 = 1 - 1023 - 52 - 2;
+        m2 = ieee_mantissa;
+    }
+    else
+    {
+        e2 = (int32_t)ieee_exponent - 1023 - 52 - 2;
+        m2 = (1ull << 52) | ieee_mantissa;
+    }
+    bool accept_bounds = (m2 & 1) == 0;  // round-to-even reads the halfway points back as this double
+    uint64_t mv = 4 * m2;
+    uint32_t mm_shift = ieee_mantissa != 0 || ieee_exponent <= 1;  // the gap below is half as wide at powers of 2
+
+    // Scale the value and its bounds to decimal: vr, vp and vm times 10^e10
+    uint64_t vr, vp, vm;
+    int32_t e10;
+    bool vm_trailing_zeros = false;
+    bool vr_trailing_zeros = false;
+    uint64_t pow5[2];
+    if (e2 >= 0)
+    {
+        uint32_t q = log10_pow2(e2) - (e2 > 3);
+        e10 = (int32_t)q;
+        int32_t k = POW5_INV_BITCOUNT + pow5_bits((int32_t)q) - 1;
+        int32_t i = -e2 + (int32_t)q + k;
+        compute_inv_pow5(q, pow5);
+        vr = mul_shift(4 * m2, pow5, i);
+        vp = mul_shift(4 * m2 + 2, pow5, i);
+        vm = mul_shift(4 * m2 - 1 - mm_shift, pow5, i);
+        if (q <= 21)
+        {
+            // Only one of mp, mv and mm can be a multiple of 5, if any
+            if (mv % 5 == 0)
+                vr_trailing_zeros = multiple_of_pow5(mv, q);
+            else if (accept_bounds)
+                vm_trailing_zeros = multiple_of_pow5(mv - 1 - mm_shift, q);
+            else
+                vp -= multiple_of_pow5(mv + 2, q);
+        }
+    }
+    else
+    {
+        uint32_t q = log10_pow5(-e2) - (-e2 > 1);
+        e10 = (int32_t)q + e2;
+        int32_t i = -e2 - (int32_t)q;
+        int32_t k = pow5_bits(i) - POW5_BITCOUNT;
+        int32_t j = (int32_t)q - k;
+        compute_pow5((uint32_t)i, pow5);
+        vr = mul_shift(4 * m2, pow5, j);
+        vp = mul_shift(4 * m2 + 2, pow5, j);
+        vm = mul_shift(4 * m2 - 1 - mm_shift, pow5, j);
+        if (q <= 1)
+        {
+            // mv = 4 * m2 always has at least two trailing zero bits
+            vr_trailing_zeros = true;
+            if (accept_bounds)
+                vm_trailing_zeros = mm_shift == 1;
+            else
+                --vp;
+        }
+        else if (q < 63)
+        {
+            vr_trailing_zeros = multiple_of_pow2(mv, q);
+        }
+    }
+
+    // Drop digits while the bounds still differ, rounding vr by the last digit dropped
+    int32_t removed = 0;
+    uint64_t output;
+    if (vm_trailing_zeros || vr_trailing_zeros)
+    {
+        // Exact cases, which need to know whether the dropped digits were all zero (rare)
+        uint8_t last_removed_digit = 0;
+        while (vp / 10 > vm / 10)
+        {
+            vm_trailing_zeros &= vm % 10 == 0;
+            vr_trailing_zeros &= last_removed_digit == 0;
+            last_removed_digit = (uint8_t)(vr % 10);
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            ++removed;
+        }
+        if (vm_trailing_zeros)
+        {
+            while (vm % 10 == 0)
+            {
+                vr_trailing_zeros &= last_removed_digit == 0;
+                last_removed_digit = (uint8_t)(vr % 10);
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                ++removed;
+            }
+        }
+        if (vr_trailing_zeros && last_removed_digit == 5 && vr % 2 == 0)
+            last_removed_digit = 4;  // exactly halfway: round to even
+        output = vr + ((vr == vm && (!accept_bounds || !vm_trailing_zeros)) || last_removed_digit >= 5);
+    }
+    else
+    {
+        bool round_up = false;
+        if (vp / 100 > vm / 100)
+        {
+            round_up = vr % 100 >= 50;
+            vr /= 100;
+            vp /= 100;
+            vm /= 100;
+            removed += 2;
+        }
+        while (vp / 10 > vm / 10)
+        {
+            round_up = vr % 10 >= 5;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            ++removed;
+        }
+        output = vr + (vr == vm || round_up);
+    }
+
+    return (decimal_double_t){ .digits = output, .exponent = e10 + removed };
+}
+
+// Plain notation for magnitudes from 1e-6 to below 1e21, scientific notation (1e+21, 2.5e-7) otherwise
+size_t shiro_format_f64(double value, uint8_t* out)
+{
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint64_t ieee_mantissa = bits & ((1ull << 52) - 1);
+    uint32_t ieee_exponent = (uint32_t)(bits >> 52) & 0x7ff;
+
+    size_t length = 0;
+    if (ieee_exponent == 0x7ff && ieee_mantissa != 0)
+    {
+        memcpy(out, "nan", 3);
+        return 3;
+    }
+    if (bits >> 63)
+        out[length++] = '-';
+    if (ieee_exponent == 0x7ff)
+    {
+        memcpy(out + length, "inf", 3);
+        return length + 3;
+    }
+    if (ieee_exponent == 0 && ieee_mantissa == 0)
+    {
+        out[length++] = '0';
+        return length;
+    }
+
+    decimal_double_t decimal = shortest_decimal(ieee_mantissa, ieee_exponent);
+    int32_t count = (int32_t)decimal_length(decimal.digits);
+    int32_t point = count + decimal.exponent;  // position of the decimal point relative to the first digit
+    uint8_t* text = out + length;
+    if (point > 0 && point <= 21)
+    {
+        if (point >= count)
+        {
+            write_digits(decimal.digits, text + count);
+            memset(text + count, '0', (size_t)(point - count));
+            return length + (size_t)point;
+        }
+        write_digits(decimal.digits, text + count + 1);
+        memmove(text, text + 1, (size_t)point);
+        text[point] = '.';
+        return length + (size_t)count + 1;
+    }
+    if (point > -6 && point <= 0)
+    {
+        text[0] = '0';
+        text[1] = '.';
+        memset(text + 2, '0', (size_t)-point);
+        write_digits(decimal.digits, text + 2 - point + count);
+        return length + 2 + (size_t)(count - point);
+    }
+
+    write_digits(decimal.digits, text + count + 1);
+    text[0] = text[1];
+    size_t mantissa_length = 1;
+    if (count > 1)
+    {
+        text[1] = '.';
+        mantissa_length = (size_t)count + 1;
+    }
+    int32_t exponent = point - 1;
+    text[mantissa_length] = 'e';
+    text[mantissa_length + 1] = exponent < 0 ? '-' : '+';
+    size_t exponent_length = shiro_format_u64((uint64_t)(exponent < 0 ? -exponent : exponent),
+        text + mantissa_length + 2);
+    return length + mantissa_length + 2 + exponent_length;
+}
+
+void printI32(int32_t value)
+{
+    uint8_t text[SHIRO_FORMAT_MAX_LENGTH];
+    size_t length = shiro_format_i64(value, text);
+    text[length++] = '\n';
+    fwrite(text, 1, length, stdout);
+}
+
+// Layout of every heap array [T]; codegen lowers them to the same struct
+typedef struct heap_array
+{
+    void* data;
+    size_t len;
+    size_t cap;
+} heap_array_t;
+
+// Grow the storage of a heap array to hold at least min_capacity elements. The capacity at least doubles, so pushing
+// n elements one at a time reallocates O(log n) times.
+void shiro_heap_array_grow(void* array, size_t element_size, size_t min_capacity)
+{
+    heap_array_t* heap_array = array;
+    if (min_capacity <= heap_array->cap)
+        return;
+
+    size_t capacity = heap_array->cap < 4 ? 4 : heap_array->cap * 2;
+    if (capacity < min_capacity)
+        capacity = min_capacity;
+
+    void* data = NULL;
+    if (capacity <= SIZE_MAX / element_size)
+        data = realloc(heap_array->data, capacity * element_size);
+    if (data == NULL)
+    {
+        fprintf(stderr, "out of memory growing array to %zu elements\n", capacity);
+        abort();
+    }
+
+    heap_array->data = data;
+    heap_array->cap = capacity;
+}
+
+// hash() of a string: eight bytes at a time are mixed in with a multiply by 2^64 / golden ratio, the last word padded
+// with zeroes. The high half is folded into the low half at the end like for integers, whose hash() is emitted inline.
+uint64_t shiro_hash_bytes(const uint8_t* data, size_t len)
+{
+    const uint64_t multiplier = 0x9E3779B97F4A7C15u;
+    uint64_t hash = len * multiplier;
+    while (len > 0)
+    {
+        uint64_t word = 0;
+        size_t word_len = len < sizeof(word) ? len : sizeof(word);
+        memcpy(&word, data, word_len);
+        hash = (hash ^ word) * multiplier;
+        hash ^= hash >> 29;
+        data += word_len;
+        len -= word_len;
+    }
+    hash *= multiplier;
+    return hash ^ (hash >> 32);
+}
+
+// Process-wide buffer of the bytes Std.IO writes to stdout. It is handed to stdio only when full, on request and at
+// exit, so the output stays in order with printf and puts while stdio is locked once per buffer instead of per call.
+// Threads share it under stdout_lock.
+static uint8_t stdout_buffer[1 << 16];
+static size_t stdout_length;
+static bool stdout_flush_registered;
+static pthread_mutex_t stdout_lock = PTHREAD_MUTEX_INITIALIZER;
+
+void shiro_stdout_flush(void)
+{
+    pthread_mutex_lock(&stdout_lock);
+    fwrite(stdout_buffer, 1, stdout_length, stdout);
+    fflush(stdout);
+    stdout_length = 0;
+    pthread_mutex_unlock(&stdout_lock);
+}
+
+static void write_all(int32_t fd, const uint8_t* data, size_t len)
+{
+    while (len > 0)
+    {
+        ssize_t written = write(fd, data, len);
+        if (written < 0 && errno == EINTR)
+            continue;
+        if (written < 0)
+            return;  // like stdio, output errors are not reported to the writer
+        data += written;
+        len -= (size_t)written;
+    }
+}
+
+// Read up to len bytes from fd, retrying reads interrupted by a signal. Returns the number of bytes read, 0 at the end
+// of the input and -1 on errors.
+int64_t shiro_read(int32_t fd, uint8_t* data, size_t len)
+{
+    while (true)
+    {
+        ssize_t count = read(fd, data, len);
+        if (count >= 0 || errno != EINTR)
+            return count;
+    }
+}
+
+// Write len bytes to fd; stdout (fd 1) goes through the process-wide buffer
+void shiro_write(int32_t fd, const uint8_t* data, size_t len)
+{
+    if (fd != 1)
+    {
+        write_all(fd, data, len);
+        return;
+    }
+
+    pthread_mutex_lock(&stdout_lock);
+    if (!stdout_flush_registered)
+    {
+        atexit(shiro_stdout_flush);
+        stdout_flush_registered = true;
+    }
+
+    if (stdout_length + len > sizeof(stdout_buffer))
+    {
+        fwrite(stdout_buffer, 1, stdout_length, stdout);
+        stdout_length = 0;
+    }
+    if (len >= sizeof(stdout_buffer))
+        fwrite(data, 1, len, stdout);
+    else
+    {
+        memcpy(stdout_buffer + stdout_length, data, len);
+        stdout_length += len;
+    }
+    pthread_mutex_unlock(&stdout_lock);
+}
+
+// Threads run a function taking one pointer, the address of a shiro function `fn entry(context: void*)`
+typedef struct thread
+{
+    pthread_t id;
+    void (*entry)(void*);
+    void* context;
+} thread_t;
+
+static void* run_thread(void* thread_)
+{
+    thread_t* thread = thread_;
+    thread->entry(thread->context);
+    return NULL;
+}
+
+// Start a thread running entry(context). Returns the thread to join, or NULL if it could not be started.
+void* shiro_thread_spawn(void* entry, void* context)
+{
+    thread_t* thread = malloc(sizeof(*thread));
+    if (thread == NULL)
+        return NULL;
+
+    *thread = (thread_t){ .entry = (void (*)(void*))entry, .context = context };
+    if (pthread_create(&thread->id, NULL, run_thread, thread) != 0)
+    {
+        free(thread);
+        return NULL;
+    }
+    return thread;
+}
+
+// Wait for a thread from shiro_thread_spawn to finish and release it
+void shiro_thread_join(void* thread_)
+{
+    thread_t* thread = thread_;
+    pthread_join(thread->id, NULL);
+    free(thread);
+}
+
+// Mutexes live on the heap because the size of pthread_mutex_t differs between platforms
+void* shiro_mutex_create(void)
+{
+    pthread_mutex_t* mutex = malloc(sizeof(*mutex));
+    if (mutex == NULL || pthread_mutex_init(mutex, NULL) != 0)
+    {
+        fprintf(stderr, "can not create mutex\n");
+        abort();
+    }
+    return mutex;
+}
+
+void shiro_mutex_destroy(void* mutex)
+{
+    pthread_mutex_destroy(mutex);
+    free(mutex);
+}
+
+void shiro_mutex_lock(void* mutex)
+{
+    pthread_mutex_lock(mutex);
+}
+
+void shiro_mutex_unlock(void* mutex)
+{
+    pthread_mutex_unlock(mutex);
+}
+
+// Work-stealing pool behind Std.Thread's parallel_for. The worker threads are started by the first parallel loop that
+// needs them and then wait for the next one. A loop's range of elements is split in halves until the halves are no
+// larger than the grain: the first half is run and the second half is pushed to the deque of the worker that split it.
+// Workers pop the most recently pushed, smallest ranges from their own deque and steal the oldest, largest ranges from
+// the others once theirs is empty. The thread calling shiro_parallel_for is worker 0 for the duration of the loop.
+enum
+{
+    PARALLEL_MAX_WORKERS = 64,
+    PARALLEL_DEQUE_CAPACITY = 128,  // ranges in a deque shrink by half from the oldest one, so at most 65 are queued
+};
+
+// A chunk of a view, passed to the loop body by value like a shiro view[T]: number of elements and the elements
+typedef struct parallel_chunk
+{
+    size_t len;
+    uint8_t* data;
+} parallel_chunk_t;
+
+typedef struct parallel_range
+{
+    _Atomic size_t begin;
+    _Atomic size_t end;
+} parallel_range_t;
+
+// Chase-Lev deque of element ranges, following Le et al., "Correct and Efficient Work-Stealing for Weak
+// Memory Models" (PPoPP 2013). The buffer does not grow: a full deque makes the owner run the range without splitting.
+typedef struct parallel_deque
+{
+    _Alignas(64) _Atomic int64_t top;
+    _Atomic int64_t bottom;
+    parallel_range_t ranges[PARALLEL_DEQUE_CAPACITY];
+} parallel_deque_t;
+
+typedef struct parallel_loop
+{
+    uint8_t* data;
+    size_t element_size;
+    size_t grain;
+    void (*body)(parallel_chunk_t chunk, void* context);
+    void* context;
+    size_t workers;             // workers taking part, the calling thread included
+    _Atomic size_t remaining;   // elements not processed yet; the loop is done at 0
+} parallel_loop_t;
+
+static pthread_mutex_t parallel_lock = PTHREAD_MUTEX_INITIALIZER;  // one loop at a time
+static pthread_mutex_t parallel_wake_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t parallel_wake = PTHREAD_COND_INITIALIZER;
+static uint64_t parallel_generation;  // incremented under parallel_wake_lock when a loop starts
+static parallel_deque_t parallel_deques[PARALLEL_MAX_WORKERS];
+static parallel_loop_t parallel_current;
+static size_t parallel_started;       // worker threads running, worker 0 not counted
+static size_t parallel_threads;       // workers of a loop, 0 until configured
+static _Thread_local bool parallel_in_worker;
+
+static bool deque_push(parallel_deque_t* deque, size_t begin, size_t end)
+{
+    int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+    int64_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    if (bottom - top >= PARALLEL_DEQUE_CAPACITY)
+        return false;
+
+    parallel_range_t* range = &deque->ranges[bottom % PARALLEL_DEQUE_CAPACITY];
+    atomic_store_explicit(&range->begin, begin, memory_order_relaxed);
+    atomic_store_explicit(&range->end, end, memory_order_relaxed);
+    atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_release);
+    return true;
+}
+
+// Owner side: take the most recently pushed range
+static bool deque_pop(parallel_deque_t* deque, size_t* begin, size_t* end)
+{
+    int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+    atomic_store_explicit(&deque->bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    int64_t top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+    if (top > bottom)
+    {
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+        return false;
+    }
+
+    parallel_range_t* range = &deque->ranges[bottom % PARALLEL_DEQUE_CAPACITY];
+    *begin = atomic_load_explicit(&range->begin, memory_order_relaxed);
+    *end = atomic_load_explicit(&range->end, memory_order_relaxed);
+    if (top == bottom)
+    {
+        // The last range: thieves may be taking it too
+        bool won = atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1, memory_order_seq_cst,
+            memory_order_relaxed);
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+        return won;
+    }
+    return true;
+}
+
+// Thief side: take the oldest range
+static bool deque_steal(parallel_deque_t* deque, size_t* begin, size_t* end)
+{
+    int64_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+    if (top >= bottom)
+        return false;
+
+    parallel_range_t* range = &deque->ranges[top % PARALLEL_DEQUE_CAPACITY];
+    *begin = atomic_load_explicit(&range->begin, memory_order_relaxed);
+    *end = atomic_load_explicit(&range->end, memory_order_relaxed);
+    return atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1, memory_order_seq_cst,
+        memory_order_relaxed);
+}
+
+static void run_range(parallel_loop_t* loop, parallel_deque_t* deque, size_t begin, size_t end)
+{
+    while (end - begin > loop->grain)
+    {
+        size_t middle = begin + (end - begin) / 2;
+        if (!deque_push(deque, middle, end))
+            break;
+        end = middle;
+    }
+
+    parallel_chunk_t chunk = { .data = loop->data + begin * loop->element_size, .len = end - begin };
+    loop->body(chunk, loop->context);
+    atomic_fetch_sub_explicit(&loop->remaining, end - begin, memory_order_acq_rel);
+}
+
+// Run ranges of the loop until all of its elements are processed. A thread late to notice the end of a loop may take
+// part in the next one with the worker count of the earlier loop; it runs the ranges it pushes itself before leaving.
+static void run_worker(parallel_loop_t* loop, size_t index, size_t workers)
+{
+    parallel_deque_t* own = &parallel_deques[index];
+    uint64_t victim_seed = index * 0x9E3779B97F4A7C15u + 1;
+    while (atomic_load_explicit(&loop->remaining, memory_order_acquire) != 0)
+    {
+        size_t begin;
+        size_t end;
+        if (deque_pop(own, &begin, &end))
+        {
+            run_range(loop, own, begin, end);
+            continue;
+        }
+
+        bool stolen = false;
+        for (size_t attempt = 0; attempt < workers && !stolen; ++attempt)
+        {
+            victim_seed ^= victim_seed << 13;
+            victim_seed ^= victim_seed >> 7;
+            victim_seed ^= victim_seed << 17;
+            size_t victim = victim_seed % workers;
+            if (victim != index)
+                stolen = deque_steal(&parallel_deques[victim], &begin, &end);
+        }
+        if (stolen)
+            run_range(loop, own, begin, end);
+        else
+            sched_yield();
+    }
+}
+
+static void* run_pool_thread(void* index_)
+{
+    size_t index = (size_t)(uintptr_t)index_;
+    parallel_in_worker = true;
+    uint64_t seen_generation = 0;
+    while (true)
+    {
+        pthread_mutex_lock(&parallel_wake_lock);
+        while (parallel_generation == seen_generation)
+            pthread_cond_wait(&parallel_wake, &parallel_wake_lock);
+        seen_generation = parallel_generation;
+        size_t workers = parallel_current.workers;
+        pthread_mutex_unlock(&parallel_wake_lock);
+
+        if (index < workers)
+            run_worker(&parallel_current, index, workers);
+    }
+    return NULL;
+}
+
+static size_t default_parallel_threads(void)
+{
+    const char* configured = getenv("SHIRO_THREADS");
+    long count = configured != NULL ? strtol(configured, NULL, 10) : sysconf(_SC_NPROCESSORS_ONLN);
+    if (count < 1)
+        return 1;
+    return count > PARALLEL_MAX_WORKERS ? PARALLEL_MAX_WORKERS : (size_t)count;
+}
+
+// Number of threads running a parallel loop, the calling thread included: SHIRO_THREADS if set, or the number of
+// processors online
+size_t shiro_parallel_threads(void)
+{
+    pthread_mutex_lock(&parallel_lock);
+    if (parallel_threads == 0)
+        parallel_threads = default_parallel_threads();
+    size_t count = parallel_threads;
+    pthread_mutex_unlock(&parallel_lock);
+    return count;
+}
+
+// Change the number of threads of the following parallel loops; 0 goes back to the default. Threads already started
+// are kept.
+void shiro_parallel_set_threads(size_t count)
+{
+    pthread_mutex_lock(&parallel_lock);
+    parallel_threads = count == 0 ? default_parallel_threads() : count;
+    if (parallel_threads > PARALLEL_MAX_WORKERS)
+        parallel_threads = PARALLEL_MAX_WORKERS;
+    pthread_mutex_unlock(&parallel_lock);
+}
+
+// Call body(chunk, context) for chunks covering count elements of element_size bytes at data, each at most grain
+// elements long (a grain of 0 counts as 1), and return once all have returned. Chunks run on the worker threads in any
+// order. A parallel loop started from a loop body runs on the calling thread alone.
+void shiro_parallel_for(uint8_t* data, size_t count, size_t element_size, size_t grain, void* body, void* context)
+{
+    void (*body_fn)(parallel_chunk_t, void*) = (void (*)(parallel_chunk_t, void*))body;
+    if (grain == 0)
+        grain = 1;
+    if (count <= grain || parallel_in_worker)
+    {
+        for (size_t begin = 0; begin < count; begin += grain)
+        {
+            size_t len = count - begin < grain ? count - begin : grain;
+            body_fn((parallel_chunk_t){ .data = data + begin * element_size, .len = len }, context);
+        }
+        return;
+    }
+
+    pthread_mutex_lock(&parallel_lock);
+    if (parallel_threads == 0)
+        parallel_threads = default_parallel_threads();
+    size_t workers = parallel_threads;
+    for (; parallel_started + 1 < workers; ++parallel_started)
+    {
+        pthread_t thread;
+        if (pthread_create(&thread, NULL, run_pool_thread, (void*)(uintptr_t)(parallel_started + 1)) != 0)
+            break;
+        pthread_detach(thread);
+    }
+    if (workers > parallel_started + 1)
+        workers = parallel_started + 1;
+
+    pthread_mutex_lock(&parallel_wake_lock);
+    // Set field by field: threads late to leave the previous loop still read remaining
+    parallel_current.data = data;
+    parallel_current.element_size = element_size;
+    parallel_current.grain = grain;
+    parallel_current.body = body_fn;
+    parallel_current.context = context;
+    parallel_current.workers = workers;
+    atomic_store_explicit(&parallel_current.remaining, count, memory_order_relaxed);
+    deque_push(&parallel_deques[0], 0, count);
+    ++parallel_generation;
+    pthread_cond_broadcast(&parallel_wake);
+    pthread_mutex_unlock(&parallel_wake_lock);
+
+    parallel_in_worker = true;
+    run_worker(&parallel_current, 0, workers);
+    parallel_in_worker = false;
+    pthread_mutex_unlock(&parallel_lock);
+}
@@ -0,0 +1,40 @@
+; ModuleID = 'TestMultiple.CoreString'
+source_filename = "TestMultiple.CoreString"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+declare void @printI32(i32)
+
+; Function Attrs: nounwind readnone willreturn
+define i32 @StringLib.CoreString.get_length() #0 !dbg !4 {
+entry:
+  ret i32 42, !dbg !10
+}
+
+; Function Attrs: nounwind readnone willreturn
+define i1 @StringLib.CoreString.validate() #0 !dbg !11 {
+entry:
+  ret i1 true, !dbg !15
+}
+
+attributes #0 = { nounwind readnone willreturn }
+
+!llvm.dbg.cu = !{!0}
+!llvm.module.flags = !{!2, !3}
+
+!0 = distinct !DICompileUnit(language: DW_LANG_C, file: !1, producer: "ShiroC Compiler\00", isOptimized: false, runtimeVersion: 0, emissionKind: FullDebug, splitDebugInlining: false)
+!1 = !DIFile(filename: "CoreString", directory: ".")
+!2 = !{i32 2, !"Dwarf Version", i32 4}
+!3 = !{i32 2, !"Debug Info Version", i32 3}
+!4 = distinct !DISubprogram(name: "get_length", linkageName: "get_length", scope: !5, file: !5, line: 3, type: !6, scopeLine: 3, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !9)
+!5 = !DIFile(filename: "string.shiro", directory: "src/tests/st/dependencies/test2_multiple/../string-utils/src/core")
+!6 = !DISubroutineType(types: !7)
+!7 = !{!8}
+!8 = !DIBasicType(name: "i32", size: 32, encoding: DW_ATE_signed)
+!9 = !{}
+!10 = !DILocation(line: 4, column: 5, scope: !4)
+!11 = distinct !DISubprogram(name: "validate", linkageName: "validate", scope: !5, file: !5, line: 7, type: !12, scopeLine: 7, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !9)
+!12 = !DISubroutineType(types: !13)
+!13 = !{!14}
+!14 = !DIBasicType(name: "bool", size: 8, encoding: DW_ATE_boolean)
+!15 = !DILocation(line: 8, column: 5, scope: !11)
@@ -0,0 +1,539 @@
+; ModuleID = 'TestMultiple.FS'
+source_filename = "TestMultiple.FS"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+%Std.FS.MappedFile = type { ptr, i64 }
+%view = type { i64, ptr }
+%Std.FS.Reader = type { i32, i1 }
+
+declare void @printI32(i32)
+
+declare i32 @close(i32)
+
+; Function Attrs: nounwind
+define i1 @Std.FS.MappedFile.map(ptr nonnull dereferenceable(16) %0, ptr %1) #0 !dbg !4 {
+entry:
+  %addr = alloca ptr, align 8, !dbg !28
+  %mapped = alloca i1, align 1, !dbg !28
+  %size = alloca i64, align 8, !dbg !28
+  %fd = alloca i32, align 4, !dbg !28
+  %self.addr = alloca ptr, align 8, !dbg !28
+  store ptr %0, ptr %self.addr, align 8, !dbg !28
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !18, metadata !DIExpression()), !dbg !28
+  %path.addr = alloca ptr, align 8, !dbg !28
+  store ptr %1, ptr %path.addr, align 8, !dbg !28
+  call void @llvm.dbg.declare(metadata ptr %path.addr, metadata !20, metadata !DIExpression()), !dbg !29
+  %2 = load ptr, ptr %self.addr, align 8, !dbg !30
+  call void @Std.FS.MappedFile.unmap(ptr %2), !dbg !30
+  call void @llvm.dbg.declare(metadata ptr %fd, metadata !21, metadata !DIExpression()), !dbg !31
+  %path = load ptr, ptr %path.addr, align 8, !dbg !32
+  %call = call i32 @open(ptr %path, i32 0), !dbg !32
+  store i32 %call, ptr %fd, align 4, !dbg !32
+  %fd1 = load i32, ptr %fd, align 4, !dbg !33
+  %lt = icmp slt i32 %fd1, 0, !dbg !33
+  br i1 %lt, label %if.then, label %if.else, !dbg !33
+
+if.then:                                          ; preds = %entry
+  ret i1 false, !dbg !34
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !34
+
+if.join:                                          ; preds = %if.else
+  call void @llvm.dbg.declare(metadata ptr %size, metadata !23, metadata !DIExpression()), !dbg !35
+  %fd2 = load i32, ptr %fd, align 4, !dbg !36
+  %call3 = call i64 @lseek(i32 %fd2, i64 0, i32 2), !dbg !36
+  store i64 %call3, ptr %size, align 8, !dbg !36
+  %size4 = load i64, ptr %size, align 8, !dbg !37
+  %lt5 = icmp slt i64 %size4, 0, !dbg !37
+  br i1 %lt5, label %if.then6, label %if.else7, !dbg !37
+
+if.then6:                                         ; preds = %if.join
+  %fd9 = load i32, ptr %fd, align 4, !dbg !38
+  %call10 = call i32 @close(i32 %fd9), !dbg !38
+  ret i1 false, !dbg !39
+
+if.else7:                                         ; preds = %if.join
+  br label %if.join8, !dbg !39
+
+if.join8:                                         ; preds = %if.else7
+  call void @llvm.dbg.declare(metadata ptr %mapped, metadata !25, metadata !DIExpression()), !dbg !40
+  store i1 true, ptr %mapped, align 1, !dbg !40
+  %size11 = load i64, ptr %size, align 8, !dbg !41
+  %gt = icmp sgt i64 %size11, 0, !dbg !41
+  br i1 %gt, label %if.then12, label %if.else13, !dbg !41
+
+if.then12:                                        ; preds = %if.join8
+  call void @llvm.dbg.declare(metadata ptr %addr, metadata !26, metadata !DIExpression()), !dbg !42
+  %size15 = load i64, ptr %size, align 8, !dbg !43
+  %fd16 = load i32, ptr %fd, align 4, !dbg !43
+  %call17 = call ptr @mmap(ptr null, i64 %size15, i32 1, i32 2, i32 %fd16, i64 0), !dbg !43
+  store ptr %call17, ptr %addr, align 8, !dbg !43
+  %addr18 = load ptr, ptr %addr, align 8, !dbg !44
+  %ptr2int = ptrtoint ptr %addr18 to i64, !dbg !44
+  %eq = icmp eq i64 %ptr2int, -1, !dbg !44
+  br i1 %eq, label %if.then19, label %if.else20, !dbg !44
+
+if.else13:                                        ; preds = %if.join8
+  br label %if.join14, !dbg !44
+
+if.join14:                                        ; preds = %if.else13, %if.join21
+  %fd25 = load i32, ptr %fd, align 4, !dbg !45
+  %call26 = call i32 @close(i32 %fd25), !dbg !45
+  %mapped27 = load i1, ptr %mapped, align 1, !dbg !46
+  ret i1 %mapped27, !dbg !46
+
+if.then19:                                        ; preds = %if.then12
+  store i1 false, ptr %mapped, align 1, !dbg !44
+  br label %if.join21, !dbg !44
+
+if.else20:                                        ; preds = %if.then12
+  %addr22 = load ptr, ptr %addr, align 8, !dbg !44
+  %3 = load ptr, ptr %self.addr, align 8, !dbg !44
+  %Std.FS.MappedFile = getelementptr inbounds %Std.FS.MappedFile, ptr %3, i32 0, i32 0, !dbg !44
+  store ptr %addr22, ptr %Std.FS.MappedFile, align 8, !dbg !44
+  %size23 = load i64, ptr %size, align 8, !dbg !44
+  %4 = load ptr, ptr %self.addr, align 8, !dbg !44
+  %Std.FS.MappedFile24 = getelementptr inbounds %Std.FS.MappedFile, ptr %4, i32 0, i32 1, !dbg !44
+  store i64 %size23, ptr %Std.FS.MappedFile24, align 8, !dbg !44
+  br label %if.join21, !dbg !44
+
+if.join21:                                        ; preds = %if.else20, %if.then19
+  br label %if.join14, !dbg !44
+}
+
+; Function Attrs: nounwind
+define void @Std.FS.MappedFile.advise(ptr nonnull dereferenceable(16) %0, i32 %1) #0 !dbg !47 {
+entry:
+  %self.addr = alloca ptr, align 8, !dbg !53
+  store ptr %0, ptr %self.addr, align 8, !dbg !53
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !51, metadata !DIExpression()), !dbg !53
+  %advice.addr = alloca i32, align 4, !dbg !53
+  store i32 %1, ptr %advice.addr, align 4, !dbg !53
+  call void @llvm.dbg.declare(metadata ptr %advice.addr, metadata !52, metadata !DIExpression()), !dbg !54
+  %2 = load ptr, ptr %self.addr, align 8, !dbg !55
+  %Std.FS.MappedFile = getelementptr inbounds %Std.FS.MappedFile, ptr %2, i32 0, i32 0, !dbg !55
+  %member_val = load ptr, ptr %Std.FS.MappedFile, align 8, !dbg !55
+  %ne = icmp ne ptr %member_val, null, !dbg !55
+  br i1 %ne, label %if.then, label %if.else, !dbg !55
+
+if.then:                                          ; preds = %entry
+  %3 = load ptr, ptr %self.addr, align 8, !dbg !56
+  %Std.FS.MappedFile1 = getelementptr inbounds %Std.FS.MappedFile, ptr %3, i32 0, i32 0, !dbg !56
+  %member_val2 = load ptr, ptr %Std.FS.MappedFile1, align 8, !dbg !56
+  %4 = load ptr, ptr %self.addr, align 8, !dbg !56
+  %Std.FS.MappedFile3 = getelementptr inbounds %Std.FS.MappedFile, ptr %4, i32 0, i32 1, !dbg !56
+  %member_val4 = load i64, ptr %Std.FS.MappedFile3, align 8, !dbg !56
+  %advice = load i32, ptr %advice.addr, align 4, !dbg !56
+  %call = call i32 @madvise(ptr %member_val2, i64 %member_val4, i32 %advice), !dbg !56
+  br label %if.join, !dbg !56
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !56
+
+if.join:                                          ; preds = %if.else, %if.then
+  ret void, !dbg !56
+}
+
+; Function Attrs: nounwind readonly willreturn
+define %view @Std.FS.MappedFile.bytes(ptr nonnull dereferenceable(16) %0) #1 !dbg !57 {
+entry:
+  %self.addr = alloca ptr, align 8, !dbg !66
+  store ptr %0, ptr %self.addr, align 8, !dbg !66
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !65, metadata !DIExpression()), !dbg !66
+  %1 = load ptr, ptr %self.addr, align 8, !dbg !67
+  %Std.FS.MappedFile = getelementptr inbounds %Std.FS.MappedFile, ptr %1, i32 0, i32 0, !dbg !67
+  %member_val = load ptr, ptr %Std.FS.MappedFile, align 8, !dbg !67
+  %2 = load ptr, ptr %self.addr, align 8, !dbg !67
+  %Std.FS.MappedFile1 = getelementptr inbounds %Std.FS.MappedFile, ptr %2, i32 0, i32 1, !dbg !67
+  %member_val2 = load i64, ptr %Std.FS.MappedFile1, align 8, !dbg !67
+  %view_size = sub i64 %member_val2, 0, !dbg !67
+  %elem_ptr = getelementptr i8, ptr %member_val, i64 0, !dbg !67
+  %view_with_len = insertvalue %view undef, i64 %view_size, 0, !dbg !67
+  %view_with_data = insertvalue %view %view_with_len, ptr %elem_ptr, 1, !dbg !67
+  ret %view %view_with_data, !dbg !67
+}
+
+; Function Attrs: nounwind
+define void @Std.FS.MappedFile.unmap(ptr nonnull dereferenceable(16) %0) #0 !dbg !68 {
+entry:
+  %self.addr = alloca ptr, align 8, !dbg !73
+  store ptr %0, ptr %self.addr, align 8, !dbg !73
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !72, metadata !DIExpression()), !dbg !73
+  %1 = load ptr, ptr %self.addr, align 8, !dbg !74
+  %Std.FS.MappedFile = getelementptr inbounds %Std.FS.MappedFile, ptr %1, i32 0, i32 0, !dbg !74
+  %member_val = load ptr, ptr %Std.FS.MappedFile, align 8, !dbg !74
+  %ne = icmp ne ptr %member_val, null, !dbg !74
+  br i1 %ne, label %if.then, label %if.else, !dbg !74
+
+if.then:                                          ; preds = %entry
+  %2 = load ptr, ptr %self.addr, align 8, !dbg !75
+  %Std.FS.MappedFile1 = getelementptr inbounds %Std.FS.MappedFile, ptr %2, i32 0, i32 0, !dbg !75
+  %member_val2 = load ptr, ptr %Std.FS.MappedFile1, align 8, !dbg !75
+  %3 = load ptr, ptr %self.addr, align 8, !dbg !75
+  %Std.FS.MappedFile3 = getelementptr inbounds %Std.FS.MappedFile, ptr %3, i32 0, i32 1, !dbg !75
+  %member_val4 = load i64, ptr %Std.FS.MappedFile3, align 8, !dbg !75
+  %call = call i32 @munmap(ptr %member_val2, i64 %member_val4), !dbg !75
+  %4 = load ptr, ptr %self.addr, align 8, !dbg !75
+  %Std.FS.MappedFile5 = getelementptr inbounds %Std.FS.MappedFile, ptr %4, i32 0, i32 0, !dbg !75
+  store ptr null, ptr %Std.FS.MappedFile5, align 8, !dbg !75
+  %5 = load ptr, ptr %self.addr, align 8, !dbg !75
+  %Std.FS.MappedFile6 = getelementptr inbounds %Std.FS.MappedFile, ptr %5, i32 0, i32 1, !dbg !75
+  store i64 0, ptr %Std.FS.MappedFile6, align 8, !dbg !75
+  br label %if.join, !dbg !75
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !75
+
+if.join:                                          ; preds = %if.else, %if.then
+  ret void, !dbg !75
+}
+
+; Function Attrs: nounwind
+define void @Std.FS.MappedFile.advise_sequential(ptr nonnull dereferenceable(16) %0) #0 !dbg !76 {
+entry:
+  %self.addr = alloca ptr, align 8, !dbg !79
+  store ptr %0, ptr %self.addr, align 8, !dbg !79
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !78, metadata !DIExpression()), !dbg !79
+  %1 = load ptr, ptr %self.addr, align 8, !dbg !80
+  call void @Std.FS.MappedFile.advise(ptr %1, i32 2), !dbg !80
+  ret void, !dbg !80
+}
+
+; Function Attrs: nounwind
+define void @Std.FS.MappedFile.advise_random(ptr nonnull dereferenceable(16) %0) #0 !dbg !81 {
+entry:
+  %self.addr = alloca ptr, align 8, !dbg !84
+  store ptr %0, ptr %self.addr, align 8, !dbg !84
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !83, metadata !DIExpression()), !dbg !84
+  %1 = load ptr, ptr %self.addr, align 8, !dbg !85
+  call void @Std.FS.MappedFile.advise(ptr %1, i32 1), !dbg !85
+  ret void, !dbg !85
+}
+
+; Function Attrs: nounwind readonly willreturn
+define i64 @Std.FS.MappedFile.len(ptr nonnull dereferenceable(16) %0) #1 !dbg !86 {
+entry:
+  %self.addr = alloca ptr, align 8, !dbg !91
+  store ptr %0, ptr %self.addr, align 8, !dbg !91
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !90, metadata !DIExpression()), !dbg !91
+  %1 = load ptr, ptr %self.addr, align 8, !dbg !92
+  %Std.FS.MappedFile = getelementptr inbounds %Std.FS.MappedFile, ptr %1, i32 0, i32 1, !dbg !92
+  %member_val = load i64, ptr %Std.FS.MappedFile, align 8, !dbg !92
+  ret i64 %member_val, !dbg !92
+}
+
+; Function Attrs: nounwind
+define void @"Std.FS.MappedFile.@destruct"(ptr nonnull dereferenceable(16) %0) #0 !dbg !93 {
+entry:
+  %self.addr = alloca ptr, align 8, !dbg !96
+  store ptr %0, ptr %self.addr, align 8, !dbg !96
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !95, metadata !DIExpression()), !dbg !96
+  %1 = load ptr, ptr %self.addr, align 8, !dbg !97
+  call void @Std.FS.MappedFile.unmap(ptr %1), !dbg !97
+  ret void, !dbg !97
+}
+
+; Function Attrs: nounwind
+define i64 @Std.FS.Reader.read_into(ptr nonnull dereferenceable(8) %0, %view %1) #0 !dbg !98 {
+entry:
+  %count = alloca i64, align 8, !dbg !116
+  %self.addr = alloca ptr, align 8, !dbg !116
+  store ptr %0, ptr %self.addr, align 8, !dbg !116
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !112, metadata !DIExpression()), !dbg !116
+  %buffer.addr = alloca %view, align 8, !dbg !116
+  store %view %1, ptr %buffer.addr, align 8, !dbg !116
+  call void @llvm.dbg.declare(metadata ptr %buffer.addr, metadata !114, metadata !DIExpression()), !dbg !117
+  call void @llvm.dbg.declare(metadata ptr %count, metadata !115, metadata !DIExpression()), !dbg !118
+  %view_len_ptr = getelementptr inbounds %view, ptr %buffer.addr, i32 0, i32 0, !dbg !119
+  %view_len = load i64, ptr %view_len_ptr, align 8, !dbg !119
+  store i64 %view_len, ptr %count, align 8, !dbg !119
+  %count1 = load i64, ptr %count, align 8, !dbg !120
+  %eq = icmp eq i64 %count1, 0, !dbg !120
+  br i1 %eq, label %if.then, label %if.else, !dbg !120
+
+if.then:                                          ; preds = %entry
+  ret i64 0, !dbg !121
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !121
+
+if.join:                                          ; preds = %if.else
+  %2 = load ptr, ptr %self.addr, align 8, !dbg !122
+  %Std.FS.Reader = getelementptr inbounds %Std.FS.Reader, ptr %2, i32 0, i32 0, !dbg !122
+  %member_val = load i32, ptr %Std.FS.Reader, align 4, !dbg !122
+  %length_ptr = getelementptr inbounds %view, ptr %buffer.addr, i32 0, i32 0, !dbg !123
+  %view_length = load i64, ptr %length_ptr, align 8, !dbg !123
+  %in_bounds = icmp ult i64 0, %view_length, !dbg !123
+  br i1 %in_bounds, label %subscript.safe, label %bounds_check.trap, !dbg !123, !prof !124
+
+subscript.safe:                                   ; preds = %if.join
+  %ptr_to_views_array_field = getelementptr inbounds %view, ptr %buffer.addr, i32 0, i32 1, !dbg !123
+  %array_ptr = load ptr, ptr %ptr_to_views_array_field, align 8, !dbg !123
+  %elem_ptr = getelementptr inbounds i8, ptr %array_ptr, i64 0, !dbg !123
+  %count2 = load i64, ptr %count, align 8, !dbg !123
+  %call = call i64 @shiro_read(i32 %member_val, ptr %elem_ptr, i64 %count2), !dbg !123
+  ret i64 %call, !dbg !123
+
+bounds_check.trap:                                ; preds = %if.join
+  call void @llvm.ubsantrap(i8 5) #4, !dbg !123
+  unreachable, !dbg !123
+}
+
+; Function Attrs: nounwind
+define void @Std.FS.Reader.close_file(ptr nonnull dereferenceable(8) %0) #0 !dbg !125 {
+entry:
+  %self.addr = alloca ptr, align 8, !dbg !130
+  store ptr %0, ptr %self.addr, align 8, !dbg !130
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !129, metadata !DIExpression()), !dbg !130
+  %1 = load ptr, ptr %self.addr, align 8, !dbg !131
+  %Std.FS.Reader = getelementptr inbounds %Std.FS.Reader, ptr %1, i32 0, i32 1, !dbg !131
+  %member_val = load i1, ptr %Std.FS.Reader, align 1, !dbg !131
+  br i1 %member_val, label %if.then, label %if.else, !dbg !131
+
+if.then:                                          ; preds = %entry
+  %2 = load ptr, ptr %self.addr, align 8, !dbg !132
+  %Std.FS.Reader1 = getelementptr inbounds %Std.FS.Reader, ptr %2, i32 0, i32 0, !dbg !132
+  %member_val2 = load i32, ptr %Std.FS.Reader1, align 4, !dbg !132
+  %call = call i32 @close(i32 %member_val2), !dbg !132
+  %3 = load ptr, ptr %self.addr, align 8, !dbg !132
+  %Std.FS.Reader3 = getelementptr inbounds %Std.FS.Reader, ptr %3, i32 0, i32 1, !dbg !132
+  store i1 false, ptr %Std.FS.Reader3, align 1, !dbg !132
+  br label %if.join, !dbg !132
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !132
+
+if.join:                                          ; preds = %if.else, %if.then
+  ret void, !dbg !132
+}
+
+; Function Attrs: nounwind
+define i1 @Std.FS.Reader.open_file(ptr nonnull dereferenceable(8) %0, ptr %1) #0 !dbg !133 {
+entry:
+  %opened = alloca i32, align 4, !dbg !140
+  %self.addr = alloca ptr, align 8, !dbg !140
+  store ptr %0, ptr %self.addr, align 8, !dbg !140
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !137, metadata !DIExpression()), !dbg !140
+  %path.addr = alloca ptr, align 8, !dbg !140
+  store ptr %1, ptr %path.addr, align 8, !dbg !140
+  call void @llvm.dbg.declare(metadata ptr %path.addr, metadata !138, metadata !DIExpression()), !dbg !141
+  %2 = load ptr, ptr %self.addr, align 8, !dbg !142
+  call void @Std.FS.Reader.close_file(ptr %2), !dbg !142
+  call void @llvm.dbg.declare(metadata ptr %opened, metadata !139, metadata !DIExpression()), !dbg !143
+  %path = load ptr, ptr %path.addr, align 8, !dbg !144
+  %call = call i32 @open(ptr %path, i32 0), !dbg !144
+  store i32 %call, ptr %opened, align 4, !dbg !144
+  %opened1 = load i32, ptr %opened, align 4, !dbg !145
+  %lt = icmp slt i32 %opened1, 0, !dbg !145
+  br i1 %lt, label %if.then, label %if.else, !dbg !145
+
+if.then:                                          ; preds = %entry
+  ret i1 false, !dbg !146
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !146
+
+if.join:                                          ; preds = %if.else
+  %opened2 = load i32, ptr %opened, align 4, !dbg !146
+  %3 = load ptr, ptr %self.addr, align 8, !dbg !146
+  %Std.FS.Reader = getelementptr inbounds %Std.FS.Reader, ptr %3, i32 0, i32 0, !dbg !146
+  store i32 %opened2, ptr %Std.FS.Reader, align 4, !dbg !146
+  %4 = load ptr, ptr %self.addr, align 8, !dbg !146
+  %Std.FS.Reader3 = getelementptr inbounds %Std.FS.Reader, ptr %4, i32 0, i32 1, !dbg !146
+  store i1 true, ptr %Std.FS.Reader3, align 1, !dbg !146
+  ret i1 true, !dbg !147
+}
+
+; Function Attrs: nounwind
+define void @"Std.FS.Reader.@destruct"(ptr nonnull dereferenceable(8) %0) #0 !dbg !148 {
+entry:
+  %self.addr = alloca ptr, align 8, !dbg !151
+  store ptr %0, ptr %self.addr, align 8, !dbg !151
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !150, metadata !DIExpression()), !dbg !151
+  %1 = load ptr, ptr %self.addr, align 8, !dbg !152
+  call void @Std.FS.Reader.close_file(ptr %1), !dbg !152
+  ret void, !dbg !152
+}
+
+declare i64 @shiro_read(i32, ptr, i64)
+
+declare i64 @lseek(i32, i64, i32)
+
+declare i32 @open(ptr, i32)
+
+declare i32 @munmap(ptr, i64)
+
+declare i32 @madvise(ptr, i64, i32)
+
+declare ptr @mmap(ptr, i64, i32, i32, i32, i64)
+
+; Function Attrs: nofree nosync nounwind readnone speculatable willreturn
+declare void @llvm.dbg.declare(metadata, metadata, metadata) #2
+
+; Function Attrs: cold noreturn nounwind
+declare void @llvm.ubsantrap(i8 immarg) #3
+
+attributes #0 = { nounwind }
+attributes #1 = { nounwind readonly willreturn }
+attributes #2 = { nofree nosync nounwind readnone speculatable willreturn }
+attributes #3 = { cold noreturn nounwind }
+attributes #4 = { cold }
+
+!llvm.dbg.cu = !{!0}
+!llvm.module.flags = !{!2, !3}
+
+!0 = distinct !DICompileUnit(language: DW_LANG_C, file: !1, producer: "ShiroC Compiler\00", isOptimized: false, runtimeVersion: 0, emissionKind: FullDebug, splitDebugInlining: false)
+!1 = !DIFile(filename: "FS", directory: ".")
+!2 = !{i32 2, !"Dwarf Version", i32 4}
+!3 = !{i32 2, !"Debug Info Version", i32 3}
+!4 = distinct !DISubprogram(name: "MappedFile.map", linkageName: "MappedFile.map", scope: !5, file: !5, line: 17, type: !6, scopeLine: 17, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !17)
+!5 = !DIFile(filename: "mapped_file.shiro", directory: "/tmp/asan/src/std/FS")
+!6 = !DISubroutineType(types: !7)
+!7 = !{!8, !9, !13}
+!8 = !DIBasicType(name: "bool", size: 8, encoding: DW_ATE_boolean)
+!9 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !10, size: 64, flags: DIFlagArtificial | DIFlagObjectPointer, dwarfAddressSpace: 0)
+!10 = !DICompositeType(tag: DW_TAG_structure_type, name: "MappedFile", file: !5, line: 11, size: 128, align: 64, elements: !11, identifier: "Std.FS.MappedFile")
+!11 = !{!12, !15}
+!12 = !DIDerivedType(tag: DW_TAG_member, name: "data", scope: !10, file: !5, baseType: !13, size: 64, align: 64)
+!13 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !14, size: 64, dwarfAddressSpace: 0)
+!14 = !DIBasicType(name: "u8", size: 8, encoding: DW_ATE_unsigned_char)
+!15 = !DIDerivedType(tag: DW_TAG_member, name: "length", scope: !10, file: !5, baseType: !16, size: 64, align: 64, offset: 64)
+!16 = !DIBasicType(name: "usize", size: 64, encoding: DW_ATE_unsigned_char)
+!17 = !{!18, !20, !21, !23, !25, !26}
+!18 = !DILocalVariable(name: "self", arg: 1, scope: !4, file: !5, line: 17, type: !19)
+!19 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !10, size: 64, dwarfAddressSpace: 0)
+!20 = !DILocalVariable(name: "path", arg: 2, scope: !4, file: !5, line: 17, type: !13)
+!21 = !DILocalVariable(name: "fd", scope: !4, file: !5, line: 20, type: !22)
+!22 = !DIBasicType(name: "i32", size: 32, encoding: DW_ATE_signed)
+!23 = !DILocalVariable(name: "size", scope: !4, file: !5, line: 24, type: !24)
+!24 = !DIBasicType(name: "i64", size: 64, encoding: DW_ATE_signed)
+!25 = !DILocalVariable(name: "mapped", scope: !4, file: !5, line: 31, type: !8)
+!26 = !DILocalVariable(name: "addr", scope: !4, file: !5, line: 33, type: !27)
+!27 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: null, size: 64, dwarfAddressSpace: 0)
+!28 = !DILocation(line: 17, column: 5, scope: !4)
+!29 = !DILocation(line: 17, column: 12, scope: !4)
+!30 = !DILocation(line: 18, column: 9, scope: !4)
+!31 = !DILocation(line: 20, column: 9, scope: !4)
+!32 = !DILocation(line: 20, column: 18, scope: !4)
+!33 = !DILocation(line: 21, column: 13, scope: !4)
+!34 = !DILocation(line: 22, column: 13, scope: !4)
+!35 = !DILocation(line: 24, column: 9, scope: !4)
+!36 = !DILocation(line: 24, column: 20, scope: !4)
+!37 = !DILocation(line: 25, column: 13, scope: !4)
+!38 = !DILocation(line: 26, column: 13, scope: !4)
+!39 = !DILocation(line: 27, column: 13, scope: !4)
+!40 = !DILocation(line: 31, column: 9, scope: !4)
+!41 = !DILocation(line: 32, column: 13, scope: !4)
+!42 = !DILocation(line: 33, column: 13, scope: !4)
+!43 = !DILocation(line: 33, column: 24, scope: !4)
+!44 = !DILocation(line: 34, column: 17, scope: !4)
+!45 = !DILocation(line: 41, column: 9, scope: !4)
+!46 = !DILocation(line: 42, column: 9, scope: !4)
+!47 = distinct !DISubprogram(name: "MappedFile.advise", linkageName: "MappedFile.advise", scope: !5, file: !5, line: 76, type: !48, scopeLine: 76, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !50)
+!48 = !DISubroutineType(types: !49)
+!49 = !{null, !9, !22}
+!50 = !{!51, !52}
+!51 = !DILocalVariable(name: "self", arg: 1, scope: !47, file: !5, line: 76, type: !19)
+!52 = !DILocalVariable(name: "advice", arg: 2, scope: !47, file: !5, line: 76, type: !22)
+!53 = !DILocation(line: 76, column: 5, scope: !47)
+!54 = !DILocation(line: 76, column: 15, scope: !47)
+!55 = !DILocation(line: 77, column: 13, scope: !47)
+!56 = !DILocation(line: 78, column: 13, scope: !47)
+!57 = distinct !DISubprogram(name: "MappedFile.bytes", linkageName: "MappedFile.bytes", scope: !5, file: !5, line: 45, type: !58, scopeLine: 45, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !64)
+!58 = !DISubroutineType(types: !59)
+!59 = !{!60, !9}
+!60 = !DICompositeType(tag: DW_TAG_structure_type, name: "view[u8]", file: !5, size: 128, align: 64, elements: !61)
+!61 = !{!62, !63}
+!62 = !DIDerivedType(tag: DW_TAG_member, name: "len", file: !5, baseType: !16, size: 64, align: 64)
+!63 = !DIDerivedType(tag: DW_TAG_member, name: "data", file: !5, baseType: !13, size: 64, align: 64, offset: 64)
+!64 = !{!65}
+!65 = !DILocalVariable(name: "self", arg: 1, scope: !57, file: !5, line: 45, type: !19)
+!66 = !DILocation(line: 45, column: 5, scope: !57)
+!67 = !DILocation(line: 46, column: 9, scope: !57)
+!68 = distinct !DISubprogram(name: "MappedFile.unmap", linkageName: "MappedFile.unmap", scope: !5, file: !5, line: 63, type: !69, scopeLine: 63, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !71)
+!69 = !DISubroutineType(types: !70)
+!70 = !{null, !9}
+!71 = !{!72}
+!72 = !DILocalVariable(name: "self", arg: 1, scope: !68, file: !5, line: 63, type: !19)
+!73 = !DILocation(line: 63, column: 5, scope: !68)
+!74 = !DILocation(line: 64, column: 13, scope: !68)
+!75 = !DILocation(line: 65, column: 13, scope: !68)
+!76 = distinct !DISubprogram(name: "MappedFile.advise_sequential", linkageName: "MappedFile.advise_sequential", scope: !5, file: !5, line: 54, type: !69, scopeLine: 54, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !77)
+!77 = !{!78}
+!78 = !DILocalVariable(name: "self", arg: 1, scope: !76, file: !5, line: 54, type: !19)
+!79 = !DILocation(line: 54, column: 5, scope: !76)
+!80 = !DILocation(line: 55, column: 9, scope: !76)
+!81 = distinct !DISubprogram(name: "MappedFile.advise_random", linkageName: "MappedFile.advise_random", scope: !5, file: !5, line: 59, type: !69, scopeLine: 59, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !82)
+!82 = !{!83}
+!83 = !DILocalVariable(name: "self", arg: 1, scope: !81, file: !5, line: 59, type: !19)
+!84 = !DILocation(line: 59, column: 5, scope: !81)
+!85 = !DILocation(line: 60, column: 9, scope: !81)
+!86 = distinct !DISubprogram(name: "MappedFile.len", linkageName: "MappedFile.len", scope: !5, file: !5, line: 49, type: !87, scopeLine: 49, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !89)
+!87 = !DISubroutineType(types: !88)
+!88 = !{!16, !9}
+!89 = !{!90}
+!90 = !DILocalVariable(name: "self", arg: 1, scope: !86, file: !5, line: 49, type: !19)
+!91 = !DILocation(line: 49, column: 5, scope: !86)
+!92 = !DILocation(line: 50, column: 9, scope: !86)
+!93 = distinct !DISubprogram(name: "MappedFile.destruct", linkageName: "MappedFile.destruct", scope: !5, file: !5, line: 71, type: !69, scopeLine: 71, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !94)
+!94 = !{!95}
+!95 = !DILocalVariable(name: "self", arg: 1, scope: !93, file: !5, line: 71, type: !19)
+!96 = !DILocation(line: 71, column: 5, scope: !93)
+!97 = !DILocation(line: 72, column: 9, scope: !93)
+!98 = distinct !DISubprogram(name: "Reader.read_into", linkageName: "Reader.read_into", scope: !99, file: !99, line: 24, type: !100, scopeLine: 24, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !111)
+!99 = !DIFile(filename: "reader.shiro", directory: "/tmp/asan/src/std/FS")
+!100 = !DISubroutineType(types: !101)
+!101 = !{!24, !102, !107}
+!102 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !103, size: 64, flags: DIFlagArtificial | DIFlagObjectPointer, dwarfAddressSpace: 0)
+!103 = !DICompositeType(tag: DW_TAG_structure_type, name: "Reader", file: !99, line: 6, size: 64, align: 32, elements: !104, identifier: "Std.FS.Reader")
+!104 = !{!105, !106}
+!105 = !DIDerivedType(tag: DW_TAG_member, name: "fd", scope: !103, file: !99, baseType: !22, size: 32, align: 32)
+!106 = !DIDerivedType(tag: DW_TAG_member, name: "owned", scope: !103, file: !99, baseType: !8, size: 1, align: 8, offset: 32)
+!107 = !DICompositeType(tag: DW_TAG_structure_type, name: "view[u8]", file: !99, size: 128, align: 64, elements: !108)
+!108 = !{!109, !110}
+!109 = !DIDerivedType(tag: DW_TAG_member, name: "len", file: !99, baseType: !16, size: 64, align: 64)
+!110 = !DIDerivedType(tag: DW_TAG_member, name: "data", file: !99, baseType: !13, size: 64, align: 64, offset: 64)
+!111 = !{!112, !114, !115}
+!112 = !DILocalVariable(name: "self", arg: 1, scope: !98, file: !99, line: 24, type: !113)
+!113 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !103, size: 64, dwarfAddressSpace: 0)
+!114 = !DILocalVariable(name: "buffer", arg: 2, scope: !98, file: !99, line: 24, type: !107)
+!115 = !DILocalVariable(name: "count", scope: !98, file: !99, line: 25, type: !16)
+!116 = !DILocation(line: 24, column: 5, scope: !98)
+!117 = !DILocation(line: 24, column: 18, scope: !98)
+!118 = !DILocation(line: 25, column: 9, scope: !98)
+!119 = !DILocation(line: 0, scope: !98)
+!120 = !DILocation(line: 26, column: 13, scope: !98)
+!121 = !DILocation(line: 27, column: 13, scope: !98)
+!122 = !DILocation(line: 29, column: 16, scope: !98)
+!123 = !DILocation(line: 29, column: 37, scope: !98)
+!124 = !{!"branch_weights", i32 1048575, i32 1}
+!125 = distinct !DISubprogram(name: "Reader.close_file", linkageName: "Reader.close_file", scope: !99, file: !99, line: 32, type: !126, scopeLine: 32, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !128)
+!126 = !DISubroutineType(types: !127)
+!127 = !{null, !102}
+!128 = !{!129}
+!129 = !DILocalVariable(name: "self", arg: 1, scope: !125, file: !99, line: 32, type: !113)
+!130 = !DILocation(line: 32, column: 5, scope: !125)
+!131 = !DILocation(line: 33, column: 9, scope: !125)
+!132 = !DILocation(line: 34, column: 13, scope: !125)
+!133 = distinct !DISubprogram(name: "Reader.open_file", linkageName: "Reader.open_file", scope: !99, file: !99, line: 11, type: !134, scopeLine: 11, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !136)
+!134 = !DISubroutineType(types: !135)
+!135 = !{!8, !102, !13}
+!136 = !{!137, !138, !139}
+!137 = !DILocalVariable(name: "self", arg: 1, scope: !133, file: !99, line: 11, type: !113)
+!138 = !DILocalVariable(name: "path", arg: 2, scope: !133, file: !99, line: 11, type: !13)
+!139 = !DILocalVariable(name: "opened", scope: !133, file: !99, line: 13, type: !22)
+!140 = !DILocation(line: 11, column: 5, scope: !133)
+!141 = !DILocation(line: 11, column: 18, scope: !133)
+!142 = !DILocation(line: 12, column: 9, scope: !133)
+!143 = !DILocation(line: 13, column: 9, scope: !133)
+!144 = !DILocation(line: 13, column: 22, scope: !133)
+!145 = !DILocation(line: 14, column: 13, scope: !133)
+!146 = !DILocation(line: 15, column: 13, scope: !133)
+!147 = !DILocation(line: 19, column: 9, scope: !133)
+!148 = distinct !DISubprogram(name: "Reader.destruct", linkageName: "Reader.destruct", scope: !99, file: !99, line: 39, type: !126, scopeLine: 39, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !149)
+!149 = !{!150}
+!150 = !DILocalVariable(name: "self", arg: 1, scope: !148, file: !99, line: 39, type: !113)
+!151 = !DILocation(line: 39, column: 5, scope: !148)
+!152 = !DILocation(line: 40, column: 9, scope: !148)
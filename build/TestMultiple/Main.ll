@@ -0,0 +1,129 @@
+; ModuleID = 'TestMultiple.Main'
+source_filename = "TestMultiple.Main"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+declare void @printI32(i32)
+
+; Function Attrs: nounwind
+declare i32 @MathLib.CoreMath.subtract(i32, i32) #0
+
+; Function Attrs: nounwind
+declare i32 @MathLib.CoreMath.add(i32, i32) #0
+
+; Function Attrs: nounwind
+declare i32 @StringLib.CoreString.get_length() #0
+
+; Function Attrs: nounwind
+declare i32 @MathLib.CoreMath.multiply(i32, i32) #0
+
+; Function Attrs: nounwind
+define i32 @main() #0 !dbg !4 {
+entry:
+  %math_multiply = alloca i32, align 4
+  %is_valid = alloca i1, align 1
+  %string_len = alloca i32, align 4
+  %math_result = alloca i32, align 4
+  call void @llvm.dbg.declare(metadata ptr %math_result, metadata !10, metadata !DIExpression()), !dbg !15
+  %call = call i32 @MathLib.CoreMath.add(i32 10, i32 5), !dbg !16
+  store i32 %call, ptr %math_result, align 4, !dbg !16
+  %math_result1 = load i32, ptr %math_result, align 4, !dbg !17
+  %ne = icmp ne i32 %math_result1, 15, !dbg !17
+  br i1 %ne, label %if.then, label %if.else, !dbg !17
+
+if.then:                                          ; preds = %entry
+  ret i32 1, !dbg !18
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !18
+
+if.join:                                          ; preds = %if.else
+  call void @llvm.dbg.declare(metadata ptr %string_len, metadata !11, metadata !DIExpression()), !dbg !19
+  %call2 = call i32 @StringLib.CoreString.get_length(), !dbg !20
+  store i32 %call2, ptr %string_len, align 4, !dbg !20
+  %string_len3 = load i32, ptr %string_len, align 4, !dbg !21
+  %ne4 = icmp ne i32 %string_len3, 42, !dbg !21
+  br i1 %ne4, label %if.then5, label %if.else6, !dbg !21
+
+if.then5:                                         ; preds = %if.join
+  ret i32 2, !dbg !22
+
+if.else6:                                         ; preds = %if.join
+  br label %if.join7, !dbg !22
+
+if.join7:                                         ; preds = %if.else6
+  call void @llvm.dbg.declare(metadata ptr %is_valid, metadata !12, metadata !DIExpression()), !dbg !23
+  %call8 = call i1 @StringLib.CoreString.validate(), !dbg !24
+  store i1 %call8, ptr %is_valid, align 1, !dbg !24
+  %is_valid9 = load i1, ptr %is_valid, align 1, !dbg !25
+  %eq = icmp eq i1 %is_valid9, false, !dbg !25
+  br i1 %eq, label %if.then10, label %if.else11, !dbg !25
+
+if.then10:                                        ; preds = %if.join7
+  ret i32 3, !dbg !26
+
+if.else11:                                        ; preds = %if.join7
+  br label %if.join12, !dbg !26
+
+if.join12:                                        ; preds = %if.else11
+  call void @llvm.dbg.declare(metadata ptr %math_multiply, metadata !14, metadata !DIExpression()), !dbg !27
+  %call13 = call i32 @MathLib.CoreMath.multiply(i32 3, i32 4), !dbg !28
+  store i32 %call13, ptr %math_multiply, align 4, !dbg !28
+  %math_multiply14 = load i32, ptr %math_multiply, align 4, !dbg !29
+  %ne15 = icmp ne i32 %math_multiply14, 12, !dbg !29
+  br i1 %ne15, label %if.then16, label %if.else17, !dbg !29
+
+if.then16:                                        ; preds = %if.join12
+  ret i32 4, !dbg !30
+
+if.else17:                                        ; preds = %if.join12
+  br label %if.join18, !dbg !30
+
+if.join18:                                        ; preds = %if.else17
+  ret i32 0, !dbg !31
+}
+
+; Function Attrs: nounwind
+declare i1 @StringLib.CoreString.validate() #0
+
+; Function Attrs: nofree nosync nounwind readnone speculatable willreturn
+declare void @llvm.dbg.declare(metadata, metadata, metadata) #1
+
+attributes #0 = { nounwind }
+attributes #1 = { nofree nosync nounwind readnone speculatable willreturn }
+
+!llvm.dbg.cu = !{!0}
+!llvm.module.flags = !{!2, !3}
+
+!0 = distinct !DICompileUnit(language: DW_LANG_C, file: !1, producer: "ShiroC Compiler\00", isOptimized: false, runtimeVersion: 0, emissionKind: FullDebug, splitDebugInlining: false)
+!1 = !DIFile(filename: "Main", directory: ".")
+!2 = !{i32 2, !"Dwarf Version", i32 4}
+!3 = !{i32 2, !"Debug Info Version", i32 3}
+!4 = distinct !DISubprogram(name: "main", linkageName: "main", scope: !5, file: !5, line: 6, type: !6, scopeLine: 6, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !9)
+!5 = !DIFile(filename: "main.shiro", directory: "src/tests/st/dependencies/test2_multiple/src/app")
+!6 = !DISubroutineType(types: !7)
+!7 = !{!8}
+!8 = !DIBasicType(name: "i32", size: 32, encoding: DW_ATE_signed)
+!9 = !{!10, !11, !12, !14}
+!10 = !DILocalVariable(name: "math_result", scope: !4, file: !5, line: 8, type: !8)
+!11 = !DILocalVariable(name: "string_len", scope: !4, file: !5, line: 13, type: !8)
+!12 = !DILocalVariable(name: "is_valid", scope: !4, file: !5, line: 18, type: !13)
+!13 = !DIBasicType(name: "bool", size: 8, encoding: DW_ATE_boolean)
+!14 = !DILocalVariable(name: "math_multiply", scope: !4, file: !5, line: 24, type: !8)
+!15 = !DILocation(line: 8, column: 5, scope: !4)
+!16 = !DILocation(line: 8, column: 23, scope: !4)
+!17 = !DILocation(line: 9, column: 9, scope: !4)
+!18 = !DILocation(line: 10, column: 9, scope: !4)
+!19 = !DILocation(line: 13, column: 5, scope: !4)
+!20 = !DILocation(line: 13, column: 22, scope: !4)
+!21 = !DILocation(line: 14, column: 9, scope: !4)
+!22 = !DILocation(line: 15, column: 9, scope: !4)
+!23 = !DILocation(line: 18, column: 5, scope: !4)
+!24 = !DILocation(line: 18, column: 20, scope: !4)
+!25 = !DILocation(line: 19, column: 9, scope: !4)
+!26 = !DILocation(line: 20, column: 9, scope: !4)
+!27 = !DILocation(line: 24, column: 5, scope: !4)
+!28 = !DILocation(line: 24, column: 25, scope: !4)
+!29 = !DILocation(line: 25, column: 9, scope: !4)
+!30 = !DILocation(line: 26, column: 9, scope: !4)
+!31 = !DILocation(line: 29, column: 5, scope: !4)
@@ -0,0 +1,516 @@
+; ModuleID = 'TestMultiple.Mem'
+source_filename = "TestMultiple.Mem"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+%Std.Mem.Arena = type { ptr, i64, i64, i64 }
+
+declare void @printI32(i32)
+
+; Function Attrs: nounwind
+define ptr @Std.Mem.allocate(i64 %0) #0 !dbg !4 {
+entry:
+  %ptr = alloca ptr, align 8, !dbg !14
+  %size.addr = alloca i64, align 8, !dbg !14
+  store i64 %0, ptr %size.addr, align 8, !dbg !14
+  call void @llvm.dbg.declare(metadata ptr %size.addr, metadata !12, metadata !DIExpression()), !dbg !15
+  call void @llvm.dbg.declare(metadata ptr %ptr, metadata !13, metadata !DIExpression()), !dbg !16
+  %size = load i64, ptr %size.addr, align 8, !dbg !17
+  %call = call ptr @malloc(i64 %size), !dbg !17
+  store ptr %call, ptr %ptr, align 8, !dbg !17
+  %ptr1 = load ptr, ptr %ptr, align 8, !dbg !18
+  %eq = icmp eq ptr %ptr1, null, !dbg !18
+  br i1 %eq, label %if.then, label %if.else, !dbg !18
+
+if.then:                                          ; preds = %entry
+  call void @abort(), !dbg !19
+  br label %if.join, !dbg !19
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !19
+
+if.join:                                          ; preds = %if.else, %if.then
+  %ptr2 = load ptr, ptr %ptr, align 8, !dbg !20
+  ret ptr %ptr2, !dbg !20
+}
+
+; Function Attrs: nounwind readnone willreturn
+define internal fastcc i64 @chunk_header_size() #1 !dbg !21 {
+entry:
+  ret i64 16, !dbg !26
+}
+
+; Function Attrs: nounwind readnone willreturn
+define internal fastcc i64 @align_up(i64 %0, i64 %1) #1 !dbg !27 {
+entry:
+  %value.addr = alloca i64, align 8, !dbg !33
+  store i64 %0, ptr %value.addr, align 8, !dbg !33
+  call void @llvm.dbg.declare(metadata ptr %value.addr, metadata !31, metadata !DIExpression()), !dbg !34
+  %align.addr = alloca i64, align 8, !dbg !33
+  store i64 %1, ptr %align.addr, align 8, !dbg !33
+  call void @llvm.dbg.declare(metadata ptr %align.addr, metadata !32, metadata !DIExpression()), !dbg !35
+  %value = load i64, ptr %value.addr, align 8, !dbg !36
+  %align = load i64, ptr %align.addr, align 8, !dbg !36
+  %add = add i64 %value, %align, !dbg !36
+  %sub = sub i64 %add, 1, !dbg !36
+  %align1 = load i64, ptr %align.addr, align 8, !dbg !36
+  %div = udiv i64 %sub, %align1, !dbg !36
+  %align2 = load i64, ptr %align.addr, align 8, !dbg !36
+  %mul = mul i64 %div, %align2, !dbg !36
+  ret i64 %mul, !dbg !36
+}
+
+; Function Attrs: nounwind
+define void @Std.Mem.Arena.reset(ptr nonnull dereferenceable(32) %0) #0 !dbg !37 {
+entry:
+  %self.addr = alloca ptr, align 8, !dbg !50
+  store ptr %0, ptr %self.addr, align 8, !dbg !50
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !48, metadata !DIExpression()), !dbg !50
+  %1 = load ptr, ptr %self.addr, align 8, !dbg !51
+  %Std.Mem.Arena = getelementptr inbounds %Std.Mem.Arena, ptr %1, i32 0, i32 0, !dbg !51
+  %member_val = load ptr, ptr %Std.Mem.Arena, align 8, !dbg !51
+  %eq = icmp eq ptr %member_val, null, !dbg !51
+  br i1 %eq, label %if.then, label %if.else, !dbg !51
+
+if.then:                                          ; preds = %entry
+  ret void, !dbg !52
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !52
+
+if.join:                                          ; preds = %if.else
+  %2 = load ptr, ptr %self.addr, align 8, !dbg !53
+  %3 = load ptr, ptr %self.addr, align 8, !dbg !53
+  %Std.Mem.Arena1 = getelementptr inbounds %Std.Mem.Arena, ptr %3, i32 0, i32 0, !dbg !53
+  %member_val2 = load ptr, ptr %Std.Mem.Arena1, align 8, !dbg !53
+  %deref = load ptr, ptr %member_val2, align 8, !dbg !53
+  call void @Std.Mem.Arena.free_chunks(ptr %2, ptr %deref), !dbg !53
+  %4 = load ptr, ptr %self.addr, align 8, !dbg !53
+  %Std.Mem.Arena3 = getelementptr inbounds %Std.Mem.Arena, ptr %4, i32 0, i32 0, !dbg !53
+  %member_val4 = load ptr, ptr %Std.Mem.Arena3, align 8, !dbg !53
+  store ptr null, ptr %member_val4, align 8, !dbg !53
+  %call = call fastcc i64 @chunk_header_size(), !dbg !54
+  %5 = load ptr, ptr %self.addr, align 8, !dbg !54
+  %Std.Mem.Arena5 = getelementptr inbounds %Std.Mem.Arena, ptr %5, i32 0, i32 2, !dbg !54
+  store i64 %call, ptr %Std.Mem.Arena5, align 8, !dbg !54
+  ret void, !dbg !54
+}
+
+; Function Attrs: nounwind
+define i64 @Std.Mem.Arena.used(ptr nonnull dereferenceable(32) %0) #0 !dbg !55 {
+entry:
+  %self.addr = alloca ptr, align 8, !dbg !60
+  store ptr %0, ptr %self.addr, align 8, !dbg !60
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !59, metadata !DIExpression()), !dbg !60
+  %1 = load ptr, ptr %self.addr, align 8, !dbg !61
+  %Std.Mem.Arena = getelementptr inbounds %Std.Mem.Arena, ptr %1, i32 0, i32 0, !dbg !61
+  %member_val = load ptr, ptr %Std.Mem.Arena, align 8, !dbg !61
+  %eq = icmp eq ptr %member_val, null, !dbg !61
+  br i1 %eq, label %if.then, label %if.else, !dbg !61
+
+if.then:                                          ; preds = %entry
+  ret i64 0, !dbg !62
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !62
+
+if.join:                                          ; preds = %if.else
+  %2 = load ptr, ptr %self.addr, align 8, !dbg !63
+  %Std.Mem.Arena1 = getelementptr inbounds %Std.Mem.Arena, ptr %2, i32 0, i32 2, !dbg !63
+  %member_val2 = load i64, ptr %Std.Mem.Arena1, align 8, !dbg !63
+  %call = call fastcc i64 @chunk_header_size(), !dbg !64
+  %sub = sub i64 %member_val2, %call, !dbg !64
+  ret i64 %sub, !dbg !64
+}
+
+; Function Attrs: nounwind
+define ptr @Std.Mem.Arena.alloc(ptr nonnull dereferenceable(32) %0, i64 %1, i64 %2) #0 !dbg !65 {
+entry:
+  %chunk_start = alloca i64, align 8, !dbg !77
+  %chunk_base = alloca i64, align 8, !dbg !77
+  %start = alloca i64, align 8, !dbg !77
+  %base = alloca i64, align 8, !dbg !77
+  %self.addr = alloca ptr, align 8, !dbg !77
+  store ptr %0, ptr %self.addr, align 8, !dbg !77
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !70, metadata !DIExpression()), !dbg !77
+  %size.addr = alloca i64, align 8, !dbg !77
+  store i64 %1, ptr %size.addr, align 8, !dbg !77
+  call void @llvm.dbg.declare(metadata ptr %size.addr, metadata !71, metadata !DIExpression()), !dbg !78
+  %align.addr = alloca i64, align 8, !dbg !77
+  store i64 %2, ptr %align.addr, align 8, !dbg !77
+  call void @llvm.dbg.declare(metadata ptr %align.addr, metadata !72, metadata !DIExpression()), !dbg !79
+  %3 = load ptr, ptr %self.addr, align 8, !dbg !80
+  %Std.Mem.Arena = getelementptr inbounds %Std.Mem.Arena, ptr %3, i32 0, i32 0, !dbg !80
+  %member_val = load ptr, ptr %Std.Mem.Arena, align 8, !dbg !80
+  %ne = icmp ne ptr %member_val, null, !dbg !80
+  br i1 %ne, label %if.then, label %if.else, !dbg !80
+
+if.then:                                          ; preds = %entry
+  call void @llvm.dbg.declare(metadata ptr %base, metadata !73, metadata !DIExpression()), !dbg !81
+  %4 = load ptr, ptr %self.addr, align 8, !dbg !81
+  %Std.Mem.Arena1 = getelementptr inbounds %Std.Mem.Arena, ptr %4, i32 0, i32 0, !dbg !81
+  %member_val2 = load ptr, ptr %Std.Mem.Arena1, align 8, !dbg !81
+  %ptr2int = ptrtoint ptr %member_val2 to i64, !dbg !81
+  store i64 %ptr2int, ptr %base, align 8, !dbg !81
+  call void @llvm.dbg.declare(metadata ptr %start, metadata !74, metadata !DIExpression()), !dbg !82
+  %base3 = load i64, ptr %base, align 8, !dbg !83
+  %5 = load ptr, ptr %self.addr, align 8, !dbg !83
+  %Std.Mem.Arena4 = getelementptr inbounds %Std.Mem.Arena, ptr %5, i32 0, i32 2, !dbg !83
+  %member_val5 = load i64, ptr %Std.Mem.Arena4, align 8, !dbg !83
+  %add = add i64 %base3, %member_val5, !dbg !83
+  %align = load i64, ptr %align.addr, align 8, !dbg !83
+  %call = call fastcc i64 @align_up(i64 %add, i64 %align), !dbg !83
+  %base6 = load i64, ptr %base, align 8, !dbg !83
+  %sub = sub i64 %call, %base6, !dbg !83
+  store i64 %sub, ptr %start, align 8, !dbg !83
+  %start7 = load i64, ptr %start, align 8, !dbg !84
+  %size = load i64, ptr %size.addr, align 8, !dbg !84
+  %add8 = add i64 %start7, %size, !dbg !84
+  %6 = load ptr, ptr %self.addr, align 8, !dbg !84
+  %Std.Mem.Arena9 = getelementptr inbounds %Std.Mem.Arena, ptr %6, i32 0, i32 1, !dbg !84
+  %member_val10 = load i64, ptr %Std.Mem.Arena9, align 8, !dbg !84
+  %lte = icmp ule i64 %add8, %member_val10, !dbg !84
+  br i1 %lte, label %if.then11, label %if.else12, !dbg !84
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !85
+
+if.join:                                          ; preds = %if.else, %if.join13
+  %7 = load ptr, ptr %self.addr, align 8, !dbg !86
+  %size21 = load i64, ptr %size.addr, align 8, !dbg !87
+  %align22 = load i64, ptr %align.addr, align 8, !dbg !87
+  %add23 = add i64 %size21, %align22, !dbg !87
+  call void @Std.Mem.Arena.add_chunk(ptr %7, i64 %add23), !dbg !87
+  call void @llvm.dbg.declare(metadata ptr %chunk_base, metadata !75, metadata !DIExpression()), !dbg !88
+  %8 = load ptr, ptr %self.addr, align 8, !dbg !88
+  %Std.Mem.Arena24 = getelementptr inbounds %Std.Mem.Arena, ptr %8, i32 0, i32 0, !dbg !88
+  %member_val25 = load ptr, ptr %Std.Mem.Arena24, align 8, !dbg !88
+  %ptr2int26 = ptrtoint ptr %member_val25 to i64, !dbg !88
+  store i64 %ptr2int26, ptr %chunk_base, align 8, !dbg !88
+  call void @llvm.dbg.declare(metadata ptr %chunk_start, metadata !76, metadata !DIExpression()), !dbg !89
+  %chunk_base27 = load i64, ptr %chunk_base, align 8, !dbg !90
+  %9 = load ptr, ptr %self.addr, align 8, !dbg !90
+  %Std.Mem.Arena28 = getelementptr inbounds %Std.Mem.Arena, ptr %9, i32 0, i32 2, !dbg !90
+  %member_val29 = load i64, ptr %Std.Mem.Arena28, align 8, !dbg !90
+  %add30 = add i64 %chunk_base27, %member_val29, !dbg !90
+  %align31 = load i64, ptr %align.addr, align 8, !dbg !90
+  %call32 = call fastcc i64 @align_up(i64 %add30, i64 %align31), !dbg !90
+  %chunk_base33 = load i64, ptr %chunk_base, align 8, !dbg !90
+  %sub34 = sub i64 %call32, %chunk_base33, !dbg !90
+  store i64 %sub34, ptr %chunk_start, align 8, !dbg !90
+  %chunk_start35 = load i64, ptr %chunk_start, align 8, !dbg !91
+  %size36 = load i64, ptr %size.addr, align 8, !dbg !91
+  %add37 = add i64 %chunk_start35, %size36, !dbg !91
+  %10 = load ptr, ptr %self.addr, align 8, !dbg !91
+  %Std.Mem.Arena38 = getelementptr inbounds %Std.Mem.Arena, ptr %10, i32 0, i32 2, !dbg !91
+  store i64 %add37, ptr %Std.Mem.Arena38, align 8, !dbg !91
+  %chunk_base39 = load i64, ptr %chunk_base, align 8, !dbg !92
+  %chunk_start40 = load i64, ptr %chunk_start, align 8, !dbg !92
+  %add41 = add i64 %chunk_base39, %chunk_start40, !dbg !92
+  %int2ptr42 = inttoptr i64 %add41 to ptr, !dbg !92
+  ret ptr %int2ptr42, !dbg !92
+
+if.then11:                                        ; preds = %if.then
+  %start14 = load i64, ptr %start, align 8, !dbg !93
+  %size15 = load i64, ptr %size.addr, align 8, !dbg !93
+  %add16 = add i64 %start14, %size15, !dbg !93
+  %11 = load ptr, ptr %self.addr, align 8, !dbg !93
+  %Std.Mem.Arena17 = getelementptr inbounds %Std.Mem.Arena, ptr %11, i32 0, i32 2, !dbg !93
+  store i64 %add16, ptr %Std.Mem.Arena17, align 8, !dbg !93
+  %base18 = load i64, ptr %base, align 8, !dbg !85
+  %start19 = load i64, ptr %start, align 8, !dbg !85
+  %add20 = add i64 %base18, %start19, !dbg !85
+  %int2ptr = inttoptr i64 %add20 to ptr, !dbg !85
+  ret ptr %int2ptr, !dbg !85
+
+if.else12:                                        ; preds = %if.then
+  br label %if.join13, !dbg !85
+
+if.join13:                                        ; preds = %if.else12
+  br label %if.join, !dbg !85
+}
+
+; Function Attrs: nounwind
+define void @Std.Mem.Arena.add_chunk(ptr nonnull dereferenceable(32) %0, i64 %1) #0 !dbg !94 {
+entry:
+  %new_chunk = alloca ptr, align 8, !dbg !102
+  %size = alloca i64, align 8, !dbg !102
+  %self.addr = alloca ptr, align 8, !dbg !102
+  store ptr %0, ptr %self.addr, align 8, !dbg !102
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !98, metadata !DIExpression()), !dbg !102
+  %min_size.addr = alloca i64, align 8, !dbg !102
+  store i64 %1, ptr %min_size.addr, align 8, !dbg !102
+  call void @llvm.dbg.declare(metadata ptr %min_size.addr, metadata !99, metadata !DIExpression()), !dbg !103
+  call void @llvm.dbg.declare(metadata ptr %size, metadata !100, metadata !DIExpression()), !dbg !104
+  %2 = load ptr, ptr %self.addr, align 8, !dbg !104
+  %Std.Mem.Arena = getelementptr inbounds %Std.Mem.Arena, ptr %2, i32 0, i32 3, !dbg !104
+  %member_val = load i64, ptr %Std.Mem.Arena, align 8, !dbg !104
+  store i64 %member_val, ptr %size, align 8, !dbg !104
+  br label %while.cond, !dbg !105
+
+while.cond:                                       ; preds = %while.body, %entry
+  %size1 = load i64, ptr %size, align 8, !dbg !106
+  %min_size = load i64, ptr %min_size.addr, align 8, !dbg !107
+  %call = call fastcc i64 @chunk_header_size(), !dbg !108
+  %add = add i64 %min_size, %call, !dbg !108
+  %lt = icmp ult i64 %size1, %add, !dbg !108
+  br i1 %lt, label %while.body, label %while.end, !dbg !108
+
+while.body:                                       ; preds = %while.cond
+  %size2 = load i64, ptr %size, align 8, !dbg !109
+  %mul = mul i64 %size2, 2, !dbg !109
+  store i64 %mul, ptr %size, align 8, !dbg !109
+  br label %while.cond, !dbg !109, !llvm.loop !110
+
+while.end:                                        ; preds = %while.cond
+  call void @llvm.dbg.declare(metadata ptr %new_chunk, metadata !101, metadata !DIExpression()), !dbg !112
+  %size3 = load i64, ptr %size, align 8, !dbg !113
+  %call4 = call ptr @Std.Mem.allocate(i64 %size3), !dbg !113
+  store ptr %call4, ptr %new_chunk, align 8, !dbg !113
+  %3 = load ptr, ptr %self.addr, align 8, !dbg !113
+  %Std.Mem.Arena5 = getelementptr inbounds %Std.Mem.Arena, ptr %3, i32 0, i32 0, !dbg !113
+  %member_val6 = load ptr, ptr %Std.Mem.Arena5, align 8, !dbg !113
+  %new_chunk7 = load ptr, ptr %new_chunk, align 8, !dbg !113
+  store ptr %member_val6, ptr %new_chunk7, align 8, !dbg !113
+  %new_chunk8 = load ptr, ptr %new_chunk, align 8, !dbg !113
+  %4 = load ptr, ptr %self.addr, align 8, !dbg !113
+  %Std.Mem.Arena9 = getelementptr inbounds %Std.Mem.Arena, ptr %4, i32 0, i32 0, !dbg !113
+  store ptr %new_chunk8, ptr %Std.Mem.Arena9, align 8, !dbg !113
+  %call10 = call fastcc i64 @chunk_header_size(), !dbg !114
+  %5 = load ptr, ptr %self.addr, align 8, !dbg !114
+  %Std.Mem.Arena11 = getelementptr inbounds %Std.Mem.Arena, ptr %5, i32 0, i32 2, !dbg !114
+  store i64 %call10, ptr %Std.Mem.Arena11, align 8, !dbg !114
+  %size12 = load i64, ptr %size, align 8, !dbg !114
+  %6 = load ptr, ptr %self.addr, align 8, !dbg !114
+  %Std.Mem.Arena13 = getelementptr inbounds %Std.Mem.Arena, ptr %6, i32 0, i32 1, !dbg !114
+  store i64 %size12, ptr %Std.Mem.Arena13, align 8, !dbg !114
+  %size14 = load i64, ptr %size, align 8, !dbg !115
+  %mul15 = mul i64 %size14, 2, !dbg !115
+  %7 = load ptr, ptr %self.addr, align 8, !dbg !115
+  %Std.Mem.Arena16 = getelementptr inbounds %Std.Mem.Arena, ptr %7, i32 0, i32 3, !dbg !115
+  store i64 %mul15, ptr %Std.Mem.Arena16, align 8, !dbg !115
+  ret void, !dbg !115
+}
+
+; Function Attrs: nounwind
+define void @Std.Mem.Arena.free_chunks(ptr nonnull dereferenceable(32) %0, ptr %1) #0 !dbg !116 {
+entry:
+  %previous = alloca ptr, align 8, !dbg !124
+  %itr = alloca ptr, align 8, !dbg !124
+  %self.addr = alloca ptr, align 8, !dbg !124
+  store ptr %0, ptr %self.addr, align 8, !dbg !124
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !120, metadata !DIExpression()), !dbg !124
+  %first.addr = alloca ptr, align 8, !dbg !124
+  store ptr %1, ptr %first.addr, align 8, !dbg !124
+  call void @llvm.dbg.declare(metadata ptr %first.addr, metadata !121, metadata !DIExpression()), !dbg !125
+  call void @llvm.dbg.declare(metadata ptr %itr, metadata !122, metadata !DIExpression()), !dbg !126
+  %first = load ptr, ptr %first.addr, align 8, !dbg !126
+  store ptr %first, ptr %itr, align 8, !dbg !126
+  br label %while.cond, !dbg !127
+
+while.cond:                                       ; preds = %while.body, %entry
+  %itr1 = load ptr, ptr %itr, align 8, !dbg !128
+  %ne = icmp ne ptr %itr1, null, !dbg !128
+  br i1 %ne, label %while.body, label %while.end, !dbg !128
+
+while.body:                                       ; preds = %while.cond
+  call void @llvm.dbg.declare(metadata ptr %previous, metadata !123, metadata !DIExpression()), !dbg !129
+  %itr2 = load ptr, ptr %itr, align 8, !dbg !129
+  %deref = load ptr, ptr %itr2, align 8, !dbg !129
+  store ptr %deref, ptr %previous, align 8, !dbg !129
+  %itr3 = load ptr, ptr %itr, align 8, !dbg !130
+  call void @Std.Mem.deallocate(ptr %itr3), !dbg !130
+  %previous4 = load ptr, ptr %previous, align 8, !dbg !130
+  store ptr %previous4, ptr %itr, align 8, !dbg !130
+  br label %while.cond, !dbg !130, !llvm.loop !131
+
+while.end:                                        ; preds = %while.cond
+  ret void, !dbg !130
+}
+
+; Function Attrs: nounwind
+define void @"Std.Mem.Arena.@destruct"(ptr nonnull dereferenceable(32) %0) #0 !dbg !132 {
+entry:
+  %self.addr = alloca ptr, align 8, !dbg !135
+  store ptr %0, ptr %self.addr, align 8, !dbg !135
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !134, metadata !DIExpression()), !dbg !135
+  %1 = load ptr, ptr %self.addr, align 8, !dbg !136
+  %2 = load ptr, ptr %self.addr, align 8, !dbg !136
+  %Std.Mem.Arena = getelementptr inbounds %Std.Mem.Arena, ptr %2, i32 0, i32 0, !dbg !136
+  %member_val = load ptr, ptr %Std.Mem.Arena, align 8, !dbg !136
+  call void @Std.Mem.Arena.free_chunks(ptr %1, ptr %member_val), !dbg !136
+  ret void, !dbg !136
+}
+
+declare void @abort()
+
+; Function Attrs: nounwind
+define void @Std.Mem.deallocate(ptr %0) #0 !dbg !137 {
+entry:
+  %ptr.addr = alloca ptr, align 8, !dbg !142
+  store ptr %0, ptr %ptr.addr, align 8, !dbg !142
+  call void @llvm.dbg.declare(metadata ptr %ptr.addr, metadata !141, metadata !DIExpression()), !dbg !143
+  %ptr = load ptr, ptr %ptr.addr, align 8, !dbg !144
+  call void @free(ptr %ptr), !dbg !144
+  ret void, !dbg !144
+}
+
+declare void @free(ptr)
+
+declare ptr @malloc(i64)
+
+; Function Attrs: nofree nosync nounwind readnone speculatable willreturn
+declare void @llvm.dbg.declare(metadata, metadata, metadata) #2
+
+attributes #0 = { nounwind }
+attributes #1 = { nounwind readnone willreturn }
+attributes #2 = { nofree nosync nounwind readnone speculatable willreturn }
+
+!llvm.dbg.cu = !{!0}
+!llvm.module.flags = !{!2, !3}
+
+!0 = distinct !DICompileUnit(language: DW_LANG_C, file: !1, producer: "ShiroC Compiler\00", isOptimized: false, runtimeVersion: 0, emissionKind: FullDebug, splitDebugInlining: false)
+!1 = !DIFile(filename: "Mem", directory: ".")
+!2 = !{i32 2, !"Dwarf Version", i32 4}
+!3 = !{i32 2, !"Debug Info Version", i32 3}
+!4 = distinct !DISubprogram(name: "allocate", linkageName: "allocate", scope: !5, file: !5, line: 9, type: !6, scopeLine: 9, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !11)
+!5 = !DIFile(filename: "alloc.shiro", directory: "/tmp/asan/src/std/Mem")
+!6 = !DISubroutineType(types: !7)
+!7 = !{!8, !10}
+!8 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !9, size: 64, dwarfAddressSpace: 0)
+!9 = !DIBasicType(name: "u8", size: 8, encoding: DW_ATE_unsigned_char)
+!10 = !DIBasicType(name: "usize", size: 64, encoding: DW_ATE_unsigned_char)
+!11 = !{!12, !13}
+!12 = !DILocalVariable(name: "size", arg: 1, scope: !4, file: !5, line: 9, type: !10)
+!13 = !DILocalVariable(name: "ptr", scope: !4, file: !5, line: 10, type: !8)
+!14 = !DILocation(line: 9, column: 8, scope: !4)
+!15 = !DILocation(line: 9, column: 20, scope: !4)
+!16 = !DILocation(line: 10, column: 5, scope: !4)
+!17 = !DILocation(line: 10, column: 15, scope: !4)
+!18 = !DILocation(line: 11, column: 9, scope: !4)
+!19 = !DILocation(line: 12, column: 9, scope: !4)
+!20 = !DILocation(line: 14, column: 5, scope: !4)
+!21 = distinct !DISubprogram(name: "chunk_header_size", linkageName: "chunk_header_size", scope: !22, file: !22, line: 6, type: !23, scopeLine: 6, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !25)
+!22 = !DIFile(filename: "arena.shiro", directory: "/tmp/asan/src/std/Mem")
+!23 = !DISubroutineType(types: !24)
+!24 = !{!10}
+!25 = !{}
+!26 = !DILocation(line: 7, column: 5, scope: !21)
+!27 = distinct !DISubprogram(name: "align_up", linkageName: "align_up", scope: !22, file: !22, line: 10, type: !28, scopeLine: 10, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !30)
+!28 = !DISubroutineType(types: !29)
+!29 = !{!10, !10, !10}
+!30 = !{!31, !32}
+!31 = !DILocalVariable(name: "value", arg: 1, scope: !27, file: !22, line: 10, type: !10)
+!32 = !DILocalVariable(name: "align", arg: 2, scope: !27, file: !22, line: 10, type: !10)
+!33 = !DILocation(line: 10, column: 1, scope: !27)
+!34 = !DILocation(line: 10, column: 13, scope: !27)
+!35 = !DILocation(line: 10, column: 27, scope: !27)
+!36 = !DILocation(line: 11, column: 13, scope: !27)
+!37 = distinct !DISubprogram(name: "Arena.reset", linkageName: "Arena.reset", scope: !22, file: !22, line: 39, type: !38, scopeLine: 39, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !47)
+!38 = !DISubroutineType(types: !39)
+!39 = !{null, !40}
+!40 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !41, size: 64, flags: DIFlagArtificial | DIFlagObjectPointer, dwarfAddressSpace: 0)
+!41 = !DICompositeType(tag: DW_TAG_structure_type, name: "Arena", file: !22, line: 14, size: 256, align: 64, elements: !42, identifier: "Std.Mem.Arena")
+!42 = !{!43, !44, !45, !46}
+!43 = !DIDerivedType(tag: DW_TAG_member, name: "chunk", scope: !41, file: !22, baseType: !8, size: 64, align: 64)
+!44 = !DIDerivedType(tag: DW_TAG_member, name: "capacity", scope: !41, file: !22, baseType: !10, size: 64, align: 64, offset: 64)
+!45 = !DIDerivedType(tag: DW_TAG_member, name: "offset", scope: !41, file: !22, baseType: !10, size: 64, align: 64, offset: 128)
+!46 = !DIDerivedType(tag: DW_TAG_member, name: "chunk_size", scope: !41, file: !22, baseType: !10, size: 64, align: 64, offset: 192)
+!47 = !{!48}
+!48 = !DILocalVariable(name: "self", arg: 1, scope: !37, file: !22, line: 39, type: !49)
+!49 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !41, size: 64, dwarfAddressSpace: 0)
+!50 = !DILocation(line: 39, column: 5, scope: !37)
+!51 = !DILocation(line: 40, column: 13, scope: !37)
+!52 = !DILocation(line: 41, column: 13, scope: !37)
+!53 = !DILocation(line: 43, column: 9, scope: !37)
+!54 = !DILocation(line: 45, column: 23, scope: !37)
+!55 = distinct !DISubprogram(name: "Arena.used", linkageName: "Arena.used", scope: !22, file: !22, line: 49, type: !56, scopeLine: 49, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !58)
+!56 = !DISubroutineType(types: !57)
+!57 = !{!10, !40}
+!58 = !{!59}
+!59 = !DILocalVariable(name: "self", arg: 1, scope: !55, file: !22, line: 49, type: !49)
+!60 = !DILocation(line: 49, column: 5, scope: !55)
+!61 = !DILocation(line: 50, column: 13, scope: !55)
+!62 = !DILocation(line: 51, column: 13, scope: !55)
+!63 = !DILocation(line: 53, column: 16, scope: !55)
+!64 = !DILocation(line: 53, column: 30, scope: !55)
+!65 = distinct !DISubprogram(name: "Arena.alloc", linkageName: "Arena.alloc", scope: !22, file: !22, line: 21, type: !66, scopeLine: 21, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !69)
+!66 = !DISubroutineType(types: !67)
+!67 = !{!68, !40, !10, !10}
+!68 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: null, size: 64, dwarfAddressSpace: 0)
+!69 = !{!70, !71, !72, !73, !74, !75, !76}
+!70 = !DILocalVariable(name: "self", arg: 1, scope: !65, file: !22, line: 21, type: !49)
+!71 = !DILocalVariable(name: "size", arg: 2, scope: !65, file: !22, line: 21, type: !10)
+!72 = !DILocalVariable(name: "align", arg: 3, scope: !65, file: !22, line: 21, type: !10)
+!73 = !DILocalVariable(name: "base", scope: !65, file: !22, line: 23, type: !10)
+!74 = !DILocalVariable(name: "start", scope: !65, file: !22, line: 24, type: !10)
+!75 = !DILocalVariable(name: "chunk_base", scope: !65, file: !22, line: 32, type: !10)
+!76 = !DILocalVariable(name: "chunk_start", scope: !65, file: !22, line: 33, type: !10)
+!77 = !DILocation(line: 21, column: 5, scope: !65)
+!78 = !DILocation(line: 21, column: 14, scope: !65)
+!79 = !DILocation(line: 21, column: 27, scope: !65)
+!80 = !DILocation(line: 22, column: 13, scope: !65)
+!81 = !DILocation(line: 23, column: 13, scope: !65)
+!82 = !DILocation(line: 24, column: 13, scope: !65)
+!83 = !DILocation(line: 24, column: 34, scope: !65)
+!84 = !DILocation(line: 25, column: 17, scope: !65)
+!85 = !DILocation(line: 27, column: 25, scope: !65)
+!86 = !DILocation(line: 31, column: 9, scope: !65)
+!87 = !DILocation(line: 31, column: 24, scope: !65)
+!88 = !DILocation(line: 32, column: 9, scope: !65)
+!89 = !DILocation(line: 33, column: 9, scope: !65)
+!90 = !DILocation(line: 33, column: 36, scope: !65)
+!91 = !DILocation(line: 34, column: 23, scope: !65)
+!92 = !DILocation(line: 35, column: 17, scope: !65)
+!93 = !DILocation(line: 26, column: 31, scope: !65)
+!94 = distinct !DISubprogram(name: "Arena.add_chunk", linkageName: "Arena.add_chunk", scope: !22, file: !22, line: 60, type: !95, scopeLine: 60, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !97)
+!95 = !DISubroutineType(types: !96)
+!96 = !{null, !40, !10}
+!97 = !{!98, !99, !100, !101}
+!98 = !DILocalVariable(name: "self", arg: 1, scope: !94, file: !22, line: 60, type: !49)
+!99 = !DILocalVariable(name: "min_size", arg: 2, scope: !94, file: !22, line: 60, type: !10)
+!100 = !DILocalVariable(name: "size", scope: !94, file: !22, line: 61, type: !10)
+!101 = !DILocalVariable(name: "new_chunk", scope: !94, file: !22, line: 66, type: !8)
+!102 = !DILocation(line: 60, column: 5, scope: !94)
+!103 = !DILocation(line: 60, column: 18, scope: !94)
+!104 = !DILocation(line: 61, column: 9, scope: !94)
+!105 = !DILocation(line: 62, column: 9, scope: !94)
+!106 = !DILocation(line: 62, column: 16, scope: !94)
+!107 = !DILocation(line: 62, column: 23, scope: !94)
+!108 = !DILocation(line: 62, column: 34, scope: !94)
+!109 = !DILocation(line: 63, column: 20, scope: !94)
+!110 = distinct !{!110, !111}
+!111 = !{!"llvm.loop.mustprogress"}
+!112 = !DILocation(line: 66, column: 9, scope: !94)
+!113 = !DILocation(line: 66, column: 25, scope: !94)
+!114 = !DILocation(line: 70, column: 23, scope: !94)
+!115 = !DILocation(line: 72, column: 27, scope: !94)
+!116 = distinct !DISubprogram(name: "Arena.free_chunks", linkageName: "Arena.free_chunks", scope: !22, file: !22, line: 75, type: !117, scopeLine: 75, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !119)
+!117 = !DISubroutineType(types: !118)
+!118 = !{null, !40, !8}
+!119 = !{!120, !121, !122, !123}
+!120 = !DILocalVariable(name: "self", arg: 1, scope: !116, file: !22, line: 75, type: !49)
+!121 = !DILocalVariable(name: "first", arg: 2, scope: !116, file: !22, line: 75, type: !8)
+!122 = !DILocalVariable(name: "itr", scope: !116, file: !22, line: 76, type: !8)
+!123 = !DILocalVariable(name: "previous", scope: !116, file: !22, line: 78, type: !8)
+!124 = !DILocation(line: 75, column: 5, scope: !116)
+!125 = !DILocation(line: 75, column: 20, scope: !116)
+!126 = !DILocation(line: 76, column: 9, scope: !116)
+!127 = !DILocation(line: 77, column: 9, scope: !116)
+!128 = !DILocation(line: 77, column: 16, scope: !116)
+!129 = !DILocation(line: 78, column: 13, scope: !116)
+!130 = !DILocation(line: 79, column: 13, scope: !116)
+!131 = distinct !{!131, !111}
+!132 = distinct !DISubprogram(name: "Arena.destruct", linkageName: "Arena.destruct", scope: !22, file: !22, line: 56, type: !38, scopeLine: 56, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !133)
+!133 = !{!134}
+!134 = !DILocalVariable(name: "self", arg: 1, scope: !132, file: !22, line: 56, type: !49)
+!135 = !DILocation(line: 56, column: 5, scope: !132)
+!136 = !DILocation(line: 57, column: 9, scope: !132)
+!137 = distinct !DISubprogram(name: "deallocate", linkageName: "deallocate", scope: !5, file: !5, line: 17, type: !138, scopeLine: 17, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !140)
+!138 = !DISubroutineType(types: !139)
+!139 = !{null, !8}
+!140 = !{!141}
+!141 = !DILocalVariable(name: "ptr", arg: 1, scope: !137, file: !5, line: 17, type: !8)
+!142 = !DILocation(line: 17, column: 8, scope: !137)
+!143 = !DILocation(line: 17, column: 22, scope: !137)
+!144 = !DILocation(line: 18, column: 5, scope: !137)
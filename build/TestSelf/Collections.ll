@@ -0,0 +1,2504 @@
+; ModuleID = 'TestSelf.Collections'
+source_filename = "TestSelf.Collections"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+%view = type { i64, ptr }
+
+declare void @printI32(i32)
+
+; Function Attrs: nounwind
+define void @Std.Collections.collection_free(ptr %0) #0 !dbg !4 {
+entry:
+  %ptr.addr = alloca ptr, align 8, !dbg !12
+  store ptr %0, ptr %ptr.addr, align 8, !dbg !12
+  call void @llvm.dbg.declare(metadata ptr %ptr.addr, metadata !11, metadata !DIExpression()), !dbg !13
+  %ptr = load ptr, ptr %ptr.addr, align 8, !dbg !14
+  call void @free(ptr %ptr), !dbg !14
+  ret void, !dbg !14
+}
+
+declare ptr @calloc(i64, i64)
+
+declare ptr @memcpy(ptr, ptr, i64)
+
+; Function Attrs: nounwind
+define ptr @Std.Collections.collection_allocate(i64 %0) #0 !dbg !15 {
+entry:
+  %ptr = alloca ptr, align 8, !dbg !22
+  %size.addr = alloca i64, align 8, !dbg !22
+  store i64 %0, ptr %size.addr, align 8, !dbg !22
+  call void @llvm.dbg.declare(metadata ptr %size.addr, metadata !20, metadata !DIExpression()), !dbg !23
+  call void @llvm.dbg.declare(metadata ptr %ptr, metadata !21, metadata !DIExpression()), !dbg !24
+  %size = load i64, ptr %size.addr, align 8, !dbg !25
+  %call = call ptr @calloc(i64 1, i64 %size), !dbg !25
+  store ptr %call, ptr %ptr, align 8, !dbg !25
+  %ptr1 = load ptr, ptr %ptr, align 8, !dbg !26
+  %eq = icmp eq ptr %ptr1, null, !dbg !26
+  br i1 %eq, label %if.then, label %if.else, !dbg !26
+
+if.then:                                          ; preds = %entry
+  call void @abort(), !dbg !27
+  br label %if.join, !dbg !27
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !27
+
+if.join:                                          ; preds = %if.else, %if.then
+  %ptr2 = load ptr, ptr %ptr, align 8, !dbg !28
+  ret ptr %ptr2, !dbg !28
+}
+
+; Function Attrs: nounwind readnone willreturn
+define i8 @Std.Collections.tag(i64 %0) #1 !dbg !29 {
+entry:
+  %hash.addr = alloca i64, align 8, !dbg !36
+  store i64 %0, ptr %hash.addr, align 8, !dbg !36
+  call void @llvm.dbg.declare(metadata ptr %hash.addr, metadata !35, metadata !DIExpression()), !dbg !37
+  %hash = load i64, ptr %hash.addr, align 8, !dbg !38
+  %rem = urem i64 %hash, 128, !dbg !38
+  %add = add i64 128, %rem, !dbg !38
+  %trunc = trunc i64 %add to i8, !dbg !38
+  ret i8 %trunc, !dbg !38
+}
+
+declare void @abort()
+
+; Function Attrs: nounwind
+define void @Std.Collections.radix_sort(%view %0) #0 !dbg !39 {
+entry:
+  %v.addr = alloca %view, align 8, !dbg !49
+  store %view %0, ptr %v.addr, align 8, !dbg !49
+  call void @llvm.dbg.declare(metadata ptr %v.addr, metadata !48, metadata !DIExpression()), !dbg !50
+  %v = load %view, ptr %v.addr, align 8, !dbg !51
+  call fastcc void @"radix_sort_bytes<u8>"(%view %v, i64 1), !dbg !51
+  ret void, !dbg !51
+}
+
+; Function Attrs: nounwind
+define void @Std.Collections.radix_sort.1(%view %0) #0 !dbg !52 {
+entry:
+  %v.addr = alloca %view, align 8, !dbg !62
+  store %view %0, ptr %v.addr, align 8, !dbg !62
+  call void @llvm.dbg.declare(metadata ptr %v.addr, metadata !61, metadata !DIExpression()), !dbg !63
+  %v = load %view, ptr %v.addr, align 8, !dbg !64
+  call fastcc void @"radix_sort_bytes<u16>"(%view %v, i64 2), !dbg !64
+  ret void, !dbg !64
+}
+
+; Function Attrs: nounwind
+define void @Std.Collections.radix_sort.2(%view %0) #0 !dbg !65 {
+entry:
+  %v.addr = alloca %view, align 8, !dbg !75
+  store %view %0, ptr %v.addr, align 8, !dbg !75
+  call void @llvm.dbg.declare(metadata ptr %v.addr, metadata !74, metadata !DIExpression()), !dbg !76
+  %v = load %view, ptr %v.addr, align 8, !dbg !77
+  call fastcc void @"radix_sort_bytes<u32>"(%view %v, i64 4), !dbg !77
+  ret void, !dbg !77
+}
+
+; Function Attrs: nounwind
+define void @Std.Collections.radix_sort.3(%view %0) #0 !dbg !78 {
+entry:
+  %v.addr = alloca %view, align 8, !dbg !87
+  store %view %0, ptr %v.addr, align 8, !dbg !87
+  call void @llvm.dbg.declare(metadata ptr %v.addr, metadata !86, metadata !DIExpression()), !dbg !88
+  %v = load %view, ptr %v.addr, align 8, !dbg !89
+  call fastcc void @"radix_sort_bytes<u64>"(%view %v, i64 8), !dbg !89
+  ret void, !dbg !89
+}
+
+declare void @free(ptr)
+
+; Function Attrs: nounwind
+define internal fastcc void @"radix_sort_bytes<u8>"(%view %0, i64 %1) #0 !dbg !90 {
+entry:
+  %sorted = alloca ptr, align 8, !dbg !115
+  %buffer = alloca ptr, align 8, !dbg !115
+  %to = alloca ptr, align 8, !dbg !115
+  %from = alloca ptr, align 8, !dbg !115
+  %size = alloca i64, align 8, !dbg !115
+  %none = alloca ptr, align 8, !dbg !115
+  %pass = alloca i64, align 8, !dbg !115
+  %key = alloca i64, align 8, !dbg !115
+  %i = alloca i64, align 8, !dbg !115
+  %slot = alloca i64, align 8, !dbg !115
+  %counts = alloca [2048 x i64], align 8, !dbg !115
+  %count = alloca i64, align 8, !dbg !115
+  %v.addr = alloca %view, align 8, !dbg !115
+  store %view %0, ptr %v.addr, align 8, !dbg !115
+  call void @llvm.dbg.declare(metadata ptr %v.addr, metadata !98, metadata !DIExpression()), !dbg !116
+  %bytes.addr = alloca i64, align 8, !dbg !115
+  store i64 %1, ptr %bytes.addr, align 8, !dbg !115
+  call void @llvm.dbg.declare(metadata ptr %bytes.addr, metadata !99, metadata !DIExpression()), !dbg !117
+  call void @llvm.dbg.declare(metadata ptr %count, metadata !100, metadata !DIExpression()), !dbg !118
+  %view_len_ptr = getelementptr inbounds %view, ptr %v.addr, i32 0, i32 0, !dbg !119
+  %view_len = load i64, ptr %view_len_ptr, align 8, !dbg !119
+  store i64 %view_len, ptr %count, align 8, !dbg !119
+  %count1 = load i64, ptr %count, align 8, !dbg !120
+  %lt = icmp ult i64 %count1, 2, !dbg !120
+  br i1 %lt, label %if.then, label %if.else, !dbg !120
+
+if.then:                                          ; preds = %entry
+  ret void, !dbg !121
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !121
+
+if.join:                                          ; preds = %if.else
+  call void @llvm.dbg.declare(metadata ptr %counts, metadata !101, metadata !DIExpression()), !dbg !122
+  call void @llvm.dbg.declare(metadata ptr %slot, metadata !105, metadata !DIExpression()), !dbg !123
+  store i64 0, ptr %slot, align 8, !dbg !123
+  br label %for.cond, !dbg !123
+
+for.cond:                                         ; preds = %for.post, %if.join
+  %slot2 = load i64, ptr %slot, align 8, !dbg !124
+  %bytes = load i64, ptr %bytes.addr, align 8, !dbg !125
+  %mul = mul i64 256, %bytes, !dbg !125
+  %lt3 = icmp ult i64 %slot2, %mul, !dbg !125
+  br i1 %lt3, label %for.body, label %for.end, !dbg !125
+
+for.body:                                         ; preds = %for.cond
+  %slot4 = load i64, ptr %slot, align 8, !dbg !126
+  %elem_ptr = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 %slot4, !dbg !126
+  store i64 0, ptr %elem_ptr, align 8, !dbg !126
+  br label %for.post, !dbg !126
+
+for.post:                                         ; preds = %for.body
+  %inc_dec.load = load i64, ptr %slot, align 8, !dbg !127
+  %inc = add i64 %inc_dec.load, 1, !dbg !127
+  store i64 %inc, ptr %slot, align 8, !dbg !127
+  br label %for.cond, !dbg !127, !llvm.loop !128
+
+for.end:                                          ; preds = %for.cond
+  call void @llvm.dbg.declare(metadata ptr %i, metadata !106, metadata !DIExpression()), !dbg !130
+  store i64 0, ptr %i, align 8, !dbg !130
+  %length_ptr = getelementptr inbounds %view, ptr %v.addr, i32 0, i32 0, !dbg !130
+  %data_ptr = getelementptr inbounds %view, ptr %v.addr, i32 0, i32 1, !dbg !130
+  %v.len = load i64, ptr %length_ptr, align 8, !dbg !130
+  %v.data = load ptr, ptr %data_ptr, align 8, !dbg !130
+  br label %for.cond5, !dbg !130
+
+for.cond5:                                        ; preds = %for.post7, %for.end
+  %i9 = load i64, ptr %i, align 8, !dbg !131
+  %count10 = load i64, ptr %count, align 8, !dbg !131
+  %lt11 = icmp ult i64 %i9, %count10, !dbg !131
+  br i1 %lt11, label %for.body6, label %for.end8, !dbg !131
+
+for.body6:                                        ; preds = %for.cond5
+  call void @llvm.dbg.declare(metadata ptr %key, metadata !107, metadata !DIExpression()), !dbg !132
+  %i12 = load i64, ptr %i, align 8, !dbg !133
+  %elem_ptr13 = getelementptr inbounds i8, ptr %v.data, i64 %i12, !dbg !133
+  %arr_elem = load i8, ptr %elem_ptr13, align 1, !dbg !133
+  %zext = zext i8 %arr_elem to i64, !dbg !133
+  store i64 %zext, ptr %key, align 8, !dbg !133
+  call void @llvm.dbg.declare(metadata ptr %pass, metadata !108, metadata !DIExpression()), !dbg !134
+  store i64 0, ptr %pass, align 8, !dbg !134
+  br label %for.cond14, !dbg !134
+
+for.post7:                                        ; preds = %for.end17
+  %inc_dec.load36 = load i64, ptr %i, align 8, !dbg !135
+  %inc37 = add i64 %inc_dec.load36, 1, !dbg !135
+  store i64 %inc37, ptr %i, align 8, !dbg !135
+  br label %for.cond5, !dbg !135, !llvm.loop !136
+
+for.end8:                                         ; preds = %for.cond5
+  call void @llvm.dbg.declare(metadata ptr %none, metadata !109, metadata !DIExpression()), !dbg !137
+  store ptr null, ptr %none, align 8, !dbg !137
+  call void @llvm.dbg.declare(metadata ptr %size, metadata !110, metadata !DIExpression()), !dbg !138
+  %none38 = load ptr, ptr %none, align 8, !dbg !139
+  %elem_ptr39 = getelementptr i8, ptr %none38, i64 1, !dbg !139
+  %ptr2int = ptrtoint ptr %elem_ptr39 to i64, !dbg !139
+  store i64 %ptr2int, ptr %size, align 8, !dbg !139
+  call void @llvm.dbg.declare(metadata ptr %from, metadata !111, metadata !DIExpression()), !dbg !140
+  %ptr_to_views_array_field = getelementptr inbounds %view, ptr %v.addr, i32 0, i32 1, !dbg !141
+  %array_ptr = load ptr, ptr %ptr_to_views_array_field, align 8, !dbg !141
+  %elem_ptr40 = getelementptr inbounds i8, ptr %array_ptr, i64 0, !dbg !141
+  store ptr %elem_ptr40, ptr %from, align 8, !dbg !141
+  call void @llvm.dbg.declare(metadata ptr %to, metadata !112, metadata !DIExpression()), !dbg !142
+  %count41 = load i64, ptr %count, align 8, !dbg !143
+  %size42 = load i64, ptr %size, align 8, !dbg !143
+  %mul43 = mul i64 %count41, %size42, !dbg !143
+  %call = call ptr @Std.Collections.collection_allocate(i64 %mul43), !dbg !143
+  store ptr %call, ptr %to, align 8, !dbg !143
+  call void @llvm.dbg.declare(metadata ptr %buffer, metadata !113, metadata !DIExpression()), !dbg !144
+  %to44 = load ptr, ptr %to, align 8, !dbg !144
+  store ptr %to44, ptr %buffer, align 8, !dbg !144
+  call void @llvm.dbg.declare(metadata ptr %sorted, metadata !114, metadata !DIExpression()), !dbg !145
+  %from45 = load ptr, ptr %from, align 8, !dbg !146
+  %to46 = load ptr, ptr %to, align 8, !dbg !146
+  %count47 = load i64, ptr %count, align 8, !dbg !146
+  %elem_ptr48 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 0, !dbg !147
+  %call49 = call fastcc ptr @"radix_pass<u8>"(ptr %from45, ptr %to46, i64 %count47, ptr %elem_ptr48, i64 1), !dbg !147
+  store ptr %call49, ptr %sorted, align 8, !dbg !147
+  %bytes50 = load i64, ptr %bytes.addr, align 8, !dbg !148
+  %gt = icmp ugt i64 %bytes50, 1, !dbg !148
+  br i1 %gt, label %if.then51, label %if.else52, !dbg !148
+
+for.cond14:                                       ; preds = %for.post16, %for.body6
+  %pass18 = load i64, ptr %pass, align 8, !dbg !149
+  %bytes19 = load i64, ptr %bytes.addr, align 8, !dbg !149
+  %lt20 = icmp ult i64 %pass18, %bytes19, !dbg !149
+  br i1 %lt20, label %for.body15, label %for.end17, !dbg !149
+
+for.body15:                                       ; preds = %for.cond14
+  %pass21 = load i64, ptr %pass, align 8, !dbg !150
+  %mul22 = mul i64 %pass21, 256, !dbg !150
+  %key23 = load i64, ptr %key, align 8, !dbg !151
+  %rem = urem i64 %key23, 256, !dbg !151
+  %add = add i64 %mul22, %rem, !dbg !151
+  %elem_ptr24 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 %add, !dbg !151
+  %arr_elem25 = load i64, ptr %elem_ptr24, align 8, !dbg !151
+  %add26 = add i64 %arr_elem25, 1, !dbg !151
+  %pass27 = load i64, ptr %pass, align 8, !dbg !150
+  %mul28 = mul i64 %pass27, 256, !dbg !150
+  %key29 = load i64, ptr %key, align 8, !dbg !151
+  %rem30 = urem i64 %key29, 256, !dbg !151
+  %add31 = add i64 %mul28, %rem30, !dbg !151
+  %elem_ptr32 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 %add31, !dbg !151
+  store i64 %add26, ptr %elem_ptr32, align 8, !dbg !151
+  %key33 = load i64, ptr %key, align 8, !dbg !152
+  %div = udiv i64 %key33, 256, !dbg !152
+  store i64 %div, ptr %key, align 8, !dbg !152
+  br label %for.post16, !dbg !152
+
+for.post16:                                       ; preds = %for.body15
+  %inc_dec.load34 = load i64, ptr %pass, align 8, !dbg !153
+  %inc35 = add i64 %inc_dec.load34, 1, !dbg !153
+  store i64 %inc35, ptr %pass, align 8, !dbg !153
+  br label %for.cond14, !dbg !153, !llvm.loop !154
+
+for.end17:                                        ; preds = %for.cond14
+  br label %for.post7, !dbg !153
+
+if.then51:                                        ; preds = %for.end8
+  %sorted54 = load ptr, ptr %sorted, align 8, !dbg !155
+  %sorted55 = load ptr, ptr %sorted, align 8, !dbg !156
+  %from56 = load ptr, ptr %from, align 8, !dbg !156
+  %to57 = load ptr, ptr %to, align 8, !dbg !156
+  %call58 = call fastcc ptr @"other_buffer<u8>"(ptr %sorted55, ptr %from56, ptr %to57), !dbg !156
+  %count59 = load i64, ptr %count, align 8, !dbg !156
+  %elem_ptr60 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 256, !dbg !157
+  %call61 = call fastcc ptr @"radix_pass<u8>"(ptr %sorted54, ptr %call58, i64 %count59, ptr %elem_ptr60, i64 256), !dbg !157
+  store ptr %call61, ptr %sorted, align 8, !dbg !157
+  br label %if.join53, !dbg !157
+
+if.else52:                                        ; preds = %for.end8
+  br label %if.join53, !dbg !157
+
+if.join53:                                        ; preds = %if.else52, %if.then51
+  %bytes62 = load i64, ptr %bytes.addr, align 8, !dbg !158
+  %gt63 = icmp ugt i64 %bytes62, 2, !dbg !158
+  br i1 %gt63, label %if.then64, label %if.else65, !dbg !158
+
+if.then64:                                        ; preds = %if.join53
+  %sorted67 = load ptr, ptr %sorted, align 8, !dbg !159
+  %sorted68 = load ptr, ptr %sorted, align 8, !dbg !160
+  %from69 = load ptr, ptr %from, align 8, !dbg !160
+  %to70 = load ptr, ptr %to, align 8, !dbg !160
+  %call71 = call fastcc ptr @"other_buffer<u8>"(ptr %sorted68, ptr %from69, ptr %to70), !dbg !160
+  %count72 = load i64, ptr %count, align 8, !dbg !160
+  %elem_ptr73 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 512, !dbg !161
+  %call74 = call fastcc ptr @"radix_pass<u8>"(ptr %sorted67, ptr %call71, i64 %count72, ptr %elem_ptr73, i64 65536), !dbg !161
+  store ptr %call74, ptr %sorted, align 8, !dbg !161
+  %sorted75 = load ptr, ptr %sorted, align 8, !dbg !162
+  %sorted76 = load ptr, ptr %sorted, align 8, !dbg !163
+  %from77 = load ptr, ptr %from, align 8, !dbg !163
+  %to78 = load ptr, ptr %to, align 8, !dbg !163
+  %call79 = call fastcc ptr @"other_buffer<u8>"(ptr %sorted76, ptr %from77, ptr %to78), !dbg !163
+  %count80 = load i64, ptr %count, align 8, !dbg !163
+  %elem_ptr81 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 768, !dbg !164
+  %call82 = call fastcc ptr @"radix_pass<u8>"(ptr %sorted75, ptr %call79, i64 %count80, ptr %elem_ptr81, i64 16777216), !dbg !164
+  store ptr %call82, ptr %sorted, align 8, !dbg !164
+  br label %if.join66, !dbg !164
+
+if.else65:                                        ; preds = %if.join53
+  br label %if.join66, !dbg !164
+
+if.join66:                                        ; preds = %if.else65, %if.then64
+  %bytes83 = load i64, ptr %bytes.addr, align 8, !dbg !165
+  %gt84 = icmp ugt i64 %bytes83, 4, !dbg !165
+  br i1 %gt84, label %if.then85, label %if.else86, !dbg !165
+
+if.then85:                                        ; preds = %if.join66
+  %sorted88 = load ptr, ptr %sorted, align 8, !dbg !166
+  %sorted89 = load ptr, ptr %sorted, align 8, !dbg !167
+  %from90 = load ptr, ptr %from, align 8, !dbg !167
+  %to91 = load ptr, ptr %to, align 8, !dbg !167
+  %call92 = call fastcc ptr @"other_buffer<u8>"(ptr %sorted89, ptr %from90, ptr %to91), !dbg !167
+  %count93 = load i64, ptr %count, align 8, !dbg !167
+  %elem_ptr94 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 1024, !dbg !168
+  %call95 = call fastcc ptr @"radix_pass<u8>"(ptr %sorted88, ptr %call92, i64 %count93, ptr %elem_ptr94, i64 4294967296), !dbg !168
+  store ptr %call95, ptr %sorted, align 8, !dbg !168
+  %sorted96 = load ptr, ptr %sorted, align 8, !dbg !169
+  %sorted97 = load ptr, ptr %sorted, align 8, !dbg !170
+  %from98 = load ptr, ptr %from, align 8, !dbg !170
+  %to99 = load ptr, ptr %to, align 8, !dbg !170
+  %call100 = call fastcc ptr @"other_buffer<u8>"(ptr %sorted97, ptr %from98, ptr %to99), !dbg !170
+  %count101 = load i64, ptr %count, align 8, !dbg !170
+  %elem_ptr102 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 1280, !dbg !171
+  %call103 = call fastcc ptr @"radix_pass<u8>"(ptr %sorted96, ptr %call100, i64 %count101, ptr %elem_ptr102, i64 1099511627776), !dbg !171
+  store ptr %call103, ptr %sorted, align 8, !dbg !171
+  %sorted104 = load ptr, ptr %sorted, align 8, !dbg !172
+  %sorted105 = load ptr, ptr %sorted, align 8, !dbg !173
+  %from106 = load ptr, ptr %from, align 8, !dbg !173
+  %to107 = load ptr, ptr %to, align 8, !dbg !173
+  %call108 = call fastcc ptr @"other_buffer<u8>"(ptr %sorted105, ptr %from106, ptr %to107), !dbg !173
+  %count109 = load i64, ptr %count, align 8, !dbg !173
+  %elem_ptr110 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 1536, !dbg !174
+  %call111 = call fastcc ptr @"radix_pass<u8>"(ptr %sorted104, ptr %call108, i64 %count109, ptr %elem_ptr110, i64 281474976710656), !dbg !174
+  store ptr %call111, ptr %sorted, align 8, !dbg !174
+  %sorted112 = load ptr, ptr %sorted, align 8, !dbg !175
+  %sorted113 = load ptr, ptr %sorted, align 8, !dbg !176
+  %from114 = load ptr, ptr %from, align 8, !dbg !176
+  %to115 = load ptr, ptr %to, align 8, !dbg !176
+  %call116 = call fastcc ptr @"other_buffer<u8>"(ptr %sorted113, ptr %from114, ptr %to115), !dbg !176
+  %count117 = load i64, ptr %count, align 8, !dbg !176
+  %elem_ptr118 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 1792, !dbg !177
+  %call119 = call fastcc ptr @"radix_pass<u8>"(ptr %sorted112, ptr %call116, i64 %count117, ptr %elem_ptr118, i64 72057594037927936), !dbg !177
+  store ptr %call119, ptr %sorted, align 8, !dbg !177
+  br label %if.join87, !dbg !177
+
+if.else86:                                        ; preds = %if.join66
+  br label %if.join87, !dbg !177
+
+if.join87:                                        ; preds = %if.else86, %if.then85
+  %sorted120 = load ptr, ptr %sorted, align 8, !dbg !178
+  %from121 = load ptr, ptr %from, align 8, !dbg !178
+  %ne = icmp ne ptr %sorted120, %from121, !dbg !178
+  br i1 %ne, label %if.then122, label %if.else123, !dbg !178
+
+if.then122:                                       ; preds = %if.join87
+  %from125 = load ptr, ptr %from, align 8, !dbg !179
+  %sorted126 = load ptr, ptr %sorted, align 8, !dbg !179
+  %count127 = load i64, ptr %count, align 8, !dbg !180
+  %size128 = load i64, ptr %size, align 8, !dbg !180
+  %mul129 = mul i64 %count127, %size128, !dbg !180
+  %call130 = call ptr @memcpy(ptr %from125, ptr %sorted126, i64 %mul129), !dbg !180
+  br label %if.join124, !dbg !180
+
+if.else123:                                       ; preds = %if.join87
+  br label %if.join124, !dbg !180
+
+if.join124:                                       ; preds = %if.else123, %if.then122
+  %buffer131 = load ptr, ptr %buffer, align 8, !dbg !181
+  call void @Std.Collections.collection_free(ptr %buffer131), !dbg !181
+  ret void, !dbg !181
+}
+
+; Function Attrs: nounwind
+define internal fastcc void @"radix_sort_bytes<u16>"(%view %0, i64 %1) #0 !dbg !182 {
+entry:
+  %sorted = alloca ptr, align 8, !dbg !203
+  %buffer = alloca ptr, align 8, !dbg !203
+  %to = alloca ptr, align 8, !dbg !203
+  %from = alloca ptr, align 8, !dbg !203
+  %size = alloca i64, align 8, !dbg !203
+  %none = alloca ptr, align 8, !dbg !203
+  %pass = alloca i64, align 8, !dbg !203
+  %key = alloca i64, align 8, !dbg !203
+  %i = alloca i64, align 8, !dbg !203
+  %slot = alloca i64, align 8, !dbg !203
+  %counts = alloca [2048 x i64], align 8, !dbg !203
+  %count = alloca i64, align 8, !dbg !203
+  %v.addr = alloca %view, align 8, !dbg !203
+  store %view %0, ptr %v.addr, align 8, !dbg !203
+  call void @llvm.dbg.declare(metadata ptr %v.addr, metadata !189, metadata !DIExpression()), !dbg !204
+  %bytes.addr = alloca i64, align 8, !dbg !203
+  store i64 %1, ptr %bytes.addr, align 8, !dbg !203
+  call void @llvm.dbg.declare(metadata ptr %bytes.addr, metadata !190, metadata !DIExpression()), !dbg !205
+  call void @llvm.dbg.declare(metadata ptr %count, metadata !191, metadata !DIExpression()), !dbg !206
+  %view_len_ptr = getelementptr inbounds %view, ptr %v.addr, i32 0, i32 0, !dbg !207
+  %view_len = load i64, ptr %view_len_ptr, align 8, !dbg !207
+  store i64 %view_len, ptr %count, align 8, !dbg !207
+  %count1 = load i64, ptr %count, align 8, !dbg !208
+  %lt = icmp ult i64 %count1, 2, !dbg !208
+  br i1 %lt, label %if.then, label %if.else, !dbg !208
+
+if.then:                                          ; preds = %entry
+  ret void, !dbg !209
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !209
+
+if.join:                                          ; preds = %if.else
+  call void @llvm.dbg.declare(metadata ptr %counts, metadata !192, metadata !DIExpression()), !dbg !210
+  call void @llvm.dbg.declare(metadata ptr %slot, metadata !193, metadata !DIExpression()), !dbg !211
+  store i64 0, ptr %slot, align 8, !dbg !211
+  br label %for.cond, !dbg !211
+
+for.cond:                                         ; preds = %for.post, %if.join
+  %slot2 = load i64, ptr %slot, align 8, !dbg !212
+  %bytes = load i64, ptr %bytes.addr, align 8, !dbg !213
+  %mul = mul i64 256, %bytes, !dbg !213
+  %lt3 = icmp ult i64 %slot2, %mul, !dbg !213
+  br i1 %lt3, label %for.body, label %for.end, !dbg !213
+
+for.body:                                         ; preds = %for.cond
+  %slot4 = load i64, ptr %slot, align 8, !dbg !214
+  %elem_ptr = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 %slot4, !dbg !214
+  store i64 0, ptr %elem_ptr, align 8, !dbg !214
+  br label %for.post, !dbg !214
+
+for.post:                                         ; preds = %for.body
+  %inc_dec.load = load i64, ptr %slot, align 8, !dbg !215
+  %inc = add i64 %inc_dec.load, 1, !dbg !215
+  store i64 %inc, ptr %slot, align 8, !dbg !215
+  br label %for.cond, !dbg !215, !llvm.loop !216
+
+for.end:                                          ; preds = %for.cond
+  call void @llvm.dbg.declare(metadata ptr %i, metadata !194, metadata !DIExpression()), !dbg !217
+  store i64 0, ptr %i, align 8, !dbg !217
+  %length_ptr = getelementptr inbounds %view, ptr %v.addr, i32 0, i32 0, !dbg !217
+  %data_ptr = getelementptr inbounds %view, ptr %v.addr, i32 0, i32 1, !dbg !217
+  %v.len = load i64, ptr %length_ptr, align 8, !dbg !217
+  %v.data = load ptr, ptr %data_ptr, align 8, !dbg !217
+  br label %for.cond5, !dbg !217
+
+for.cond5:                                        ; preds = %for.post7, %for.end
+  %i9 = load i64, ptr %i, align 8, !dbg !218
+  %count10 = load i64, ptr %count, align 8, !dbg !218
+  %lt11 = icmp ult i64 %i9, %count10, !dbg !218
+  br i1 %lt11, label %for.body6, label %for.end8, !dbg !218
+
+for.body6:                                        ; preds = %for.cond5
+  call void @llvm.dbg.declare(metadata ptr %key, metadata !195, metadata !DIExpression()), !dbg !219
+  %i12 = load i64, ptr %i, align 8, !dbg !220
+  %elem_ptr13 = getelementptr inbounds i16, ptr %v.data, i64 %i12, !dbg !220
+  %arr_elem = load i16, ptr %elem_ptr13, align 2, !dbg !220
+  %zext = zext i16 %arr_elem to i64, !dbg !220
+  store i64 %zext, ptr %key, align 8, !dbg !220
+  call void @llvm.dbg.declare(metadata ptr %pass, metadata !196, metadata !DIExpression()), !dbg !221
+  store i64 0, ptr %pass, align 8, !dbg !221
+  br label %for.cond14, !dbg !221
+
+for.post7:                                        ; preds = %for.end17
+  %inc_dec.load36 = load i64, ptr %i, align 8, !dbg !222
+  %inc37 = add i64 %inc_dec.load36, 1, !dbg !222
+  store i64 %inc37, ptr %i, align 8, !dbg !222
+  br label %for.cond5, !dbg !222, !llvm.loop !223
+
+for.end8:                                         ; preds = %for.cond5
+  call void @llvm.dbg.declare(metadata ptr %none, metadata !197, metadata !DIExpression()), !dbg !224
+  store ptr null, ptr %none, align 8, !dbg !224
+  call void @llvm.dbg.declare(metadata ptr %size, metadata !198, metadata !DIExpression()), !dbg !225
+  %none38 = load ptr, ptr %none, align 8, !dbg !226
+  %elem_ptr39 = getelementptr i16, ptr %none38, i64 1, !dbg !226
+  %ptr2int = ptrtoint ptr %elem_ptr39 to i64, !dbg !226
+  store i64 %ptr2int, ptr %size, align 8, !dbg !226
+  call void @llvm.dbg.declare(metadata ptr %from, metadata !199, metadata !DIExpression()), !dbg !227
+  %ptr_to_views_array_field = getelementptr inbounds %view, ptr %v.addr, i32 0, i32 1, !dbg !228
+  %array_ptr = load ptr, ptr %ptr_to_views_array_field, align 8, !dbg !228
+  %elem_ptr40 = getelementptr inbounds i16, ptr %array_ptr, i64 0, !dbg !228
+  store ptr %elem_ptr40, ptr %from, align 8, !dbg !228
+  call void @llvm.dbg.declare(metadata ptr %to, metadata !200, metadata !DIExpression()), !dbg !229
+  %count41 = load i64, ptr %count, align 8, !dbg !230
+  %size42 = load i64, ptr %size, align 8, !dbg !230
+  %mul43 = mul i64 %count41, %size42, !dbg !230
+  %call = call ptr @Std.Collections.collection_allocate(i64 %mul43), !dbg !230
+  store ptr %call, ptr %to, align 8, !dbg !230
+  call void @llvm.dbg.declare(metadata ptr %buffer, metadata !201, metadata !DIExpression()), !dbg !231
+  %to44 = load ptr, ptr %to, align 8, !dbg !231
+  store ptr %to44, ptr %buffer, align 8, !dbg !231
+  call void @llvm.dbg.declare(metadata ptr %sorted, metadata !202, metadata !DIExpression()), !dbg !232
+  %from45 = load ptr, ptr %from, align 8, !dbg !233
+  %to46 = load ptr, ptr %to, align 8, !dbg !233
+  %count47 = load i64, ptr %count, align 8, !dbg !233
+  %elem_ptr48 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 0, !dbg !234
+  %call49 = call fastcc ptr @"radix_pass<u16>"(ptr %from45, ptr %to46, i64 %count47, ptr %elem_ptr48, i64 1), !dbg !234
+  store ptr %call49, ptr %sorted, align 8, !dbg !234
+  %bytes50 = load i64, ptr %bytes.addr, align 8, !dbg !235
+  %gt = icmp ugt i64 %bytes50, 1, !dbg !235
+  br i1 %gt, label %if.then51, label %if.else52, !dbg !235
+
+for.cond14:                                       ; preds = %for.post16, %for.body6
+  %pass18 = load i64, ptr %pass, align 8, !dbg !236
+  %bytes19 = load i64, ptr %bytes.addr, align 8, !dbg !236
+  %lt20 = icmp ult i64 %pass18, %bytes19, !dbg !236
+  br i1 %lt20, label %for.body15, label %for.end17, !dbg !236
+
+for.body15:                                       ; preds = %for.cond14
+  %pass21 = load i64, ptr %pass, align 8, !dbg !237
+  %mul22 = mul i64 %pass21, 256, !dbg !237
+  %key23 = load i64, ptr %key, align 8, !dbg !238
+  %rem = urem i64 %key23, 256, !dbg !238
+  %add = add i64 %mul22, %rem, !dbg !238
+  %elem_ptr24 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 %add, !dbg !238
+  %arr_elem25 = load i64, ptr %elem_ptr24, align 8, !dbg !238
+  %add26 = add i64 %arr_elem25, 1, !dbg !238
+  %pass27 = load i64, ptr %pass, align 8, !dbg !237
+  %mul28 = mul i64 %pass27, 256, !dbg !237
+  %key29 = load i64, ptr %key, align 8, !dbg !238
+  %rem30 = urem i64 %key29, 256, !dbg !238
+  %add31 = add i64 %mul28, %rem30, !dbg !238
+  %elem_ptr32 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 %add31, !dbg !238
+  store i64 %add26, ptr %elem_ptr32, align 8, !dbg !238
+  %key33 = load i64, ptr %key, align 8, !dbg !239
+  %div = udiv i64 %key33, 256, !dbg !239
+  store i64 %div, ptr %key, align 8, !dbg !239
+  br label %for.post16, !dbg !239
+
+for.post16:                                       ; preds = %for.body15
+  %inc_dec.load34 = load i64, ptr %pass, align 8, !dbg !240
+  %inc35 = add i64 %inc_dec.load34, 1, !dbg !240
+  store i64 %inc35, ptr %pass, align 8, !dbg !240
+  br label %for.cond14, !dbg !240, !llvm.loop !241
+
+for.end17:                                        ; preds = %for.cond14
+  br label %for.post7, !dbg !240
+
+if.then51:                                        ; preds = %for.end8
+  %sorted54 = load ptr, ptr %sorted, align 8, !dbg !242
+  %sorted55 = load ptr, ptr %sorted, align 8, !dbg !243
+  %from56 = load ptr, ptr %from, align 8, !dbg !243
+  %to57 = load ptr, ptr %to, align 8, !dbg !243
+  %call58 = call fastcc ptr @"other_buffer<u16>"(ptr %sorted55, ptr %from56, ptr %to57), !dbg !243
+  %count59 = load i64, ptr %count, align 8, !dbg !243
+  %elem_ptr60 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 256, !dbg !244
+  %call61 = call fastcc ptr @"radix_pass<u16>"(ptr %sorted54, ptr %call58, i64 %count59, ptr %elem_ptr60, i64 256), !dbg !244
+  store ptr %call61, ptr %sorted, align 8, !dbg !244
+  br label %if.join53, !dbg !244
+
+if.else52:                                        ; preds = %for.end8
+  br label %if.join53, !dbg !244
+
+if.join53:                                        ; preds = %if.else52, %if.then51
+  %bytes62 = load i64, ptr %bytes.addr, align 8, !dbg !245
+  %gt63 = icmp ugt i64 %bytes62, 2, !dbg !245
+  br i1 %gt63, label %if.then64, label %if.else65, !dbg !245
+
+if.then64:                                        ; preds = %if.join53
+  %sorted67 = load ptr, ptr %sorted, align 8, !dbg !246
+  %sorted68 = load ptr, ptr %sorted, align 8, !dbg !247
+  %from69 = load ptr, ptr %from, align 8, !dbg !247
+  %to70 = load ptr, ptr %to, align 8, !dbg !247
+  %call71 = call fastcc ptr @"other_buffer<u16>"(ptr %sorted68, ptr %from69, ptr %to70), !dbg !247
+  %count72 = load i64, ptr %count, align 8, !dbg !247
+  %elem_ptr73 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 512, !dbg !248
+  %call74 = call fastcc ptr @"radix_pass<u16>"(ptr %sorted67, ptr %call71, i64 %count72, ptr %elem_ptr73, i64 65536), !dbg !248
+  store ptr %call74, ptr %sorted, align 8, !dbg !248
+  %sorted75 = load ptr, ptr %sorted, align 8, !dbg !249
+  %sorted76 = load ptr, ptr %sorted, align 8, !dbg !250
+  %from77 = load ptr, ptr %from, align 8, !dbg !250
+  %to78 = load ptr, ptr %to, align 8, !dbg !250
+  %call79 = call fastcc ptr @"other_buffer<u16>"(ptr %sorted76, ptr %from77, ptr %to78), !dbg !250
+  %count80 = load i64, ptr %count, align 8, !dbg !250
+  %elem_ptr81 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 768, !dbg !251
+  %call82 = call fastcc ptr @"radix_pass<u16>"(ptr %sorted75, ptr %call79, i64 %count80, ptr %elem_ptr81, i64 16777216), !dbg !251
+  store ptr %call82, ptr %sorted, align 8, !dbg !251
+  br label %if.join66, !dbg !251
+
+if.else65:                                        ; preds = %if.join53
+  br label %if.join66, !dbg !251
+
+if.join66:                                        ; preds = %if.else65, %if.then64
+  %bytes83 = load i64, ptr %bytes.addr, align 8, !dbg !252
+  %gt84 = icmp ugt i64 %bytes83, 4, !dbg !252
+  br i1 %gt84, label %if.then85, label %if.else86, !dbg !252
+
+if.then85:                                        ; preds = %if.join66
+  %sorted88 = load ptr, ptr %sorted, align 8, !dbg !253
+  %sorted89 = load ptr, ptr %sorted, align 8, !dbg !254
+  %from90 = load ptr, ptr %from, align 8, !dbg !254
+  %to91 = load ptr, ptr %to, align 8, !dbg !254
+  %call92 = call fastcc ptr @"other_buffer<u16>"(ptr %sorted89, ptr %from90, ptr %to91), !dbg !254
+  %count93 = load i64, ptr %count, align 8, !dbg !254
+  %elem_ptr94 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 1024, !dbg !255
+  %call95 = call fastcc ptr @"radix_pass<u16>"(ptr %sorted88, ptr %call92, i64 %count93, ptr %elem_ptr94, i64 4294967296), !dbg !255
+  store ptr %call95, ptr %sorted, align 8, !dbg !255
+  %sorted96 = load ptr, ptr %sorted, align 8, !dbg !256
+  %sorted97 = load ptr, ptr %sorted, align 8, !dbg !257
+  %from98 = load ptr, ptr %from, align 8, !dbg !257
+  %to99 = load ptr, ptr %to, align 8, !dbg !257
+  %call100 = call fastcc ptr @"other_buffer<u16>"(ptr %sorted97, ptr %from98, ptr %to99), !dbg !257
+  %count101 = load i64, ptr %count, align 8, !dbg !257
+  %elem_ptr102 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 1280, !dbg !258
+  %call103 = call fastcc ptr @"radix_pass<u16>"(ptr %sorted96, ptr %call100, i64 %count101, ptr %elem_ptr102, i64 1099511627776), !dbg !258
+  store ptr %call103, ptr %sorted, align 8, !dbg !258
+  %sorted104 = load ptr, ptr %sorted, align 8, !dbg !259
+  %sorted105 = load ptr, ptr %sorted, align 8, !dbg !260
+  %from106 = load ptr, ptr %from, align 8, !dbg !260
+  %to107 = load ptr, ptr %to, align 8, !dbg !260
+  %call108 = call fastcc ptr @"other_buffer<u16>"(ptr %sorted105, ptr %from106, ptr %to107), !dbg !260
+  %count109 = load i64, ptr %count, align 8, !dbg !260
+  %elem_ptr110 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 1536, !dbg !261
+  %call111 = call fastcc ptr @"radix_pass<u16>"(ptr %sorted104, ptr %call108, i64 %count109, ptr %elem_ptr110, i64 281474976710656), !dbg !261
+  store ptr %call111, ptr %sorted, align 8, !dbg !261
+  %sorted112 = load ptr, ptr %sorted, align 8, !dbg !262
+  %sorted113 = load ptr, ptr %sorted, align 8, !dbg !263
+  %from114 = load ptr, ptr %from, align 8, !dbg !263
+  %to115 = load ptr, ptr %to, align 8, !dbg !263
+  %call116 = call fastcc ptr @"other_buffer<u16>"(ptr %sorted113, ptr %from114, ptr %to115), !dbg !263
+  %count117 = load i64, ptr %count, align 8, !dbg !263
+  %elem_ptr118 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 1792, !dbg !264
+  %call119 = call fastcc ptr @"radix_pass<u16>"(ptr %sorted112, ptr %call116, i64 %count117, ptr %elem_ptr118, i64 72057594037927936), !dbg !264
+  store ptr %call119, ptr %sorted, align 8, !dbg !264
+  br label %if.join87, !dbg !264
+
+if.else86:                                        ; preds = %if.join66
+  br label %if.join87, !dbg !264
+
+if.join87:                                        ; preds = %if.else86, %if.then85
+  %sorted120 = load ptr, ptr %sorted, align 8, !dbg !265
+  %from121 = load ptr, ptr %from, align 8, !dbg !265
+  %ne = icmp ne ptr %sorted120, %from121, !dbg !265
+  br i1 %ne, label %if.then122, label %if.else123, !dbg !265
+
+if.then122:                                       ; preds = %if.join87
+  %from125 = load ptr, ptr %from, align 8, !dbg !266
+  %sorted126 = load ptr, ptr %sorted, align 8, !dbg !266
+  %count127 = load i64, ptr %count, align 8, !dbg !267
+  %size128 = load i64, ptr %size, align 8, !dbg !267
+  %mul129 = mul i64 %count127, %size128, !dbg !267
+  %call130 = call ptr @memcpy(ptr %from125, ptr %sorted126, i64 %mul129), !dbg !267
+  br label %if.join124, !dbg !267
+
+if.else123:                                       ; preds = %if.join87
+  br label %if.join124, !dbg !267
+
+if.join124:                                       ; preds = %if.else123, %if.then122
+  %buffer131 = load ptr, ptr %buffer, align 8, !dbg !268
+  call void @Std.Collections.collection_free(ptr %buffer131), !dbg !268
+  ret void, !dbg !268
+}
+
+; Function Attrs: nounwind
+define internal fastcc void @"radix_sort_bytes<u32>"(%view %0, i64 %1) #0 !dbg !269 {
+entry:
+  %sorted = alloca ptr, align 8, !dbg !290
+  %buffer = alloca ptr, align 8, !dbg !290
+  %to = alloca ptr, align 8, !dbg !290
+  %from = alloca ptr, align 8, !dbg !290
+  %size = alloca i64, align 8, !dbg !290
+  %none = alloca ptr, align 8, !dbg !290
+  %pass = alloca i64, align 8, !dbg !290
+  %key = alloca i64, align 8, !dbg !290
+  %i = alloca i64, align 8, !dbg !290
+  %slot = alloca i64, align 8, !dbg !290
+  %counts = alloca [2048 x i64], align 8, !dbg !290
+  %count = alloca i64, align 8, !dbg !290
+  %v.addr = alloca %view, align 8, !dbg !290
+  store %view %0, ptr %v.addr, align 8, !dbg !290
+  call void @llvm.dbg.declare(metadata ptr %v.addr, metadata !276, metadata !DIExpression()), !dbg !291
+  %bytes.addr = alloca i64, align 8, !dbg !290
+  store i64 %1, ptr %bytes.addr, align 8, !dbg !290
+  call void @llvm.dbg.declare(metadata ptr %bytes.addr, metadata !277, metadata !DIExpression()), !dbg !292
+  call void @llvm.dbg.declare(metadata ptr %count, metadata !278, metadata !DIExpression()), !dbg !293
+  %view_len_ptr = getelementptr inbounds %view, ptr %v.addr, i32 0, i32 0, !dbg !294
+  %view_len = load i64, ptr %view_len_ptr, align 8, !dbg !294
+  store i64 %view_len, ptr %count, align 8, !dbg !294
+  %count1 = load i64, ptr %count, align 8, !dbg !295
+  %lt = icmp ult i64 %count1, 2, !dbg !295
+  br i1 %lt, label %if.then, label %if.else, !dbg !295
+
+if.then:                                          ; preds = %entry
+  ret void, !dbg !296
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !296
+
+if.join:                                          ; preds = %if.else
+  call void @llvm.dbg.declare(metadata ptr %counts, metadata !279, metadata !DIExpression()), !dbg !297
+  call void @llvm.dbg.declare(metadata ptr %slot, metadata !280, metadata !DIExpression()), !dbg !298
+  store i64 0, ptr %slot, align 8, !dbg !298
+  br label %for.cond, !dbg !298
+
+for.cond:                                         ; preds = %for.post, %if.join
+  %slot2 = load i64, ptr %slot, align 8, !dbg !299
+  %bytes = load i64, ptr %bytes.addr, align 8, !dbg !300
+  %mul = mul i64 256, %bytes, !dbg !300
+  %lt3 = icmp ult i64 %slot2, %mul, !dbg !300
+  br i1 %lt3, label %for.body, label %for.end, !dbg !300
+
+for.body:                                         ; preds = %for.cond
+  %slot4 = load i64, ptr %slot, align 8, !dbg !301
+  %elem_ptr = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 %slot4, !dbg !301
+  store i64 0, ptr %elem_ptr, align 8, !dbg !301
+  br label %for.post, !dbg !301
+
+for.post:                                         ; preds = %for.body
+  %inc_dec.load = load i64, ptr %slot, align 8, !dbg !302
+  %inc = add i64 %inc_dec.load, 1, !dbg !302
+  store i64 %inc, ptr %slot, align 8, !dbg !302
+  br label %for.cond, !dbg !302, !llvm.loop !303
+
+for.end:                                          ; preds = %for.cond
+  call void @llvm.dbg.declare(metadata ptr %i, metadata !281, metadata !DIExpression()), !dbg !304
+  store i64 0, ptr %i, align 8, !dbg !304
+  %length_ptr = getelementptr inbounds %view, ptr %v.addr, i32 0, i32 0, !dbg !304
+  %data_ptr = getelementptr inbounds %view, ptr %v.addr, i32 0, i32 1, !dbg !304
+  %v.len = load i64, ptr %length_ptr, align 8, !dbg !304
+  %v.data = load ptr, ptr %data_ptr, align 8, !dbg !304
+  br label %for.cond5, !dbg !304
+
+for.cond5:                                        ; preds = %for.post7, %for.end
+  %i9 = load i64, ptr %i, align 8, !dbg !305
+  %count10 = load i64, ptr %count, align 8, !dbg !305
+  %lt11 = icmp ult i64 %i9, %count10, !dbg !305
+  br i1 %lt11, label %for.body6, label %for.end8, !dbg !305
+
+for.body6:                                        ; preds = %for.cond5
+  call void @llvm.dbg.declare(metadata ptr %key, metadata !282, metadata !DIExpression()), !dbg !306
+  %i12 = load i64, ptr %i, align 8, !dbg !307
+  %elem_ptr13 = getelementptr inbounds i32, ptr %v.data, i64 %i12, !dbg !307
+  %arr_elem = load i32, ptr %elem_ptr13, align 4, !dbg !307
+  %zext = zext i32 %arr_elem to i64, !dbg !307
+  store i64 %zext, ptr %key, align 8, !dbg !307
+  call void @llvm.dbg.declare(metadata ptr %pass, metadata !283, metadata !DIExpression()), !dbg !308
+  store i64 0, ptr %pass, align 8, !dbg !308
+  br label %for.cond14, !dbg !308
+
+for.post7:                                        ; preds = %for.end17
+  %inc_dec.load36 = load i64, ptr %i, align 8, !dbg !309
+  %inc37 = add i64 %inc_dec.load36, 1, !dbg !309
+  store i64 %inc37, ptr %i, align 8, !dbg !309
+  br label %for.cond5, !dbg !309, !llvm.loop !310
+
+for.end8:                                         ; preds = %for.cond5
+  call void @llvm.dbg.declare(metadata ptr %none, metadata !284, metadata !DIExpression()), !dbg !311
+  store ptr null, ptr %none, align 8, !dbg !311
+  call void @llvm.dbg.declare(metadata ptr %size, metadata !285, metadata !DIExpression()), !dbg !312
+  %none38 = load ptr, ptr %none, align 8, !dbg !313
+  %elem_ptr39 = getelementptr i32, ptr %none38, i64 1, !dbg !313
+  %ptr2int = ptrtoint ptr %elem_ptr39 to i64, !dbg !313
+  store i64 %ptr2int, ptr %size, align 8, !dbg !313
+  call void @llvm.dbg.declare(metadata ptr %from, metadata !286, metadata !DIExpression()), !dbg !314
+  %ptr_to_views_array_field = getelementptr inbounds %view, ptr %v.addr, i32 0, i32 1, !dbg !315
+  %array_ptr = load ptr, ptr %ptr_to_views_array_field, align 8, !dbg !315
+  %elem_ptr40 = getelementptr inbounds i32, ptr %array_ptr, i64 0, !dbg !315
+  store ptr %elem_ptr40, ptr %from, align 8, !dbg !315
+  call void @llvm.dbg.declare(metadata ptr %to, metadata !287, metadata !DIExpression()), !dbg !316
+  %count41 = load i64, ptr %count, align 8, !dbg !317
+  %size42 = load i64, ptr %size, align 8, !dbg !317
+  %mul43 = mul i64 %count41, %size42, !dbg !317
+  %call = call ptr @Std.Collections.collection_allocate(i64 %mul43), !dbg !317
+  store ptr %call, ptr %to, align 8, !dbg !317
+  call void @llvm.dbg.declare(metadata ptr %buffer, metadata !288, metadata !DIExpression()), !dbg !318
+  %to44 = load ptr, ptr %to, align 8, !dbg !318
+  store ptr %to44, ptr %buffer, align 8, !dbg !318
+  call void @llvm.dbg.declare(metadata ptr %sorted, metadata !289, metadata !DIExpression()), !dbg !319
+  %from45 = load ptr, ptr %from, align 8, !dbg !320
+  %to46 = load ptr, ptr %to, align 8, !dbg !320
+  %count47 = load i64, ptr %count, align 8, !dbg !320
+  %elem_ptr48 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 0, !dbg !321
+  %call49 = call fastcc ptr @"radix_pass<u32>"(ptr %from45, ptr %to46, i64 %count47, ptr %elem_ptr48, i64 1), !dbg !321
+  store ptr %call49, ptr %sorted, align 8, !dbg !321
+  %bytes50 = load i64, ptr %bytes.addr, align 8, !dbg !322
+  %gt = icmp ugt i64 %bytes50, 1, !dbg !322
+  br i1 %gt, label %if.then51, label %if.else52, !dbg !322
+
+for.cond14:                                       ; preds = %for.post16, %for.body6
+  %pass18 = load i64, ptr %pass, align 8, !dbg !323
+  %bytes19 = load i64, ptr %bytes.addr, align 8, !dbg !323
+  %lt20 = icmp ult i64 %pass18, %bytes19, !dbg !323
+  br i1 %lt20, label %for.body15, label %for.end17, !dbg !323
+
+for.body15:                                       ; preds = %for.cond14
+  %pass21 = load i64, ptr %pass, align 8, !dbg !324
+  %mul22 = mul i64 %pass21, 256, !dbg !324
+  %key23 = load i64, ptr %key, align 8, !dbg !325
+  %rem = urem i64 %key23, 256, !dbg !325
+  %add = add i64 %mul22, %rem, !dbg !325
+  %elem_ptr24 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 %add, !dbg !325
+  %arr_elem25 = load i64, ptr %elem_ptr24, align 8, !dbg !325
+  %add26 = add i64 %arr_elem25, 1, !dbg !325
+  %pass27 = load i64, ptr %pass, align 8, !dbg !324
+  %mul28 = mul i64 %pass27, 256, !dbg !324
+  %key29 = load i64, ptr %key, align 8, !dbg !325
+  %rem30 = urem i64 %key29, 256, !dbg !325
+  %add31 = add i64 %mul28, %rem30, !dbg !325
+  %elem_ptr32 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 %add31, !dbg !325
+  store i64 %add26, ptr %elem_ptr32, align 8, !dbg !325
+  %key33 = load i64, ptr %key, align 8, !dbg !326
+  %div = udiv i64 %key33, 256, !dbg !326
+  store i64 %div, ptr %key, align 8, !dbg !326
+  br label %for.post16, !dbg !326
+
+for.post16:                                       ; preds = %for.body15
+  %inc_dec.load34 = load i64, ptr %pass, align 8, !dbg !327
+  %inc35 = add i64 %inc_dec.load34, 1, !dbg !327
+  store i64 %inc35, ptr %pass, align 8, !dbg !327
+  br label %for.cond14, !dbg !327, !llvm.loop !328
+
+for.end17:                                        ; preds = %for.cond14
+  br label %for.post7, !dbg !327
+
+if.then51:                                        ; preds = %for.end8
+  %sorted54 = load ptr, ptr %sorted, align 8, !dbg !329
+  %sorted55 = load ptr, ptr %sorted, align 8, !dbg !330
+  %from56 = load ptr, ptr %from, align 8, !dbg !330
+  %to57 = load ptr, ptr %to, align 8, !dbg !330
+  %call58 = call fastcc ptr @"other_buffer<u32>"(ptr %sorted55, ptr %from56, ptr %to57), !dbg !330
+  %count59 = load i64, ptr %count, align 8, !dbg !330
+  %elem_ptr60 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 256, !dbg !331
+  %call61 = call fastcc ptr @"radix_pass<u32>"(ptr %sorted54, ptr %call58, i64 %count59, ptr %elem_ptr60, i64 256), !dbg !331
+  store ptr %call61, ptr %sorted, align 8, !dbg !331
+  br label %if.join53, !dbg !331
+
+if.else52:                                        ; preds = %for.end8
+  br label %if.join53, !dbg !331
+
+if.join53:                                        ; preds = %if.else52, %if.then51
+  %bytes62 = load i64, ptr %bytes.addr, align 8, !dbg !332
+  %gt63 = icmp ugt i64 %bytes62, 2, !dbg !332
+  br i1 %gt63, label %if.then64, label %if.else65, !dbg !332
+
+if.then64:                                        ; preds = %if.join53
+  %sorted67 = load ptr, ptr %sorted, align 8, !dbg !333
+  %sorted68 = load ptr, ptr %sorted, align 8, !dbg !334
+  %from69 = load ptr, ptr %from, align 8, !dbg !334
+  %to70 = load ptr, ptr %to, align 8, !dbg !334
+  %call71 = call fastcc ptr @"other_buffer<u32>"(ptr %sorted68, ptr %from69, ptr %to70), !dbg !334
+  %count72 = load i64, ptr %count, align 8, !dbg !334
+  %elem_ptr73 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 512, !dbg !335
+  %call74 = call fastcc ptr @"radix_pass<u32>"(ptr %sorted67, ptr %call71, i64 %count72, ptr %elem_ptr73, i64 65536), !dbg !335
+  store ptr %call74, ptr %sorted, align 8, !dbg !335
+  %sorted75 = load ptr, ptr %sorted, align 8, !dbg !336
+  %sorted76 = load ptr, ptr %sorted, align 8, !dbg !337
+  %from77 = load ptr, ptr %from, align 8, !dbg !337
+  %to78 = load ptr, ptr %to, align 8, !dbg !337
+  %call79 = call fastcc ptr @"other_buffer<u32>"(ptr %sorted76, ptr %from77, ptr %to78), !dbg !337
+  %count80 = load i64, ptr %count, align 8, !dbg !337
+  %elem_ptr81 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 768, !dbg !338
+  %call82 = call fastcc ptr @"radix_pass<u32>"(ptr %sorted75, ptr %call79, i64 %count80, ptr %elem_ptr81, i64 16777216), !dbg !338
+  store ptr %call82, ptr %sorted, align 8, !dbg !338
+  br label %if.join66, !dbg !338
+
+if.else65:                                        ; preds = %if.join53
+  br label %if.join66, !dbg !338
+
+if.join66:                                        ; preds = %if.else65, %if.then64
+  %bytes83 = load i64, ptr %bytes.addr, align 8, !dbg !339
+  %gt84 = icmp ugt i64 %bytes83, 4, !dbg !339
+  br i1 %gt84, label %if.then85, label %if.else86, !dbg !339
+
+if.then85:                                        ; preds = %if.join66
+  %sorted88 = load ptr, ptr %sorted, align 8, !dbg !340
+  %sorted89 = load ptr, ptr %sorted, align 8, !dbg !341
+  %from90 = load ptr, ptr %from, align 8, !dbg !341
+  %to91 = load ptr, ptr %to, align 8, !dbg !341
+  %call92 = call fastcc ptr @"other_buffer<u32>"(ptr %sorted89, ptr %from90, ptr %to91), !dbg !341
+  %count93 = load i64, ptr %count, align 8, !dbg !341
+  %elem_ptr94 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 1024, !dbg !342
+  %call95 = call fastcc ptr @"radix_pass<u32>"(ptr %sorted88, ptr %call92, i64 %count93, ptr %elem_ptr94, i64 4294967296), !dbg !342
+  store ptr %call95, ptr %sorted, align 8, !dbg !342
+  %sorted96 = load ptr, ptr %sorted, align 8, !dbg !343
+  %sorted97 = load ptr, ptr %sorted, align 8, !dbg !344
+  %from98 = load ptr, ptr %from, align 8, !dbg !344
+  %to99 = load ptr, ptr %to, align 8, !dbg !344
+  %call100 = call fastcc ptr @"other_buffer<u32>"(ptr %sorted97, ptr %from98, ptr %to99), !dbg !344
+  %count101 = load i64, ptr %count, align 8, !dbg !344
+  %elem_ptr102 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 1280, !dbg !345
+  %call103 = call fastcc ptr @"radix_pass<u32>"(ptr %sorted96, ptr %call100, i64 %count101, ptr %elem_ptr102, i64 1099511627776), !dbg !345
+  store ptr %call103, ptr %sorted, align 8, !dbg !345
+  %sorted104 = load ptr, ptr %sorted, align 8, !dbg !346
+  %sorted105 = load ptr, ptr %sorted, align 8, !dbg !347
+  %from106 = load ptr, ptr %from, align 8, !dbg !347
+  %to107 = load ptr, ptr %to, align 8, !dbg !347
+  %call108 = call fastcc ptr @"other_buffer<u32>"(ptr %sorted105, ptr %from106, ptr %to107), !dbg !347
+  %count109 = load i64, ptr %count, align 8, !dbg !347
+  %elem_ptr110 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 1536, !dbg !348
+  %call111 = call fastcc ptr @"radix_pass<u32>"(ptr %sorted104, ptr %call108, i64 %count109, ptr %elem_ptr110, i64 281474976710656), !dbg !348
+  store ptr %call111, ptr %sorted, align 8, !dbg !348
+  %sorted112 = load ptr, ptr %sorted, align 8, !dbg !349
+  %sorted113 = load ptr, ptr %sorted, align 8, !dbg !350
+  %from114 = load ptr, ptr %from, align 8, !dbg !350
+  %to115 = load ptr, ptr %to, align 8, !dbg !350
+  %call116 = call fastcc ptr @"other_buffer<u32>"(ptr %sorted113, ptr %from114, ptr %to115), !dbg !350
+  %count117 = load i64, ptr %count, align 8, !dbg !350
+  %elem_ptr118 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 1792, !dbg !351
+  %call119 = call fastcc ptr @"radix_pass<u32>"(ptr %sorted112, ptr %call116, i64 %count117, ptr %elem_ptr118, i64 72057594037927936), !dbg !351
+  store ptr %call119, ptr %sorted, align 8, !dbg !351
+  br label %if.join87, !dbg !351
+
+if.else86:                                        ; preds = %if.join66
+  br label %if.join87, !dbg !351
+
+if.join87:                                        ; preds = %if.else86, %if.then85
+  %sorted120 = load ptr, ptr %sorted, align 8, !dbg !352
+  %from121 = load ptr, ptr %from, align 8, !dbg !352
+  %ne = icmp ne ptr %sorted120, %from121, !dbg !352
+  br i1 %ne, label %if.then122, label %if.else123, !dbg !352
+
+if.then122:                                       ; preds = %if.join87
+  %from125 = load ptr, ptr %from, align 8, !dbg !353
+  %sorted126 = load ptr, ptr %sorted, align 8, !dbg !353
+  %count127 = load i64, ptr %count, align 8, !dbg !354
+  %size128 = load i64, ptr %size, align 8, !dbg !354
+  %mul129 = mul i64 %count127, %size128, !dbg !354
+  %call130 = call ptr @memcpy(ptr %from125, ptr %sorted126, i64 %mul129), !dbg !354
+  br label %if.join124, !dbg !354
+
+if.else123:                                       ; preds = %if.join87
+  br label %if.join124, !dbg !354
+
+if.join124:                                       ; preds = %if.else123, %if.then122
+  %buffer131 = load ptr, ptr %buffer, align 8, !dbg !355
+  call void @Std.Collections.collection_free(ptr %buffer131), !dbg !355
+  ret void, !dbg !355
+}
+
+; Function Attrs: nounwind
+define internal fastcc void @"radix_sort_bytes<u64>"(%view %0, i64 %1) #0 !dbg !356 {
+entry:
+  %sorted = alloca ptr, align 8, !dbg !377
+  %buffer = alloca ptr, align 8, !dbg !377
+  %to = alloca ptr, align 8, !dbg !377
+  %from = alloca ptr, align 8, !dbg !377
+  %size = alloca i64, align 8, !dbg !377
+  %none = alloca ptr, align 8, !dbg !377
+  %pass = alloca i64, align 8, !dbg !377
+  %key = alloca i64, align 8, !dbg !377
+  %i = alloca i64, align 8, !dbg !377
+  %slot = alloca i64, align 8, !dbg !377
+  %counts = alloca [2048 x i64], align 8, !dbg !377
+  %count = alloca i64, align 8, !dbg !377
+  %v.addr = alloca %view, align 8, !dbg !377
+  store %view %0, ptr %v.addr, align 8, !dbg !377
+  call void @llvm.dbg.declare(metadata ptr %v.addr, metadata !363, metadata !DIExpression()), !dbg !378
+  %bytes.addr = alloca i64, align 8, !dbg !377
+  store i64 %1, ptr %bytes.addr, align 8, !dbg !377
+  call void @llvm.dbg.declare(metadata ptr %bytes.addr, metadata !364, metadata !DIExpression()), !dbg !379
+  call void @llvm.dbg.declare(metadata ptr %count, metadata !365, metadata !DIExpression()), !dbg !380
+  %view_len_ptr = getelementptr inbounds %view, ptr %v.addr, i32 0, i32 0, !dbg !381
+  %view_len = load i64, ptr %view_len_ptr, align 8, !dbg !381
+  store i64 %view_len, ptr %count, align 8, !dbg !381
+  %count1 = load i64, ptr %count, align 8, !dbg !382
+  %lt = icmp ult i64 %count1, 2, !dbg !382
+  br i1 %lt, label %if.then, label %if.else, !dbg !382
+
+if.then:                                          ; preds = %entry
+  ret void, !dbg !383
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !383
+
+if.join:                                          ; preds = %if.else
+  call void @llvm.dbg.declare(metadata ptr %counts, metadata !366, metadata !DIExpression()), !dbg !384
+  call void @llvm.dbg.declare(metadata ptr %slot, metadata !367, metadata !DIExpression()), !dbg !385
+  store i64 0, ptr %slot, align 8, !dbg !385
+  br label %for.cond, !dbg !385
+
+for.cond:                                         ; preds = %for.post, %if.join
+  %slot2 = load i64, ptr %slot, align 8, !dbg !386
+  %bytes = load i64, ptr %bytes.addr, align 8, !dbg !387
+  %mul = mul i64 256, %bytes, !dbg !387
+  %lt3 = icmp ult i64 %slot2, %mul, !dbg !387
+  br i1 %lt3, label %for.body, label %for.end, !dbg !387
+
+for.body:                                         ; preds = %for.cond
+  %slot4 = load i64, ptr %slot, align 8, !dbg !388
+  %elem_ptr = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 %slot4, !dbg !388
+  store i64 0, ptr %elem_ptr, align 8, !dbg !388
+  br label %for.post, !dbg !388
+
+for.post:                                         ; preds = %for.body
+  %inc_dec.load = load i64, ptr %slot, align 8, !dbg !389
+  %inc = add i64 %inc_dec.load, 1, !dbg !389
+  store i64 %inc, ptr %slot, align 8, !dbg !389
+  br label %for.cond, !dbg !389, !llvm.loop !390
+
+for.end:                                          ; preds = %for.cond
+  call void @llvm.dbg.declare(metadata ptr %i, metadata !368, metadata !DIExpression()), !dbg !391
+  store i64 0, ptr %i, align 8, !dbg !391
+  %length_ptr = getelementptr inbounds %view, ptr %v.addr, i32 0, i32 0, !dbg !391
+  %data_ptr = getelementptr inbounds %view, ptr %v.addr, i32 0, i32 1, !dbg !391
+  %v.len = load i64, ptr %length_ptr, align 8, !dbg !391
+  %v.data = load ptr, ptr %data_ptr, align 8, !dbg !391
+  br label %for.cond5, !dbg !391
+
+for.cond5:                                        ; preds = %for.post7, %for.end
+  %i9 = load i64, ptr %i, align 8, !dbg !392
+  %count10 = load i64, ptr %count, align 8, !dbg !392
+  %lt11 = icmp ult i64 %i9, %count10, !dbg !392
+  br i1 %lt11, label %for.body6, label %for.end8, !dbg !392
+
+for.body6:                                        ; preds = %for.cond5
+  call void @llvm.dbg.declare(metadata ptr %key, metadata !369, metadata !DIExpression()), !dbg !393
+  %i12 = load i64, ptr %i, align 8, !dbg !394
+  %elem_ptr13 = getelementptr inbounds i64, ptr %v.data, i64 %i12, !dbg !394
+  %arr_elem = load i64, ptr %elem_ptr13, align 8, !dbg !394
+  store i64 %arr_elem, ptr %key, align 8, !dbg !394
+  call void @llvm.dbg.declare(metadata ptr %pass, metadata !370, metadata !DIExpression()), !dbg !395
+  store i64 0, ptr %pass, align 8, !dbg !395
+  br label %for.cond14, !dbg !395
+
+for.post7:                                        ; preds = %for.end17
+  %inc_dec.load36 = load i64, ptr %i, align 8, !dbg !396
+  %inc37 = add i64 %inc_dec.load36, 1, !dbg !396
+  store i64 %inc37, ptr %i, align 8, !dbg !396
+  br label %for.cond5, !dbg !396, !llvm.loop !397
+
+for.end8:                                         ; preds = %for.cond5
+  call void @llvm.dbg.declare(metadata ptr %none, metadata !371, metadata !DIExpression()), !dbg !398
+  store ptr null, ptr %none, align 8, !dbg !398
+  call void @llvm.dbg.declare(metadata ptr %size, metadata !372, metadata !DIExpression()), !dbg !399
+  %none38 = load ptr, ptr %none, align 8, !dbg !400
+  %elem_ptr39 = getelementptr i64, ptr %none38, i64 1, !dbg !400
+  %ptr2int = ptrtoint ptr %elem_ptr39 to i64, !dbg !400
+  store i64 %ptr2int, ptr %size, align 8, !dbg !400
+  call void @llvm.dbg.declare(metadata ptr %from, metadata !373, metadata !DIExpression()), !dbg !401
+  %ptr_to_views_array_field = getelementptr inbounds %view, ptr %v.addr, i32 0, i32 1, !dbg !402
+  %array_ptr = load ptr, ptr %ptr_to_views_array_field, align 8, !dbg !402
+  %elem_ptr40 = getelementptr inbounds i64, ptr %array_ptr, i64 0, !dbg !402
+  store ptr %elem_ptr40, ptr %from, align 8, !dbg !402
+  call void @llvm.dbg.declare(metadata ptr %to, metadata !374, metadata !DIExpression()), !dbg !403
+  %count41 = load i64, ptr %count, align 8, !dbg !404
+  %size42 = load i64, ptr %size, align 8, !dbg !404
+  %mul43 = mul i64 %count41, %size42, !dbg !404
+  %call = call ptr @Std.Collections.collection_allocate(i64 %mul43), !dbg !404
+  store ptr %call, ptr %to, align 8, !dbg !404
+  call void @llvm.dbg.declare(metadata ptr %buffer, metadata !375, metadata !DIExpression()), !dbg !405
+  %to44 = load ptr, ptr %to, align 8, !dbg !405
+  store ptr %to44, ptr %buffer, align 8, !dbg !405
+  call void @llvm.dbg.declare(metadata ptr %sorted, metadata !376, metadata !DIExpression()), !dbg !406
+  %from45 = load ptr, ptr %from, align 8, !dbg !407
+  %to46 = load ptr, ptr %to, align 8, !dbg !407
+  %count47 = load i64, ptr %count, align 8, !dbg !407
+  %elem_ptr48 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 0, !dbg !408
+  %call49 = call fastcc ptr @"radix_pass<u64>"(ptr %from45, ptr %to46, i64 %count47, ptr %elem_ptr48, i64 1), !dbg !408
+  store ptr %call49, ptr %sorted, align 8, !dbg !408
+  %bytes50 = load i64, ptr %bytes.addr, align 8, !dbg !409
+  %gt = icmp ugt i64 %bytes50, 1, !dbg !409
+  br i1 %gt, label %if.then51, label %if.else52, !dbg !409
+
+for.cond14:                                       ; preds = %for.post16, %for.body6
+  %pass18 = load i64, ptr %pass, align 8, !dbg !410
+  %bytes19 = load i64, ptr %bytes.addr, align 8, !dbg !410
+  %lt20 = icmp ult i64 %pass18, %bytes19, !dbg !410
+  br i1 %lt20, label %for.body15, label %for.end17, !dbg !410
+
+for.body15:                                       ; preds = %for.cond14
+  %pass21 = load i64, ptr %pass, align 8, !dbg !411
+  %mul22 = mul i64 %pass21, 256, !dbg !411
+  %key23 = load i64, ptr %key, align 8, !dbg !412
+  %rem = urem i64 %key23, 256, !dbg !412
+  %add = add i64 %mul22, %rem, !dbg !412
+  %elem_ptr24 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 %add, !dbg !412
+  %arr_elem25 = load i64, ptr %elem_ptr24, align 8, !dbg !412
+  %add26 = add i64 %arr_elem25, 1, !dbg !412
+  %pass27 = load i64, ptr %pass, align 8, !dbg !411
+  %mul28 = mul i64 %pass27, 256, !dbg !411
+  %key29 = load i64, ptr %key, align 8, !dbg !412
+  %rem30 = urem i64 %key29, 256, !dbg !412
+  %add31 = add i64 %mul28, %rem30, !dbg !412
+  %elem_ptr32 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 %add31, !dbg !412
+  store i64 %add26, ptr %elem_ptr32, align 8, !dbg !412
+  %key33 = load i64, ptr %key, align 8, !dbg !413
+  %div = udiv i64 %key33, 256, !dbg !413
+  store i64 %div, ptr %key, align 8, !dbg !413
+  br label %for.post16, !dbg !413
+
+for.post16:                                       ; preds = %for.body15
+  %inc_dec.load34 = load i64, ptr %pass, align 8, !dbg !414
+  %inc35 = add i64 %inc_dec.load34, 1, !dbg !414
+  store i64 %inc35, ptr %pass, align 8, !dbg !414
+  br label %for.cond14, !dbg !414, !llvm.loop !415
+
+for.end17:                                        ; preds = %for.cond14
+  br label %for.post7, !dbg !414
+
+if.then51:                                        ; preds = %for.end8
+  %sorted54 = load ptr, ptr %sorted, align 8, !dbg !416
+  %sorted55 = load ptr, ptr %sorted, align 8, !dbg !417
+  %from56 = load ptr, ptr %from, align 8, !dbg !417
+  %to57 = load ptr, ptr %to, align 8, !dbg !417
+  %call58 = call fastcc ptr @"other_buffer<u64>"(ptr %sorted55, ptr %from56, ptr %to57), !dbg !417
+  %count59 = load i64, ptr %count, align 8, !dbg !417
+  %elem_ptr60 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 256, !dbg !418
+  %call61 = call fastcc ptr @"radix_pass<u64>"(ptr %sorted54, ptr %call58, i64 %count59, ptr %elem_ptr60, i64 256), !dbg !418
+  store ptr %call61, ptr %sorted, align 8, !dbg !418
+  br label %if.join53, !dbg !418
+
+if.else52:                                        ; preds = %for.end8
+  br label %if.join53, !dbg !418
+
+if.join53:                                        ; preds = %if.else52, %if.then51
+  %bytes62 = load i64, ptr %bytes.addr, align 8, !dbg !419
+  %gt63 = icmp ugt i64 %bytes62, 2, !dbg !419
+  br i1 %gt63, label %if.then64, label %if.else65, !dbg !419
+
+if.then64:                                        ; preds = %if.join53
+  %sorted67 = load ptr, ptr %sorted, align 8, !dbg !420
+  %sorted68 = load ptr, ptr %sorted, align 8, !dbg !421
+  %from69 = load ptr, ptr %from, align 8, !dbg !421
+  %to70 = load ptr, ptr %to, align 8, !dbg !421
+  %call71 = call fastcc ptr @"other_buffer<u64>"(ptr %sorted68, ptr %from69, ptr %to70), !dbg !421
+  %count72 = load i64, ptr %count, align 8, !dbg !421
+  %elem_ptr73 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 512, !dbg !422
+  %call74 = call fastcc ptr @"radix_pass<u64>"(ptr %sorted67, ptr %call71, i64 %count72, ptr %elem_ptr73, i64 65536), !dbg !422
+  store ptr %call74, ptr %sorted, align 8, !dbg !422
+  %sorted75 = load ptr, ptr %sorted, align 8, !dbg !423
+  %sorted76 = load ptr, ptr %sorted, align 8, !dbg !424
+  %from77 = load ptr, ptr %from, align 8, !dbg !424
+  %to78 = load ptr, ptr %to, align 8, !dbg !424
+  %call79 = call fastcc ptr @"other_buffer<u64>"(ptr %sorted76, ptr %from77, ptr %to78), !dbg !424
+  %count80 = load i64, ptr %count, align 8, !dbg !424
+  %elem_ptr81 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 768, !dbg !425
+  %call82 = call fastcc ptr @"radix_pass<u64>"(ptr %sorted75, ptr %call79, i64 %count80, ptr %elem_ptr81, i64 16777216), !dbg !425
+  store ptr %call82, ptr %sorted, align 8, !dbg !425
+  br label %if.join66, !dbg !425
+
+if.else65:                                        ; preds = %if.join53
+  br label %if.join66, !dbg !425
+
+if.join66:                                        ; preds = %if.else65, %if.then64
+  %bytes83 = load i64, ptr %bytes.addr, align 8, !dbg !426
+  %gt84 = icmp ugt i64 %bytes83, 4, !dbg !426
+  br i1 %gt84, label %if.then85, label %if.else86, !dbg !426
+
+if.then85:                                        ; preds = %if.join66
+  %sorted88 = load ptr, ptr %sorted, align 8, !dbg !427
+  %sorted89 = load ptr, ptr %sorted, align 8, !dbg !428
+  %from90 = load ptr, ptr %from, align 8, !dbg !428
+  %to91 = load ptr, ptr %to, align 8, !dbg !428
+  %call92 = call fastcc ptr @"other_buffer<u64>"(ptr %sorted89, ptr %from90, ptr %to91), !dbg !428
+  %count93 = load i64, ptr %count, align 8, !dbg !428
+  %elem_ptr94 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 1024, !dbg !429
+  %call95 = call fastcc ptr @"radix_pass<u64>"(ptr %sorted88, ptr %call92, i64 %count93, ptr %elem_ptr94, i64 4294967296), !dbg !429
+  store ptr %call95, ptr %sorted, align 8, !dbg !429
+  %sorted96 = load ptr, ptr %sorted, align 8, !dbg !430
+  %sorted97 = load ptr, ptr %sorted, align 8, !dbg !431
+  %from98 = load ptr, ptr %from, align 8, !dbg !431
+  %to99 = load ptr, ptr %to, align 8, !dbg !431
+  %call100 = call fastcc ptr @"other_buffer<u64>"(ptr %sorted97, ptr %from98, ptr %to99), !dbg !431
+  %count101 = load i64, ptr %count, align 8, !dbg !431
+  %elem_ptr102 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 1280, !dbg !432
+  %call103 = call fastcc ptr @"radix_pass<u64>"(ptr %sorted96, ptr %call100, i64 %count101, ptr %elem_ptr102, i64 1099511627776), !dbg !432
+  store ptr %call103, ptr %sorted, align 8, !dbg !432
+  %sorted104 = load ptr, ptr %sorted, align 8, !dbg !433
+  %sorted105 = load ptr, ptr %sorted, align 8, !dbg !434
+  %from106 = load ptr, ptr %from, align 8, !dbg !434
+  %to107 = load ptr, ptr %to, align 8, !dbg !434
+  %call108 = call fastcc ptr @"other_buffer<u64>"(ptr %sorted105, ptr %from106, ptr %to107), !dbg !434
+  %count109 = load i64, ptr %count, align 8, !dbg !434
+  %elem_ptr110 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 1536, !dbg !435
+  %call111 = call fastcc ptr @"radix_pass<u64>"(ptr %sorted104, ptr %call108, i64 %count109, ptr %elem_ptr110, i64 281474976710656), !dbg !435
+  store ptr %call111, ptr %sorted, align 8, !dbg !435
+  %sorted112 = load ptr, ptr %sorted, align 8, !dbg !436
+  %sorted113 = load ptr, ptr %sorted, align 8, !dbg !437
+  %from114 = load ptr, ptr %from, align 8, !dbg !437
+  %to115 = load ptr, ptr %to, align 8, !dbg !437
+  %call116 = call fastcc ptr @"other_buffer<u64>"(ptr %sorted113, ptr %from114, ptr %to115), !dbg !437
+  %count117 = load i64, ptr %count, align 8, !dbg !437
+  %elem_ptr118 = getelementptr inbounds [2048 x i64], ptr %counts, i64 0, i64 1792, !dbg !438
+  %call119 = call fastcc ptr @"radix_pass<u64>"(ptr %sorted112, ptr %call116, i64 %count117, ptr %elem_ptr118, i64 72057594037927936), !dbg !438
+  store ptr %call119, ptr %sorted, align 8, !dbg !438
+  br label %if.join87, !dbg !438
+
+if.else86:                                        ; preds = %if.join66
+  br label %if.join87, !dbg !438
+
+if.join87:                                        ; preds = %if.else86, %if.then85
+  %sorted120 = load ptr, ptr %sorted, align 8, !dbg !439
+  %from121 = load ptr, ptr %from, align 8, !dbg !439
+  %ne = icmp ne ptr %sorted120, %from121, !dbg !439
+  br i1 %ne, label %if.then122, label %if.else123, !dbg !439
+
+if.then122:                                       ; preds = %if.join87
+  %from125 = load ptr, ptr %from, align 8, !dbg !440
+  %sorted126 = load ptr, ptr %sorted, align 8, !dbg !440
+  %count127 = load i64, ptr %count, align 8, !dbg !441
+  %size128 = load i64, ptr %size, align 8, !dbg !441
+  %mul129 = mul i64 %count127, %size128, !dbg !441
+  %call130 = call ptr @memcpy(ptr %from125, ptr %sorted126, i64 %mul129), !dbg !441
+  br label %if.join124, !dbg !441
+
+if.else123:                                       ; preds = %if.join87
+  br label %if.join124, !dbg !441
+
+if.join124:                                       ; preds = %if.else123, %if.then122
+  %buffer131 = load ptr, ptr %buffer, align 8, !dbg !442
+  call void @Std.Collections.collection_free(ptr %buffer131), !dbg !442
+  ret void, !dbg !442
+}
+
+; Function Attrs: alwaysinline nounwind
+define internal fastcc ptr @"radix_pass<u8>"(ptr %0, ptr %1, i64 %2, ptr %3, i64 %4) #2 !dbg !443 {
+entry:
+  %digit = alloca i64, align 8, !dbg !461
+  %i = alloca i64, align 8, !dbg !461
+  %value = alloca i64, align 8, !dbg !461
+  %offset = alloca i64, align 8, !dbg !461
+  %offsets = alloca [256 x i64], align 8, !dbg !461
+  %source.addr = alloca ptr, align 8, !dbg !461
+  store ptr %0, ptr %source.addr, align 8, !dbg !461
+  call void @llvm.dbg.declare(metadata ptr %source.addr, metadata !448, metadata !DIExpression()), !dbg !462
+  %target.addr = alloca ptr, align 8, !dbg !461
+  store ptr %1, ptr %target.addr, align 8, !dbg !461
+  call void @llvm.dbg.declare(metadata ptr %target.addr, metadata !449, metadata !DIExpression()), !dbg !463
+  %count.addr = alloca i64, align 8, !dbg !461
+  store i64 %2, ptr %count.addr, align 8, !dbg !461
+  call void @llvm.dbg.declare(metadata ptr %count.addr, metadata !450, metadata !DIExpression()), !dbg !464
+  %counts.addr = alloca ptr, align 8, !dbg !461
+  store ptr %3, ptr %counts.addr, align 8, !dbg !461
+  call void @llvm.dbg.declare(metadata ptr %counts.addr, metadata !451, metadata !DIExpression()), !dbg !465
+  %divisor.addr = alloca i64, align 8, !dbg !461
+  store i64 %4, ptr %divisor.addr, align 8, !dbg !461
+  call void @llvm.dbg.declare(metadata ptr %divisor.addr, metadata !452, metadata !DIExpression()), !dbg !466
+  call void @llvm.dbg.declare(metadata ptr %offsets, metadata !453, metadata !DIExpression()), !dbg !467
+  call void @llvm.dbg.declare(metadata ptr %offset, metadata !457, metadata !DIExpression()), !dbg !468
+  store i64 0, ptr %offset, align 8, !dbg !468
+  call void @llvm.dbg.declare(metadata ptr %value, metadata !458, metadata !DIExpression()), !dbg !469
+  store i64 0, ptr %value, align 8, !dbg !469
+  br label %for.cond, !dbg !469
+
+for.cond:                                         ; preds = %for.post, %entry
+  %value1 = load i64, ptr %value, align 8, !dbg !470
+  %lt = icmp ult i64 %value1, 256, !dbg !470
+  br i1 %lt, label %for.body, label %for.end, !dbg !470
+
+for.body:                                         ; preds = %for.cond
+  %counts = load ptr, ptr %counts.addr, align 8, !dbg !471
+  %value2 = load i64, ptr %value, align 8, !dbg !471
+  %elem_ptr = getelementptr i64, ptr %counts, i64 %value2, !dbg !471
+  %arr_elem = load i64, ptr %elem_ptr, align 8, !dbg !471
+  %count = load i64, ptr %count.addr, align 8, !dbg !471
+  %eq = icmp eq i64 %arr_elem, %count, !dbg !471
+  br i1 %eq, label %if.then, label %if.else, !dbg !471
+
+for.post:                                         ; preds = %if.join
+  %inc_dec.load = load i64, ptr %value, align 8, !dbg !472
+  %inc = add i64 %inc_dec.load, 1, !dbg !472
+  store i64 %inc, ptr %value, align 8, !dbg !472
+  br label %for.cond, !dbg !472, !llvm.loop !473
+
+for.end:                                          ; preds = %for.cond
+  call void @llvm.dbg.declare(metadata ptr %i, metadata !459, metadata !DIExpression()), !dbg !474
+  store i64 0, ptr %i, align 8, !dbg !474
+  br label %for.cond11, !dbg !474
+
+if.then:                                          ; preds = %for.body
+  %source = load ptr, ptr %source.addr, align 8, !dbg !475
+  ret ptr %source, !dbg !475
+
+if.else:                                          ; preds = %for.body
+  br label %if.join, !dbg !475
+
+if.join:                                          ; preds = %if.else
+  %offset3 = load i64, ptr %offset, align 8, !dbg !475
+  %value4 = load i64, ptr %value, align 8, !dbg !476
+  %elem_ptr5 = getelementptr inbounds [256 x i64], ptr %offsets, i64 0, i64 %value4, !dbg !476
+  store i64 %offset3, ptr %elem_ptr5, align 8, !dbg !476
+  %offset6 = load i64, ptr %offset, align 8, !dbg !477
+  %counts7 = load ptr, ptr %counts.addr, align 8, !dbg !478
+  %value8 = load i64, ptr %value, align 8, !dbg !478
+  %elem_ptr9 = getelementptr i64, ptr %counts7, i64 %value8, !dbg !478
+  %arr_elem10 = load i64, ptr %elem_ptr9, align 8, !dbg !478
+  %add = add i64 %offset6, %arr_elem10, !dbg !478
+  store i64 %add, ptr %offset, align 8, !dbg !478
+  br label %for.post, !dbg !478
+
+for.cond11:                                       ; preds = %for.post13, %for.end
+  %i15 = load i64, ptr %i, align 8, !dbg !479
+  %count16 = load i64, ptr %count.addr, align 8, !dbg !479
+  %lt17 = icmp ult i64 %i15, %count16, !dbg !479
+  br i1 %lt17, label %for.body12, label %for.end14, !dbg !479
+
+for.body12:                                       ; preds = %for.cond11
+  call void @llvm.dbg.declare(metadata ptr %digit, metadata !460, metadata !DIExpression()), !dbg !480
+  %source18 = load ptr, ptr %source.addr, align 8, !dbg !481
+  %i19 = load i64, ptr %i, align 8, !dbg !481
+  %elem_ptr20 = getelementptr i8, ptr %source18, i64 %i19, !dbg !481
+  %arr_elem21 = load i8, ptr %elem_ptr20, align 1, !dbg !481
+  %zext = zext i8 %arr_elem21 to i64, !dbg !481
+  %divisor = load i64, ptr %divisor.addr, align 8, !dbg !481
+  %div = udiv i64 %zext, %divisor, !dbg !481
+  %rem = urem i64 %div, 256, !dbg !481
+  store i64 %rem, ptr %digit, align 8, !dbg !481
+  %source22 = load ptr, ptr %source.addr, align 8, !dbg !482
+  %i23 = load i64, ptr %i, align 8, !dbg !482
+  %elem_ptr24 = getelementptr i8, ptr %source22, i64 %i23, !dbg !482
+  %arr_elem25 = load i8, ptr %elem_ptr24, align 1, !dbg !482
+  %target = load ptr, ptr %target.addr, align 8, !dbg !483
+  %digit26 = load i64, ptr %digit, align 8, !dbg !484
+  %elem_ptr27 = getelementptr inbounds [256 x i64], ptr %offsets, i64 0, i64 %digit26, !dbg !484
+  %arr_elem28 = load i64, ptr %elem_ptr27, align 8, !dbg !484
+  %elem_ptr29 = getelementptr i8, ptr %target, i64 %arr_elem28, !dbg !484
+  store i8 %arr_elem25, ptr %elem_ptr29, align 1, !dbg !484
+  %digit30 = load i64, ptr %digit, align 8, !dbg !485
+  %elem_ptr31 = getelementptr inbounds [256 x i64], ptr %offsets, i64 0, i64 %digit30, !dbg !485
+  %arr_elem32 = load i64, ptr %elem_ptr31, align 8, !dbg !485
+  %add33 = add i64 %arr_elem32, 1, !dbg !485
+  %digit34 = load i64, ptr %digit, align 8, !dbg !485
+  %elem_ptr35 = getelementptr inbounds [256 x i64], ptr %offsets, i64 0, i64 %digit34, !dbg !485
+  store i64 %add33, ptr %elem_ptr35, align 8, !dbg !485
+  br label %for.post13, !dbg !485
+
+for.post13:                                       ; preds = %for.body12
+  %inc_dec.load36 = load i64, ptr %i, align 8, !dbg !486
+  %inc37 = add i64 %inc_dec.load36, 1, !dbg !486
+  store i64 %inc37, ptr %i, align 8, !dbg !486
+  br label %for.cond11, !dbg !486, !llvm.loop !487
+
+for.end14:                                        ; preds = %for.cond11
+  %target38 = load ptr, ptr %target.addr, align 8, !dbg !488
+  ret ptr %target38, !dbg !488
+}
+
+; Function Attrs: nounwind readnone willreturn
+define internal fastcc ptr @"other_buffer<u8>"(ptr %0, ptr %1, ptr %2) #1 !dbg !489 {
+entry:
+  %buffer.addr = alloca ptr, align 8, !dbg !496
+  store ptr %0, ptr %buffer.addr, align 8, !dbg !496
+  call void @llvm.dbg.declare(metadata ptr %buffer.addr, metadata !493, metadata !DIExpression()), !dbg !497
+  %first.addr = alloca ptr, align 8, !dbg !496
+  store ptr %1, ptr %first.addr, align 8, !dbg !496
+  call void @llvm.dbg.declare(metadata ptr %first.addr, metadata !494, metadata !DIExpression()), !dbg !498
+  %second.addr = alloca ptr, align 8, !dbg !496
+  store ptr %2, ptr %second.addr, align 8, !dbg !496
+  call void @llvm.dbg.declare(metadata ptr %second.addr, metadata !495, metadata !DIExpression()), !dbg !499
+  %buffer = load ptr, ptr %buffer.addr, align 8, !dbg !500
+  %first = load ptr, ptr %first.addr, align 8, !dbg !500
+  %eq = icmp eq ptr %buffer, %first, !dbg !500
+  br i1 %eq, label %if.then, label %if.else, !dbg !500
+
+if.then:                                          ; preds = %entry
+  %second = load ptr, ptr %second.addr, align 8, !dbg !501
+  ret ptr %second, !dbg !501
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !501
+
+if.join:                                          ; preds = %if.else
+  %first1 = load ptr, ptr %first.addr, align 8, !dbg !502
+  ret ptr %first1, !dbg !502
+}
+
+; Function Attrs: alwaysinline nounwind
+define internal fastcc ptr @"radix_pass<u16>"(ptr %0, ptr %1, i64 %2, ptr %3, i64 %4) #2 !dbg !503 {
+entry:
+  %digit = alloca i64, align 8, !dbg !517
+  %i = alloca i64, align 8, !dbg !517
+  %value = alloca i64, align 8, !dbg !517
+  %offset = alloca i64, align 8, !dbg !517
+  %offsets = alloca [256 x i64], align 8, !dbg !517
+  %source.addr = alloca ptr, align 8, !dbg !517
+  store ptr %0, ptr %source.addr, align 8, !dbg !517
+  call void @llvm.dbg.declare(metadata ptr %source.addr, metadata !507, metadata !DIExpression()), !dbg !518
+  %target.addr = alloca ptr, align 8, !dbg !517
+  store ptr %1, ptr %target.addr, align 8, !dbg !517
+  call void @llvm.dbg.declare(metadata ptr %target.addr, metadata !508, metadata !DIExpression()), !dbg !519
+  %count.addr = alloca i64, align 8, !dbg !517
+  store i64 %2, ptr %count.addr, align 8, !dbg !517
+  call void @llvm.dbg.declare(metadata ptr %count.addr, metadata !509, metadata !DIExpression()), !dbg !520
+  %counts.addr = alloca ptr, align 8, !dbg !517
+  store ptr %3, ptr %counts.addr, align 8, !dbg !517
+  call void @llvm.dbg.declare(metadata ptr %counts.addr, metadata !510, metadata !DIExpression()), !dbg !521
+  %divisor.addr = alloca i64, align 8, !dbg !517
+  store i64 %4, ptr %divisor.addr, align 8, !dbg !517
+  call void @llvm.dbg.declare(metadata ptr %divisor.addr, metadata !511, metadata !DIExpression()), !dbg !522
+  call void @llvm.dbg.declare(metadata ptr %offsets, metadata !512, metadata !DIExpression()), !dbg !523
+  call void @llvm.dbg.declare(metadata ptr %offset, metadata !513, metadata !DIExpression()), !dbg !524
+  store i64 0, ptr %offset, align 8, !dbg !524
+  call void @llvm.dbg.declare(metadata ptr %value, metadata !514, metadata !DIExpression()), !dbg !525
+  store i64 0, ptr %value, align 8, !dbg !525
+  br label %for.cond, !dbg !525
+
+for.cond:                                         ; preds = %for.post, %entry
+  %value1 = load i64, ptr %value, align 8, !dbg !526
+  %lt = icmp ult i64 %value1, 256, !dbg !526
+  br i1 %lt, label %for.body, label %for.end, !dbg !526
+
+for.body:                                         ; preds = %for.cond
+  %counts = load ptr, ptr %counts.addr, align 8, !dbg !527
+  %value2 = load i64, ptr %value, align 8, !dbg !527
+  %elem_ptr = getelementptr i64, ptr %counts, i64 %value2, !dbg !527
+  %arr_elem = load i64, ptr %elem_ptr, align 8, !dbg !527
+  %count = load i64, ptr %count.addr, align 8, !dbg !527
+  %eq = icmp eq i64 %arr_elem, %count, !dbg !527
+  br i1 %eq, label %if.then, label %if.else, !dbg !527
+
+for.post:                                         ; preds = %if.join
+  %inc_dec.load = load i64, ptr %value, align 8, !dbg !528
+  %inc = add i64 %inc_dec.load, 1, !dbg !528
+  store i64 %inc, ptr %value, align 8, !dbg !528
+  br label %for.cond, !dbg !528, !llvm.loop !529
+
+for.end:                                          ; preds = %for.cond
+  call void @llvm.dbg.declare(metadata ptr %i, metadata !515, metadata !DIExpression()), !dbg !530
+  store i64 0, ptr %i, align 8, !dbg !530
+  br label %for.cond11, !dbg !530
+
+if.then:                                          ; preds = %for.body
+  %source = load ptr, ptr %source.addr, align 8, !dbg !531
+  ret ptr %source, !dbg !531
+
+if.else:                                          ; preds = %for.body
+  br label %if.join, !dbg !531
+
+if.join:                                          ; preds = %if.else
+  %offset3 = load i64, ptr %offset, align 8, !dbg !531
+  %value4 = load i64, ptr %value, align 8, !dbg !532
+  %elem_ptr5 = getelementptr inbounds [256 x i64], ptr %offsets, i64 0, i64 %value4, !dbg !532
+  store i64 %offset3, ptr %elem_ptr5, align 8, !dbg !532
+  %offset6 = load i64, ptr %offset, align 8, !dbg !533
+  %counts7 = load ptr, ptr %counts.addr, align 8, !dbg !534
+  %value8 = load i64, ptr %value, align 8, !dbg !534
+  %elem_ptr9 = getelementptr i64, ptr %counts7, i64 %value8, !dbg !534
+  %arr_elem10 = load i64, ptr %elem_ptr9, align 8, !dbg !534
+  %add = add i64 %offset6, %arr_elem10, !dbg !534
+  store i64 %add, ptr %offset, align 8, !dbg !534
+  br label %for.post, !dbg !534
+
+for.cond11:                                       ; preds = %for.post13, %for.end
+  %i15 = load i64, ptr %i, align 8, !dbg !535
+  %count16 = load i64, ptr %count.addr, align 8, !dbg !535
+  %lt17 = icmp ult i64 %i15, %count16, !dbg !535
+  br i1 %lt17, label %for.body12, label %for.end14, !dbg !535
+
+for.body12:                                       ; preds = %for.cond11
+  call void @llvm.dbg.declare(metadata ptr %digit, metadata !516, metadata !DIExpression()), !dbg !536
+  %source18 = load ptr, ptr %source.addr, align 8, !dbg !537
+  %i19 = load i64, ptr %i, align 8, !dbg !537
+  %elem_ptr20 = getelementptr i16, ptr %source18, i64 %i19, !dbg !537
+  %arr_elem21 = load i16, ptr %elem_ptr20, align 2, !dbg !537
+  %zext = zext i16 %arr_elem21 to i64, !dbg !537
+  %divisor = load i64, ptr %divisor.addr, align 8, !dbg !537
+  %div = udiv i64 %zext, %divisor, !dbg !537
+  %rem = urem i64 %div, 256, !dbg !537
+  store i64 %rem, ptr %digit, align 8, !dbg !537
+  %source22 = load ptr, ptr %source.addr, align 8, !dbg !538
+  %i23 = load i64, ptr %i, align 8, !dbg !538
+  %elem_ptr24 = getelementptr i16, ptr %source22, i64 %i23, !dbg !538
+  %arr_elem25 = load i16, ptr %elem_ptr24, align 2, !dbg !538
+  %target = load ptr, ptr %target.addr, align 8, !dbg !539
+  %digit26 = load i64, ptr %digit, align 8, !dbg !540
+  %elem_ptr27 = getelementptr inbounds [256 x i64], ptr %offsets, i64 0, i64 %digit26, !dbg !540
+  %arr_elem28 = load i64, ptr %elem_ptr27, align 8, !dbg !540
+  %elem_ptr29 = getelementptr i16, ptr %target, i64 %arr_elem28, !dbg !540
+  store i16 %arr_elem25, ptr %elem_ptr29, align 2, !dbg !540
+  %digit30 = load i64, ptr %digit, align 8, !dbg !541
+  %elem_ptr31 = getelementptr inbounds [256 x i64], ptr %offsets, i64 0, i64 %digit30, !dbg !541
+  %arr_elem32 = load i64, ptr %elem_ptr31, align 8, !dbg !541
+  %add33 = add i64 %arr_elem32, 1, !dbg !541
+  %digit34 = load i64, ptr %digit, align 8, !dbg !541
+  %elem_ptr35 = getelementptr inbounds [256 x i64], ptr %offsets, i64 0, i64 %digit34, !dbg !541
+  store i64 %add33, ptr %elem_ptr35, align 8, !dbg !541
+  br label %for.post13, !dbg !541
+
+for.post13:                                       ; preds = %for.body12
+  %inc_dec.load36 = load i64, ptr %i, align 8, !dbg !542
+  %inc37 = add i64 %inc_dec.load36, 1, !dbg !542
+  store i64 %inc37, ptr %i, align 8, !dbg !542
+  br label %for.cond11, !dbg !542, !llvm.loop !543
+
+for.end14:                                        ; preds = %for.cond11
+  %target38 = load ptr, ptr %target.addr, align 8, !dbg !544
+  ret ptr %target38, !dbg !544
+}
+
+; Function Attrs: nounwind readnone willreturn
+define internal fastcc ptr @"other_buffer<u16>"(ptr %0, ptr %1, ptr %2) #1 !dbg !545 {
+entry:
+  %buffer.addr = alloca ptr, align 8, !dbg !552
+  store ptr %0, ptr %buffer.addr, align 8, !dbg !552
+  call void @llvm.dbg.declare(metadata ptr %buffer.addr, metadata !549, metadata !DIExpression()), !dbg !553
+  %first.addr = alloca ptr, align 8, !dbg !552
+  store ptr %1, ptr %first.addr, align 8, !dbg !552
+  call void @llvm.dbg.declare(metadata ptr %first.addr, metadata !550, metadata !DIExpression()), !dbg !554
+  %second.addr = alloca ptr, align 8, !dbg !552
+  store ptr %2, ptr %second.addr, align 8, !dbg !552
+  call void @llvm.dbg.declare(metadata ptr %second.addr, metadata !551, metadata !DIExpression()), !dbg !555
+  %buffer = load ptr, ptr %buffer.addr, align 8, !dbg !556
+  %first = load ptr, ptr %first.addr, align 8, !dbg !556
+  %eq = icmp eq ptr %buffer, %first, !dbg !556
+  br i1 %eq, label %if.then, label %if.else, !dbg !556
+
+if.then:                                          ; preds = %entry
+  %second = load ptr, ptr %second.addr, align 8, !dbg !557
+  ret ptr %second, !dbg !557
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !557
+
+if.join:                                          ; preds = %if.else
+  %first1 = load ptr, ptr %first.addr, align 8, !dbg !558
+  ret ptr %first1, !dbg !558
+}
+
+; Function Attrs: alwaysinline nounwind
+define internal fastcc ptr @"radix_pass<u32>"(ptr %0, ptr %1, i64 %2, ptr %3, i64 %4) #2 !dbg !559 {
+entry:
+  %digit = alloca i64, align 8, !dbg !573
+  %i = alloca i64, align 8, !dbg !573
+  %value = alloca i64, align 8, !dbg !573
+  %offset = alloca i64, align 8, !dbg !573
+  %offsets = alloca [256 x i64], align 8, !dbg !573
+  %source.addr = alloca ptr, align 8, !dbg !573
+  store ptr %0, ptr %source.addr, align 8, !dbg !573
+  call void @llvm.dbg.declare(metadata ptr %source.addr, metadata !563, metadata !DIExpression()), !dbg !574
+  %target.addr = alloca ptr, align 8, !dbg !573
+  store ptr %1, ptr %target.addr, align 8, !dbg !573
+  call void @llvm.dbg.declare(metadata ptr %target.addr, metadata !564, metadata !DIExpression()), !dbg !575
+  %count.addr = alloca i64, align 8, !dbg !573
+  store i64 %2, ptr %count.addr, align 8, !dbg !573
+  call void @llvm.dbg.declare(metadata ptr %count.addr, metadata !565, metadata !DIExpression()), !dbg !576
+  %counts.addr = alloca ptr, align 8, !dbg !573
+  store ptr %3, ptr %counts.addr, align 8, !dbg !573
+  call void @llvm.dbg.declare(metadata ptr %counts.addr, metadata !566, metadata !DIExpression()), !dbg !577
+  %divisor.addr = alloca i64, align 8, !dbg !573
+  store i64 %4, ptr %divisor.addr, align 8, !dbg !573
+  call void @llvm.dbg.declare(metadata ptr %divisor.addr, metadata !567, metadata !DIExpression()), !dbg !578
+  call void @llvm.dbg.declare(metadata ptr %offsets, metadata !568, metadata !DIExpression()), !dbg !579
+  call void @llvm.dbg.declare(metadata ptr %offset, metadata !569, metadata !DIExpression()), !dbg !580
+  store i64 0, ptr %offset, align 8, !dbg !580
+  call void @llvm.dbg.declare(metadata ptr %value, metadata !570, metadata !DIExpression()), !dbg !581
+  store i64 0, ptr %value, align 8, !dbg !581
+  br label %for.cond, !dbg !581
+
+for.cond:                                         ; preds = %for.post, %entry
+  %value1 = load i64, ptr %value, align 8, !dbg !582
+  %lt = icmp ult i64 %value1, 256, !dbg !582
+  br i1 %lt, label %for.body, label %for.end, !dbg !582
+
+for.body:                                         ; preds = %for.cond
+  %counts = load ptr, ptr %counts.addr, align 8, !dbg !583
+  %value2 = load i64, ptr %value, align 8, !dbg !583
+  %elem_ptr = getelementptr i64, ptr %counts, i64 %value2, !dbg !583
+  %arr_elem = load i64, ptr %elem_ptr, align 8, !dbg !583
+  %count = load i64, ptr %count.addr, align 8, !dbg !583
+  %eq = icmp eq i64 %arr_elem, %count, !dbg !583
+  br i1 %eq, label %if.then, label %if.else, !dbg !583
+
+for.post:                                         ; preds = %if.join
+  %inc_dec.load = load i64, ptr %value, align 8, !dbg !584
+  %inc = add i64 %inc_dec.load, 1, !dbg !584
+  store i64 %inc, ptr %value, align 8, !dbg !584
+  br label %for.cond, !dbg !584, !llvm.loop !585
+
+for.end:                                          ; preds = %for.cond
+  call void @llvm.dbg.declare(metadata ptr %i, metadata !571, metadata !DIExpression()), !dbg !586
+  store i64 0, ptr %i, align 8, !dbg !586
+  br label %for.cond11, !dbg !586
+
+if.then:                                          ; preds = %for.body
+  %source = load ptr, ptr %source.addr, align 8, !dbg !587
+  ret ptr %source, !dbg !587
+
+if.else:                                          ; preds = %for.body
+  br label %if.join, !dbg !587
+
+if.join:                                          ; preds = %if.else
+  %offset3 = load i64, ptr %offset, align 8, !dbg !587
+  %value4 = load i64, ptr %value, align 8, !dbg !588
+  %elem_ptr5 = getelementptr inbounds [256 x i64], ptr %offsets, i64 0, i64 %value4, !dbg !588
+  store i64 %offset3, ptr %elem_ptr5, align 8, !dbg !588
+  %offset6 = load i64, ptr %offset, align 8, !dbg !589
+  %counts7 = load ptr, ptr %counts.addr, align 8, !dbg !590
+  %value8 = load i64, ptr %value, align 8, !dbg !590
+  %elem_ptr9 = getelementptr i64, ptr %counts7, i64 %value8, !dbg !590
+  %arr_elem10 = load i64, ptr %elem_ptr9, align 8, !dbg !590
+  %add = add i64 %offset6, %arr_elem10, !dbg !590
+  store i64 %add, ptr %offset, align 8, !dbg !590
+  br label %for.post, !dbg !590
+
+for.cond11:                                       ; preds = %for.post13, %for.end
+  %i15 = load i64, ptr %i, align 8, !dbg !591
+  %count16 = load i64, ptr %count.addr, align 8, !dbg !591
+  %lt17 = icmp ult i64 %i15, %count16, !dbg !591
+  br i1 %lt17, label %for.body12, label %for.end14, !dbg !591
+
+for.body12:                                       ; preds = %for.cond11
+  call void @llvm.dbg.declare(metadata ptr %digit, metadata !572, metadata !DIExpression()), !dbg !592
+  %source18 = load ptr, ptr %source.addr, align 8, !dbg !593
+  %i19 = load i64, ptr %i, align 8, !dbg !593
+  %elem_ptr20 = getelementptr i32, ptr %source18, i64 %i19, !dbg !593
+  %arr_elem21 = load i32, ptr %elem_ptr20, align 4, !dbg !593
+  %zext = zext i32 %arr_elem21 to i64, !dbg !593
+  %divisor = load i64, ptr %divisor.addr, align 8, !dbg !593
+  %div = udiv i64 %zext, %divisor, !dbg !593
+  %rem = urem i64 %div, 256, !dbg !593
+  store i64 %rem, ptr %digit, align 8, !dbg !593
+  %source22 = load ptr, ptr %source.addr, align 8, !dbg !594
+  %i23 = load i64, ptr %i, align 8, !dbg !594
+  %elem_ptr24 = getelementptr i32, ptr %source22, i64 %i23, !dbg !594
+  %arr_elem25 = load i32, ptr %elem_ptr24, align 4, !dbg !594
+  %target = load ptr, ptr %target.addr, align 8, !dbg !595
+  %digit26 = load i64, ptr %digit, align 8, !dbg !596
+  %elem_ptr27 = getelementptr inbounds [256 x i64], ptr %offsets, i64 0, i64 %digit26, !dbg !596
+  %arr_elem28 = load i64, ptr %elem_ptr27, align 8, !dbg !596
+  %elem_ptr29 = getelementptr i32, ptr %target, i64 %arr_elem28, !dbg !596
+  store i32 %arr_elem25, ptr %elem_ptr29, align 4, !dbg !596
+  %digit30 = load i64, ptr %digit, align 8, !dbg !597
+  %elem_ptr31 = getelementptr inbounds [256 x i64], ptr %offsets, i64 0, i64 %digit30, !dbg !597
+  %arr_elem32 = load i64, ptr %elem_ptr31, align 8, !dbg !597
+  %add33 = add i64 %arr_elem32, 1, !dbg !597
+  %digit34 = load i64, ptr %digit, align 8, !dbg !597
+  %elem_ptr35 = getelementptr inbounds [256 x i64], ptr %offsets, i64 0, i64 %digit34, !dbg !597
+  store i64 %add33, ptr %elem_ptr35, align 8, !dbg !597
+  br label %for.post13, !dbg !597
+
+for.post13:                                       ; preds = %for.body12
+  %inc_dec.load36 = load i64, ptr %i, align 8, !dbg !598
+  %inc37 = add i64 %inc_dec.load36, 1, !dbg !598
+  store i64 %inc37, ptr %i, align 8, !dbg !598
+  br label %for.cond11, !dbg !598, !llvm.loop !599
+
+for.end14:                                        ; preds = %for.cond11
+  %target38 = load ptr, ptr %target.addr, align 8, !dbg !600
+  ret ptr %target38, !dbg !600
+}
+
+; Function Attrs: nounwind readnone willreturn
+define internal fastcc ptr @"other_buffer<u32>"(ptr %0, ptr %1, ptr %2) #1 !dbg !601 {
+entry:
+  %buffer.addr = alloca ptr, align 8, !dbg !608
+  store ptr %0, ptr %buffer.addr, align 8, !dbg !608
+  call void @llvm.dbg.declare(metadata ptr %buffer.addr, metadata !605, metadata !DIExpression()), !dbg !609
+  %first.addr = alloca ptr, align 8, !dbg !608
+  store ptr %1, ptr %first.addr, align 8, !dbg !608
+  call void @llvm.dbg.declare(metadata ptr %first.addr, metadata !606, metadata !DIExpression()), !dbg !610
+  %second.addr = alloca ptr, align 8, !dbg !608
+  store ptr %2, ptr %second.addr, align 8, !dbg !608
+  call void @llvm.dbg.declare(metadata ptr %second.addr, metadata !607, metadata !DIExpression()), !dbg !611
+  %buffer = load ptr, ptr %buffer.addr, align 8, !dbg !612
+  %first = load ptr, ptr %first.addr, align 8, !dbg !612
+  %eq = icmp eq ptr %buffer, %first, !dbg !612
+  br i1 %eq, label %if.then, label %if.else, !dbg !612
+
+if.then:                                          ; preds = %entry
+  %second = load ptr, ptr %second.addr, align 8, !dbg !613
+  ret ptr %second, !dbg !613
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !613
+
+if.join:                                          ; preds = %if.else
+  %first1 = load ptr, ptr %first.addr, align 8, !dbg !614
+  ret ptr %first1, !dbg !614
+}
+
+; Function Attrs: alwaysinline nounwind
+define internal fastcc ptr @"radix_pass<u64>"(ptr %0, ptr %1, i64 %2, ptr %3, i64 %4) #2 !dbg !615 {
+entry:
+  %digit = alloca i64, align 8, !dbg !629
+  %i = alloca i64, align 8, !dbg !629
+  %value = alloca i64, align 8, !dbg !629
+  %offset = alloca i64, align 8, !dbg !629
+  %offsets = alloca [256 x i64], align 8, !dbg !629
+  %source.addr = alloca ptr, align 8, !dbg !629
+  store ptr %0, ptr %source.addr, align 8, !dbg !629
+  call void @llvm.dbg.declare(metadata ptr %source.addr, metadata !619, metadata !DIExpression()), !dbg !630
+  %target.addr = alloca ptr, align 8, !dbg !629
+  store ptr %1, ptr %target.addr, align 8, !dbg !629
+  call void @llvm.dbg.declare(metadata ptr %target.addr, metadata !620, metadata !DIExpression()), !dbg !631
+  %count.addr = alloca i64, align 8, !dbg !629
+  store i64 %2, ptr %count.addr, align 8, !dbg !629
+  call void @llvm.dbg.declare(metadata ptr %count.addr, metadata !621, metadata !DIExpression()), !dbg !632
+  %counts.addr = alloca ptr, align 8, !dbg !629
+  store ptr %3, ptr %counts.addr, align 8, !dbg !629
+  call void @llvm.dbg.declare(metadata ptr %counts.addr, metadata !622, metadata !DIExpression()), !dbg !633
+  %divisor.addr = alloca i64, align 8, !dbg !629
+  store i64 %4, ptr %divisor.addr, align 8, !dbg !629
+  call void @llvm.dbg.declare(metadata ptr %divisor.addr, metadata !623, metadata !DIExpression()), !dbg !634
+  call void @llvm.dbg.declare(metadata ptr %offsets, metadata !624, metadata !DIExpression()), !dbg !635
+  call void @llvm.dbg.declare(metadata ptr %offset, metadata !625, metadata !DIExpression()), !dbg !636
+  store i64 0, ptr %offset, align 8, !dbg !636
+  call void @llvm.dbg.declare(metadata ptr %value, metadata !626, metadata !DIExpression()), !dbg !637
+  store i64 0, ptr %value, align 8, !dbg !637
+  br label %for.cond, !dbg !637
+
+for.cond:                                         ; preds = %for.post, %entry
+  %value1 = load i64, ptr %value, align 8, !dbg !638
+  %lt = icmp ult i64 %value1, 256, !dbg !638
+  br i1 %lt, label %for.body, label %for.end, !dbg !638
+
+for.body:                                         ; preds = %for.cond
+  %counts = load ptr, ptr %counts.addr, align 8, !dbg !639
+  %value2 = load i64, ptr %value, align 8, !dbg !639
+  %elem_ptr = getelementptr i64, ptr %counts, i64 %value2, !dbg !639
+  %arr_elem = load i64, ptr %elem_ptr, align 8, !dbg !639
+  %count = load i64, ptr %count.addr, align 8, !dbg !639
+  %eq = icmp eq i64 %arr_elem, %count, !dbg !639
+  br i1 %eq, label %if.then, label %if.else, !dbg !639
+
+for.post:                                         ; preds = %if.join
+  %inc_dec.load = load i64, ptr %value, align 8, !dbg !640
+  %inc = add i64 %inc_dec.load, 1, !dbg !640
+  store i64 %inc, ptr %value, align 8, !dbg !640
+  br label %for.cond, !dbg !640, !llvm.loop !641
+
+for.end:                                          ; preds = %for.cond
+  call void @llvm.dbg.declare(metadata ptr %i, metadata !627, metadata !DIExpression()), !dbg !642
+  store i64 0, ptr %i, align 8, !dbg !642
+  br label %for.cond11, !dbg !642
+
+if.then:                                          ; preds = %for.body
+  %source = load ptr, ptr %source.addr, align 8, !dbg !643
+  ret ptr %source, !dbg !643
+
+if.else:                                          ; preds = %for.body
+  br label %if.join, !dbg !643
+
+if.join:                                          ; preds = %if.else
+  %offset3 = load i64, ptr %offset, align 8, !dbg !643
+  %value4 = load i64, ptr %value, align 8, !dbg !644
+  %elem_ptr5 = getelementptr inbounds [256 x i64], ptr %offsets, i64 0, i64 %value4, !dbg !644
+  store i64 %offset3, ptr %elem_ptr5, align 8, !dbg !644
+  %offset6 = load i64, ptr %offset, align 8, !dbg !645
+  %counts7 = load ptr, ptr %counts.addr, align 8, !dbg !646
+  %value8 = load i64, ptr %value, align 8, !dbg !646
+  %elem_ptr9 = getelementptr i64, ptr %counts7, i64 %value8, !dbg !646
+  %arr_elem10 = load i64, ptr %elem_ptr9, align 8, !dbg !646
+  %add = add i64 %offset6, %arr_elem10, !dbg !646
+  store i64 %add, ptr %offset, align 8, !dbg !646
+  br label %for.post, !dbg !646
+
+for.cond11:                                       ; preds = %for.post13, %for.end
+  %i15 = load i64, ptr %i, align 8, !dbg !647
+  %count16 = load i64, ptr %count.addr, align 8, !dbg !647
+  %lt17 = icmp ult i64 %i15, %count16, !dbg !647
+  br i1 %lt17, label %for.body12, label %for.end14, !dbg !647
+
+for.body12:                                       ; preds = %for.cond11
+  call void @llvm.dbg.declare(metadata ptr %digit, metadata !628, metadata !DIExpression()), !dbg !648
+  %source18 = load ptr, ptr %source.addr, align 8, !dbg !649
+  %i19 = load i64, ptr %i, align 8, !dbg !649
+  %elem_ptr20 = getelementptr i64, ptr %source18, i64 %i19, !dbg !649
+  %arr_elem21 = load i64, ptr %elem_ptr20, align 8, !dbg !649
+  %divisor = load i64, ptr %divisor.addr, align 8, !dbg !649
+  %div = udiv i64 %arr_elem21, %divisor, !dbg !649
+  %rem = urem i64 %div, 256, !dbg !649
+  store i64 %rem, ptr %digit, align 8, !dbg !649
+  %source22 = load ptr, ptr %source.addr, align 8, !dbg !650
+  %i23 = load i64, ptr %i, align 8, !dbg !650
+  %elem_ptr24 = getelementptr i64, ptr %source22, i64 %i23, !dbg !650
+  %arr_elem25 = load i64, ptr %elem_ptr24, align 8, !dbg !650
+  %target = load ptr, ptr %target.addr, align 8, !dbg !651
+  %digit26 = load i64, ptr %digit, align 8, !dbg !652
+  %elem_ptr27 = getelementptr inbounds [256 x i64], ptr %offsets, i64 0, i64 %digit26, !dbg !652
+  %arr_elem28 = load i64, ptr %elem_ptr27, align 8, !dbg !652
+  %elem_ptr29 = getelementptr i64, ptr %target, i64 %arr_elem28, !dbg !652
+  store i64 %arr_elem25, ptr %elem_ptr29, align 8, !dbg !652
+  %digit30 = load i64, ptr %digit, align 8, !dbg !653
+  %elem_ptr31 = getelementptr inbounds [256 x i64], ptr %offsets, i64 0, i64 %digit30, !dbg !653
+  %arr_elem32 = load i64, ptr %elem_ptr31, align 8, !dbg !653
+  %add33 = add i64 %arr_elem32, 1, !dbg !653
+  %digit34 = load i64, ptr %digit, align 8, !dbg !653
+  %elem_ptr35 = getelementptr inbounds [256 x i64], ptr %offsets, i64 0, i64 %digit34, !dbg !653
+  store i64 %add33, ptr %elem_ptr35, align 8, !dbg !653
+  br label %for.post13, !dbg !653
+
+for.post13:                                       ; preds = %for.body12
+  %inc_dec.load36 = load i64, ptr %i, align 8, !dbg !654
+  %inc37 = add i64 %inc_dec.load36, 1, !dbg !654
+  store i64 %inc37, ptr %i, align 8, !dbg !654
+  br label %for.cond11, !dbg !654, !llvm.loop !655
+
+for.end14:                                        ; preds = %for.cond11
+  %target38 = load ptr, ptr %target.addr, align 8, !dbg !656
+  ret ptr %target38, !dbg !656
+}
+
+; Function Attrs: nounwind readnone willreturn
+define internal fastcc ptr @"other_buffer<u64>"(ptr %0, ptr %1, ptr %2) #1 !dbg !657 {
+entry:
+  %buffer.addr = alloca ptr, align 8, !dbg !664
+  store ptr %0, ptr %buffer.addr, align 8, !dbg !664
+  call void @llvm.dbg.declare(metadata ptr %buffer.addr, metadata !661, metadata !DIExpression()), !dbg !665
+  %first.addr = alloca ptr, align 8, !dbg !664
+  store ptr %1, ptr %first.addr, align 8, !dbg !664
+  call void @llvm.dbg.declare(metadata ptr %first.addr, metadata !662, metadata !DIExpression()), !dbg !666
+  %second.addr = alloca ptr, align 8, !dbg !664
+  store ptr %2, ptr %second.addr, align 8, !dbg !664
+  call void @llvm.dbg.declare(metadata ptr %second.addr, metadata !663, metadata !DIExpression()), !dbg !667
+  %buffer = load ptr, ptr %buffer.addr, align 8, !dbg !668
+  %first = load ptr, ptr %first.addr, align 8, !dbg !668
+  %eq = icmp eq ptr %buffer, %first, !dbg !668
+  br i1 %eq, label %if.then, label %if.else, !dbg !668
+
+if.then:                                          ; preds = %entry
+  %second = load ptr, ptr %second.addr, align 8, !dbg !669
+  ret ptr %second, !dbg !669
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !669
+
+if.join:                                          ; preds = %if.else
+  %first1 = load ptr, ptr %first.addr, align 8, !dbg !670
+  ret ptr %first1, !dbg !670
+}
+
+; Function Attrs: nofree nosync nounwind readnone speculatable willreturn
+declare void @llvm.dbg.declare(metadata, metadata, metadata) #3
+
+attributes #0 = { nounwind }
+attributes #1 = { nounwind readnone willreturn }
+attributes #2 = { alwaysinline nounwind }
+attributes #3 = { nofree nosync nounwind readnone speculatable willreturn }
+
+!llvm.dbg.cu = !{!0}
+!llvm.module.flags = !{!2, !3}
+
+!0 = distinct !DICompileUnit(language: DW_LANG_C, file: !1, producer: "ShiroC Compiler\00", isOptimized: false, runtimeVersion: 0, emissionKind: FullDebug, splitDebugInlining: false)
+!1 = !DIFile(filename: "Collections", directory: ".")
+!2 = !{i32 2, !"Dwarf Version", i32 4}
+!3 = !{i32 2, !"Debug Info Version", i32 3}
+!4 = distinct !DISubprogram(name: "collection_free", linkageName: "collection_free", scope: !5, file: !5, line: 17, type: !6, scopeLine: 17, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !10)
+!5 = !DIFile(filename: "alloc.shiro", directory: "/tmp/asan/src/std/Collections")
+!6 = !DISubroutineType(types: !7)
+!7 = !{null, !8}
+!8 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !9, size: 64, dwarfAddressSpace: 0)
+!9 = !DIBasicType(name: "u8", size: 8, encoding: DW_ATE_unsigned_char)
+!10 = !{!11}
+!11 = !DILocalVariable(name: "ptr", arg: 1, scope: !4, file: !5, line: 17, type: !8)
+!12 = !DILocation(line: 17, column: 8, scope: !4)
+!13 = !DILocation(line: 17, column: 27, scope: !4)
+!14 = !DILocation(line: 18, column: 5, scope: !4)
+!15 = distinct !DISubprogram(name: "collection_allocate", linkageName: "collection_allocate", scope: !5, file: !5, line: 9, type: !16, scopeLine: 9, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !19)
+!16 = !DISubroutineType(types: !17)
+!17 = !{!8, !18}
+!18 = !DIBasicType(name: "usize", size: 64, encoding: DW_ATE_unsigned_char)
+!19 = !{!20, !21}
+!20 = !DILocalVariable(name: "size", arg: 1, scope: !15, file: !5, line: 9, type: !18)
+!21 = !DILocalVariable(name: "ptr", scope: !15, file: !5, line: 10, type: !8)
+!22 = !DILocation(line: 9, column: 8, scope: !15)
+!23 = !DILocation(line: 9, column: 31, scope: !15)
+!24 = !DILocation(line: 10, column: 5, scope: !15)
+!25 = !DILocation(line: 10, column: 15, scope: !15)
+!26 = !DILocation(line: 11, column: 9, scope: !15)
+!27 = !DILocation(line: 12, column: 9, scope: !15)
+!28 = !DILocation(line: 14, column: 5, scope: !15)
+!29 = distinct !DISubprogram(name: "tag", linkageName: "tag", scope: !30, file: !30, line: 175, type: !31, scopeLine: 175, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !34)
+!30 = !DIFile(filename: "hash_map.shiro", directory: "/tmp/asan/src/std/Collections")
+!31 = !DISubroutineType(types: !32)
+!32 = !{!9, !33}
+!33 = !DIBasicType(name: "u64", size: 64, encoding: DW_ATE_unsigned_char)
+!34 = !{!35}
+!35 = !DILocalVariable(name: "hash", arg: 1, scope: !29, file: !30, line: 175, type: !33)
+!36 = !DILocation(line: 175, column: 8, scope: !29)
+!37 = !DILocation(line: 175, column: 15, scope: !29)
+!38 = !DILocation(line: 176, column: 22, scope: !29)
+!39 = distinct !DISubprogram(name: "radix_sort", linkageName: "radix_sort", scope: !40, file: !40, line: 195, type: !41, scopeLine: 195, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !47)
+!40 = !DIFile(filename: "sort.shiro", directory: "/tmp/asan/src/std/Collections")
+!41 = !DISubroutineType(types: !42)
+!42 = !{null, !43}
+!43 = !DICompositeType(tag: DW_TAG_structure_type, name: "view[u8]", file: !40, size: 128, align: 64, elements: !44)
+!44 = !{!45, !46}
+!45 = !DIDerivedType(tag: DW_TAG_member, name: "len", file: !40, baseType: !18, size: 64, align: 64)
+!46 = !DIDerivedType(tag: DW_TAG_member, name: "data", file: !40, baseType: !8, size: 64, align: 64, offset: 64)
+!47 = !{!48}
+!48 = !DILocalVariable(name: "v", arg: 1, scope: !39, file: !40, line: 195, type: !43)
+!49 = !DILocation(line: 195, column: 8, scope: !39)
+!50 = !DILocation(line: 195, column: 22, scope: !39)
+!51 = !DILocation(line: 196, column: 5, scope: !39)
+!52 = distinct !DISubprogram(name: "radix_sort", linkageName: "radix_sort", scope: !40, file: !40, line: 199, type: !53, scopeLine: 199, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !60)
+!53 = !DISubroutineType(types: !54)
+!54 = !{null, !55}
+!55 = !DICompositeType(tag: DW_TAG_structure_type, name: "view[u16]", file: !40, size: 128, align: 64, elements: !56)
+!56 = !{!45, !57}
+!57 = !DIDerivedType(tag: DW_TAG_member, name: "data", file: !40, baseType: !58, size: 64, align: 64, offset: 64)
+!58 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !59, size: 64, dwarfAddressSpace: 0)
+!59 = !DIBasicType(name: "u16", size: 16, encoding: DW_ATE_unsigned_char)
+!60 = !{!61}
+!61 = !DILocalVariable(name: "v", arg: 1, scope: !52, file: !40, line: 199, type: !55)
+!62 = !DILocation(line: 199, column: 8, scope: !52)
+!63 = !DILocation(line: 199, column: 22, scope: !52)
+!64 = !DILocation(line: 200, column: 5, scope: !52)
+!65 = distinct !DISubprogram(name: "radix_sort", linkageName: "radix_sort", scope: !40, file: !40, line: 203, type: !66, scopeLine: 203, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !73)
+!66 = !DISubroutineType(types: !67)
+!67 = !{null, !68}
+!68 = !DICompositeType(tag: DW_TAG_structure_type, name: "view[u32]", file: !40, size: 128, align: 64, elements: !69)
+!69 = !{!45, !70}
+!70 = !DIDerivedType(tag: DW_TAG_member, name: "data", file: !40, baseType: !71, size: 64, align: 64, offset: 64)
+!71 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !72, size: 64, dwarfAddressSpace: 0)
+!72 = !DIBasicType(name: "u32", size: 32, encoding: DW_ATE_unsigned_char)
+!73 = !{!74}
+!74 = !DILocalVariable(name: "v", arg: 1, scope: !65, file: !40, line: 203, type: !68)
+!75 = !DILocation(line: 203, column: 8, scope: !65)
+!76 = !DILocation(line: 203, column: 22, scope: !65)
+!77 = !DILocation(line: 204, column: 5, scope: !65)
+!78 = distinct !DISubprogram(name: "radix_sort", linkageName: "radix_sort", scope: !40, file: !40, line: 207, type: !79, scopeLine: 207, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !85)
+!79 = !DISubroutineType(types: !80)
+!80 = !{null, !81}
+!81 = !DICompositeType(tag: DW_TAG_structure_type, name: "view[u64]", file: !40, size: 128, align: 64, elements: !82)
+!82 = !{!45, !83}
+!83 = !DIDerivedType(tag: DW_TAG_member, name: "data", file: !40, baseType: !84, size: 64, align: 64, offset: 64)
+!84 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !33, size: 64, dwarfAddressSpace: 0)
+!85 = !{!86}
+!86 = !DILocalVariable(name: "v", arg: 1, scope: !78, file: !40, line: 207, type: !81)
+!87 = !DILocation(line: 207, column: 8, scope: !78)
+!88 = !DILocation(line: 207, column: 22, scope: !78)
+!89 = !DILocation(line: 208, column: 5, scope: !78)
+!90 = distinct !DISubprogram(name: "radix_sort_bytes<u8>", linkageName: "radix_sort_bytes<u8>", scope: !5, file: !5, line: 211, type: !91, scopeLine: 211, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !97)
+!91 = !DISubroutineType(types: !92)
+!92 = !{null, !93, !18}
+!93 = !DICompositeType(tag: DW_TAG_structure_type, name: "view[u8]", file: !5, size: 128, align: 64, elements: !94)
+!94 = !{!95, !96}
+!95 = !DIDerivedType(tag: DW_TAG_member, name: "len", file: !5, baseType: !18, size: 64, align: 64)
+!96 = !DIDerivedType(tag: DW_TAG_member, name: "data", file: !5, baseType: !8, size: 64, align: 64, offset: 64)
+!97 = !{!98, !99, !100, !101, !105, !106, !107, !108, !109, !110, !111, !112, !113, !114}
+!98 = !DILocalVariable(name: "v", arg: 1, scope: !90, file: !5, line: 211, type: !93)
+!99 = !DILocalVariable(name: "bytes", arg: 2, scope: !90, file: !5, line: 211, type: !18)
+!100 = !DILocalVariable(name: "count", scope: !90, file: !5, line: 212, type: !18)
+!101 = !DILocalVariable(name: "counts", scope: !90, file: !5, line: 218, type: !102)
+!102 = !DICompositeType(tag: DW_TAG_array_type, baseType: !18, size: 131072, align: 64, elements: !103)
+!103 = !{!104}
+!104 = !DISubrange(count: 2048, lowerBound: 0)
+!105 = !DILocalVariable(name: "slot", scope: !90, file: !5, line: 219, type: !18)
+!106 = !DILocalVariable(name: "i", scope: !90, file: !5, line: 222, type: !18)
+!107 = !DILocalVariable(name: "key", scope: !90, file: !5, line: 223, type: !33)
+!108 = !DILocalVariable(name: "pass", scope: !90, file: !5, line: 224, type: !18)
+!109 = !DILocalVariable(name: "none", scope: !90, file: !5, line: 230, type: !8)
+!110 = !DILocalVariable(name: "size", scope: !90, file: !5, line: 231, type: !18)
+!111 = !DILocalVariable(name: "from", scope: !90, file: !5, line: 232, type: !8)
+!112 = !DILocalVariable(name: "to", scope: !90, file: !5, line: 233, type: !8)
+!113 = !DILocalVariable(name: "buffer", scope: !90, file: !5, line: 234, type: !8)
+!114 = !DILocalVariable(name: "sorted", scope: !90, file: !5, line: 237, type: !8)
+!115 = !DILocation(line: 211, column: 12, scope: !90)
+!116 = !DILocation(line: 211, column: 35, scope: !90)
+!117 = !DILocation(line: 211, column: 47, scope: !90)
+!118 = !DILocation(line: 212, column: 5, scope: !90)
+!119 = !DILocation(line: 0, scope: !90)
+!120 = !DILocation(line: 213, column: 9, scope: !90)
+!121 = !DILocation(line: 214, column: 9, scope: !90)
+!122 = !DILocation(line: 218, column: 5, scope: !90)
+!123 = !DILocation(line: 219, column: 10, scope: !90)
+!124 = !DILocation(line: 219, column: 29, scope: !90)
+!125 = !DILocation(line: 219, column: 36, scope: !90)
+!126 = !DILocation(line: 220, column: 9, scope: !90)
+!127 = !DILocation(line: 219, column: 54, scope: !90)
+!128 = distinct !{!128, !129}
+!129 = !{!"llvm.loop.mustprogress"}
+!130 = !DILocation(line: 222, column: 10, scope: !90)
+!131 = !DILocation(line: 222, column: 26, scope: !90)
+!132 = !DILocation(line: 223, column: 9, scope: !90)
+!133 = !DILocation(line: 223, column: 19, scope: !90)
+!134 = !DILocation(line: 224, column: 14, scope: !90)
+!135 = !DILocation(line: 222, column: 37, scope: !90)
+!136 = distinct !{!136, !129}
+!137 = !DILocation(line: 230, column: 5, scope: !90)
+!138 = !DILocation(line: 231, column: 5, scope: !90)
+!139 = !DILocation(line: 231, column: 18, scope: !90)
+!140 = !DILocation(line: 232, column: 5, scope: !90)
+!141 = !DILocation(line: 232, column: 17, scope: !90)
+!142 = !DILocation(line: 233, column: 5, scope: !90)
+!143 = !DILocation(line: 233, column: 34, scope: !90)
+!144 = !DILocation(line: 234, column: 5, scope: !90)
+!145 = !DILocation(line: 237, column: 5, scope: !90)
+!146 = !DILocation(line: 237, column: 18, scope: !90)
+!147 = !DILocation(line: 237, column: 47, scope: !90)
+!148 = !DILocation(line: 238, column: 9, scope: !90)
+!149 = !DILocation(line: 224, column: 33, scope: !90)
+!150 = !DILocation(line: 225, column: 20, scope: !90)
+!151 = !DILocation(line: 225, column: 39, scope: !90)
+!152 = !DILocation(line: 226, column: 19, scope: !90)
+!153 = !DILocation(line: 224, column: 47, scope: !90)
+!154 = distinct !{!154, !129}
+!155 = !DILocation(line: 239, column: 18, scope: !90)
+!156 = !DILocation(line: 239, column: 37, scope: !90)
+!157 = !DILocation(line: 239, column: 77, scope: !90)
+!158 = !DILocation(line: 241, column: 9, scope: !90)
+!159 = !DILocation(line: 242, column: 18, scope: !90)
+!160 = !DILocation(line: 242, column: 37, scope: !90)
+!161 = !DILocation(line: 242, column: 77, scope: !90)
+!162 = !DILocation(line: 243, column: 18, scope: !90)
+!163 = !DILocation(line: 243, column: 37, scope: !90)
+!164 = !DILocation(line: 243, column: 77, scope: !90)
+!165 = !DILocation(line: 245, column: 9, scope: !90)
+!166 = !DILocation(line: 246, column: 18, scope: !90)
+!167 = !DILocation(line: 246, column: 37, scope: !90)
+!168 = !DILocation(line: 246, column: 77, scope: !90)
+!169 = !DILocation(line: 247, column: 18, scope: !90)
+!170 = !DILocation(line: 247, column: 37, scope: !90)
+!171 = !DILocation(line: 247, column: 77, scope: !90)
+!172 = !DILocation(line: 248, column: 18, scope: !90)
+!173 = !DILocation(line: 248, column: 37, scope: !90)
+!174 = !DILocation(line: 248, column: 77, scope: !90)
+!175 = !DILocation(line: 249, column: 18, scope: !90)
+!176 = !DILocation(line: 249, column: 37, scope: !90)
+!177 = !DILocation(line: 249, column: 77, scope: !90)
+!178 = !DILocation(line: 252, column: 9, scope: !90)
+!179 = !DILocation(line: 253, column: 9, scope: !90)
+!180 = !DILocation(line: 253, column: 48, scope: !90)
+!181 = !DILocation(line: 255, column: 5, scope: !90)
+!182 = distinct !DISubprogram(name: "radix_sort_bytes<u16>", linkageName: "radix_sort_bytes<u16>", scope: !5, file: !5, line: 211, type: !183, scopeLine: 211, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !188)
+!183 = !DISubroutineType(types: !184)
+!184 = !{null, !185, !18}
+!185 = !DICompositeType(tag: DW_TAG_structure_type, name: "view[u16]", file: !5, size: 128, align: 64, elements: !186)
+!186 = !{!95, !187}
+!187 = !DIDerivedType(tag: DW_TAG_member, name: "data", file: !5, baseType: !58, size: 64, align: 64, offset: 64)
+!188 = !{!189, !190, !191, !192, !193, !194, !195, !196, !197, !198, !199, !200, !201, !202}
+!189 = !DILocalVariable(name: "v", arg: 1, scope: !182, file: !5, line: 211, type: !185)
+!190 = !DILocalVariable(name: "bytes", arg: 2, scope: !182, file: !5, line: 211, type: !18)
+!191 = !DILocalVariable(name: "count", scope: !182, file: !5, line: 212, type: !18)
+!192 = !DILocalVariable(name: "counts", scope: !182, file: !5, line: 218, type: !102)
+!193 = !DILocalVariable(name: "slot", scope: !182, file: !5, line: 219, type: !18)
+!194 = !DILocalVariable(name: "i", scope: !182, file: !5, line: 222, type: !18)
+!195 = !DILocalVariable(name: "key", scope: !182, file: !5, line: 223, type: !33)
+!196 = !DILocalVariable(name: "pass", scope: !182, file: !5, line: 224, type: !18)
+!197 = !DILocalVariable(name: "none", scope: !182, file: !5, line: 230, type: !58)
+!198 = !DILocalVariable(name: "size", scope: !182, file: !5, line: 231, type: !18)
+!199 = !DILocalVariable(name: "from", scope: !182, file: !5, line: 232, type: !58)
+!200 = !DILocalVariable(name: "to", scope: !182, file: !5, line: 233, type: !58)
+!201 = !DILocalVariable(name: "buffer", scope: !182, file: !5, line: 234, type: !58)
+!202 = !DILocalVariable(name: "sorted", scope: !182, file: !5, line: 237, type: !58)
+!203 = !DILocation(line: 211, column: 12, scope: !182)
+!204 = !DILocation(line: 211, column: 35, scope: !182)
+!205 = !DILocation(line: 211, column: 47, scope: !182)
+!206 = !DILocation(line: 212, column: 5, scope: !182)
+!207 = !DILocation(line: 0, scope: !182)
+!208 = !DILocation(line: 213, column: 9, scope: !182)
+!209 = !DILocation(line: 214, column: 9, scope: !182)
+!210 = !DILocation(line: 218, column: 5, scope: !182)
+!211 = !DILocation(line: 219, column: 10, scope: !182)
+!212 = !DILocation(line: 219, column: 29, scope: !182)
+!213 = !DILocation(line: 219, column: 36, scope: !182)
+!214 = !DILocation(line: 220, column: 9, scope: !182)
+!215 = !DILocation(line: 219, column: 54, scope: !182)
+!216 = distinct !{!216, !129}
+!217 = !DILocation(line: 222, column: 10, scope: !182)
+!218 = !DILocation(line: 222, column: 26, scope: !182)
+!219 = !DILocation(line: 223, column: 9, scope: !182)
+!220 = !DILocation(line: 223, column: 19, scope: !182)
+!221 = !DILocation(line: 224, column: 14, scope: !182)
+!222 = !DILocation(line: 222, column: 37, scope: !182)
+!223 = distinct !{!223, !129}
+!224 = !DILocation(line: 230, column: 5, scope: !182)
+!225 = !DILocation(line: 231, column: 5, scope: !182)
+!226 = !DILocation(line: 231, column: 18, scope: !182)
+!227 = !DILocation(line: 232, column: 5, scope: !182)
+!228 = !DILocation(line: 232, column: 17, scope: !182)
+!229 = !DILocation(line: 233, column: 5, scope: !182)
+!230 = !DILocation(line: 233, column: 34, scope: !182)
+!231 = !DILocation(line: 234, column: 5, scope: !182)
+!232 = !DILocation(line: 237, column: 5, scope: !182)
+!233 = !DILocation(line: 237, column: 18, scope: !182)
+!234 = !DILocation(line: 237, column: 47, scope: !182)
+!235 = !DILocation(line: 238, column: 9, scope: !182)
+!236 = !DILocation(line: 224, column: 33, scope: !182)
+!237 = !DILocation(line: 225, column: 20, scope: !182)
+!238 = !DILocation(line: 225, column: 39, scope: !182)
+!239 = !DILocation(line: 226, column: 19, scope: !182)
+!240 = !DILocation(line: 224, column: 47, scope: !182)
+!241 = distinct !{!241, !129}
+!242 = !DILocation(line: 239, column: 18, scope: !182)
+!243 = !DILocation(line: 239, column: 37, scope: !182)
+!244 = !DILocation(line: 239, column: 77, scope: !182)
+!245 = !DILocation(line: 241, column: 9, scope: !182)
+!246 = !DILocation(line: 242, column: 18, scope: !182)
+!247 = !DILocation(line: 242, column: 37, scope: !182)
+!248 = !DILocation(line: 242, column: 77, scope: !182)
+!249 = !DILocation(line: 243, column: 18, scope: !182)
+!250 = !DILocation(line: 243, column: 37, scope: !182)
+!251 = !DILocation(line: 243, column: 77, scope: !182)
+!252 = !DILocation(line: 245, column: 9, scope: !182)
+!253 = !DILocation(line: 246, column: 18, scope: !182)
+!254 = !DILocation(line: 246, column: 37, scope: !182)
+!255 = !DILocation(line: 246, column: 77, scope: !182)
+!256 = !DILocation(line: 247, column: 18, scope: !182)
+!257 = !DILocation(line: 247, column: 37, scope: !182)
+!258 = !DILocation(line: 247, column: 77, scope: !182)
+!259 = !DILocation(line: 248, column: 18, scope: !182)
+!260 = !DILocation(line: 248, column: 37, scope: !182)
+!261 = !DILocation(line: 248, column: 77, scope: !182)
+!262 = !DILocation(line: 249, column: 18, scope: !182)
+!263 = !DILocation(line: 249, column: 37, scope: !182)
+!264 = !DILocation(line: 249, column: 77, scope: !182)
+!265 = !DILocation(line: 252, column: 9, scope: !182)
+!266 = !DILocation(line: 253, column: 9, scope: !182)
+!267 = !DILocation(line: 253, column: 48, scope: !182)
+!268 = !DILocation(line: 255, column: 5, scope: !182)
+!269 = distinct !DISubprogram(name: "radix_sort_bytes<u32>", linkageName: "radix_sort_bytes<u32>", scope: !5, file: !5, line: 211, type: !270, scopeLine: 211, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !275)
+!270 = !DISubroutineType(types: !271)
+!271 = !{null, !272, !18}
+!272 = !DICompositeType(tag: DW_TAG_structure_type, name: "view[u32]", file: !5, size: 128, align: 64, elements: !273)
+!273 = !{!95, !274}
+!274 = !DIDerivedType(tag: DW_TAG_member, name: "data", file: !5, baseType: !71, size: 64, align: 64, offset: 64)
+!275 = !{!276, !277, !278, !279, !280, !281, !282, !283, !284, !285, !286, !287, !288, !289}
+!276 = !DILocalVariable(name: "v", arg: 1, scope: !269, file: !5, line: 211, type: !272)
+!277 = !DILocalVariable(name: "bytes", arg: 2, scope: !269, file: !5, line: 211, type: !18)
+!278 = !DILocalVariable(name: "count", scope: !269, file: !5, line: 212, type: !18)
+!279 = !DILocalVariable(name: "counts", scope: !269, file: !5, line: 218, type: !102)
+!280 = !DILocalVariable(name: "slot", scope: !269, file: !5, line: 219, type: !18)
+!281 = !DILocalVariable(name: "i", scope: !269, file: !5, line: 222, type: !18)
+!282 = !DILocalVariable(name: "key", scope: !269, file: !5, line: 223, type: !33)
+!283 = !DILocalVariable(name: "pass", scope: !269, file: !5, line: 224, type: !18)
+!284 = !DILocalVariable(name: "none", scope: !269, file: !5, line: 230, type: !71)
+!285 = !DILocalVariable(name: "size", scope: !269, file: !5, line: 231, type: !18)
+!286 = !DILocalVariable(name: "from", scope: !269, file: !5, line: 232, type: !71)
+!287 = !DILocalVariable(name: "to", scope: !269, file: !5, line: 233, type: !71)
+!288 = !DILocalVariable(name: "buffer", scope: !269, file: !5, line: 234, type: !71)
+!289 = !DILocalVariable(name: "sorted", scope: !269, file: !5, line: 237, type: !71)
+!290 = !DILocation(line: 211, column: 12, scope: !269)
+!291 = !DILocation(line: 211, column: 35, scope: !269)
+!292 = !DILocation(line: 211, column: 47, scope: !269)
+!293 = !DILocation(line: 212, column: 5, scope: !269)
+!294 = !DILocation(line: 0, scope: !269)
+!295 = !DILocation(line: 213, column: 9, scope: !269)
+!296 = !DILocation(line: 214, column: 9, scope: !269)
+!297 = !DILocation(line: 218, column: 5, scope: !269)
+!298 = !DILocation(line: 219, column: 10, scope: !269)
+!299 = !DILocation(line: 219, column: 29, scope: !269)
+!300 = !DILocation(line: 219, column: 36, scope: !269)
+!301 = !DILocation(line: 220, column: 9, scope: !269)
+!302 = !DILocation(line: 219, column: 54, scope: !269)
+!303 = distinct !{!303, !129}
+!304 = !DILocation(line: 222, column: 10, scope: !269)
+!305 = !DILocation(line: 222, column: 26, scope: !269)
+!306 = !DILocation(line: 223, column: 9, scope: !269)
+!307 = !DILocation(line: 223, column: 19, scope: !269)
+!308 = !DILocation(line: 224, column: 14, scope: !269)
+!309 = !DILocation(line: 222, column: 37, scope: !269)
+!310 = distinct !{!310, !129}
+!311 = !DILocation(line: 230, column: 5, scope: !269)
+!312 = !DILocation(line: 231, column: 5, scope: !269)
+!313 = !DILocation(line: 231, column: 18, scope: !269)
+!314 = !DILocation(line: 232, column: 5, scope: !269)
+!315 = !DILocation(line: 232, column: 17, scope: !269)
+!316 = !DILocation(line: 233, column: 5, scope: !269)
+!317 = !DILocation(line: 233, column: 34, scope: !269)
+!318 = !DILocation(line: 234, column: 5, scope: !269)
+!319 = !DILocation(line: 237, column: 5, scope: !269)
+!320 = !DILocation(line: 237, column: 18, scope: !269)
+!321 = !DILocation(line: 237, column: 47, scope: !269)
+!322 = !DILocation(line: 238, column: 9, scope: !269)
+!323 = !DILocation(line: 224, column: 33, scope: !269)
+!324 = !DILocation(line: 225, column: 20, scope: !269)
+!325 = !DILocation(line: 225, column: 39, scope: !269)
+!326 = !DILocation(line: 226, column: 19, scope: !269)
+!327 = !DILocation(line: 224, column: 47, scope: !269)
+!328 = distinct !{!328, !129}
+!329 = !DILocation(line: 239, column: 18, scope: !269)
+!330 = !DILocation(line: 239, column: 37, scope: !269)
+!331 = !DILocation(line: 239, column: 77, scope: !269)
+!332 = !DILocation(line: 241, column: 9, scope: !269)
+!333 = !DILocation(line: 242, column: 18, scope: !269)
+!334 = !DILocation(line: 242, column: 37, scope: !269)
+!335 = !DILocation(line: 242, column: 77, scope: !269)
+!336 = !DILocation(line: 243, column: 18, scope: !269)
+!337 = !DILocation(line: 243, column: 37, scope: !269)
+!338 = !DILocation(line: 243, column: 77, scope: !269)
+!339 = !DILocation(line: 245, column: 9, scope: !269)
+!340 = !DILocation(line: 246, column: 18, scope: !269)
+!341 = !DILocation(line: 246, column: 37, scope: !269)
+!342 = !DILocation(line: 246, column: 77, scope: !269)
+!343 = !DILocation(line: 247, column: 18, scope: !269)
+!344 = !DILocation(line: 247, column: 37, scope: !269)
+!345 = !DILocation(line: 247, column: 77, scope: !269)
+!346 = !DILocation(line: 248, column: 18, scope: !269)
+!347 = !DILocation(line: 248, column: 37, scope: !269)
+!348 = !DILocation(line: 248, column: 77, scope: !269)
+!349 = !DILocation(line: 249, column: 18, scope: !269)
+!350 = !DILocation(line: 249, column: 37, scope: !269)
+!351 = !DILocation(line: 249, column: 77, scope: !269)
+!352 = !DILocation(line: 252, column: 9, scope: !269)
+!353 = !DILocation(line: 253, column: 9, scope: !269)
+!354 = !DILocation(line: 253, column: 48, scope: !269)
+!355 = !DILocation(line: 255, column: 5, scope: !269)
+!356 = distinct !DISubprogram(name: "radix_sort_bytes<u64>", linkageName: "radix_sort_bytes<u64>", scope: !5, file: !5, line: 211, type: !357, scopeLine: 211, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !362)
+!357 = !DISubroutineType(types: !358)
+!358 = !{null, !359, !18}
+!359 = !DICompositeType(tag: DW_TAG_structure_type, name: "view[u64]", file: !5, size: 128, align: 64, elements: !360)
+!360 = !{!95, !361}
+!361 = !DIDerivedType(tag: DW_TAG_member, name: "data", file: !5, baseType: !84, size: 64, align: 64, offset: 64)
+!362 = !{!363, !364, !365, !366, !367, !368, !369, !370, !371, !372, !373, !374, !375, !376}
+!363 = !DILocalVariable(name: "v", arg: 1, scope: !356, file: !5, line: 211, type: !359)
+!364 = !DILocalVariable(name: "bytes", arg: 2, scope: !356, file: !5, line: 211, type: !18)
+!365 = !DILocalVariable(name: "count", scope: !356, file: !5, line: 212, type: !18)
+!366 = !DILocalVariable(name: "counts", scope: !356, file: !5, line: 218, type: !102)
+!367 = !DILocalVariable(name: "slot", scope: !356, file: !5, line: 219, type: !18)
+!368 = !DILocalVariable(name: "i", scope: !356, file: !5, line: 222, type: !18)
+!369 = !DILocalVariable(name: "key", scope: !356, file: !5, line: 223, type: !33)
+!370 = !DILocalVariable(name: "pass", scope: !356, file: !5, line: 224, type: !18)
+!371 = !DILocalVariable(name: "none", scope: !356, file: !5, line: 230, type: !84)
+!372 = !DILocalVariable(name: "size", scope: !356, file: !5, line: 231, type: !18)
+!373 = !DILocalVariable(name: "from", scope: !356, file: !5, line: 232, type: !84)
+!374 = !DILocalVariable(name: "to", scope: !356, file: !5, line: 233, type: !84)
+!375 = !DILocalVariable(name: "buffer", scope: !356, file: !5, line: 234, type: !84)
+!376 = !DILocalVariable(name: "sorted", scope: !356, file: !5, line: 237, type: !84)
+!377 = !DILocation(line: 211, column: 12, scope: !356)
+!378 = !DILocation(line: 211, column: 35, scope: !356)
+!379 = !DILocation(line: 211, column: 47, scope: !356)
+!380 = !DILocation(line: 212, column: 5, scope: !356)
+!381 = !DILocation(line: 0, scope: !356)
+!382 = !DILocation(line: 213, column: 9, scope: !356)
+!383 = !DILocation(line: 214, column: 9, scope: !356)
+!384 = !DILocation(line: 218, column: 5, scope: !356)
+!385 = !DILocation(line: 219, column: 10, scope: !356)
+!386 = !DILocation(line: 219, column: 29, scope: !356)
+!387 = !DILocation(line: 219, column: 36, scope: !356)
+!388 = !DILocation(line: 220, column: 9, scope: !356)
+!389 = !DILocation(line: 219, column: 54, scope: !356)
+!390 = distinct !{!390, !129}
+!391 = !DILocation(line: 222, column: 10, scope: !356)
+!392 = !DILocation(line: 222, column: 26, scope: !356)
+!393 = !DILocation(line: 223, column: 9, scope: !356)
+!394 = !DILocation(line: 223, column: 19, scope: !356)
+!395 = !DILocation(line: 224, column: 14, scope: !356)
+!396 = !DILocation(line: 222, column: 37, scope: !356)
+!397 = distinct !{!397, !129}
+!398 = !DILocation(line: 230, column: 5, scope: !356)
+!399 = !DILocation(line: 231, column: 5, scope: !356)
+!400 = !DILocation(line: 231, column: 18, scope: !356)
+!401 = !DILocation(line: 232, column: 5, scope: !356)
+!402 = !DILocation(line: 232, column: 17, scope: !356)
+!403 = !DILocation(line: 233, column: 5, scope: !356)
+!404 = !DILocation(line: 233, column: 34, scope: !356)
+!405 = !DILocation(line: 234, column: 5, scope: !356)
+!406 = !DILocation(line: 237, column: 5, scope: !356)
+!407 = !DILocation(line: 237, column: 18, scope: !356)
+!408 = !DILocation(line: 237, column: 47, scope: !356)
+!409 = !DILocation(line: 238, column: 9, scope: !356)
+!410 = !DILocation(line: 224, column: 33, scope: !356)
+!411 = !DILocation(line: 225, column: 20, scope: !356)
+!412 = !DILocation(line: 225, column: 39, scope: !356)
+!413 = !DILocation(line: 226, column: 19, scope: !356)
+!414 = !DILocation(line: 224, column: 47, scope: !356)
+!415 = distinct !{!415, !129}
+!416 = !DILocation(line: 239, column: 18, scope: !356)
+!417 = !DILocation(line: 239, column: 37, scope: !356)
+!418 = !DILocation(line: 239, column: 77, scope: !356)
+!419 = !DILocation(line: 241, column: 9, scope: !356)
+!420 = !DILocation(line: 242, column: 18, scope: !356)
+!421 = !DILocation(line: 242, column: 37, scope: !356)
+!422 = !DILocation(line: 242, column: 77, scope: !356)
+!423 = !DILocation(line: 243, column: 18, scope: !356)
+!424 = !DILocation(line: 243, column: 37, scope: !356)
+!425 = !DILocation(line: 243, column: 77, scope: !356)
+!426 = !DILocation(line: 245, column: 9, scope: !356)
+!427 = !DILocation(line: 246, column: 18, scope: !356)
+!428 = !DILocation(line: 246, column: 37, scope: !356)
+!429 = !DILocation(line: 246, column: 77, scope: !356)
+!430 = !DILocation(line: 247, column: 18, scope: !356)
+!431 = !DILocation(line: 247, column: 37, scope: !356)
+!432 = !DILocation(line: 247, column: 77, scope: !356)
+!433 = !DILocation(line: 248, column: 18, scope: !356)
+!434 = !DILocation(line: 248, column: 37, scope: !356)
+!435 = !DILocation(line: 248, column: 77, scope: !356)
+!436 = !DILocation(line: 249, column: 18, scope: !356)
+!437 = !DILocation(line: 249, column: 37, scope: !356)
+!438 = !DILocation(line: 249, column: 77, scope: !356)
+!439 = !DILocation(line: 252, column: 9, scope: !356)
+!440 = !DILocation(line: 253, column: 9, scope: !356)
+!441 = !DILocation(line: 253, column: 48, scope: !356)
+!442 = !DILocation(line: 255, column: 5, scope: !356)
+!443 = distinct !DISubprogram(name: "radix_pass<u8>", linkageName: "radix_pass<u8>", scope: !5, file: !5, line: 260, type: !444, scopeLine: 260, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !447)
+!444 = !DISubroutineType(types: !445)
+!445 = !{!8, !8, !8, !18, !446, !33}
+!446 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !18, size: 64, dwarfAddressSpace: 0)
+!447 = !{!448, !449, !450, !451, !452, !453, !457, !458, !459, !460}
+!448 = !DILocalVariable(name: "source", arg: 1, scope: !443, file: !5, line: 260, type: !8)
+!449 = !DILocalVariable(name: "target", arg: 2, scope: !443, file: !5, line: 260, type: !8)
+!450 = !DILocalVariable(name: "count", arg: 3, scope: !443, file: !5, line: 260, type: !18)
+!451 = !DILocalVariable(name: "counts", arg: 4, scope: !443, file: !5, line: 260, type: !446)
+!452 = !DILocalVariable(name: "divisor", arg: 5, scope: !443, file: !5, line: 260, type: !33)
+!453 = !DILocalVariable(name: "offsets", scope: !443, file: !5, line: 261, type: !454)
+!454 = !DICompositeType(tag: DW_TAG_array_type, baseType: !18, size: 16384, align: 64, elements: !455)
+!455 = !{!456}
+!456 = !DISubrange(count: 256, lowerBound: 0)
+!457 = !DILocalVariable(name: "offset", scope: !443, file: !5, line: 262, type: !18)
+!458 = !DILocalVariable(name: "value", scope: !443, file: !5, line: 263, type: !18)
+!459 = !DILocalVariable(name: "i", scope: !443, file: !5, line: 271, type: !18)
+!460 = !DILocalVariable(name: "digit", scope: !443, file: !5, line: 272, type: !18)
+!461 = !DILocation(line: 260, column: 20, scope: !443)
+!462 = !DILocation(line: 260, column: 37, scope: !443)
+!463 = !DILocation(line: 260, column: 49, scope: !443)
+!464 = !DILocation(line: 260, column: 61, scope: !443)
+!465 = !DILocation(line: 260, column: 75, scope: !443)
+!466 = !DILocation(line: 260, column: 91, scope: !443)
+!467 = !DILocation(line: 261, column: 5, scope: !443)
+!468 = !DILocation(line: 262, column: 5, scope: !443)
+!469 = !DILocation(line: 263, column: 10, scope: !443)
+!470 = !DILocation(line: 263, column: 30, scope: !443)
+!471 = !DILocation(line: 264, column: 13, scope: !443)
+!472 = !DILocation(line: 263, column: 48, scope: !443)
+!473 = distinct !{!473, !129}
+!474 = !DILocation(line: 271, column: 10, scope: !443)
+!475 = !DILocation(line: 265, column: 13, scope: !443)
+!476 = !DILocation(line: 267, column: 9, scope: !443)
+!477 = !DILocation(line: 268, column: 9, scope: !443)
+!478 = !DILocation(line: 268, column: 19, scope: !443)
+!479 = !DILocation(line: 271, column: 26, scope: !443)
+!480 = !DILocation(line: 272, column: 9, scope: !443)
+!481 = !DILocation(line: 272, column: 23, scope: !443)
+!482 = !DILocation(line: 273, column: 34, scope: !443)
+!483 = !DILocation(line: 273, column: 9, scope: !443)
+!484 = !DILocation(line: 273, column: 16, scope: !443)
+!485 = !DILocation(line: 274, column: 9, scope: !443)
+!486 = !DILocation(line: 271, column: 37, scope: !443)
+!487 = distinct !{!487, !129}
+!488 = !DILocation(line: 276, column: 5, scope: !443)
+!489 = distinct !DISubprogram(name: "other_buffer<u8>", linkageName: "other_buffer<u8>", scope: !5, file: !5, line: 279, type: !490, scopeLine: 279, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !492)
+!490 = !DISubroutineType(types: !491)
+!491 = !{!8, !8, !8, !8}
+!492 = !{!493, !494, !495}
+!493 = !DILocalVariable(name: "buffer", arg: 1, scope: !489, file: !5, line: 279, type: !8)
+!494 = !DILocalVariable(name: "first", arg: 2, scope: !489, file: !5, line: 279, type: !8)
+!495 = !DILocalVariable(name: "second", arg: 3, scope: !489, file: !5, line: 279, type: !8)
+!496 = !DILocation(line: 279, column: 1, scope: !489)
+!497 = !DILocation(line: 279, column: 20, scope: !489)
+!498 = !DILocation(line: 279, column: 32, scope: !489)
+!499 = !DILocation(line: 279, column: 43, scope: !489)
+!500 = !DILocation(line: 280, column: 9, scope: !489)
+!501 = !DILocation(line: 281, column: 9, scope: !489)
+!502 = !DILocation(line: 283, column: 5, scope: !489)
+!503 = distinct !DISubprogram(name: "radix_pass<u16>", linkageName: "radix_pass<u16>", scope: !5, file: !5, line: 260, type: !504, scopeLine: 260, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !506)
+!504 = !DISubroutineType(types: !505)
+!505 = !{!58, !58, !58, !18, !446, !33}
+!506 = !{!507, !508, !509, !510, !511, !512, !513, !514, !515, !516}
+!507 = !DILocalVariable(name: "source", arg: 1, scope: !503, file: !5, line: 260, type: !58)
+!508 = !DILocalVariable(name: "target", arg: 2, scope: !503, file: !5, line: 260, type: !58)
+!509 = !DILocalVariable(name: "count", arg: 3, scope: !503, file: !5, line: 260, type: !18)
+!510 = !DILocalVariable(name: "counts", arg: 4, scope: !503, file: !5, line: 260, type: !446)
+!511 = !DILocalVariable(name: "divisor", arg: 5, scope: !503, file: !5, line: 260, type: !33)
+!512 = !DILocalVariable(name: "offsets", scope: !503, file: !5, line: 261, type: !454)
+!513 = !DILocalVariable(name: "offset", scope: !503, file: !5, line: 262, type: !18)
+!514 = !DILocalVariable(name: "value", scope: !503, file: !5, line: 263, type: !18)
+!515 = !DILocalVariable(name: "i", scope: !503, file: !5, line: 271, type: !18)
+!516 = !DILocalVariable(name: "digit", scope: !503, file: !5, line: 272, type: !18)
+!517 = !DILocation(line: 260, column: 20, scope: !503)
+!518 = !DILocation(line: 260, column: 37, scope: !503)
+!519 = !DILocation(line: 260, column: 49, scope: !503)
+!520 = !DILocation(line: 260, column: 61, scope: !503)
+!521 = !DILocation(line: 260, column: 75, scope: !503)
+!522 = !DILocation(line: 260, column: 91, scope: !503)
+!523 = !DILocation(line: 261, column: 5, scope: !503)
+!524 = !DILocation(line: 262, column: 5, scope: !503)
+!525 = !DILocation(line: 263, column: 10, scope: !503)
+!526 = !DILocation(line: 263, column: 30, scope: !503)
+!527 = !DILocation(line: 264, column: 13, scope: !503)
+!528 = !DILocation(line: 263, column: 48, scope: !503)
+!529 = distinct !{!529, !129}
+!530 = !DILocation(line: 271, column: 10, scope: !503)
+!531 = !DILocation(line: 265, column: 13, scope: !503)
+!532 = !DILocation(line: 267, column: 9, scope: !503)
+!533 = !DILocation(line: 268, column: 9, scope: !503)
+!534 = !DILocation(line: 268, column: 19, scope: !503)
+!535 = !DILocation(line: 271, column: 26, scope: !503)
+!536 = !DILocation(line: 272, column: 9, scope: !503)
+!537 = !DILocation(line: 272, column: 23, scope: !503)
+!538 = !DILocation(line: 273, column: 34, scope: !503)
+!539 = !DILocation(line: 273, column: 9, scope: !503)
+!540 = !DILocation(line: 273, column: 16, scope: !503)
+!541 = !DILocation(line: 274, column: 9, scope: !503)
+!542 = !DILocation(line: 271, column: 37, scope: !503)
+!543 = distinct !{!543, !129}
+!544 = !DILocation(line: 276, column: 5, scope: !503)
+!545 = distinct !DISubprogram(name: "other_buffer<u16>", linkageName: "other_buffer<u16>", scope: !5, file: !5, line: 279, type: !546, scopeLine: 279, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !548)
+!546 = !DISubroutineType(types: !547)
+!547 = !{!58, !58, !58, !58}
+!548 = !{!549, !550, !551}
+!549 = !DILocalVariable(name: "buffer", arg: 1, scope: !545, file: !5, line: 279, type: !58)
+!550 = !DILocalVariable(name: "first", arg: 2, scope: !545, file: !5, line: 279, type: !58)
+!551 = !DILocalVariable(name: "second", arg: 3, scope: !545, file: !5, line: 279, type: !58)
+!552 = !DILocation(line: 279, column: 1, scope: !545)
+!553 = !DILocation(line: 279, column: 20, scope: !545)
+!554 = !DILocation(line: 279, column: 32, scope: !545)
+!555 = !DILocation(line: 279, column: 43, scope: !545)
+!556 = !DILocation(line: 280, column: 9, scope: !545)
+!557 = !DILocation(line: 281, column: 9, scope: !545)
+!558 = !DILocation(line: 283, column: 5, scope: !545)
+!559 = distinct !DISubprogram(name: "radix_pass<u32>", linkageName: "radix_pass<u32>", scope: !5, file: !5, line: 260, type: !560, scopeLine: 260, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !562)
+!560 = !DISubroutineType(types: !561)
+!561 = !{!71, !71, !71, !18, !446, !33}
+!562 = !{!563, !564, !565, !566, !567, !568, !569, !570, !571, !572}
+!563 = !DILocalVariable(name: "source", arg: 1, scope: !559, file: !5, line: 260, type: !71)
+!564 = !DILocalVariable(name: "target", arg: 2, scope: !559, file: !5, line: 260, type: !71)
+!565 = !DILocalVariable(name: "count", arg: 3, scope: !559, file: !5, line: 260, type: !18)
+!566 = !DILocalVariable(name: "counts", arg: 4, scope: !559, file: !5, line: 260, type: !446)
+!567 = !DILocalVariable(name: "divisor", arg: 5, scope: !559, file: !5, line: 260, type: !33)
+!568 = !DILocalVariable(name: "offsets", scope: !559, file: !5, line: 261, type: !454)
+!569 = !DILocalVariable(name: "offset", scope: !559, file: !5, line: 262, type: !18)
+!570 = !DILocalVariable(name: "value", scope: !559, file: !5, line: 263, type: !18)
+!571 = !DILocalVariable(name: "i", scope: !559, file: !5, line: 271, type: !18)
+!572 = !DILocalVariable(name: "digit", scope: !559, file: !5, line: 272, type: !18)
+!573 = !DILocation(line: 260, column: 20, scope: !559)
+!574 = !DILocation(line: 260, column: 37, scope: !559)
+!575 = !DILocation(line: 260, column: 49, scope: !559)
+!576 = !DILocation(line: 260, column: 61, scope: !559)
+!577 = !DILocation(line: 260, column: 75, scope: !559)
+!578 = !DILocation(line: 260, column: 91, scope: !559)
+!579 = !DILocation(line: 261, column: 5, scope: !559)
+!580 = !DILocation(line: 262, column: 5, scope: !559)
+!581 = !DILocation(line: 263, column: 10, scope: !559)
+!582 = !DILocation(line: 263, column: 30, scope: !559)
+!583 = !DILocation(line: 264, column: 13, scope: !559)
+!584 = !DILocation(line: 263, column: 48, scope: !559)
+!585 = distinct !{!585, !129}
+!586 = !DILocation(line: 271, column: 10, scope: !559)
+!587 = !DILocation(line: 265, column: 13, scope: !559)
+!588 = !DILocation(line: 267, column: 9, scope: !559)
+!589 = !DILocation(line: 268, column: 9, scope: !559)
+!590 = !DILocation(line: 268, column: 19, scope: !559)
+!591 = !DILocation(line: 271, column: 26, scope: !559)
+!592 = !DILocation(line: 272, column: 9, scope: !559)
+!593 = !DILocation(line: 272, column: 23, scope: !559)
+!594 = !DILocation(line: 273, column: 34, scope: !559)
+!595 = !DILocation(line: 273, column: 9, scope: !559)
+!596 = !DILocation(line: 273, column: 16, scope: !559)
+!597 = !DILocation(line: 274, column: 9, scope: !559)
+!598 = !DILocation(line: 271, column: 37, scope: !559)
+!599 = distinct !{!599, !129}
+!600 = !DILocation(line: 276, column: 5, scope: !559)
+!601 = distinct !DISubprogram(name: "other_buffer<u32>", linkageName: "other_buffer<u32>", scope: !5, file: !5, line: 279, type: !602, scopeLine: 279, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !604)
+!602 = !DISubroutineType(types: !603)
+!603 = !{!71, !71, !71, !71}
+!604 = !{!605, !606, !607}
+!605 = !DILocalVariable(name: "buffer", arg: 1, scope: !601, file: !5, line: 279, type: !71)
+!606 = !DILocalVariable(name: "first", arg: 2, scope: !601, file: !5, line: 279, type: !71)
+!607 = !DILocalVariable(name: "second", arg: 3, scope: !601, file: !5, line: 279, type: !71)
+!608 = !DILocation(line: 279, column: 1, scope: !601)
+!609 = !DILocation(line: 279, column: 20, scope: !601)
+!610 = !DILocation(line: 279, column: 32, scope: !601)
+!611 = !DILocation(line: 279, column: 43, scope: !601)
+!612 = !DILocation(line: 280, column: 9, scope: !601)
+!613 = !DILocation(line: 281, column: 9, scope: !601)
+!614 = !DILocation(line: 283, column: 5, scope: !601)
+!615 = distinct !DISubprogram(name: "radix_pass<u64>", linkageName: "radix_pass<u64>", scope: !5, file: !5, line: 260, type: !616, scopeLine: 260, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !618)
+!616 = !DISubroutineType(types: !617)
+!617 = !{!84, !84, !84, !18, !446, !33}
+!618 = !{!619, !620, !621, !622, !623, !624, !625, !626, !627, !628}
+!619 = !DILocalVariable(name: "source", arg: 1, scope: !615, file: !5, line: 260, type: !84)
+!620 = !DILocalVariable(name: "target", arg: 2, scope: !615, file: !5, line: 260, type: !84)
+!621 = !DILocalVariable(name: "count", arg: 3, scope: !615, file: !5, line: 260, type: !18)
+!622 = !DILocalVariable(name: "counts", arg: 4, scope: !615, file: !5, line: 260, type: !446)
+!623 = !DILocalVariable(name: "divisor", arg: 5, scope: !615, file: !5, line: 260, type: !33)
+!624 = !DILocalVariable(name: "offsets", scope: !615, file: !5, line: 261, type: !454)
+!625 = !DILocalVariable(name: "offset", scope: !615, file: !5, line: 262, type: !18)
+!626 = !DILocalVariable(name: "value", scope: !615, file: !5, line: 263, type: !18)
+!627 = !DILocalVariable(name: "i", scope: !615, file: !5, line: 271, type: !18)
+!628 = !DILocalVariable(name: "digit", scope: !615, file: !5, line: 272, type: !18)
+!629 = !DILocation(line: 260, column: 20, scope: !615)
+!630 = !DILocation(line: 260, column: 37, scope: !615)
+!631 = !DILocation(line: 260, column: 49, scope: !615)
+!632 = !DILocation(line: 260, column: 61, scope: !615)
+!633 = !DILocation(line: 260, column: 75, scope: !615)
+!634 = !DILocation(line: 260, column: 91, scope: !615)
+!635 = !DILocation(line: 261, column: 5, scope: !615)
+!636 = !DILocation(line: 262, column: 5, scope: !615)
+!637 = !DILocation(line: 263, column: 10, scope: !615)
+!638 = !DILocation(line: 263, column: 30, scope: !615)
+!639 = !DILocation(line: 264, column: 13, scope: !615)
+!640 = !DILocation(line: 263, column: 48, scope: !615)
+!641 = distinct !{!641, !129}
+!642 = !DILocation(line: 271, column: 10, scope: !615)
+!643 = !DILocation(line: 265, column: 13, scope: !615)
+!644 = !DILocation(line: 267, column: 9, scope: !615)
+!645 = !DILocation(line: 268, column: 9, scope: !615)
+!646 = !DILocation(line: 268, column: 19, scope: !615)
+!647 = !DILocation(line: 271, column: 26, scope: !615)
+!648 = !DILocation(line: 272, column: 9, scope: !615)
+!649 = !DILocation(line: 272, column: 23, scope: !615)
+!650 = !DILocation(line: 273, column: 34, scope: !615)
+!651 = !DILocation(line: 273, column: 9, scope: !615)
+!652 = !DILocation(line: 273, column: 16, scope: !615)
+!653 = !DILocation(line: 274, column: 9, scope: !615)
+!654 = !DILocation(line: 271, column: 37, scope: !615)
+!655 = distinct !{!655, !129}
+!656 = !DILocation(line: 276, column: 5, scope: !615)
+!657 = distinct !DISubprogram(name: "other_buffer<u64>", linkageName: "other_buffer<u64>", scope: !5, file: !5, line: 279, type: !658, scopeLine: 279, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !660)
+!658 = !DISubroutineType(types: !659)
+!659 = !{!84, !84, !84, !84}
+!660 = !{!661, !662, !663}
+!661 = !DILocalVariable(name: "buffer", arg: 1, scope: !657, file: !5, line: 279, type: !84)
+!662 = !DILocalVariable(name: "first", arg: 2, scope: !657, file: !5, line: 279, type: !84)
+!663 = !DILocalVariable(name: "second", arg: 3, scope: !657, file: !5, line: 279, type: !84)
+!664 = !DILocation(line: 279, column: 1, scope: !657)
+!665 = !DILocation(line: 279, column: 20, scope: !657)
+!666 = !DILocation(line: 279, column: 32, scope: !657)
+!667 = !DILocation(line: 279, column: 43, scope: !657)
+!668 = !DILocation(line: 280, column: 9, scope: !657)
+!669 = !DILocation(line: 281, column: 9, scope: !657)
+!670 = !DILocation(line: 283, column: 5, scope: !657)
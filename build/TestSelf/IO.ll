@@ -0,0 +1,865 @@
+; ModuleID = 'TestSelf.IO'
+source_filename = "TestSelf.IO"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+%string = type { ptr, i64 }
+%view = type { i64, ptr }
+%Std.IO.Writer = type { i32, i64, i64, ptr }
+
+declare void @printI32(i32)
+
+declare ptr @memcpy(ptr, ptr, i64)
+
+declare void @shiro_write(i32, ptr, i64)
+
+; Function Attrs: nounwind
+define void @Std.IO.println(%string %0) #0 !dbg !4 {
+entry:
+  %str.addr = alloca %string, align 8, !dbg !17
+  store %string %0, ptr %str.addr, align 8, !dbg !17
+  call void @llvm.dbg.declare(metadata ptr %str.addr, metadata !16, metadata !DIExpression()), !dbg !18
+  %str_raw_ptr = getelementptr inbounds %string, ptr %str.addr, i32 0, i32 0, !dbg !19
+  %str_raw = load ptr, ptr %str_raw_ptr, align 8, !dbg !19
+  call void @puts(ptr %str_raw), !dbg !19
+  ret void, !dbg !19
+}
+
+declare i64 @shiro_format_u64(i64, ptr)
+
+declare void @puts(ptr)
+
+; Function Attrs: nounwind
+define i64 @Std.IO.format_uint(i64 %0, %view %1) #0 !dbg !20 {
+entry:
+  %value.addr = alloca i64, align 8, !dbg !32
+  store i64 %0, ptr %value.addr, align 8, !dbg !32
+  call void @llvm.dbg.declare(metadata ptr %value.addr, metadata !30, metadata !DIExpression()), !dbg !33
+  %out.addr = alloca %view, align 8, !dbg !32
+  store %view %1, ptr %out.addr, align 8, !dbg !32
+  call void @llvm.dbg.declare(metadata ptr %out.addr, metadata !31, metadata !DIExpression()), !dbg !34
+  %view_len_ptr = getelementptr inbounds %view, ptr %out.addr, i32 0, i32 0, !dbg !35
+  %view_len = load i64, ptr %view_len_ptr, align 8, !dbg !35
+  %call = call i64 @Std.IO.max_u64_length(), !dbg !36
+  %lt = icmp ult i64 %view_len, %call, !dbg !36
+  br i1 %lt, label %if.then, label %if.else, !dbg !36
+
+if.then:                                          ; preds = %entry
+  ret i64 0, !dbg !37
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !37
+
+if.join:                                          ; preds = %if.else
+  %value = load i64, ptr %value.addr, align 8, !dbg !38
+  %length_ptr = getelementptr inbounds %view, ptr %out.addr, i32 0, i32 0, !dbg !39
+  %view_length = load i64, ptr %length_ptr, align 8, !dbg !39
+  %in_bounds = icmp ult i64 0, %view_length, !dbg !39
+  br i1 %in_bounds, label %subscript.safe, label %bounds_check.trap, !dbg !39, !prof !40
+
+subscript.safe:                                   ; preds = %if.join
+  %ptr_to_views_array_field = getelementptr inbounds %view, ptr %out.addr, i32 0, i32 1, !dbg !39
+  %array_ptr = load ptr, ptr %ptr_to_views_array_field, align 8, !dbg !39
+  %elem_ptr = getelementptr inbounds i8, ptr %array_ptr, i64 0, !dbg !39
+  %call1 = call i64 @shiro_format_u64(i64 %value, ptr %elem_ptr), !dbg !39
+  ret i64 %call1, !dbg !39
+
+bounds_check.trap:                                ; preds = %if.join
+  call void @llvm.ubsantrap(i8 5) #5, !dbg !39
+  unreachable, !dbg !39
+}
+
+; Function Attrs: nounwind
+define void @Std.IO.print(%string %0) #0 !dbg !41 {
+entry:
+  %str.addr = alloca %string, align 8, !dbg !51
+  store %string %0, ptr %str.addr, align 8, !dbg !51
+  call void @llvm.dbg.declare(metadata ptr %str.addr, metadata !50, metadata !DIExpression()), !dbg !52
+  %str_raw_ptr = getelementptr inbounds %string, ptr %str.addr, i32 0, i32 0, !dbg !53
+  %str_raw = load ptr, ptr %str_raw_ptr, align 8, !dbg !53
+  %str_len_ptr = getelementptr inbounds %string, ptr %str.addr, i32 0, i32 1, !dbg !53
+  %str_len = load i64, ptr %str_len_ptr, align 8, !dbg !53
+  call void @shiro_write(i32 1, ptr %str_raw, i64 %str_len), !dbg !53
+  ret void, !dbg !53
+}
+
+; Function Attrs: nounwind readnone willreturn
+define i64 @Std.IO.max_i64_length() #1 !dbg !54 {
+entry:
+  ret i64 20, !dbg !58
+}
+
+; Function Attrs: nounwind
+define void @Std.IO.Writer.write_byte(ptr nonnull dereferenceable(32) %0, i8 %1) #0 !dbg !59 {
+entry:
+  %self.addr = alloca ptr, align 8, !dbg !74
+  store ptr %0, ptr %self.addr, align 8, !dbg !74
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !71, metadata !DIExpression()), !dbg !74
+  %byte.addr = alloca i8, align 1, !dbg !74
+  store i8 %1, ptr %byte.addr, align 1, !dbg !74
+  call void @llvm.dbg.declare(metadata ptr %byte.addr, metadata !73, metadata !DIExpression()), !dbg !75
+  %2 = load ptr, ptr %self.addr, align 8, !dbg !76
+  call void @Std.IO.Writer.reserve(ptr %2, i64 1), !dbg !76
+  %byte = load i8, ptr %byte.addr, align 1, !dbg !76
+  %3 = load ptr, ptr %self.addr, align 8, !dbg !77
+  %method_call = call ptr @Std.IO.Writer.tail(ptr %3), !dbg !77
+  store i8 %byte, ptr %method_call, align 1, !dbg !77
+  %4 = load ptr, ptr %self.addr, align 8, !dbg !78
+  %Std.IO.Writer = getelementptr inbounds %Std.IO.Writer, ptr %4, i32 0, i32 2, !dbg !78
+  %member_val = load i64, ptr %Std.IO.Writer, align 8, !dbg !78
+  %add = add i64 %member_val, 1, !dbg !78
+  %5 = load ptr, ptr %self.addr, align 8, !dbg !78
+  %Std.IO.Writer1 = getelementptr inbounds %Std.IO.Writer, ptr %5, i32 0, i32 2, !dbg !78
+  store i64 %add, ptr %Std.IO.Writer1, align 8, !dbg !78
+  ret void, !dbg !78
+}
+
+; Function Attrs: nounwind readonly willreturn
+define ptr @Std.IO.Writer.tail(ptr nonnull dereferenceable(32) %0) #2 !dbg !79 {
+entry:
+  %self.addr = alloca ptr, align 8, !dbg !84
+  store ptr %0, ptr %self.addr, align 8, !dbg !84
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !83, metadata !DIExpression()), !dbg !84
+  %1 = load ptr, ptr %self.addr, align 8, !dbg !85
+  %Std.IO.Writer = getelementptr inbounds %Std.IO.Writer, ptr %1, i32 0, i32 3, !dbg !85
+  %member_val = load ptr, ptr %Std.IO.Writer, align 8, !dbg !85
+  %ptr2int = ptrtoint ptr %member_val to i64, !dbg !85
+  %2 = load ptr, ptr %self.addr, align 8, !dbg !85
+  %Std.IO.Writer1 = getelementptr inbounds %Std.IO.Writer, ptr %2, i32 0, i32 2, !dbg !85
+  %member_val2 = load i64, ptr %Std.IO.Writer1, align 8, !dbg !85
+  %add = add i64 %ptr2int, %member_val2, !dbg !85
+  %int2ptr = inttoptr i64 %add to ptr, !dbg !85
+  ret ptr %int2ptr, !dbg !85
+}
+
+; Function Attrs: nounwind
+define void @Std.IO.Writer.write_str(ptr nonnull dereferenceable(32) %0, %string %1) #0 !dbg !86 {
+entry:
+  %self.addr = alloca ptr, align 8, !dbg !92
+  store ptr %0, ptr %self.addr, align 8, !dbg !92
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !90, metadata !DIExpression()), !dbg !92
+  %str.addr = alloca %string, align 8, !dbg !92
+  store %string %1, ptr %str.addr, align 8, !dbg !92
+  call void @llvm.dbg.declare(metadata ptr %str.addr, metadata !91, metadata !DIExpression()), !dbg !93
+  %2 = load ptr, ptr %self.addr, align 8, !dbg !94
+  %str_raw_ptr = getelementptr inbounds %string, ptr %str.addr, i32 0, i32 0, !dbg !95
+  %str_raw = load ptr, ptr %str_raw_ptr, align 8, !dbg !95
+  %str_len_ptr = getelementptr inbounds %string, ptr %str.addr, i32 0, i32 1, !dbg !95
+  %str_len = load i64, ptr %str_len_ptr, align 8, !dbg !95
+  call void @Std.IO.Writer.write_raw(ptr %2, ptr %str_raw, i64 %str_len), !dbg !95
+  ret void, !dbg !95
+}
+
+; Function Attrs: nounwind
+define void @Std.IO.Writer.write_raw(ptr nonnull dereferenceable(32) %0, ptr %1, i64 %2) #0 !dbg !96 {
+entry:
+  %self.addr = alloca ptr, align 8, !dbg !103
+  store ptr %0, ptr %self.addr, align 8, !dbg !103
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !100, metadata !DIExpression()), !dbg !103
+  %data.addr = alloca ptr, align 8, !dbg !103
+  store ptr %1, ptr %data.addr, align 8, !dbg !103
+  call void @llvm.dbg.declare(metadata ptr %data.addr, metadata !101, metadata !DIExpression()), !dbg !104
+  %count.addr = alloca i64, align 8, !dbg !103
+  store i64 %2, ptr %count.addr, align 8, !dbg !103
+  call void @llvm.dbg.declare(metadata ptr %count.addr, metadata !102, metadata !DIExpression()), !dbg !105
+  %3 = load ptr, ptr %self.addr, align 8, !dbg !106
+  %count = load i64, ptr %count.addr, align 8, !dbg !106
+  call void @Std.IO.Writer.reserve(ptr %3, i64 %count), !dbg !106
+  %count1 = load i64, ptr %count.addr, align 8, !dbg !107
+  %4 = load ptr, ptr %self.addr, align 8, !dbg !107
+  %Std.IO.Writer = getelementptr inbounds %Std.IO.Writer, ptr %4, i32 0, i32 1, !dbg !107
+  %member_val = load i64, ptr %Std.IO.Writer, align 8, !dbg !107
+  %gt = icmp ugt i64 %count1, %member_val, !dbg !107
+  br i1 %gt, label %if.then, label %if.else, !dbg !107
+
+if.then:                                          ; preds = %entry
+  %5 = load ptr, ptr %self.addr, align 8, !dbg !108
+  %Std.IO.Writer2 = getelementptr inbounds %Std.IO.Writer, ptr %5, i32 0, i32 0, !dbg !108
+  %member_val3 = load i32, ptr %Std.IO.Writer2, align 4, !dbg !108
+  %data = load ptr, ptr %data.addr, align 8, !dbg !108
+  %count4 = load i64, ptr %count.addr, align 8, !dbg !108
+  call void @shiro_write(i32 %member_val3, ptr %data, i64 %count4), !dbg !108
+  ret void, !dbg !109
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !109
+
+if.join:                                          ; preds = %if.else
+  %6 = load ptr, ptr %self.addr, align 8, !dbg !110
+  %method_call = call ptr @Std.IO.Writer.tail(ptr %6), !dbg !110
+  %data5 = load ptr, ptr %data.addr, align 8, !dbg !110
+  %count6 = load i64, ptr %count.addr, align 8, !dbg !110
+  %call = call ptr @memcpy(ptr %method_call, ptr %data5, i64 %count6), !dbg !110
+  %7 = load ptr, ptr %self.addr, align 8, !dbg !111
+  %Std.IO.Writer7 = getelementptr inbounds %Std.IO.Writer, ptr %7, i32 0, i32 2, !dbg !111
+  %member_val8 = load i64, ptr %Std.IO.Writer7, align 8, !dbg !111
+  %count9 = load i64, ptr %count.addr, align 8, !dbg !111
+  %add = add i64 %member_val8, %count9, !dbg !111
+  %8 = load ptr, ptr %self.addr, align 8, !dbg !111
+  %Std.IO.Writer10 = getelementptr inbounds %Std.IO.Writer, ptr %8, i32 0, i32 2, !dbg !111
+  store i64 %add, ptr %Std.IO.Writer10, align 8, !dbg !111
+  ret void, !dbg !111
+}
+
+; Function Attrs: nounwind
+define void @Std.IO.Writer.write_u64(ptr nonnull dereferenceable(32) %0, i64 %1) #0 !dbg !112 {
+entry:
+  %self.addr = alloca ptr, align 8, !dbg !118
+  store ptr %0, ptr %self.addr, align 8, !dbg !118
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !116, metadata !DIExpression()), !dbg !118
+  %value.addr = alloca i64, align 8, !dbg !118
+  store i64 %1, ptr %value.addr, align 8, !dbg !118
+  call void @llvm.dbg.declare(metadata ptr %value.addr, metadata !117, metadata !DIExpression()), !dbg !119
+  %2 = load ptr, ptr %self.addr, align 8, !dbg !120
+  %call = call i64 @Std.IO.max_u64_length(), !dbg !121
+  call void @Std.IO.Writer.reserve(ptr %2, i64 %call), !dbg !121
+  %3 = load ptr, ptr %self.addr, align 8, !dbg !122
+  %Std.IO.Writer = getelementptr inbounds %Std.IO.Writer, ptr %3, i32 0, i32 2, !dbg !122
+  %member_val = load i64, ptr %Std.IO.Writer, align 8, !dbg !122
+  %value = load i64, ptr %value.addr, align 8, !dbg !123
+  %4 = load ptr, ptr %self.addr, align 8, !dbg !124
+  %method_call = call ptr @Std.IO.Writer.tail(ptr %4), !dbg !124
+  %call1 = call i64 @shiro_format_u64(i64 %value, ptr %method_call), !dbg !124
+  %add = add i64 %member_val, %call1, !dbg !124
+  %5 = load ptr, ptr %self.addr, align 8, !dbg !124
+  %Std.IO.Writer2 = getelementptr inbounds %Std.IO.Writer, ptr %5, i32 0, i32 2, !dbg !124
+  store i64 %add, ptr %Std.IO.Writer2, align 8, !dbg !124
+  ret void, !dbg !124
+}
+
+; Function Attrs: nounwind
+define void @Std.IO.Writer.reserve(ptr nonnull dereferenceable(32) %0, i64 %1) #0 !dbg !125 {
+entry:
+  %self.addr = alloca ptr, align 8, !dbg !131
+  store ptr %0, ptr %self.addr, align 8, !dbg !131
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !129, metadata !DIExpression()), !dbg !131
+  %count.addr = alloca i64, align 8, !dbg !131
+  store i64 %1, ptr %count.addr, align 8, !dbg !131
+  call void @llvm.dbg.declare(metadata ptr %count.addr, metadata !130, metadata !DIExpression()), !dbg !132
+  %2 = load ptr, ptr %self.addr, align 8, !dbg !133
+  %Std.IO.Writer = getelementptr inbounds %Std.IO.Writer, ptr %2, i32 0, i32 3, !dbg !133
+  %member_val = load ptr, ptr %Std.IO.Writer, align 8, !dbg !133
+  %eq = icmp eq ptr %member_val, null, !dbg !133
+  br i1 %eq, label %if.then, label %if.else, !dbg !133
+
+if.then:                                          ; preds = %entry
+  %3 = load ptr, ptr %self.addr, align 8, !dbg !134
+  %Std.IO.Writer1 = getelementptr inbounds %Std.IO.Writer, ptr %3, i32 0, i32 1, !dbg !134
+  %member_val2 = load i64, ptr %Std.IO.Writer1, align 8, !dbg !134
+  %call = call i64 @Std.IO.max_f64_length(), !dbg !135
+  %lt = icmp ult i64 %member_val2, %call, !dbg !135
+  br i1 %lt, label %if.then3, label %if.else4, !dbg !135
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !136
+
+if.join:                                          ; preds = %if.else, %if.join17
+  %4 = load ptr, ptr %self.addr, align 8, !dbg !137
+  %Std.IO.Writer18 = getelementptr inbounds %Std.IO.Writer, ptr %4, i32 0, i32 2, !dbg !137
+  %member_val19 = load i64, ptr %Std.IO.Writer18, align 8, !dbg !137
+  %count = load i64, ptr %count.addr, align 8, !dbg !137
+  %add = add i64 %member_val19, %count, !dbg !137
+  %5 = load ptr, ptr %self.addr, align 8, !dbg !137
+  %Std.IO.Writer20 = getelementptr inbounds %Std.IO.Writer, ptr %5, i32 0, i32 1, !dbg !137
+  %member_val21 = load i64, ptr %Std.IO.Writer20, align 8, !dbg !137
+  %gt = icmp ugt i64 %add, %member_val21, !dbg !137
+  br i1 %gt, label %if.then22, label %if.else23, !dbg !137
+
+if.then3:                                         ; preds = %if.then
+  %call6 = call i64 @Std.IO.max_f64_length(), !dbg !138
+  %6 = load ptr, ptr %self.addr, align 8, !dbg !138
+  %Std.IO.Writer7 = getelementptr inbounds %Std.IO.Writer, ptr %6, i32 0, i32 1, !dbg !138
+  store i64 %call6, ptr %Std.IO.Writer7, align 8, !dbg !138
+  br label %if.join5, !dbg !138
+
+if.else4:                                         ; preds = %if.then
+  br label %if.join5, !dbg !138
+
+if.join5:                                         ; preds = %if.else4, %if.then3
+  %7 = load ptr, ptr %self.addr, align 8, !dbg !139
+  %Std.IO.Writer8 = getelementptr inbounds %Std.IO.Writer, ptr %7, i32 0, i32 1, !dbg !139
+  %member_val9 = load i64, ptr %Std.IO.Writer8, align 8, !dbg !139
+  %call10 = call ptr @malloc(i64 %member_val9), !dbg !139
+  %8 = load ptr, ptr %self.addr, align 8, !dbg !139
+  %Std.IO.Writer11 = getelementptr inbounds %Std.IO.Writer, ptr %8, i32 0, i32 3, !dbg !139
+  store ptr %call10, ptr %Std.IO.Writer11, align 8, !dbg !139
+  %9 = load ptr, ptr %self.addr, align 8, !dbg !140
+  %Std.IO.Writer12 = getelementptr inbounds %Std.IO.Writer, ptr %9, i32 0, i32 3, !dbg !140
+  %member_val13 = load ptr, ptr %Std.IO.Writer12, align 8, !dbg !140
+  %eq14 = icmp eq ptr %member_val13, null, !dbg !140
+  br i1 %eq14, label %if.then15, label %if.else16, !dbg !140
+
+if.then15:                                        ; preds = %if.join5
+  call void @abort(), !dbg !136
+  br label %if.join17, !dbg !136
+
+if.else16:                                        ; preds = %if.join5
+  br label %if.join17, !dbg !136
+
+if.join17:                                        ; preds = %if.else16, %if.then15
+  br label %if.join, !dbg !136
+
+if.then22:                                        ; preds = %if.join
+  %10 = load ptr, ptr %self.addr, align 8, !dbg !141
+  %Std.IO.Writer25 = getelementptr inbounds %Std.IO.Writer, ptr %10, i32 0, i32 0, !dbg !141
+  %member_val26 = load i32, ptr %Std.IO.Writer25, align 4, !dbg !141
+  %11 = load ptr, ptr %self.addr, align 8, !dbg !141
+  %Std.IO.Writer27 = getelementptr inbounds %Std.IO.Writer, ptr %11, i32 0, i32 3, !dbg !141
+  %member_val28 = load ptr, ptr %Std.IO.Writer27, align 8, !dbg !141
+  %12 = load ptr, ptr %self.addr, align 8, !dbg !141
+  %Std.IO.Writer29 = getelementptr inbounds %Std.IO.Writer, ptr %12, i32 0, i32 2, !dbg !141
+  %member_val30 = load i64, ptr %Std.IO.Writer29, align 8, !dbg !141
+  call void @shiro_write(i32 %member_val26, ptr %member_val28, i64 %member_val30), !dbg !141
+  %13 = load ptr, ptr %self.addr, align 8, !dbg !141
+  %Std.IO.Writer31 = getelementptr inbounds %Std.IO.Writer, ptr %13, i32 0, i32 2, !dbg !141
+  store i64 0, ptr %Std.IO.Writer31, align 8, !dbg !141
+  br label %if.join24, !dbg !141
+
+if.else23:                                        ; preds = %if.join
+  br label %if.join24, !dbg !141
+
+if.join24:                                        ; preds = %if.else23, %if.then22
+  ret void, !dbg !141
+}
+
+; Function Attrs: nounwind
+define void @Std.IO.Writer.write_f64(ptr nonnull dereferenceable(32) %0, double %1) #0 !dbg !142 {
+entry:
+  %self.addr = alloca ptr, align 8, !dbg !149
+  store ptr %0, ptr %self.addr, align 8, !dbg !149
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !147, metadata !DIExpression()), !dbg !149
+  %value.addr = alloca double, align 8, !dbg !149
+  store double %1, ptr %value.addr, align 8, !dbg !149
+  call void @llvm.dbg.declare(metadata ptr %value.addr, metadata !148, metadata !DIExpression()), !dbg !150
+  %2 = load ptr, ptr %self.addr, align 8, !dbg !151
+  %call = call i64 @Std.IO.max_f64_length(), !dbg !152
+  call void @Std.IO.Writer.reserve(ptr %2, i64 %call), !dbg !152
+  %3 = load ptr, ptr %self.addr, align 8, !dbg !153
+  %Std.IO.Writer = getelementptr inbounds %Std.IO.Writer, ptr %3, i32 0, i32 2, !dbg !153
+  %member_val = load i64, ptr %Std.IO.Writer, align 8, !dbg !153
+  %value = load double, ptr %value.addr, align 8, !dbg !154
+  %4 = load ptr, ptr %self.addr, align 8, !dbg !155
+  %method_call = call ptr @Std.IO.Writer.tail(ptr %4), !dbg !155
+  %call1 = call i64 @shiro_format_f64(double %value, ptr %method_call), !dbg !155
+  %add = add i64 %member_val, %call1, !dbg !155
+  %5 = load ptr, ptr %self.addr, align 8, !dbg !155
+  %Std.IO.Writer2 = getelementptr inbounds %Std.IO.Writer, ptr %5, i32 0, i32 2, !dbg !155
+  store i64 %add, ptr %Std.IO.Writer2, align 8, !dbg !155
+  ret void, !dbg !155
+}
+
+; Function Attrs: nounwind
+define void @Std.IO.Writer.write_i64(ptr nonnull dereferenceable(32) %0, i64 %1) #0 !dbg !156 {
+entry:
+  %self.addr = alloca ptr, align 8, !dbg !163
+  store ptr %0, ptr %self.addr, align 8, !dbg !163
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !161, metadata !DIExpression()), !dbg !163
+  %value.addr = alloca i64, align 8, !dbg !163
+  store i64 %1, ptr %value.addr, align 8, !dbg !163
+  call void @llvm.dbg.declare(metadata ptr %value.addr, metadata !162, metadata !DIExpression()), !dbg !164
+  %2 = load ptr, ptr %self.addr, align 8, !dbg !165
+  %call = call i64 @Std.IO.max_i64_length(), !dbg !166
+  call void @Std.IO.Writer.reserve(ptr %2, i64 %call), !dbg !166
+  %3 = load ptr, ptr %self.addr, align 8, !dbg !167
+  %Std.IO.Writer = getelementptr inbounds %Std.IO.Writer, ptr %3, i32 0, i32 2, !dbg !167
+  %member_val = load i64, ptr %Std.IO.Writer, align 8, !dbg !167
+  %value = load i64, ptr %value.addr, align 8, !dbg !168
+  %4 = load ptr, ptr %self.addr, align 8, !dbg !169
+  %method_call = call ptr @Std.IO.Writer.tail(ptr %4), !dbg !169
+  %call1 = call i64 @shiro_format_i64(i64 %value, ptr %method_call), !dbg !169
+  %add = add i64 %member_val, %call1, !dbg !169
+  %5 = load ptr, ptr %self.addr, align 8, !dbg !169
+  %Std.IO.Writer2 = getelementptr inbounds %Std.IO.Writer, ptr %5, i32 0, i32 2, !dbg !169
+  store i64 %add, ptr %Std.IO.Writer2, align 8, !dbg !169
+  ret void, !dbg !169
+}
+
+; Function Attrs: nounwind
+define void @Std.IO.Writer.write(ptr nonnull dereferenceable(32) %0, %view %1) #0 !dbg !170 {
+entry:
+  %count = alloca i64, align 8, !dbg !181
+  %self.addr = alloca ptr, align 8, !dbg !181
+  store ptr %0, ptr %self.addr, align 8, !dbg !181
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !178, metadata !DIExpression()), !dbg !181
+  %bytes.addr = alloca %view, align 8, !dbg !181
+  store %view %1, ptr %bytes.addr, align 8, !dbg !181
+  call void @llvm.dbg.declare(metadata ptr %bytes.addr, metadata !179, metadata !DIExpression()), !dbg !182
+  call void @llvm.dbg.declare(metadata ptr %count, metadata !180, metadata !DIExpression()), !dbg !183
+  %view_len_ptr = getelementptr inbounds %view, ptr %bytes.addr, i32 0, i32 0, !dbg !184
+  %view_len = load i64, ptr %view_len_ptr, align 8, !dbg !184
+  store i64 %view_len, ptr %count, align 8, !dbg !184
+  %count1 = load i64, ptr %count, align 8, !dbg !185
+  %ne = icmp ne i64 %count1, 0, !dbg !185
+  br i1 %ne, label %if.then, label %if.else, !dbg !185
+
+if.then:                                          ; preds = %entry
+  %2 = load ptr, ptr %self.addr, align 8, !dbg !186
+  %length_ptr = getelementptr inbounds %view, ptr %bytes.addr, i32 0, i32 0, !dbg !187
+  %view_length = load i64, ptr %length_ptr, align 8, !dbg !187
+  %in_bounds = icmp ult i64 0, %view_length, !dbg !187
+  br i1 %in_bounds, label %subscript.safe, label %bounds_check.trap, !dbg !187, !prof !40
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !187
+
+if.join:                                          ; preds = %if.else, %subscript.safe
+  ret void, !dbg !187
+
+subscript.safe:                                   ; preds = %if.then
+  %ptr_to_views_array_field = getelementptr inbounds %view, ptr %bytes.addr, i32 0, i32 1, !dbg !187
+  %array_ptr = load ptr, ptr %ptr_to_views_array_field, align 8, !dbg !187
+  %elem_ptr = getelementptr inbounds i8, ptr %array_ptr, i64 0, !dbg !187
+  %count2 = load i64, ptr %count, align 8, !dbg !187
+  call void @Std.IO.Writer.write_raw(ptr %2, ptr %elem_ptr, i64 %count2), !dbg !187
+  br label %if.join, !dbg !187
+
+bounds_check.trap:                                ; preds = %if.then
+  call void @llvm.ubsantrap(i8 5) #5, !dbg !187
+  unreachable, !dbg !187
+}
+
+; Function Attrs: nounwind
+define void @Std.IO.Writer.flush(ptr nonnull dereferenceable(32) %0) #0 !dbg !188 {
+entry:
+  %self.addr = alloca ptr, align 8, !dbg !193
+  store ptr %0, ptr %self.addr, align 8, !dbg !193
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !192, metadata !DIExpression()), !dbg !193
+  %1 = load ptr, ptr %self.addr, align 8, !dbg !194
+  %Std.IO.Writer = getelementptr inbounds %Std.IO.Writer, ptr %1, i32 0, i32 2, !dbg !194
+  %member_val = load i64, ptr %Std.IO.Writer, align 8, !dbg !194
+  %ne = icmp ne i64 %member_val, 0, !dbg !194
+  br i1 %ne, label %if.then, label %if.else, !dbg !194
+
+if.then:                                          ; preds = %entry
+  %2 = load ptr, ptr %self.addr, align 8, !dbg !195
+  %Std.IO.Writer1 = getelementptr inbounds %Std.IO.Writer, ptr %2, i32 0, i32 0, !dbg !195
+  %member_val2 = load i32, ptr %Std.IO.Writer1, align 4, !dbg !195
+  %3 = load ptr, ptr %self.addr, align 8, !dbg !195
+  %Std.IO.Writer3 = getelementptr inbounds %Std.IO.Writer, ptr %3, i32 0, i32 3, !dbg !195
+  %member_val4 = load ptr, ptr %Std.IO.Writer3, align 8, !dbg !195
+  %4 = load ptr, ptr %self.addr, align 8, !dbg !195
+  %Std.IO.Writer5 = getelementptr inbounds %Std.IO.Writer, ptr %4, i32 0, i32 2, !dbg !195
+  %member_val6 = load i64, ptr %Std.IO.Writer5, align 8, !dbg !195
+  call void @shiro_write(i32 %member_val2, ptr %member_val4, i64 %member_val6), !dbg !195
+  %5 = load ptr, ptr %self.addr, align 8, !dbg !195
+  %Std.IO.Writer7 = getelementptr inbounds %Std.IO.Writer, ptr %5, i32 0, i32 2, !dbg !195
+  store i64 0, ptr %Std.IO.Writer7, align 8, !dbg !195
+  br label %if.join, !dbg !195
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !195
+
+if.join:                                          ; preds = %if.else, %if.then
+  %6 = load ptr, ptr %self.addr, align 8, !dbg !196
+  %Std.IO.Writer8 = getelementptr inbounds %Std.IO.Writer, ptr %6, i32 0, i32 0, !dbg !196
+  %member_val9 = load i32, ptr %Std.IO.Writer8, align 4, !dbg !196
+  %eq = icmp eq i32 %member_val9, 1, !dbg !196
+  br i1 %eq, label %if.then10, label %if.else11, !dbg !196
+
+if.then10:                                        ; preds = %if.join
+  call void @shiro_stdout_flush(), !dbg !197
+  br label %if.join12, !dbg !197
+
+if.else11:                                        ; preds = %if.join
+  br label %if.join12, !dbg !197
+
+if.join12:                                        ; preds = %if.else11, %if.then10
+  ret void, !dbg !197
+}
+
+; Function Attrs: nounwind
+define void @"Std.IO.Writer.@destruct"(ptr nonnull dereferenceable(32) %0) #0 !dbg !198 {
+entry:
+  %self.addr = alloca ptr, align 8, !dbg !201
+  store ptr %0, ptr %self.addr, align 8, !dbg !201
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !200, metadata !DIExpression()), !dbg !201
+  %1 = load ptr, ptr %self.addr, align 8, !dbg !202
+  %Std.IO.Writer = getelementptr inbounds %Std.IO.Writer, ptr %1, i32 0, i32 3, !dbg !202
+  %member_val = load ptr, ptr %Std.IO.Writer, align 8, !dbg !202
+  %ne = icmp ne ptr %member_val, null, !dbg !202
+  br i1 %ne, label %if.then, label %if.else, !dbg !202
+
+if.then:                                          ; preds = %entry
+  %2 = load ptr, ptr %self.addr, align 8, !dbg !203
+  call void @Std.IO.Writer.flush(ptr %2), !dbg !203
+  %3 = load ptr, ptr %self.addr, align 8, !dbg !204
+  %Std.IO.Writer1 = getelementptr inbounds %Std.IO.Writer, ptr %3, i32 0, i32 3, !dbg !204
+  %member_val2 = load ptr, ptr %Std.IO.Writer1, align 8, !dbg !204
+  call void @free(ptr %member_val2), !dbg !204
+  br label %if.join, !dbg !204
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !204
+
+if.join:                                          ; preds = %if.else, %if.then
+  ret void, !dbg !204
+}
+
+declare ptr @malloc(i64)
+
+declare i64 @shiro_format_f64(double, ptr)
+
+declare void @shiro_stdout_flush()
+
+; Function Attrs: nounwind
+define void @Std.IO.flush_stdout() #0 !dbg !205 {
+entry:
+  call void @shiro_stdout_flush(), !dbg !208
+  ret void, !dbg !208
+}
+
+declare i64 @shiro_format_i64(i64, ptr)
+
+; Function Attrs: nounwind
+define i64 @Std.IO.format_float(double %0, %view %1) #0 !dbg !209 {
+entry:
+  %value.addr = alloca double, align 8, !dbg !215
+  store double %0, ptr %value.addr, align 8, !dbg !215
+  call void @llvm.dbg.declare(metadata ptr %value.addr, metadata !213, metadata !DIExpression()), !dbg !216
+  %out.addr = alloca %view, align 8, !dbg !215
+  store %view %1, ptr %out.addr, align 8, !dbg !215
+  call void @llvm.dbg.declare(metadata ptr %out.addr, metadata !214, metadata !DIExpression()), !dbg !217
+  %view_len_ptr = getelementptr inbounds %view, ptr %out.addr, i32 0, i32 0, !dbg !218
+  %view_len = load i64, ptr %view_len_ptr, align 8, !dbg !218
+  %call = call i64 @Std.IO.max_f64_length(), !dbg !219
+  %lt = icmp ult i64 %view_len, %call, !dbg !219
+  br i1 %lt, label %if.then, label %if.else, !dbg !219
+
+if.then:                                          ; preds = %entry
+  ret i64 0, !dbg !220
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !220
+
+if.join:                                          ; preds = %if.else
+  %value = load double, ptr %value.addr, align 8, !dbg !221
+  %length_ptr = getelementptr inbounds %view, ptr %out.addr, i32 0, i32 0, !dbg !222
+  %view_length = load i64, ptr %length_ptr, align 8, !dbg !222
+  %in_bounds = icmp ult i64 0, %view_length, !dbg !222
+  br i1 %in_bounds, label %subscript.safe, label %bounds_check.trap, !dbg !222, !prof !40
+
+subscript.safe:                                   ; preds = %if.join
+  %ptr_to_views_array_field = getelementptr inbounds %view, ptr %out.addr, i32 0, i32 1, !dbg !222
+  %array_ptr = load ptr, ptr %ptr_to_views_array_field, align 8, !dbg !222
+  %elem_ptr = getelementptr inbounds i8, ptr %array_ptr, i64 0, !dbg !222
+  %call1 = call i64 @shiro_format_f64(double %value, ptr %elem_ptr), !dbg !222
+  ret i64 %call1, !dbg !222
+
+bounds_check.trap:                                ; preds = %if.join
+  call void @llvm.ubsantrap(i8 5) #5, !dbg !222
+  unreachable, !dbg !222
+}
+
+; Function Attrs: nounwind readnone willreturn
+define i64 @Std.IO.max_u64_length() #1 !dbg !223 {
+entry:
+  ret i64 20, !dbg !224
+}
+
+; Function Attrs: nounwind
+define i64 @Std.IO.format_int(i64 %0, %view %1) #0 !dbg !225 {
+entry:
+  %value.addr = alloca i64, align 8, !dbg !231
+  store i64 %0, ptr %value.addr, align 8, !dbg !231
+  call void @llvm.dbg.declare(metadata ptr %value.addr, metadata !229, metadata !DIExpression()), !dbg !232
+  %out.addr = alloca %view, align 8, !dbg !231
+  store %view %1, ptr %out.addr, align 8, !dbg !231
+  call void @llvm.dbg.declare(metadata ptr %out.addr, metadata !230, metadata !DIExpression()), !dbg !233
+  %view_len_ptr = getelementptr inbounds %view, ptr %out.addr, i32 0, i32 0, !dbg !234
+  %view_len = load i64, ptr %view_len_ptr, align 8, !dbg !234
+  %call = call i64 @Std.IO.max_i64_length(), !dbg !235
+  %lt = icmp ult i64 %view_len, %call, !dbg !235
+  br i1 %lt, label %if.then, label %if.else, !dbg !235
+
+if.then:                                          ; preds = %entry
+  ret i64 0, !dbg !236
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !236
+
+if.join:                                          ; preds = %if.else
+  %value = load i64, ptr %value.addr, align 8, !dbg !237
+  %length_ptr = getelementptr inbounds %view, ptr %out.addr, i32 0, i32 0, !dbg !238
+  %view_length = load i64, ptr %length_ptr, align 8, !dbg !238
+  %in_bounds = icmp ult i64 0, %view_length, !dbg !238
+  br i1 %in_bounds, label %subscript.safe, label %bounds_check.trap, !dbg !238, !prof !40
+
+subscript.safe:                                   ; preds = %if.join
+  %ptr_to_views_array_field = getelementptr inbounds %view, ptr %out.addr, i32 0, i32 1, !dbg !238
+  %array_ptr = load ptr, ptr %ptr_to_views_array_field, align 8, !dbg !238
+  %elem_ptr = getelementptr inbounds i8, ptr %array_ptr, i64 0, !dbg !238
+  %call1 = call i64 @shiro_format_i64(i64 %value, ptr %elem_ptr), !dbg !238
+  ret i64 %call1, !dbg !238
+
+bounds_check.trap:                                ; preds = %if.join
+  call void @llvm.ubsantrap(i8 5) #5, !dbg !238
+  unreachable, !dbg !238
+}
+
+declare void @abort()
+
+declare void @free(ptr)
+
+; Function Attrs: nounwind readnone willreturn
+define i64 @Std.IO.max_f64_length() #1 !dbg !239 {
+entry:
+  ret i64 25, !dbg !240
+}
+
+; Function Attrs: nofree nosync nounwind readnone speculatable willreturn
+declare void @llvm.dbg.declare(metadata, metadata, metadata) #3
+
+; Function Attrs: cold noreturn nounwind
+declare void @llvm.ubsantrap(i8 immarg) #4
+
+attributes #0 = { nounwind }
+attributes #1 = { nounwind readnone willreturn }
+attributes #2 = { nounwind readonly willreturn }
+attributes #3 = { nofree nosync nounwind readnone speculatable willreturn }
+attributes #4 = { cold noreturn nounwind }
+attributes #5 = { cold }
+
+!llvm.dbg.cu = !{!0}
+!llvm.module.flags = !{!2, !3}
+
+!0 = distinct !DICompileUnit(language: DW_LANG_C, file: !1, producer: "ShiroC Compiler\00", isOptimized: false, runtimeVersion: 0, emissionKind: FullDebug, splitDebugInlining: false)
+!1 = !DIFile(filename: "IO", directory: ".")
+!2 = !{i32 2, !"Dwarf Version", i32 4}
+!3 = !{i32 2, !"Debug Info Version", i32 3}
+!4 = distinct !DISubprogram(name: "println", linkageName: "println", scope: !5, file: !5, line: 3, type: !6, scopeLine: 3, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !15)
+!5 = !DIFile(filename: "print.shiro", directory: "/tmp/asan/src/std/IO")
+!6 = !DISubroutineType(types: !7)
+!7 = !{null, !8}
+!8 = !DICompositeType(tag: DW_TAG_structure_type, name: "string", file: !5, size: 128, align: 64, elements: !9)
+!9 = !{!10, !13}
+!10 = !DIDerivedType(tag: DW_TAG_member, name: "data", file: !5, baseType: !11, size: 64, align: 64)
+!11 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !12, size: 64, dwarfAddressSpace: 0)
+!12 = !DIBasicType(name: "u8", size: 8, encoding: DW_ATE_unsigned_char)
+!13 = !DIDerivedType(tag: DW_TAG_member, name: "len", file: !5, baseType: !14, size: 64, align: 64, offset: 64)
+!14 = !DIBasicType(name: "usize", size: 64, encoding: DW_ATE_unsigned_char)
+!15 = !{!16}
+!16 = !DILocalVariable(name: "str", arg: 1, scope: !4, file: !5, line: 3, type: !8)
+!17 = !DILocation(line: 3, column: 8, scope: !4)
+!18 = !DILocation(line: 3, column: 19, scope: !4)
+!19 = !DILocation(line: 0, scope: !4)
+!20 = distinct !DISubprogram(name: "format_uint", linkageName: "format_uint", scope: !21, file: !21, line: 28, type: !22, scopeLine: 28, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !29)
+!21 = !DIFile(filename: "format.shiro", directory: "/tmp/asan/src/std/IO")
+!22 = !DISubroutineType(types: !23)
+!23 = !{!14, !24, !25}
+!24 = !DIBasicType(name: "u64", size: 64, encoding: DW_ATE_unsigned_char)
+!25 = !DICompositeType(tag: DW_TAG_structure_type, name: "view[u8]", file: !21, size: 128, align: 64, elements: !26)
+!26 = !{!27, !28}
+!27 = !DIDerivedType(tag: DW_TAG_member, name: "len", file: !21, baseType: !14, size: 64, align: 64)
+!28 = !DIDerivedType(tag: DW_TAG_member, name: "data", file: !21, baseType: !11, size: 64, align: 64, offset: 64)
+!29 = !{!30, !31}
+!30 = !DILocalVariable(name: "value", arg: 1, scope: !20, file: !21, line: 28, type: !24)
+!31 = !DILocalVariable(name: "out", arg: 2, scope: !20, file: !21, line: 28, type: !25)
+!32 = !DILocation(line: 28, column: 8, scope: !20)
+!33 = !DILocation(line: 28, column: 23, scope: !20)
+!34 = !DILocation(line: 28, column: 35, scope: !20)
+!35 = !DILocation(line: 0, scope: !20)
+!36 = !DILocation(line: 29, column: 21, scope: !20)
+!37 = !DILocation(line: 30, column: 9, scope: !20)
+!38 = !DILocation(line: 32, column: 12, scope: !20)
+!39 = !DILocation(line: 32, column: 37, scope: !20)
+!40 = !{!"branch_weights", i32 1048575, i32 1}
+!41 = distinct !DISubprogram(name: "print", linkageName: "print", scope: !42, file: !42, line: 101, type: !43, scopeLine: 101, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !49)
+!42 = !DIFile(filename: "writer.shiro", directory: "/tmp/asan/src/std/IO")
+!43 = !DISubroutineType(types: !44)
+!44 = !{null, !45}
+!45 = !DICompositeType(tag: DW_TAG_structure_type, name: "string", file: !42, size: 128, align: 64, elements: !46)
+!46 = !{!47, !48}
+!47 = !DIDerivedType(tag: DW_TAG_member, name: "data", file: !42, baseType: !11, size: 64, align: 64)
+!48 = !DIDerivedType(tag: DW_TAG_member, name: "len", file: !42, baseType: !14, size: 64, align: 64, offset: 64)
+!49 = !{!50}
+!50 = !DILocalVariable(name: "str", arg: 1, scope: !41, file: !42, line: 101, type: !45)
+!51 = !DILocation(line: 101, column: 8, scope: !41)
+!52 = !DILocation(line: 101, column: 17, scope: !41)
+!53 = !DILocation(line: 0, scope: !41)
+!54 = distinct !DISubprogram(name: "max_i64_length", linkageName: "max_i64_length", scope: !21, file: !21, line: 9, type: !55, scopeLine: 9, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !57)
+!55 = !DISubroutineType(types: !56)
+!56 = !{!14}
+!57 = !{}
+!58 = !DILocation(line: 10, column: 5, scope: !54)
+!59 = distinct !DISubprogram(name: "Writer.write_byte", linkageName: "Writer.write_byte", scope: !42, file: !42, line: 29, type: !60, scopeLine: 29, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !70)
+!60 = !DISubroutineType(types: !61)
+!61 = !{null, !62, !12}
+!62 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !63, size: 64, flags: DIFlagArtificial | DIFlagObjectPointer, dwarfAddressSpace: 0)
+!63 = !DICompositeType(tag: DW_TAG_structure_type, name: "Writer", file: !42, line: 12, size: 256, align: 64, elements: !64, identifier: "Std.IO.Writer")
+!64 = !{!65, !67, !68, !69}
+!65 = !DIDerivedType(tag: DW_TAG_member, name: "fd", scope: !63, file: !42, baseType: !66, size: 32, align: 32)
+!66 = !DIBasicType(name: "i32", size: 32, encoding: DW_ATE_signed)
+!67 = !DIDerivedType(tag: DW_TAG_member, name: "capacity", scope: !63, file: !42, baseType: !14, size: 64, align: 64, offset: 64)
+!68 = !DIDerivedType(tag: DW_TAG_member, name: "length", scope: !63, file: !42, baseType: !14, size: 64, align: 64, offset: 128)
+!69 = !DIDerivedType(tag: DW_TAG_member, name: "buffer", scope: !63, file: !42, baseType: !11, size: 64, align: 64, offset: 192)
+!70 = !{!71, !73}
+!71 = !DILocalVariable(name: "self", arg: 1, scope: !59, file: !42, line: 29, type: !72)
+!72 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !63, size: 64, dwarfAddressSpace: 0)
+!73 = !DILocalVariable(name: "byte", arg: 2, scope: !59, file: !42, line: 29, type: !12)
+!74 = !DILocation(line: 29, column: 5, scope: !59)
+!75 = !DILocation(line: 29, column: 19, scope: !59)
+!76 = !DILocation(line: 30, column: 9, scope: !59)
+!77 = !DILocation(line: 31, column: 10, scope: !59)
+!78 = !DILocation(line: 32, column: 23, scope: !59)
+!79 = distinct !DISubprogram(name: "Writer.tail", linkageName: "Writer.tail", scope: !42, file: !42, line: 95, type: !80, scopeLine: 95, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !82)
+!80 = !DISubroutineType(types: !81)
+!81 = !{!11, !62}
+!82 = !{!83}
+!83 = !DILocalVariable(name: "self", arg: 1, scope: !79, file: !42, line: 95, type: !72)
+!84 = !DILocation(line: 95, column: 5, scope: !79)
+!85 = !DILocation(line: 96, column: 17, scope: !79)
+!86 = distinct !DISubprogram(name: "Writer.write_str", linkageName: "Writer.write_str", scope: !42, file: !42, line: 25, type: !87, scopeLine: 25, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !89)
+!87 = !DISubroutineType(types: !88)
+!88 = !{null, !62, !45}
+!89 = !{!90, !91}
+!90 = !DILocalVariable(name: "self", arg: 1, scope: !86, file: !42, line: 25, type: !72)
+!91 = !DILocalVariable(name: "str", arg: 2, scope: !86, file: !42, line: 25, type: !45)
+!92 = !DILocation(line: 25, column: 5, scope: !86)
+!93 = !DILocation(line: 25, column: 18, scope: !86)
+!94 = !DILocation(line: 26, column: 9, scope: !86)
+!95 = !DILocation(line: 0, scope: !86)
+!96 = distinct !DISubprogram(name: "Writer.write_raw", linkageName: "Writer.write_raw", scope: !42, file: !42, line: 68, type: !97, scopeLine: 68, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !99)
+!97 = !DISubroutineType(types: !98)
+!98 = !{null, !62, !11, !14}
+!99 = !{!100, !101, !102}
+!100 = !DILocalVariable(name: "self", arg: 1, scope: !96, file: !42, line: 68, type: !72)
+!101 = !DILocalVariable(name: "data", arg: 2, scope: !96, file: !42, line: 68, type: !11)
+!102 = !DILocalVariable(name: "count", arg: 3, scope: !96, file: !42, line: 68, type: !14)
+!103 = !DILocation(line: 68, column: 5, scope: !96)
+!104 = !DILocation(line: 68, column: 18, scope: !96)
+!105 = !DILocation(line: 68, column: 29, scope: !96)
+!106 = !DILocation(line: 69, column: 9, scope: !96)
+!107 = !DILocation(line: 70, column: 13, scope: !96)
+!108 = !DILocation(line: 71, column: 13, scope: !96)
+!109 = !DILocation(line: 72, column: 13, scope: !96)
+!110 = !DILocation(line: 74, column: 16, scope: !96)
+!111 = !DILocation(line: 75, column: 23, scope: !96)
+!112 = distinct !DISubprogram(name: "Writer.write_u64", linkageName: "Writer.write_u64", scope: !42, file: !42, line: 40, type: !113, scopeLine: 40, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !115)
+!113 = !DISubroutineType(types: !114)
+!114 = !{null, !62, !24}
+!115 = !{!116, !117}
+!116 = !DILocalVariable(name: "self", arg: 1, scope: !112, file: !42, line: 40, type: !72)
+!117 = !DILocalVariable(name: "value", arg: 2, scope: !112, file: !42, line: 40, type: !24)
+!118 = !DILocation(line: 40, column: 5, scope: !112)
+!119 = !DILocation(line: 40, column: 18, scope: !112)
+!120 = !DILocation(line: 41, column: 9, scope: !112)
+!121 = !DILocation(line: 41, column: 22, scope: !112)
+!122 = !DILocation(line: 42, column: 23, scope: !112)
+!123 = !DILocation(line: 42, column: 37, scope: !112)
+!124 = !DILocation(line: 42, column: 61, scope: !112)
+!125 = distinct !DISubprogram(name: "Writer.reserve", linkageName: "Writer.reserve", scope: !42, file: !42, line: 79, type: !126, scopeLine: 79, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !128)
+!126 = !DISubroutineType(types: !127)
+!127 = !{null, !62, !14}
+!128 = !{!129, !130}
+!129 = !DILocalVariable(name: "self", arg: 1, scope: !125, file: !42, line: 79, type: !72)
+!130 = !DILocalVariable(name: "count", arg: 2, scope: !125, file: !42, line: 79, type: !14)
+!131 = !DILocation(line: 79, column: 5, scope: !125)
+!132 = !DILocation(line: 79, column: 16, scope: !125)
+!133 = !DILocation(line: 80, column: 13, scope: !125)
+!134 = !DILocation(line: 81, column: 17, scope: !125)
+!135 = !DILocation(line: 81, column: 33, scope: !125)
+!136 = !DILocation(line: 86, column: 17, scope: !125)
+!137 = !DILocation(line: 89, column: 13, scope: !125)
+!138 = !DILocation(line: 82, column: 33, scope: !125)
+!139 = !DILocation(line: 84, column: 27, scope: !125)
+!140 = !DILocation(line: 85, column: 17, scope: !125)
+!141 = !DILocation(line: 90, column: 13, scope: !125)
+!142 = distinct !DISubprogram(name: "Writer.write_f64", linkageName: "Writer.write_f64", scope: !42, file: !42, line: 46, type: !143, scopeLine: 46, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !146)
+!143 = !DISubroutineType(types: !144)
+!144 = !{null, !62, !145}
+!145 = !DIBasicType(name: "f64", size: 64, encoding: DW_ATE_float)
+!146 = !{!147, !148}
+!147 = !DILocalVariable(name: "self", arg: 1, scope: !142, file: !42, line: 46, type: !72)
+!148 = !DILocalVariable(name: "value", arg: 2, scope: !142, file: !42, line: 46, type: !145)
+!149 = !DILocation(line: 46, column: 5, scope: !142)
+!150 = !DILocation(line: 46, column: 18, scope: !142)
+!151 = !DILocation(line: 47, column: 9, scope: !142)
+!152 = !DILocation(line: 47, column: 22, scope: !142)
+!153 = !DILocation(line: 48, column: 23, scope: !142)
+!154 = !DILocation(line: 48, column: 37, scope: !142)
+!155 = !DILocation(line: 48, column: 61, scope: !142)
+!156 = distinct !DISubprogram(name: "Writer.write_i64", linkageName: "Writer.write_i64", scope: !42, file: !42, line: 35, type: !157, scopeLine: 35, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !160)
+!157 = !DISubroutineType(types: !158)
+!158 = !{null, !62, !159}
+!159 = !DIBasicType(name: "i64", size: 64, encoding: DW_ATE_signed)
+!160 = !{!161, !162}
+!161 = !DILocalVariable(name: "self", arg: 1, scope: !156, file: !42, line: 35, type: !72)
+!162 = !DILocalVariable(name: "value", arg: 2, scope: !156, file: !42, line: 35, type: !159)
+!163 = !DILocation(line: 35, column: 5, scope: !156)
+!164 = !DILocation(line: 35, column: 18, scope: !156)
+!165 = !DILocation(line: 36, column: 9, scope: !156)
+!166 = !DILocation(line: 36, column: 22, scope: !156)
+!167 = !DILocation(line: 37, column: 23, scope: !156)
+!168 = !DILocation(line: 37, column: 37, scope: !156)
+!169 = !DILocation(line: 37, column: 61, scope: !156)
+!170 = distinct !DISubprogram(name: "Writer.write", linkageName: "Writer.write", scope: !42, file: !42, line: 18, type: !171, scopeLine: 18, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !177)
+!171 = !DISubroutineType(types: !172)
+!172 = !{null, !62, !173}
+!173 = !DICompositeType(tag: DW_TAG_structure_type, name: "view[u8]", file: !42, size: 128, align: 64, elements: !174)
+!174 = !{!175, !176}
+!175 = !DIDerivedType(tag: DW_TAG_member, name: "len", file: !42, baseType: !14, size: 64, align: 64)
+!176 = !DIDerivedType(tag: DW_TAG_member, name: "data", file: !42, baseType: !11, size: 64, align: 64, offset: 64)
+!177 = !{!178, !179, !180}
+!178 = !DILocalVariable(name: "self", arg: 1, scope: !170, file: !42, line: 18, type: !72)
+!179 = !DILocalVariable(name: "bytes", arg: 2, scope: !170, file: !42, line: 18, type: !173)
+!180 = !DILocalVariable(name: "count", scope: !170, file: !42, line: 19, type: !14)
+!181 = !DILocation(line: 18, column: 5, scope: !170)
+!182 = !DILocation(line: 18, column: 14, scope: !170)
+!183 = !DILocation(line: 19, column: 9, scope: !170)
+!184 = !DILocation(line: 0, scope: !170)
+!185 = !DILocation(line: 20, column: 13, scope: !170)
+!186 = !DILocation(line: 21, column: 13, scope: !170)
+!187 = !DILocation(line: 21, column: 29, scope: !170)
+!188 = distinct !DISubprogram(name: "Writer.flush", linkageName: "Writer.flush", scope: !42, file: !42, line: 51, type: !189, scopeLine: 51, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !191)
+!189 = !DISubroutineType(types: !190)
+!190 = !{null, !62}
+!191 = !{!192}
+!192 = !DILocalVariable(name: "self", arg: 1, scope: !188, file: !42, line: 51, type: !72)
+!193 = !DILocation(line: 51, column: 5, scope: !188)
+!194 = !DILocation(line: 52, column: 13, scope: !188)
+!195 = !DILocation(line: 53, column: 13, scope: !188)
+!196 = !DILocation(line: 56, column: 13, scope: !188)
+!197 = !DILocation(line: 57, column: 13, scope: !188)
+!198 = distinct !DISubprogram(name: "Writer.destruct", linkageName: "Writer.destruct", scope: !42, file: !42, line: 61, type: !189, scopeLine: 61, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !199)
+!199 = !{!200}
+!200 = !DILocalVariable(name: "self", arg: 1, scope: !198, file: !42, line: 61, type: !72)
+!201 = !DILocation(line: 61, column: 5, scope: !198)
+!202 = !DILocation(line: 62, column: 13, scope: !198)
+!203 = !DILocation(line: 63, column: 13, scope: !198)
+!204 = !DILocation(line: 64, column: 13, scope: !198)
+!205 = distinct !DISubprogram(name: "flush_stdout", linkageName: "flush_stdout", scope: !42, file: !42, line: 105, type: !206, scopeLine: 105, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !57)
+!206 = !DISubroutineType(types: !207)
+!207 = !{null}
+!208 = !DILocation(line: 106, column: 5, scope: !205)
+!209 = distinct !DISubprogram(name: "format_float", linkageName: "format_float", scope: !21, file: !21, line: 36, type: !210, scopeLine: 36, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !212)
+!210 = !DISubroutineType(types: !211)
+!211 = !{!14, !145, !25}
+!212 = !{!213, !214}
+!213 = !DILocalVariable(name: "value", arg: 1, scope: !209, file: !21, line: 36, type: !145)
+!214 = !DILocalVariable(name: "out", arg: 2, scope: !209, file: !21, line: 36, type: !25)
+!215 = !DILocation(line: 36, column: 8, scope: !209)
+!216 = !DILocation(line: 36, column: 24, scope: !209)
+!217 = !DILocation(line: 36, column: 36, scope: !209)
+!218 = !DILocation(line: 0, scope: !209)
+!219 = !DILocation(line: 37, column: 21, scope: !209)
+!220 = !DILocation(line: 38, column: 9, scope: !209)
+!221 = !DILocation(line: 40, column: 12, scope: !209)
+!222 = !DILocation(line: 40, column: 37, scope: !209)
+!223 = distinct !DISubprogram(name: "max_u64_length", linkageName: "max_u64_length", scope: !21, file: !21, line: 13, type: !55, scopeLine: 13, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !57)
+!224 = !DILocation(line: 14, column: 5, scope: !223)
+!225 = distinct !DISubprogram(name: "format_int", linkageName: "format_int", scope: !21, file: !21, line: 21, type: !226, scopeLine: 21, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !228)
+!226 = !DISubroutineType(types: !227)
+!227 = !{!14, !159, !25}
+!228 = !{!229, !230}
+!229 = !DILocalVariable(name: "value", arg: 1, scope: !225, file: !21, line: 21, type: !159)
+!230 = !DILocalVariable(name: "out", arg: 2, scope: !225, file: !21, line: 21, type: !25)
+!231 = !DILocation(line: 21, column: 8, scope: !225)
+!232 = !DILocation(line: 21, column: 22, scope: !225)
+!233 = !DILocation(line: 21, column: 34, scope: !225)
+!234 = !DILocation(line: 0, scope: !225)
+!235 = !DILocation(line: 22, column: 21, scope: !225)
+!236 = !DILocation(line: 23, column: 9, scope: !225)
+!237 = !DILocation(line: 25, column: 12, scope: !225)
+!238 = !DILocation(line: 25, column: 37, scope: !225)
+!239 = distinct !DISubprogram(name: "max_f64_length", linkageName: "max_f64_length", scope: !21, file: !21, line: 17, type: !55, scopeLine: 17, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !57)
+!240 = !DILocation(line: 18, column: 5, scope: !239)
@@ -0,0 +1,136 @@
+; ModuleID = 'TestSelf.Main'
+source_filename = "TestSelf.Main"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+declare void @printI32(i32)
+
+; Function Attrs: nounwind
+declare i32 @MathLib.CoreMath.subtract(i32, i32) #0
+
+; Function Attrs: nounwind
+declare i32 @MathLib.CoreMath.add(i32, i32) #0
+
+; Function Attrs: nounwind
+declare i32 @Self.Utils.triple(i32) #0
+
+; Function Attrs: nounwind
+declare i32 @MathLib.CoreMath.multiply(i32, i32) #0
+
+; Function Attrs: nounwind
+define i32 @main() #0 !dbg !4 {
+entry:
+  %final_result = alloca i32, align 4
+  %dep_result = alloca i32, align 4
+  %sum = alloca i32, align 4
+  %tripled = alloca i32, align 4
+  %doubled = alloca i32, align 4
+  call void @llvm.dbg.declare(metadata ptr %doubled, metadata !10, metadata !DIExpression()), !dbg !15
+  %call = call i32 @Self.Utils.double(i32 5), !dbg !16
+  store i32 %call, ptr %doubled, align 4, !dbg !16
+  %doubled1 = load i32, ptr %doubled, align 4, !dbg !17
+  %ne = icmp ne i32 %doubled1, 10, !dbg !17
+  br i1 %ne, label %if.then, label %if.else, !dbg !17
+
+if.then:                                          ; preds = %entry
+  ret i32 1, !dbg !18
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !18
+
+if.join:                                          ; preds = %if.else
+  call void @llvm.dbg.declare(metadata ptr %tripled, metadata !11, metadata !DIExpression()), !dbg !19
+  %call2 = call i32 @Self.Utils.triple(i32 4), !dbg !20
+  store i32 %call2, ptr %tripled, align 4, !dbg !20
+  %tripled3 = load i32, ptr %tripled, align 4, !dbg !21
+  %ne4 = icmp ne i32 %tripled3, 12, !dbg !21
+  br i1 %ne4, label %if.then5, label %if.else6, !dbg !21
+
+if.then5:                                         ; preds = %if.join
+  ret i32 2, !dbg !22
+
+if.else6:                                         ; preds = %if.join
+  br label %if.join7, !dbg !22
+
+if.join7:                                         ; preds = %if.else6
+  call void @llvm.dbg.declare(metadata ptr %sum, metadata !12, metadata !DIExpression()), !dbg !23
+  %call8 = call i32 @MathLib.CoreMath.add(i32 7, i32 3), !dbg !24
+  store i32 %call8, ptr %sum, align 4, !dbg !24
+  %sum9 = load i32, ptr %sum, align 4, !dbg !25
+  %ne10 = icmp ne i32 %sum9, 10, !dbg !25
+  br i1 %ne10, label %if.then11, label %if.else12, !dbg !25
+
+if.then11:                                        ; preds = %if.join7
+  ret i32 3, !dbg !26
+
+if.else12:                                        ; preds = %if.join7
+  br label %if.join13, !dbg !26
+
+if.join13:                                        ; preds = %if.else12
+  call void @llvm.dbg.declare(metadata ptr %dep_result, metadata !13, metadata !DIExpression()), !dbg !27
+  %call14 = call i32 @MathLib.CoreMath.multiply(i32 2, i32 3), !dbg !28
+  store i32 %call14, ptr %dep_result, align 4, !dbg !28
+  call void @llvm.dbg.declare(metadata ptr %final_result, metadata !14, metadata !DIExpression()), !dbg !29
+  %dep_result15 = load i32, ptr %dep_result, align 4, !dbg !30
+  %call16 = call i32 @Self.Utils.double(i32 %dep_result15), !dbg !30
+  store i32 %call16, ptr %final_result, align 4, !dbg !30
+  %final_result17 = load i32, ptr %final_result, align 4, !dbg !31
+  %ne18 = icmp ne i32 %final_result17, 12, !dbg !31
+  br i1 %ne18, label %if.then19, label %if.else20, !dbg !31
+
+if.then19:                                        ; preds = %if.join13
+  ret i32 4, !dbg !32
+
+if.else20:                                        ; preds = %if.join13
+  br label %if.join21, !dbg !32
+
+if.join21:                                        ; preds = %if.else20
+  ret i32 0, !dbg !33
+}
+
+; Function Attrs: nounwind
+declare i32 @Self.Utils.double(i32) #0
+
+; Function Attrs: nofree nosync nounwind readnone speculatable willreturn
+declare void @llvm.dbg.declare(metadata, metadata, metadata) #1
+
+attributes #0 = { nounwind }
+attributes #1 = { nofree nosync nounwind readnone speculatable willreturn }
+
+!llvm.dbg.cu = !{!0}
+!llvm.module.flags = !{!2, !3}
+
+!0 = distinct !DICompileUnit(language: DW_LANG_C, file: !1, producer: "ShiroC Compiler\00", isOptimized: false, runtimeVersion: 0, emissionKind: FullDebug, splitDebugInlining: false)
+!1 = !DIFile(filename: "Main", directory: ".")
+!2 = !{i32 2, !"Dwarf Version", i32 4}
+!3 = !{i32 2, !"Debug Info Version", i32 3}
+!4 = distinct !DISubprogram(name: "main", linkageName: "main", scope: !5, file: !5, line: 6, type: !6, scopeLine: 6, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !9)
+!5 = !DIFile(filename: "main.shiro", directory: "src/tests/st/dependencies/test3_self/src/main")
+!6 = !DISubroutineType(types: !7)
+!7 = !{!8}
+!8 = !DIBasicType(name: "i32", size: 32, encoding: DW_ATE_signed)
+!9 = !{!10, !11, !12, !13, !14}
+!10 = !DILocalVariable(name: "doubled", scope: !4, file: !5, line: 8, type: !8)
+!11 = !DILocalVariable(name: "tripled", scope: !4, file: !5, line: 13, type: !8)
+!12 = !DILocalVariable(name: "sum", scope: !4, file: !5, line: 19, type: !8)
+!13 = !DILocalVariable(name: "dep_result", scope: !4, file: !5, line: 25, type: !8)
+!14 = !DILocalVariable(name: "final_result", scope: !4, file: !5, line: 26, type: !8)
+!15 = !DILocation(line: 8, column: 5, scope: !4)
+!16 = !DILocation(line: 8, column: 19, scope: !4)
+!17 = !DILocation(line: 9, column: 9, scope: !4)
+!18 = !DILocation(line: 10, column: 9, scope: !4)
+!19 = !DILocation(line: 13, column: 5, scope: !4)
+!20 = !DILocation(line: 13, column: 19, scope: !4)
+!21 = !DILocation(line: 14, column: 9, scope: !4)
+!22 = !DILocation(line: 15, column: 9, scope: !4)
+!23 = !DILocation(line: 19, column: 5, scope: !4)
+!24 = !DILocation(line: 19, column: 15, scope: !4)
+!25 = !DILocation(line: 20, column: 9, scope: !4)
+!26 = !DILocation(line: 21, column: 9, scope: !4)
+!27 = !DILocation(line: 25, column: 5, scope: !4)
+!28 = !DILocation(line: 25, column: 22, scope: !4)
+!29 = !DILocation(line: 26, column: 5, scope: !4)
+!30 = !DILocation(line: 26, column: 24, scope: !4)
+!31 = !DILocation(line: 27, column: 9, scope: !4)
+!32 = !DILocation(line: 28, column: 9, scope: !4)
+!33 = !DILocation(line: 31, column: 5, scope: !4)
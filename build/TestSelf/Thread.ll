@@ -0,0 +1,410 @@
+; ModuleID = 'TestSelf.Thread'
+source_filename = "TestSelf.Thread"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+%Std.Thread.Mutex = type { i64 }
+%Std.Thread.Thread = type { ptr }
+
+declare void @printI32(i32)
+
+declare ptr @shiro_thread_spawn(ptr, ptr)
+
+; Function Attrs: nounwind
+define ptr @Std.Thread.Mutex.system_mutex(ptr nonnull dereferenceable(8) %0) #0 !dbg !4 {
+entry:
+  %created = alloca i64, align 8, !dbg !19
+  %current = alloca i64, align 8, !dbg !19
+  %self.addr = alloca ptr, align 8, !dbg !19
+  store ptr %0, ptr %self.addr, align 8, !dbg !19
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !15, metadata !DIExpression()), !dbg !19
+  call void @llvm.dbg.declare(metadata ptr %current, metadata !17, metadata !DIExpression()), !dbg !20
+  %1 = load ptr, ptr %self.addr, align 8, !dbg !21
+  %Std.Thread.Mutex = getelementptr inbounds %Std.Thread.Mutex, ptr %1, i32 0, i32 0, !dbg !21
+  %atomic_load = load atomic i64, ptr %Std.Thread.Mutex acquire, align 8, !dbg !21
+  store i64 %atomic_load, ptr %current, align 8, !dbg !21
+  %current1 = load i64, ptr %current, align 8, !dbg !22
+  %ne = icmp ne i64 %current1, 0, !dbg !22
+  br i1 %ne, label %if.then, label %if.else, !dbg !22
+
+if.then:                                          ; preds = %entry
+  %current2 = load i64, ptr %current, align 8, !dbg !23
+  %int2ptr = inttoptr i64 %current2 to ptr, !dbg !23
+  ret ptr %int2ptr, !dbg !23
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !23
+
+if.join:                                          ; preds = %if.else
+  call void @llvm.dbg.declare(metadata ptr %created, metadata !18, metadata !DIExpression()), !dbg !24
+  %call = call ptr @shiro_mutex_create(), !dbg !25
+  %ptr2int = ptrtoint ptr %call to i64, !dbg !25
+  store i64 %ptr2int, ptr %created, align 8, !dbg !25
+  %2 = load ptr, ptr %self.addr, align 8, !dbg !26
+  %Std.Thread.Mutex3 = getelementptr inbounds %Std.Thread.Mutex, ptr %2, i32 0, i32 0, !dbg !26
+  %created4 = load i64, ptr %created, align 8, !dbg !26
+  %3 = cmpxchg ptr %Std.Thread.Mutex3, i64 0, i64 %created4 acq_rel acquire, align 8, !dbg !26
+  %exchanged = extractvalue { i64, i1 } %3, 1, !dbg !26
+  br i1 %exchanged, label %if.then5, label %if.else6, !dbg !26
+
+if.then5:                                         ; preds = %if.join
+  %created8 = load i64, ptr %created, align 8, !dbg !27
+  %int2ptr9 = inttoptr i64 %created8 to ptr, !dbg !27
+  ret ptr %int2ptr9, !dbg !27
+
+if.else6:                                         ; preds = %if.join
+  br label %if.join7, !dbg !27
+
+if.join7:                                         ; preds = %if.else6
+  %created10 = load i64, ptr %created, align 8, !dbg !28
+  %int2ptr11 = inttoptr i64 %created10 to ptr, !dbg !28
+  call void @shiro_mutex_destroy(ptr %int2ptr11), !dbg !28
+  %4 = load ptr, ptr %self.addr, align 8, !dbg !29
+  %Std.Thread.Mutex12 = getelementptr inbounds %Std.Thread.Mutex, ptr %4, i32 0, i32 0, !dbg !29
+  %atomic_load13 = load atomic i64, ptr %Std.Thread.Mutex12 acquire, align 8, !dbg !29
+  %int2ptr14 = inttoptr i64 %atomic_load13 to ptr, !dbg !29
+  ret ptr %int2ptr14, !dbg !29
+}
+
+; Function Attrs: nounwind
+define void @Std.Thread.Mutex.lock(ptr nonnull dereferenceable(8) %0) #0 !dbg !30 {
+entry:
+  %self.addr = alloca ptr, align 8, !dbg !35
+  store ptr %0, ptr %self.addr, align 8, !dbg !35
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !34, metadata !DIExpression()), !dbg !35
+  %1 = load ptr, ptr %self.addr, align 8, !dbg !36
+  %method_call = call ptr @Std.Thread.Mutex.system_mutex(ptr %1), !dbg !36
+  call void @shiro_mutex_lock(ptr %method_call), !dbg !36
+  ret void, !dbg !36
+}
+
+; Function Attrs: nounwind
+define void @Std.Thread.Mutex.unlock(ptr nonnull dereferenceable(8) %0) #0 !dbg !37 {
+entry:
+  %self.addr = alloca ptr, align 8, !dbg !40
+  store ptr %0, ptr %self.addr, align 8, !dbg !40
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !39, metadata !DIExpression()), !dbg !40
+  %1 = load ptr, ptr %self.addr, align 8, !dbg !41
+  %Std.Thread.Mutex = getelementptr inbounds %Std.Thread.Mutex, ptr %1, i32 0, i32 0, !dbg !41
+  %member_val = load i64, ptr %Std.Thread.Mutex, align 8, !dbg !41
+  %int2ptr = inttoptr i64 %member_val to ptr, !dbg !41
+  call void @shiro_mutex_unlock(ptr %int2ptr), !dbg !41
+  ret void, !dbg !41
+}
+
+; Function Attrs: nounwind
+define void @"Std.Thread.Mutex.@destruct"(ptr nonnull dereferenceable(8) %0) #0 !dbg !42 {
+entry:
+  %self.addr = alloca ptr, align 8, !dbg !45
+  store ptr %0, ptr %self.addr, align 8, !dbg !45
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !44, metadata !DIExpression()), !dbg !45
+  %1 = load ptr, ptr %self.addr, align 8, !dbg !46
+  %Std.Thread.Mutex = getelementptr inbounds %Std.Thread.Mutex, ptr %1, i32 0, i32 0, !dbg !46
+  %member_val = load i64, ptr %Std.Thread.Mutex, align 8, !dbg !46
+  %ne = icmp ne i64 %member_val, 0, !dbg !46
+  br i1 %ne, label %if.then, label %if.else, !dbg !46
+
+if.then:                                          ; preds = %entry
+  %2 = load ptr, ptr %self.addr, align 8, !dbg !47
+  %Std.Thread.Mutex1 = getelementptr inbounds %Std.Thread.Mutex, ptr %2, i32 0, i32 0, !dbg !47
+  %member_val2 = load i64, ptr %Std.Thread.Mutex1, align 8, !dbg !47
+  %int2ptr = inttoptr i64 %member_val2 to ptr, !dbg !47
+  call void @shiro_mutex_destroy(ptr %int2ptr), !dbg !47
+  br label %if.join, !dbg !47
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !47
+
+if.join:                                          ; preds = %if.else, %if.then
+  ret void, !dbg !47
+}
+
+declare void @shiro_mutex_lock(ptr)
+
+declare i64 @shiro_parallel_threads()
+
+declare void @shiro_parallel_for(ptr, i64, i64, i64, ptr, ptr)
+
+; Function Attrs: nounwind
+define i64 @Std.Thread.parallel_threads() #0 !dbg !48 {
+entry:
+  %call = tail call i64 @shiro_parallel_threads(), !dbg !53
+  ret i64 %call, !dbg !53
+}
+
+declare void @shiro_thread_join(ptr)
+
+; Function Attrs: nounwind
+define void @Std.Thread.set_parallel_threads(i64 %0) #0 !dbg !54 {
+entry:
+  %count.addr = alloca i64, align 8, !dbg !59
+  store i64 %0, ptr %count.addr, align 8, !dbg !59
+  call void @llvm.dbg.declare(metadata ptr %count.addr, metadata !58, metadata !DIExpression()), !dbg !60
+  %count = load i64, ptr %count.addr, align 8, !dbg !61
+  call void @shiro_parallel_set_threads(i64 %count), !dbg !61
+  ret void, !dbg !61
+}
+
+; Function Attrs: nounwind
+define void @Std.Thread.parallel_run(ptr %0, i64 %1, i64 %2, i64 %3, ptr %4, ptr %5) #0 !dbg !62 {
+entry:
+  %data.addr = alloca ptr, align 8, !dbg !74
+  store ptr %0, ptr %data.addr, align 8, !dbg !74
+  call void @llvm.dbg.declare(metadata ptr %data.addr, metadata !68, metadata !DIExpression()), !dbg !75
+  %count.addr = alloca i64, align 8, !dbg !74
+  store i64 %1, ptr %count.addr, align 8, !dbg !74
+  call void @llvm.dbg.declare(metadata ptr %count.addr, metadata !69, metadata !DIExpression()), !dbg !76
+  %element_size.addr = alloca i64, align 8, !dbg !74
+  store i64 %2, ptr %element_size.addr, align 8, !dbg !74
+  call void @llvm.dbg.declare(metadata ptr %element_size.addr, metadata !70, metadata !DIExpression()), !dbg !77
+  %grain.addr = alloca i64, align 8, !dbg !74
+  store i64 %3, ptr %grain.addr, align 8, !dbg !74
+  call void @llvm.dbg.declare(metadata ptr %grain.addr, metadata !71, metadata !DIExpression()), !dbg !78
+  %body.addr = alloca ptr, align 8, !dbg !74
+  store ptr %4, ptr %body.addr, align 8, !dbg !74
+  call void @llvm.dbg.declare(metadata ptr %body.addr, metadata !72, metadata !DIExpression()), !dbg !79
+  %context.addr = alloca ptr, align 8, !dbg !74
+  store ptr %5, ptr %context.addr, align 8, !dbg !74
+  call void @llvm.dbg.declare(metadata ptr %context.addr, metadata !73, metadata !DIExpression()), !dbg !80
+  %data = load ptr, ptr %data.addr, align 8, !dbg !81
+  %count = load i64, ptr %count.addr, align 8, !dbg !81
+  %element_size = load i64, ptr %element_size.addr, align 8, !dbg !81
+  %grain = load i64, ptr %grain.addr, align 8, !dbg !81
+  %body = load ptr, ptr %body.addr, align 8, !dbg !81
+  %context = load ptr, ptr %context.addr, align 8, !dbg !81
+  call void @shiro_parallel_for(ptr %data, i64 %count, i64 %element_size, i64 %grain, ptr %body, ptr %context), !dbg !81
+  ret void, !dbg !81
+}
+
+; Function Attrs: nounwind
+define i1 @Std.Thread.Thread.spawn(ptr nonnull dereferenceable(8) %0, ptr %1, ptr %2) #0 !dbg !82 {
+entry:
+  %self.addr = alloca ptr, align 8, !dbg !96
+  store ptr %0, ptr %self.addr, align 8, !dbg !96
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !92, metadata !DIExpression()), !dbg !96
+  %entry.addr = alloca ptr, align 8, !dbg !96
+  store ptr %1, ptr %entry.addr, align 8, !dbg !96
+  call void @llvm.dbg.declare(metadata ptr %entry.addr, metadata !94, metadata !DIExpression()), !dbg !97
+  %context.addr = alloca ptr, align 8, !dbg !96
+  store ptr %2, ptr %context.addr, align 8, !dbg !96
+  call void @llvm.dbg.declare(metadata ptr %context.addr, metadata !95, metadata !DIExpression()), !dbg !98
+  %3 = load ptr, ptr %self.addr, align 8, !dbg !99
+  %Std.Thread.Thread = getelementptr inbounds %Std.Thread.Thread, ptr %3, i32 0, i32 0, !dbg !99
+  %member_val = load ptr, ptr %Std.Thread.Thread, align 8, !dbg !99
+  %ne = icmp ne ptr %member_val, null, !dbg !99
+  br i1 %ne, label %if.then, label %if.else, !dbg !99
+
+if.then:                                          ; preds = %entry
+  ret i1 false, !dbg !100
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !100
+
+if.join:                                          ; preds = %if.else
+  %entry1 = load ptr, ptr %entry.addr, align 8, !dbg !101
+  %context = load ptr, ptr %context.addr, align 8, !dbg !101
+  %call = call ptr @shiro_thread_spawn(ptr %entry1, ptr %context), !dbg !101
+  %4 = load ptr, ptr %self.addr, align 8, !dbg !101
+  %Std.Thread.Thread2 = getelementptr inbounds %Std.Thread.Thread, ptr %4, i32 0, i32 0, !dbg !101
+  store ptr %call, ptr %Std.Thread.Thread2, align 8, !dbg !101
+  %5 = load ptr, ptr %self.addr, align 8, !dbg !102
+  %Std.Thread.Thread3 = getelementptr inbounds %Std.Thread.Thread, ptr %5, i32 0, i32 0, !dbg !102
+  %member_val4 = load ptr, ptr %Std.Thread.Thread3, align 8, !dbg !102
+  %ne5 = icmp ne ptr %member_val4, null, !dbg !102
+  ret i1 %ne5, !dbg !102
+}
+
+; Function Attrs: nounwind
+define void @Std.Thread.Thread.join(ptr nonnull dereferenceable(8) %0) #0 !dbg !103 {
+entry:
+  %self.addr = alloca ptr, align 8, !dbg !108
+  store ptr %0, ptr %self.addr, align 8, !dbg !108
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !107, metadata !DIExpression()), !dbg !108
+  %1 = load ptr, ptr %self.addr, align 8, !dbg !109
+  %Std.Thread.Thread = getelementptr inbounds %Std.Thread.Thread, ptr %1, i32 0, i32 0, !dbg !109
+  %member_val = load ptr, ptr %Std.Thread.Thread, align 8, !dbg !109
+  %ne = icmp ne ptr %member_val, null, !dbg !109
+  br i1 %ne, label %if.then, label %if.else, !dbg !109
+
+if.then:                                          ; preds = %entry
+  %2 = load ptr, ptr %self.addr, align 8, !dbg !110
+  %Std.Thread.Thread1 = getelementptr inbounds %Std.Thread.Thread, ptr %2, i32 0, i32 0, !dbg !110
+  %member_val2 = load ptr, ptr %Std.Thread.Thread1, align 8, !dbg !110
+  call void @shiro_thread_join(ptr %member_val2), !dbg !110
+  %3 = load ptr, ptr %self.addr, align 8, !dbg !110
+  %Std.Thread.Thread3 = getelementptr inbounds %Std.Thread.Thread, ptr %3, i32 0, i32 0, !dbg !110
+  store ptr null, ptr %Std.Thread.Thread3, align 8, !dbg !110
+  br label %if.join, !dbg !110
+
+if.else:                                          ; preds = %entry
+  br label %if.join, !dbg !110
+
+if.join:                                          ; preds = %if.else, %if.then
+  ret void, !dbg !110
+}
+
+; Function Attrs: nounwind readonly willreturn
+define i1 @Std.Thread.Thread.running(ptr nonnull dereferenceable(8) %0) #1 !dbg !111 {
+entry:
+  %self.addr = alloca ptr, align 8, !dbg !116
+  store ptr %0, ptr %self.addr, align 8, !dbg !116
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !115, metadata !DIExpression()), !dbg !116
+  %1 = load ptr, ptr %self.addr, align 8, !dbg !117
+  %Std.Thread.Thread = getelementptr inbounds %Std.Thread.Thread, ptr %1, i32 0, i32 0, !dbg !117
+  %member_val = load ptr, ptr %Std.Thread.Thread, align 8, !dbg !117
+  %ne = icmp ne ptr %member_val, null, !dbg !117
+  ret i1 %ne, !dbg !117
+}
+
+; Function Attrs: nounwind
+define void @"Std.Thread.Thread.@destruct"(ptr nonnull dereferenceable(8) %0) #0 !dbg !118 {
+entry:
+  %self.addr = alloca ptr, align 8, !dbg !121
+  store ptr %0, ptr %self.addr, align 8, !dbg !121
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !120, metadata !DIExpression()), !dbg !121
+  %1 = load ptr, ptr %self.addr, align 8, !dbg !122
+  call void @Std.Thread.Thread.join(ptr %1), !dbg !122
+  ret void, !dbg !122
+}
+
+declare void @shiro_mutex_destroy(ptr)
+
+declare void @shiro_mutex_unlock(ptr)
+
+declare void @shiro_parallel_set_threads(i64)
+
+declare ptr @shiro_mutex_create()
+
+; Function Attrs: nofree nosync nounwind readnone speculatable willreturn
+declare void @llvm.dbg.declare(metadata, metadata, metadata) #2
+
+attributes #0 = { nounwind }
+attributes #1 = { nounwind readonly willreturn }
+attributes #2 = { nofree nosync nounwind readnone speculatable willreturn }
+
+!llvm.dbg.cu = !{!0}
+!llvm.module.flags = !{!2, !3}
+
+!0 = distinct !DICompileUnit(language: DW_LANG_C, file: !1, producer: "ShiroC Compiler\00", isOptimized: false, runtimeVersion: 0, emissionKind: FullDebug, splitDebugInlining: false)
+!1 = !DIFile(filename: "Thread", directory: ".")
+!2 = !{i32 2, !"Dwarf Version", i32 4}
+!3 = !{i32 2, !"Debug Info Version", i32 3}
+!4 = distinct !DISubprogram(name: "Mutex.system_mutex", linkageName: "Mutex.system_mutex", scope: !5, file: !5, line: 27, type: !6, scopeLine: 27, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !14)
+!5 = !DIFile(filename: "mutex.shiro", directory: "/tmp/asan/src/std/Thread")
+!6 = !DISubroutineType(types: !7)
+!7 = !{!8, !9}
+!8 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: null, size: 64, dwarfAddressSpace: 0)
+!9 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !10, size: 64, flags: DIFlagArtificial | DIFlagObjectPointer, dwarfAddressSpace: 0)
+!10 = !DICompositeType(tag: DW_TAG_structure_type, name: "Mutex", file: !5, line: 9, size: 64, align: 64, elements: !11, identifier: "Std.Thread.Mutex")
+!11 = !{!12}
+!12 = !DIDerivedType(tag: DW_TAG_member, name: "handle", scope: !10, file: !5, baseType: !13, size: 64, align: 64)
+!13 = !DIBasicType(name: "usize", size: 64, encoding: DW_ATE_unsigned_char)
+!14 = !{!15, !17, !18}
+!15 = !DILocalVariable(name: "self", arg: 1, scope: !4, file: !5, line: 27, type: !16)
+!16 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !10, size: 64, dwarfAddressSpace: 0)
+!17 = !DILocalVariable(name: "current", scope: !4, file: !5, line: 28, type: !13)
+!18 = !DILocalVariable(name: "created", scope: !4, file: !5, line: 33, type: !13)
+!19 = !DILocation(line: 27, column: 5, scope: !4)
+!20 = !DILocation(line: 28, column: 9, scope: !4)
+!21 = !DILocation(line: 28, column: 23, scope: !4)
+!22 = !DILocation(line: 29, column: 13, scope: !4)
+!23 = !DILocation(line: 30, column: 13, scope: !4)
+!24 = !DILocation(line: 33, column: 9, scope: !4)
+!25 = !DILocation(line: 33, column: 23, scope: !4)
+!26 = !DILocation(line: 34, column: 13, scope: !4)
+!27 = !DILocation(line: 35, column: 13, scope: !4)
+!28 = !DILocation(line: 37, column: 9, scope: !4)
+!29 = !DILocation(line: 38, column: 16, scope: !4)
+!30 = distinct !DISubprogram(name: "Mutex.lock", linkageName: "Mutex.lock", scope: !5, file: !5, line: 12, type: !31, scopeLine: 12, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !33)
+!31 = !DISubroutineType(types: !32)
+!32 = !{null, !9}
+!33 = !{!34}
+!34 = !DILocalVariable(name: "self", arg: 1, scope: !30, file: !5, line: 12, type: !16)
+!35 = !DILocation(line: 12, column: 5, scope: !30)
+!36 = !DILocation(line: 13, column: 26, scope: !30)
+!37 = distinct !DISubprogram(name: "Mutex.unlock", linkageName: "Mutex.unlock", scope: !5, file: !5, line: 16, type: !31, scopeLine: 16, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !38)
+!38 = !{!39}
+!39 = !DILocalVariable(name: "self", arg: 1, scope: !37, file: !5, line: 16, type: !16)
+!40 = !DILocation(line: 16, column: 5, scope: !37)
+!41 = !DILocation(line: 17, column: 9, scope: !37)
+!42 = distinct !DISubprogram(name: "Mutex.destruct", linkageName: "Mutex.destruct", scope: !5, file: !5, line: 20, type: !31, scopeLine: 20, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !43)
+!43 = !{!44}
+!44 = !DILocalVariable(name: "self", arg: 1, scope: !42, file: !5, line: 20, type: !16)
+!45 = !DILocation(line: 20, column: 5, scope: !42)
+!46 = !DILocation(line: 21, column: 13, scope: !42)
+!47 = !DILocation(line: 22, column: 13, scope: !42)
+!48 = distinct !DISubprogram(name: "parallel_threads", linkageName: "parallel_threads", scope: !49, file: !49, line: 32, type: !50, scopeLine: 32, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !52)
+!49 = !DIFile(filename: "parallel.shiro", directory: "/tmp/asan/src/std/Thread")
+!50 = !DISubroutineType(types: !51)
+!51 = !{!13}
+!52 = !{}
+!53 = !DILocation(line: 33, column: 12, scope: !48)
+!54 = distinct !DISubprogram(name: "set_parallel_threads", linkageName: "set_parallel_threads", scope: !49, file: !49, line: 37, type: !55, scopeLine: 37, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !57)
+!55 = !DISubroutineType(types: !56)
+!56 = !{null, !13}
+!57 = !{!58}
+!58 = !DILocalVariable(name: "count", arg: 1, scope: !54, file: !49, line: 37, type: !13)
+!59 = !DILocation(line: 37, column: 8, scope: !54)
+!60 = !DILocation(line: 37, column: 32, scope: !54)
+!61 = !DILocation(line: 38, column: 5, scope: !54)
+!62 = distinct !DISubprogram(name: "parallel_run", linkageName: "parallel_run", scope: !49, file: !49, line: 27, type: !63, scopeLine: 27, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !67)
+!63 = !DISubroutineType(types: !64)
+!64 = !{null, !65, !13, !13, !13, !8, !8}
+!65 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !66, size: 64, dwarfAddressSpace: 0)
+!66 = !DIBasicType(name: "u8", size: 8, encoding: DW_ATE_unsigned_char)
+!67 = !{!68, !69, !70, !71, !72, !73}
+!68 = !DILocalVariable(name: "data", arg: 1, scope: !62, file: !49, line: 27, type: !65)
+!69 = !DILocalVariable(name: "count", arg: 2, scope: !62, file: !49, line: 27, type: !13)
+!70 = !DILocalVariable(name: "element_size", arg: 3, scope: !62, file: !49, line: 27, type: !13)
+!71 = !DILocalVariable(name: "grain", arg: 4, scope: !62, file: !49, line: 27, type: !13)
+!72 = !DILocalVariable(name: "body", arg: 5, scope: !62, file: !49, line: 27, type: !8)
+!73 = !DILocalVariable(name: "context", arg: 6, scope: !62, file: !49, line: 27, type: !8)
+!74 = !DILocation(line: 27, column: 8, scope: !62)
+!75 = !DILocation(line: 27, column: 24, scope: !62)
+!76 = !DILocation(line: 27, column: 35, scope: !62)
+!77 = !DILocation(line: 27, column: 49, scope: !62)
+!78 = !DILocation(line: 27, column: 70, scope: !62)
+!79 = !DILocation(line: 27, column: 84, scope: !62)
+!80 = !DILocation(line: 27, column: 97, scope: !62)
+!81 = !DILocation(line: 28, column: 5, scope: !62)
+!82 = distinct !DISubprogram(name: "Thread.spawn", linkageName: "Thread.spawn", scope: !83, file: !83, line: 18, type: !84, scopeLine: 18, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !91)
+!83 = !DIFile(filename: "thread.shiro", directory: "/tmp/asan/src/std/Thread")
+!84 = !DISubroutineType(types: !85)
+!85 = !{!86, !87, !8, !8}
+!86 = !DIBasicType(name: "bool", size: 8, encoding: DW_ATE_boolean)
+!87 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !88, size: 64, flags: DIFlagArtificial | DIFlagObjectPointer, dwarfAddressSpace: 0)
+!88 = !DICompositeType(tag: DW_TAG_structure_type, name: "Thread", file: !83, line: 13, size: 64, align: 64, elements: !89, identifier: "Std.Thread.Thread")
+!89 = !{!90}
+!90 = !DIDerivedType(tag: DW_TAG_member, name: "handle", scope: !88, file: !83, baseType: !8, size: 64, align: 64)
+!91 = !{!92, !94, !95}
+!92 = !DILocalVariable(name: "self", arg: 1, scope: !82, file: !83, line: 18, type: !93)
+!93 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !88, size: 64, dwarfAddressSpace: 0)
+!94 = !DILocalVariable(name: "entry", arg: 2, scope: !82, file: !83, line: 18, type: !8)
+!95 = !DILocalVariable(name: "context", arg: 3, scope: !82, file: !83, line: 18, type: !8)
+!96 = !DILocation(line: 18, column: 5, scope: !82)
+!97 = !DILocation(line: 18, column: 14, scope: !82)
+!98 = !DILocation(line: 18, column: 28, scope: !82)
+!99 = !DILocation(line: 19, column: 13, scope: !82)
+!100 = !DILocation(line: 20, column: 13, scope: !82)
+!101 = !DILocation(line: 22, column: 23, scope: !82)
+!102 = !DILocation(line: 23, column: 16, scope: !82)
+!103 = distinct !DISubprogram(name: "Thread.join", linkageName: "Thread.join", scope: !83, file: !83, line: 27, type: !104, scopeLine: 27, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !106)
+!104 = !DISubroutineType(types: !105)
+!105 = !{null, !87}
+!106 = !{!107}
+!107 = !DILocalVariable(name: "self", arg: 1, scope: !103, file: !83, line: 27, type: !93)
+!108 = !DILocation(line: 27, column: 5, scope: !103)
+!109 = !DILocation(line: 28, column: 13, scope: !103)
+!110 = !DILocation(line: 29, column: 13, scope: !103)
+!111 = distinct !DISubprogram(name: "Thread.running", linkageName: "Thread.running", scope: !83, file: !83, line: 34, type: !112, scopeLine: 34, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !114)
+!112 = !DISubroutineType(types: !113)
+!113 = !{!86, !87}
+!114 = !{!115}
+!115 = !DILocalVariable(name: "self", arg: 1, scope: !111, file: !83, line: 34, type: !93)
+!116 = !DILocation(line: 34, column: 5, scope: !111)
+!117 = !DILocation(line: 35, column: 16, scope: !111)
+!118 = distinct !DISubprogram(name: "Thread.destruct", linkageName: "Thread.destruct", scope: !83, file: !83, line: 39, type: !104, scopeLine: 39, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !119)
+!119 = !{!120}
+!120 = !DILocalVariable(name: "self", arg: 1, scope: !118, file: !83, line: 39, type: !93)
+!121 = !DILocation(line: 39, column: 5, scope: !118)
+!122 = !DILocation(line: 40, column: 9, scope: !118)
@@ -0,0 +1,58 @@
+; ModuleID = 'TestSelf.Utils'
+source_filename = "TestSelf.Utils"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+declare void @printI32(i32)
+
+; Function Attrs: nounwind readnone willreturn
+define i32 @Self.Utils.triple(i32 %0) #0 !dbg !4 {
+entry:
+  %x.addr = alloca i32, align 4, !dbg !11
+  store i32 %0, ptr %x.addr, align 4, !dbg !11
+  call void @llvm.dbg.declare(metadata ptr %x.addr, metadata !10, metadata !DIExpression()), !dbg !12
+  %x = load i32, ptr %x.addr, align 4, !dbg !13
+  %mul = mul nsw i32 %x, 3, !dbg !13
+  ret i32 %mul, !dbg !13
+}
+
+; Function Attrs: nounwind readnone willreturn
+define i32 @Self.Utils.double(i32 %0) #0 !dbg !14 {
+entry:
+  %x.addr = alloca i32, align 4, !dbg !17
+  store i32 %0, ptr %x.addr, align 4, !dbg !17
+  call void @llvm.dbg.declare(metadata ptr %x.addr, metadata !16, metadata !DIExpression()), !dbg !18
+  %x = load i32, ptr %x.addr, align 4, !dbg !19
+  %mul = mul nsw i32 %x, 2, !dbg !19
+  ret i32 %mul, !dbg !19
+}
+
+; Function Attrs: nofree nosync nounwind readnone speculatable willreturn
+declare void @llvm.dbg.declare(metadata, metadata, metadata) #1
+
+attributes #0 = { nounwind readnone willreturn }
+attributes #1 = { nofree nosync nounwind readnone speculatable willreturn }
+
+!llvm.dbg.cu = !{!0}
+!llvm.module.flags = !{!2, !3}
+
+!0 = distinct !DICompileUnit(language: DW_LANG_C, file: !1, producer: "ShiroC Compiler\00", isOptimized: false, runtimeVersion: 0, emissionKind: FullDebug, splitDebugInlining: false)
+!1 = !DIFile(filename: "Utils", directory: ".")
+!2 = !{i32 2, !"Dwarf Version", i32 4}
+!3 = !{i32 2, !"Debug Info Version", i32 3}
+!4 = distinct !DISubprogram(name: "triple", linkageName: "triple", scope: !5, file: !5, line: 7, type: !6, scopeLine: 7, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !9)
+!5 = !DIFile(filename: "helper.shiro", directory: "src/tests/st/dependencies/test3_self/src/utils")
+!6 = !DISubroutineType(types: !7)
+!7 = !{!8, !8}
+!8 = !DIBasicType(name: "i32", size: 32, encoding: DW_ATE_signed)
+!9 = !{!10}
+!10 = !DILocalVariable(name: "x", arg: 1, scope: !4, file: !5, line: 7, type: !8)
+!11 = !DILocation(line: 7, column: 8, scope: !4)
+!12 = !DILocation(line: 7, column: 18, scope: !4)
+!13 = !DILocation(line: 8, column: 12, scope: !4)
+!14 = distinct !DISubprogram(name: "double", linkageName: "double", scope: !5, file: !5, line: 3, type: !6, scopeLine: 3, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !15)
+!15 = !{!16}
+!16 = !DILocalVariable(name: "x", arg: 1, scope: !14, file: !5, line: 3, type: !8)
+!17 = !DILocation(line: 3, column: 8, scope: !14)
+!18 = !DILocation(line: 3, column: 18, scope: !14)
+!19 = !DILocation(line: 4, column: 12, scope: !14)
@@ -0,0 +1,116 @@
+; ModuleID = 'basic_project.Calculator'
+source_filename = "basic_project.Calculator"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+%Self.Calculator.Adder = type { i32 }
+
+declare void @printI32(i32)
+
+; Function Attrs: nounwind readnone willreturn
+define internal fastcc i32 @add_helper(i32 %0, i32 %1) #0 !dbg !4 {
+entry:
+  %first.addr = alloca i32, align 4, !dbg !12
+  store i32 %0, ptr %first.addr, align 4, !dbg !12
+  call void @llvm.dbg.declare(metadata ptr %first.addr, metadata !10, metadata !DIExpression()), !dbg !13
+  %second.addr = alloca i32, align 4, !dbg !12
+  store i32 %1, ptr %second.addr, align 4, !dbg !12
+  call void @llvm.dbg.declare(metadata ptr %second.addr, metadata !11, metadata !DIExpression()), !dbg !14
+  %first = load i32, ptr %first.addr, align 4, !dbg !15
+  %second = load i32, ptr %second.addr, align 4, !dbg !15
+  %add = add nsw i32 %first, %second, !dbg !15
+  ret i32 %add, !dbg !15
+}
+
+; Function Attrs: nounwind willreturn
+define i32 @Self.Calculator.Adder.add(ptr nonnull dereferenceable(4) %0, i32 %1, i32 %2) #1 !dbg !16 {
+entry:
+  %self.addr = alloca ptr, align 8, !dbg !29
+  store ptr %0, ptr %self.addr, align 8, !dbg !29
+  call void @llvm.dbg.declare(metadata ptr %self.addr, metadata !25, metadata !DIExpression()), !dbg !29
+  %lhs.addr = alloca i32, align 4, !dbg !29
+  store i32 %1, ptr %lhs.addr, align 4, !dbg !29
+  call void @llvm.dbg.declare(metadata ptr %lhs.addr, metadata !27, metadata !DIExpression()), !dbg !30
+  %rhs.addr = alloca i32, align 4, !dbg !29
+  store i32 %2, ptr %rhs.addr, align 4, !dbg !29
+  call void @llvm.dbg.declare(metadata ptr %rhs.addr, metadata !28, metadata !DIExpression()), !dbg !31
+  %lhs = load i32, ptr %lhs.addr, align 4, !dbg !32
+  %rhs = load i32, ptr %rhs.addr, align 4, !dbg !32
+  %add = add nsw i32 %lhs, %rhs, !dbg !32
+  %3 = load ptr, ptr %self.addr, align 8, !dbg !32
+  %Self.Calculator.Adder = getelementptr inbounds %Self.Calculator.Adder, ptr %3, i32 0, i32 0, !dbg !32
+  store i32 %add, ptr %Self.Calculator.Adder, align 4, !dbg !32
+  %4 = load ptr, ptr %self.addr, align 8, !dbg !33
+  %Self.Calculator.Adder1 = getelementptr inbounds %Self.Calculator.Adder, ptr %4, i32 0, i32 0, !dbg !33
+  %member_val = load i32, ptr %Self.Calculator.Adder1, align 4, !dbg !33
+  ret i32 %member_val, !dbg !33
+}
+
+; Function Attrs: nounwind
+define i32 @Self.Calculator.add(i32 %0, i32 %1) #2 !dbg !34 {
+entry:
+  %first.addr = alloca i32, align 4, !dbg !38
+  store i32 %0, ptr %first.addr, align 4, !dbg !38
+  call void @llvm.dbg.declare(metadata ptr %first.addr, metadata !36, metadata !DIExpression()), !dbg !39
+  %second.addr = alloca i32, align 4, !dbg !38
+  store i32 %1, ptr %second.addr, align 4, !dbg !38
+  call void @llvm.dbg.declare(metadata ptr %second.addr, metadata !37, metadata !DIExpression()), !dbg !40
+  %first = load i32, ptr %first.addr, align 4, !dbg !41
+  %second = load i32, ptr %second.addr, align 4, !dbg !41
+  %call = tail call fastcc i32 @add_helper(i32 %first, i32 %second), !dbg !41
+  ret i32 %call, !dbg !41
+}
+
+; Function Attrs: nofree nosync nounwind readnone speculatable willreturn
+declare void @llvm.dbg.declare(metadata, metadata, metadata) #3
+
+attributes #0 = { nounwind readnone willreturn }
+attributes #1 = { nounwind willreturn }
+attributes #2 = { nounwind }
+attributes #3 = { nofree nosync nounwind readnone speculatable willreturn }
+
+!llvm.dbg.cu = !{!0}
+!llvm.module.flags = !{!2, !3}
+
+!0 = distinct !DICompileUnit(language: DW_LANG_C, file: !1, producer: "ShiroC Compiler\00", isOptimized: false, runtimeVersion: 0, emissionKind: FullDebug, splitDebugInlining: false)
+!1 = !DIFile(filename: "Calculator", directory: ".")
+!2 = !{i32 2, !"Dwarf Version", i32 4}
+!3 = !{i32 2, !"Debug Info Version", i32 3}
+!4 = distinct !DISubprogram(name: "add_helper", linkageName: "add_helper", scope: !5, file: !5, line: 8, type: !6, scopeLine: 8, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !9)
+!5 = !DIFile(filename: "fns.shiro", directory: "src/tests/st/basic_project/calculator")
+!6 = !DISubroutineType(types: !7)
+!7 = !{!8, !8, !8}
+!8 = !DIBasicType(name: "i32", size: 32, encoding: DW_ATE_signed)
+!9 = !{!10, !11}
+!10 = !DILocalVariable(name: "first", arg: 1, scope: !4, file: !5, line: 8, type: !8)
+!11 = !DILocalVariable(name: "second", arg: 2, scope: !4, file: !5, line: 8, type: !8)
+!12 = !DILocation(line: 8, column: 1, scope: !4)
+!13 = !DILocation(line: 8, column: 15, scope: !4)
+!14 = !DILocation(line: 8, column: 27, scope: !4)
+!15 = !DILocation(line: 9, column: 12, scope: !4)
+!16 = distinct !DISubprogram(name: "Adder.add", linkageName: "Adder.add", scope: !17, file: !17, line: 7, type: !18, scopeLine: 7, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !24)
+!17 = !DIFile(filename: "adder.shiro", directory: "src/tests/st/basic_project/calculator")
+!18 = !DISubroutineType(types: !19)
+!19 = !{!8, !20, !8, !8}
+!20 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !21, size: 64, flags: DIFlagArtificial | DIFlagObjectPointer, dwarfAddressSpace: 0)
+!21 = !DICompositeType(tag: DW_TAG_structure_type, name: "Adder", file: !17, line: 3, size: 32, align: 32, elements: !22, identifier: "Self.Calculator.Adder")
+!22 = !{!23}
+!23 = !DIDerivedType(tag: DW_TAG_member, name: "last_result", scope: !21, file: !17, baseType: !8, size: 32, align: 32)
+!24 = !{!25, !27, !28}
+!25 = !DILocalVariable(name: "self", arg: 1, scope: !16, file: !17, line: 7, type: !26)
+!26 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !21, size: 64, dwarfAddressSpace: 0)
+!27 = !DILocalVariable(name: "lhs", arg: 2, scope: !16, file: !17, line: 7, type: !8)
+!28 = !DILocalVariable(name: "rhs", arg: 3, scope: !16, file: !17, line: 7, type: !8)
+!29 = !DILocation(line: 7, column: 5, scope: !16)
+!30 = !DILocation(line: 7, column: 12, scope: !16)
+!31 = !DILocation(line: 7, column: 22, scope: !16)
+!32 = !DILocation(line: 8, column: 23, scope: !16)
+!33 = !DILocation(line: 9, column: 9, scope: !16)
+!34 = distinct !DISubprogram(name: "add", linkageName: "add", scope: !5, file: !5, line: 3, type: !6, scopeLine: 3, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !35)
+!35 = !{!36, !37}
+!36 = !DILocalVariable(name: "first", arg: 1, scope: !34, file: !5, line: 3, type: !8)
+!37 = !DILocalVariable(name: "second", arg: 2, scope: !34, file: !5, line: 3, type: !8)
+!38 = !DILocation(line: 3, column: 8, scope: !34)
+!39 = !DILocation(line: 3, column: 15, scope: !34)
+!40 = !DILocation(line: 3, column: 27, scope: !34)
+!41 = !DILocation(line: 4, column: 12, scope: !34)
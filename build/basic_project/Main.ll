@@ -0,0 +1,174 @@
+; ModuleID = 'basic_project.Main'
+source_filename = "basic_project.Main"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+%string = type { ptr, i64 }
+%view = type { i64, ptr }
+%Self.Calculator.Adder = type { i32 }
+
+@.str = private unnamed_addr constant [8 x i8] c"testing\00"
+
+declare void @printI32(i32)
+
+; Function Attrs: nounwind
+declare i32 @Self.Calculator.Adder.add(ptr nonnull dereferenceable(4), i32, i32) #0
+
+; Function Attrs: nounwind
+declare void @Std.IO.println(%string) #0
+
+; Function Attrs: nounwind
+declare i64 @Std.IO.format_uint(i64, %view) #0
+
+; Function Attrs: nounwind
+define i32 @main() #0 !dbg !4 {
+entry:
+  %string_lit = alloca %string, align 8
+  %i = alloca i32, align 4
+  %construct = alloca %Self.Calculator.Adder, align 8
+  %adder = alloca %Self.Calculator.Adder, align 8
+  call void @llvm.dbg.declare(metadata ptr %adder, metadata !10, metadata !DIExpression()), !dbg !15
+  %last_result = getelementptr inbounds %Self.Calculator.Adder, ptr %construct, i32 0, i32 0, !dbg !15
+  store i32 0, ptr %last_result, align 4, !dbg !15
+  %load_class = load %Self.Calculator.Adder, ptr %construct, align 4, !dbg !15
+  store %Self.Calculator.Adder %load_class, ptr %adder, align 4, !dbg !15
+  %method_call = call i32 @Self.Calculator.Adder.add(ptr %adder, i32 10, i32 20), !dbg !16
+  call void @printI32(i32 %method_call), !dbg !16
+  %Self.Calculator.Adder = getelementptr inbounds %Self.Calculator.Adder, ptr %adder, i32 0, i32 0, !dbg !17
+  %member_val = load i32, ptr %Self.Calculator.Adder, align 4, !dbg !17
+  call void @printI32(i32 %member_val), !dbg !17
+  call void @llvm.dbg.declare(metadata ptr %i, metadata !14, metadata !DIExpression()), !dbg !18
+  %call = call fastcc i32 @add(i32 100, i32 200), !dbg !19
+  store i32 %call, ptr %i, align 4, !dbg !19
+  %i1 = load i32, ptr %i, align 4, !dbg !20
+  call void @printI32(i32 %i1), !dbg !20
+  %call2 = call i32 @Self.Calculator.add(i32 100, i32 200), !dbg !21
+  store i32 %call2, ptr %i, align 4, !dbg !21
+  %i3 = load i32, ptr %i, align 4, !dbg !22
+  call void @printI32(i32 %i3), !dbg !22
+  %data_field_ptr = getelementptr inbounds %string, ptr %string_lit, i32 0, i32 0, !dbg !23
+  store ptr getelementptr inbounds ([8 x i8], ptr @.str, i64 0, i64 0), ptr %data_field_ptr, align 8, !dbg !23
+  %len_field_ptr = getelementptr inbounds %string, ptr %string_lit, i32 0, i32 1, !dbg !23
+  store i64 7, ptr %len_field_ptr, align 8, !dbg !23
+  %load_string = load %string, ptr %string_lit, align 8, !dbg !23
+  call void @Std.IO.println(%string %load_string), !dbg !23
+  ret i32 0, !dbg !24
+}
+
+; Function Attrs: nounwind
+declare void @Std.IO.print(%string) #0
+
+; Function Attrs: nounwind
+declare i64 @Std.IO.max_i64_length() #0
+
+; Function Attrs: nounwind
+declare void @Std.IO.Writer.write_byte(ptr nonnull dereferenceable(32), i8) #0
+
+; Function Attrs: nounwind
+declare ptr @Std.IO.Writer.tail(ptr nonnull dereferenceable(32)) #0
+
+; Function Attrs: nounwind
+declare void @Std.IO.Writer.write_str(ptr nonnull dereferenceable(32), %string) #0
+
+; Function Attrs: nounwind
+declare void @Std.IO.Writer.write_raw(ptr nonnull dereferenceable(32), ptr, i64) #0
+
+; Function Attrs: nounwind
+declare void @Std.IO.Writer.write_u64(ptr nonnull dereferenceable(32), i64) #0
+
+; Function Attrs: nounwind
+declare void @Std.IO.Writer.reserve(ptr nonnull dereferenceable(32), i64) #0
+
+; Function Attrs: nounwind
+declare void @Std.IO.Writer.write_f64(ptr nonnull dereferenceable(32), double) #0
+
+; Function Attrs: nounwind
+declare void @Std.IO.Writer.write_i64(ptr nonnull dereferenceable(32), i64) #0
+
+; Function Attrs: nounwind
+declare void @Std.IO.Writer.write(ptr nonnull dereferenceable(32), %view) #0
+
+; Function Attrs: nounwind
+declare void @Std.IO.Writer.flush(ptr nonnull dereferenceable(32)) #0
+
+; Function Attrs: nounwind
+declare void @"Std.IO.Writer.@destruct"(ptr nonnull dereferenceable(32)) #0
+
+; Function Attrs: nounwind
+declare void @Std.IO.flush_stdout() #0
+
+; Function Attrs: nounwind
+declare i64 @Std.IO.format_float(double, %view) #0
+
+; Function Attrs: nounwind readnone willreturn
+define internal fastcc i32 @add(i32 %0, i32 %1) #1 !dbg !25 {
+entry:
+  %a.addr = alloca i32, align 4, !dbg !31
+  store i32 %0, ptr %a.addr, align 4, !dbg !31
+  call void @llvm.dbg.declare(metadata ptr %a.addr, metadata !29, metadata !DIExpression()), !dbg !32
+  %b.addr = alloca i32, align 4, !dbg !31
+  store i32 %1, ptr %b.addr, align 4, !dbg !31
+  call void @llvm.dbg.declare(metadata ptr %b.addr, metadata !30, metadata !DIExpression()), !dbg !33
+  %a = load i32, ptr %a.addr, align 4, !dbg !34
+  %b = load i32, ptr %b.addr, align 4, !dbg !34
+  %mul = mul nsw i32 %a, %b, !dbg !34
+  ret i32 %mul, !dbg !34
+}
+
+; Function Attrs: nounwind
+declare i32 @Self.Calculator.add(i32, i32) #0
+
+; Function Attrs: nounwind
+declare i64 @Std.IO.max_u64_length() #0
+
+; Function Attrs: nounwind
+declare i64 @Std.IO.format_int(i64, %view) #0
+
+; Function Attrs: nounwind
+declare i64 @Std.IO.max_f64_length() #0
+
+; Function Attrs: nofree nosync nounwind readnone speculatable willreturn
+declare void @llvm.dbg.declare(metadata, metadata, metadata) #2
+
+attributes #0 = { nounwind }
+attributes #1 = { nounwind readnone willreturn }
+attributes #2 = { nofree nosync nounwind readnone speculatable willreturn }
+
+!llvm.dbg.cu = !{!0}
+!llvm.module.flags = !{!2, !3}
+
+!0 = distinct !DICompileUnit(language: DW_LANG_C, file: !1, producer: "ShiroC Compiler\00", isOptimized: false, runtimeVersion: 0, emissionKind: FullDebug, splitDebugInlining: false)
+!1 = !DIFile(filename: "Main", directory: ".")
+!2 = !{i32 2, !"Dwarf Version", i32 4}
+!3 = !{i32 2, !"Debug Info Version", i32 3}
+!4 = distinct !DISubprogram(name: "main", linkageName: "main", scope: !5, file: !5, line: 12, type: !6, scopeLine: 12, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !9)
+!5 = !DIFile(filename: "main.shiro", directory: "src/tests/st/basic_project/main")
+!6 = !DISubroutineType(types: !7)
+!7 = !{!8}
+!8 = !DIBasicType(name: "i32", size: 32, encoding: DW_ATE_signed)
+!9 = !{!10, !14}
+!10 = !DILocalVariable(name: "adder", scope: !4, file: !5, line: 14, type: !11)
+!11 = !DICompositeType(tag: DW_TAG_structure_type, name: "Adder", file: !5, line: 3, size: 32, align: 32, elements: !12, identifier: "Self.Calculator.Adder")
+!12 = !{!13}
+!13 = !DIDerivedType(tag: DW_TAG_member, name: "last_result", scope: !11, file: !5, baseType: !8, size: 32, align: 32)
+!14 = !DILocalVariable(name: "i", scope: !4, file: !5, line: 18, type: !8)
+!15 = !DILocation(line: 14, column: 5, scope: !4)
+!16 = !DILocation(line: 0, scope: !4)
+!17 = !DILocation(line: 16, column: 5, scope: !4)
+!18 = !DILocation(line: 18, column: 5, scope: !4)
+!19 = !DILocation(line: 18, column: 13, scope: !4)
+!20 = !DILocation(line: 19, column: 5, scope: !4)
+!21 = !DILocation(line: 22, column: 9, scope: !4)
+!22 = !DILocation(line: 23, column: 5, scope: !4)
+!23 = !DILocation(line: 25, column: 5, scope: !4)
+!24 = !DILocation(line: 27, column: 5, scope: !4)
+!25 = distinct !DISubprogram(name: "add", linkageName: "add", scope: !5, file: !5, line: 7, type: !26, scopeLine: 7, spFlags: DISPFlagDefinition, unit: !0, retainedNodes: !28)
+!26 = !DISubroutineType(types: !27)
+!27 = !{!8, !8, !8}
+!28 = !{!29, !30}
+!29 = !DILocalVariable(name: "a", arg: 1, scope: !25, file: !5, line: 7, type: !8)
+!30 = !DILocalVariable(name: "b", arg: 2, scope: !25, file: !5, line: 7, type: !8)
+!31 = !DILocation(line: 7, column: 1, scope: !25)
+!32 = !DILocation(line: 7, column: 8, scope: !25)
+!33 = !DILocation(line: 7, column: 16, scope: !25)
+!34 = !DILocation(line: 9, column: 12, scope: !25)
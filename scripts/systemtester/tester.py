@@ -7,6 +7,7 @@ Reads test instructions from comments in the format: //! <instruction>
 import argparse
 import os
 import re
+import shutil
 import subprocess
 import sys
 import tempfile
@@ -54,6 +55,12 @@ class RunInstruction(TestInstruction):
         return context.run(custom_path)
 
 
+class JitInstruction(TestInstruction):
+    """Run the file or project in memory with `shiro run`"""
+    def execute(self, context: 'TestContext') -> bool:
+        return context.run_jit()
+
+
 class OptionsInstruction(TestInstruction):
     """Set compiler options"""
     def execute(self, context: 'TestContext') -> bool:
@@ -61,6 +68,12 @@ class OptionsInstruction(TestInstruction):
         return True
 
 
+class ProfileInstruction(TestInstruction):
+    """Build instrumented, run once and compile the test with the collected profile"""
+    def execute(self, context: 'TestContext') -> bool:
+        return context.collect_profile()
+
+
 class ErrorInstruction(TestInstruction):
     """Expect a compiler error matching the regex at the instruction's line"""
     def execute(self, context: 'TestContext') -> bool:
@@ -136,18 +149,43 @@ class StdoutInstruction(TestInstruction):
         return True
 
 
+class IrInstruction(TestInstruction):
+    """Expect the LLVM IR of the file, as handed to clang, to match the regex; `N "regex"` expects exactly N matches"""
+    def execute(self, context: 'TestContext') -> bool:
+        match = re.match(r'^(\d+)\s+(.*)$', self.args.strip())
+        expected_count = int(match.group(1)) if match else None
+        pattern = (match.group(2) if match else self.args).strip().strip('"').strip("'")
+
+        if context.ir_text is None and not context.emit_ir():
+            return False
+
+        count = len(re.findall(pattern, context.ir_text, re.MULTILINE))
+        if expected_count is None and count == 0:
+            context.error_message = f"Expected IR pattern '{pattern}' at line {self.line_number} not found"
+            return False
+        if expected_count is not None and count != expected_count:
+            context.error_message = (
+                f"Expected IR pattern '{pattern}' at line {self.line_number} {expected_count} times, found {count}"
+            )
+            return False
+        return True
+
+
 # Instruction registry
 INSTRUCTION_REGISTRY = {
     'compile': CompileInstruction,
     'run': RunInstruction,
+    'jit': JitInstruction,
     'options': OptionsInstruction,
+    'profile': ProfileInstruction,
     'error': ErrorInstruction,
     'warning': WarningInstruction,
     'stdout': StdoutInstruction,
+    'ir': IrInstruction,
 }
 
 # Instructions that require arguments
-REQUIRED_ARGS_INSTRUCTIONS = {'options', 'error', 'warning', 'stdout'}
+REQUIRED_ARGS_INSTRUCTIONS = {'options', 'error', 'warning', 'stdout', 'ir'}
 
 
 class TestContext:
@@ -165,6 +203,7 @@ class TestContext:
         self.executable = None  # Temp file path when no custom path is specified
         self.custom_executable_path = None  # User-specified executable path from !run
         self.has_error_instruction = False
+        self.profile_dir = None  # Temp directory holding the raw and merged profiles from !profile
 
         # Track errors and warnings by line number
         self.errors_by_line: Dict[int, List[Tuple[int, str]]] = {}
@@ -178,6 +217,9 @@ class TestContext:
         self.stdout_lines: List[str] = []
         self.stdout_cursor: int = 0
 
+        # LLVM IR from --emit-llvm, written on the first !ir
+        self.ir_text: Optional[str] = None
+
     def parse_compiler_messages(self):
         """Parse compiler output for errors and warnings"""
         # Remove color from compiler output
@@ -285,6 +327,44 @@ class TestContext:
             self.error_message = f"Compilation error: {e}"
             return False
 
+    def run_jit(self) -> bool:
+        """Compile and run in one step with the JIT. Returns True if both succeeded as expected."""
+        cmd = [COMPILER, "run", str(self.test_target)]
+        if self.compiler_options:
+            cmd.extend(self.compiler_options.split())
+        if USE_VALGRIND:
+            cmd = VALGRIND_CMD + cmd
+
+        try:
+            result = subprocess.run(
+                cmd,
+                capture_output=True,
+                text=True,
+                timeout=COMPILE_TIMEOUT + RUN_TIMEOUT
+            )
+            # Compiler messages go to stderr; stdout belongs to the program
+            self.compile_output = result.stderr + "\n"
+            self.compile_returncode = result.returncode
+            self.run_output = result.stdout
+            self.run_returncode = result.returncode
+            self.stdout_lines = self.run_output.splitlines()
+            self.parse_compiler_messages()
+
+            if self.has_error_instruction:
+                return True
+
+            if result.returncode != 0:
+                self.error_message = f"shiro run exited with non-zero code: {result.returncode}"
+                return False
+
+            return True
+        except subprocess.TimeoutExpired:
+            self.error_message = "shiro run timed out"
+            return False
+        except Exception as e:
+            self.error_message = f"shiro run error: {e}"
+            return False
+
     def check_uncovered_messages(self) -> bool:
         """Check if there are any uncovered errors or warnings"""
         uncovered_errors = [
@@ -321,7 +401,68 @@ class TestContext:
 
         return True
 
-    def run(self, custom_path: Optional[str] = None) -> bool:
+    def collect_profile(self) -> bool:
+        """Compile with --profile-generate, run once and merge the profile into --profile-use for later steps"""
+        self.profile_dir = tempfile.mkdtemp()
+        base_options = self.compiler_options
+        self.compiler_options = f"{base_options} --profile-generate"
+        if not self.compile():
+            return False
+        env = dict(os.environ, LLVM_PROFILE_FILE=os.path.join(self.profile_dir, "%p.profraw"))
+        if not self.run(env=env):
+            return False
+        self.stdout_lines = []
+
+        raw_profiles = [str(p) for p in Path(self.profile_dir).glob("*.profraw")]
+        if not raw_profiles:
+            self.error_message = "Instrumented program did not write a profile"
+            return False
+        merged = os.path.join(self.profile_dir, "merged.profdata")
+        try:
+            result = subprocess.run(
+                ["llvm-profdata", "merge", "-o", merged] + raw_profiles,
+                capture_output=True,
+                text=True,
+                timeout=COMPILE_TIMEOUT
+            )
+        except Exception as e:
+            self.error_message = f"Profile merge error: {e}"
+            return False
+        if result.returncode != 0:
+            self.error_message = f"Profile merge failed:\n{result.stderr}"
+            return False
+
+        self.compiler_options = f"{base_options} --profile-use={merged}"
+        return True
+
+    def emit_ir(self) -> bool:
+        """Write the LLVM IR of the file with the test's options into ir_text. Returns True on success."""
+        if self.is_directory:
+            self.error_message = "IR can only be checked for single files"
+            return False
+
+        with tempfile.NamedTemporaryFile(suffix='.ll', delete=False) as tmp:
+            ir_path = tmp.name
+        cmd = [COMPILER, str(self.test_target), "--emit-llvm", "-o", ir_path]
+        if self.compiler_options:
+            cmd.extend(self.compiler_options.split())
+
+        try:
+            result = subprocess.run(cmd, capture_output=True, text=True, timeout=COMPILE_TIMEOUT)
+            if result.returncode != 0:
+                self.error_message = f"Emitting IR failed:\n{result.stdout}{result.stderr}"
+                return False
+            with open(ir_path, 'r', encoding='utf-8') as f:
+                self.ir_text = f.read()
+            return True
+        except Exception as e:
+            self.error_message = f"Emitting IR error: {e}"
+            return False
+        finally:
+            if os.path.exists(ir_path):
+                os.remove(ir_path)
+
+    def run(self, custom_path: Optional[str] = None, env: Optional[Dict[str, str]] = None) -> bool:
         """Run the compiled executable. Returns True if run succeeded as expected."""
         # Determine which executable to run
         executable_path = custom_path if custom_path else self.executable
@@ -339,7 +480,8 @@ class TestContext:
                 cmd,
                 capture_output=True,
                 text=True,
-                timeout=RUN_TIMEOUT
+                timeout=RUN_TIMEOUT,
+                env=env
             )
             self.run_output = result.stdout
             self.run_returncode = result.returncode
@@ -374,6 +516,8 @@ class TestContext:
                 os.remove(self.executable)
             except:
                 pass
+        if self.profile_dir:
+            shutil.rmtree(self.profile_dir, ignore_errors=True)
 
 
 def parse_instructions_from_file(filepath: Path) -> List[Tuple[str, str, int]]:
@@ -447,10 +591,13 @@ def run_test(test_target: Path) -> bool:
     instruction_objects = {
         'compile': [],
         'run': [],
+        'jit': [],
         'options': [],
+        'profile': [],
         'error': [],
         'warning': [],
         'stdout': [],
+        'ir': [],
     }
 
     for inst_name, args, line_num in instructions:
@@ -463,7 +610,7 @@ def run_test(test_target: Path) -> bool:
         instruction_objects[inst_name].append(inst_obj)
 
     # Validate single-instance instructions
-    for inst_type in ['compile', 'run', 'options']:
+    for inst_type in ['compile', 'run', 'jit', 'options', 'profile']:
         if len(instruction_objects[inst_type]) > 1:
             print(f"  ERROR: {display_name} - Multiple '{inst_type}' instructions not allowed")
             return False
@@ -480,6 +627,15 @@ def run_test(test_target: Path) -> bool:
                 print(f"    {context.error_message}")
                 return False
 
+        # Collect a profile before the final compile (if requested)
+        if instruction_objects['profile']:
+            if not instruction_objects['profile'][0].execute(context):
+                print(f"  FAIL: {display_name}")
+                print(f"    {context.error_message}")
+                print(f"    Compile output:\n{context.compile_output}")
+                print(f"    Run output:\n{context.run_output}")
+                return False
+
         # Execute compile or run (run implies compile)
         if instruction_objects['run']:
             if not instruction_objects['run'][0].execute(context):
@@ -488,6 +644,13 @@ def run_test(test_target: Path) -> bool:
                 print(f"    Compile output:\n{context.compile_output}")
                 print(f"    Run output:\n{context.run_output}")
                 return False
+        elif instruction_objects['jit']:
+            if not instruction_objects['jit'][0].execute(context):
+                print(f"  FAIL: {display_name}")
+                print(f"    {context.error_message}")
+                print(f"    Compile output:\n{context.compile_output}")
+                print(f"    Run output:\n{context.run_output}")
+                return False
         elif instruction_objects['compile']:
             if not instruction_objects['compile'][0].execute(context):
                 print(f"  FAIL: {display_name}")
@@ -533,6 +696,13 @@ def run_test(test_target: Path) -> bool:
             print(f"    Program output:\n{context.run_output}")
             return False
 
+        # Validate IR expectations
+        for ir_inst in instruction_objects['ir']:
+            if not ir_inst.execute(context):
+                print(f"  FAIL: {display_name}")
+                print(f"    {context.error_message}")
+                return False
+
         print(f"  PASS: {display_name}")
         return True
 
@@ -41,6 +41,7 @@ ast_var_decl_t* ast_var_decl_create_mandatory(const char* name)
         .name = strdup(name),
     };
     AST_NODE(var_decl)->vtable = &ast_var_decl_vtable;
+    AST_NODE(var_decl)->kind = AST_DECL_VAR;
     return var_decl;
 }
 
@@ -40,6 +40,16 @@ ast_def_t* ast_fn_def_create(const char* name, vec_t* params, ast_type_t* ret_ty
     return (ast_def_t*)fn_def;
 }
 
+void ast_fn_def_copy_attributes(ast_fn_def_t* dest, const ast_fn_def_t* source)
+{
+    dest->unchecked = source->unchecked;
+    dest->always_inline = source->always_inline;
+    dest->no_inline = source->no_inline;
+    dest->hot = source->hot;
+    dest->cold = source->cold;
+    dest->flatten = source->flatten;
+}
+
 ast_def_t* ast_fn_def_create_va(const char* name, ast_type_t* ret_type, ast_stmt_t* body, ...)
 {
     vec_t params = VEC_INIT(ast_node_destroy);
@@ -19,10 +19,19 @@ typedef struct ast_fn_def
     symbol_t* symbol;      // only valid after decl_collector & while semantic_context is valid (we do not own memory)
     char* extern_abi;      // if not nullptr, function is external
     bool exported;
+    bool unchecked;        // @unchecked: no runtime bounds checks are emitted inside the body
+    bool always_inline;    // @inline
+    bool no_inline;        // @noinline
+    bool hot;              // @hot
+    bool cold;             // @cold
+    bool flatten;          // @flatten: every call made directly from the body is inlined
 } ast_fn_def_t;
 
 ast_def_t* ast_fn_def_create(const char* name, vec_t* params, ast_type_t* ret_type, ast_stmt_t* body, bool exported);
 
+// Copy the @ attributes (unchecked, inline, noinline, hot, cold, flatten) of source to dest
+void ast_fn_def_copy_attributes(ast_fn_def_t* dest, const ast_fn_def_t* source);
+
 __attribute__((sentinel))
 ast_def_t* ast_fn_def_create_va(const char* name, ast_type_t* ret_type, ast_stmt_t* body, ...);
 
@@ -29,6 +29,7 @@ ast_def_t* ast_method_def_create_from(ast_fn_def_t* fn_def)
     fn_def->body = nullptr;
 
     ast_def_t* method_def = ast_method_def_create(fn_def->base.name, &fn_def->params, ret_type, body);
+    ast_fn_def_copy_attributes(&((ast_method_def_t*)method_def)->base, fn_def);
     ast_node_destroy(fn_def);
     return method_def;
 }
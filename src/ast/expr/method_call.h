@@ -6,6 +6,17 @@
 
 typedef struct symbol symbol_t;
 
+// Ordering of the atomic builtin methods of integer pointers, given as a string literal ending their arguments
+typedef enum memory_order
+{
+    MEMORY_ORDER_NONE,  // not an atomic method
+    MEMORY_ORDER_RELAXED,
+    MEMORY_ORDER_ACQUIRE,
+    MEMORY_ORDER_RELEASE,
+    MEMORY_ORDER_ACQ_REL,
+    MEMORY_ORDER_SEQ_CST,
+} memory_order_t;
+
 typedef struct ast_method_call
 {
     ast_expr_t base;
@@ -15,6 +26,7 @@ typedef struct ast_method_call
     vec_t arguments;          // ast_expr_t*
     size_t overload_index;    // set by SEMA during overload resolution
     bool is_builtin_method;
+    memory_order_t memory_order;  // set by SEMA for atomic methods
 } ast_method_call_t;
 
 ast_expr_t* ast_method_call_create(ast_expr_t* instance, const char* method_name, vec_t* arguments);
@@ -5,11 +5,14 @@
 #include "common/containers/vec.h"
 #include "parser/lexer.h"
 
+typedef struct symbol symbol_t;
+
 typedef struct ast_unary_op
 {
     ast_expr_t base;
     token_type_t op;
     ast_expr_t* expr;
+    symbol_t* function_symbol;  // set by SEMA when taking the address of a function, valid while semantic_context is valid
 } ast_unary_op_t;
 
 ast_expr_t* ast_unary_op_create(token_type_t op, ast_expr_t* expr);
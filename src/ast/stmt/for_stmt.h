@@ -2,6 +2,7 @@
 #define AST_STMT_FOR__H
 
 #include "ast/expr/expr.h"
+#include "ast/stmt/loop_hints.h"
 #include "ast/stmt/stmt.h"
 
 typedef struct ast_for_stmt
@@ -14,6 +15,7 @@ typedef struct ast_for_stmt
     ast_stmt_t* post_stmt;  // nullable
     ast_stmt_t* body;       // correct syntax requires this to be ast_compound_stmt, but AST can be
                             // constructed (with errors) with any statement, so don't assume type
+    ast_loop_hints_t hints;
 } ast_for_stmt_t;
 
 ast_stmt_t* ast_for_stmt_create(ast_stmt_t* init_stmt, ast_expr_t* cond_expr, ast_stmt_t* post_stmt,
@@ -0,0 +1,29 @@
+#ifndef AST_STMT_LOOP_HINTS__H
+#define AST_STMT_LOOP_HINTS__H
+
+#include <stdint.h>
+
+typedef enum ast_loop_unroll
+{
+    AST_LOOP_UNROLL_DEFAULT,    // left to the optimizer
+    AST_LOOP_UNROLL_COUNT,      // @unroll(N); N == 1 disables unrolling
+    AST_LOOP_UNROLL_FULL,       // @unroll(full)
+} ast_loop_unroll_t;
+
+typedef enum ast_loop_vectorize
+{
+    AST_LOOP_VECTORIZE_DEFAULT,  // left to the optimizer
+    AST_LOOP_VECTORIZE_ENABLE,   // @vectorize or @vectorize(width=N)
+    AST_LOOP_VECTORIZE_DISABLE,  // @novectorize
+} ast_loop_vectorize_t;
+
+// Optimizer hints given by attributes in front of a loop, e.g. `@unroll(4) for (...) { ... }`
+typedef struct ast_loop_hints
+{
+    ast_loop_unroll_t unroll;
+    uint32_t unroll_count;          // valid for AST_LOOP_UNROLL_COUNT
+    ast_loop_vectorize_t vectorize;
+    uint32_t vectorize_width;       // 0 if not given
+} ast_loop_hints_t;
+
+#endif
@@ -8,6 +8,7 @@ typedef struct ast_return_stmt
 {
     ast_stmt_t base;
     ast_expr_t* value_expr;  // can be nullptr
+    bool tail_call;          // `return @tail f(...)`: the returned call must be a guaranteed tail call
 } ast_return_stmt_t;
 
 ast_stmt_t* ast_return_stmt_create(ast_expr_t* value_expr);
@@ -249,7 +249,7 @@ ast_type_t* ast_type_variable(const char* name)
         .data.type_variable.name = strdup(name),
     };
     set_default_traits(type_var);
-    hash_table_insert(type_variable_cache, name, type_var);
+    hash_table_insert(type_variable_cache, type_var->data.type_variable.name, type_var);  // name may not outlive it
     return type_var;
 }
 
@@ -453,6 +453,7 @@ size_t ast_type_sizeof(ast_type_t* type)
         case AST_TYPE_POINTER:
             return sizeof(void*);
         case AST_TYPE_HEAP_ARRAY:
+            return 3 * sizeof(void*);
         case AST_TYPE_CLASS:
         case AST_TYPE_INVALID:
         case AST_TYPE_VARIABLE:
@@ -466,8 +467,8 @@ size_t ast_type_sizeof(ast_type_t* type)
 bool ast_type_has_equality(ast_type_t* type)
 {
     if (type->kind == AST_TYPE_BUILTIN)
-        return type->data.builtin.type != TYPE_VOID && type->data.builtin.type != TYPE_STRING;
-    else if (type->kind == AST_TYPE_POINTER)
+        return type->data.builtin.type != TYPE_VOID;
+    else if (type->kind == AST_TYPE_POINTER || type->kind == AST_TYPE_VARIABLE)
         return true;
     return false;
 }
@@ -689,6 +690,13 @@ static void set_default_traits(ast_type_t* type)
     else if (type->kind == AST_TYPE_ARRAY || type->kind == AST_TYPE_HEAP_ARRAY || type->kind == AST_TYPE_VIEW)
     {
         type->traits[TRAIT_SUBSCRIPTABLE] = true;
+
+        // Heap arrays own their storage: it is freed when the array is destroyed, so they can only be moved
+        if (type->kind == AST_TYPE_HEAP_ARRAY)
+        {
+            type->traits[TRAIT_EXPLICIT_DESTRUCTOR] = true;
+            type->traits[TRAIT_COPYABLE] = false;
+        }
     }
     else if (type->kind == AST_TYPE_VARIABLE)
     {
@@ -9,6 +9,7 @@
 #include "ast/expr/bin_op.h"
 #include "ast/expr/bool_lit.h"
 #include "ast/expr/call_expr.h"
+#include "ast/expr/cast_expr.h"
 #include "ast/expr/coercion_expr.h"
 #include "ast/expr/construct_expr.h"
 #include "ast/expr/float_lit.h"
@@ -50,6 +51,26 @@ typedef struct cloner_visitor
     ast_expr_t* result;
 } cloner_visitor_t;
 
+// Clones keep the source location of the original, so errors and debug info of instantiated templates point into the
+// template
+static void clone_source_location(void* dst, void* src)
+{
+    ast_node_t* to = dst;
+    ast_node_t* from = src;
+    if (from->source_begin.filename != nullptr)
+    {
+        source_location_deinit(&to->source_begin);
+        set_source_location(&to->source_begin, from->source_begin.filename, from->source_begin.line,
+            from->source_begin.column);
+    }
+    if (from->source_end.filename != nullptr)
+    {
+        source_location_deinit(&to->source_end);
+        set_source_location(&to->source_end, from->source_end.filename, from->source_end.line,
+            from->source_end.column);
+    }
+}
+
 static void clone_int_lit(void* self_, ast_int_lit_t* lit, void* out_)
 {
     (void)out_;
@@ -224,6 +245,14 @@ static void clone_construct_expr(void* self_, ast_construct_expr_t* construct, v
     cloner->result = ast_construct_expr_create(construct->class_type, &member_inits);
 }
 
+static void clone_cast_expr(void* self_, ast_cast_expr_t* cast, void* out_)
+{
+    (void)out_;
+    cloner_visitor_t* cloner = self_;
+    ast_expr_t* expr = ast_expr_clone(cast->expr);
+    cloner->result = ast_cast_expr_create(expr, cast->target);
+}
+
 static void clone_coercion_expr(void* self_, ast_coercion_expr_t* coercion, void* out_)
 {
     (void)out_;
@@ -260,20 +289,19 @@ ast_expr_t* ast_expr_clone(ast_expr_t* expr)
     cloner.base.visit_call_expr = clone_call_expr;
     cloner.base.visit_method_call = clone_method_call;
     cloner.base.visit_construct_expr = clone_construct_expr;
+    cloner.base.visit_cast_expr = clone_cast_expr;
     cloner.base.visit_coercion_expr = clone_coercion_expr;
 
     ast_visitor_visit(&cloner.base, AST_NODE(expr), nullptr);
 
     panic_if(cloner.result == nullptr);
     cloner.result->type = expr->type;
+    clone_source_location(cloner.result, expr);
     return cloner.result;
 }
 
-ast_stmt_t* ast_stmt_clone(ast_stmt_t* stmt)
+static ast_stmt_t* clone_stmt(ast_stmt_t* stmt)
 {
-    if (stmt == nullptr)
-        return nullptr;
-
     switch (AST_KIND(stmt))
     {
         case AST_STMT_COMPOUND:
@@ -301,7 +329,9 @@ ast_stmt_t* ast_stmt_clone(ast_stmt_t* stmt)
         {
             ast_return_stmt_t* ret = (ast_return_stmt_t*)stmt;
             ast_expr_t* cloned_expr = ret->value_expr != nullptr ? ast_expr_clone(ret->value_expr) : nullptr;
-            return ast_return_stmt_create(cloned_expr);
+            ast_return_stmt_t* cloned = (ast_return_stmt_t*)ast_return_stmt_create(cloned_expr);
+            cloned->tail_call = ret->tail_call;
+            return (ast_stmt_t*)cloned;
         }
         case AST_STMT_IF:
         {
@@ -314,7 +344,10 @@ ast_stmt_t* ast_stmt_clone(ast_stmt_t* stmt)
         case AST_STMT_WHILE:
         {
             ast_while_stmt_t* while_stmt = (ast_while_stmt_t*)stmt;
-            return ast_while_stmt_create(ast_expr_clone(while_stmt->condition), ast_stmt_clone(while_stmt->body));
+            ast_stmt_t* cloned = ast_while_stmt_create(ast_expr_clone(while_stmt->condition),
+                ast_stmt_clone(while_stmt->body));
+            ((ast_while_stmt_t*)cloned)->hints = while_stmt->hints;
+            return cloned;
         }
         case AST_STMT_FOR:
         {
@@ -322,7 +355,10 @@ ast_stmt_t* ast_stmt_clone(ast_stmt_t* stmt)
             ast_stmt_t* cloned_init = for_stmt->init_stmt != nullptr ? ast_stmt_clone(for_stmt->init_stmt) : nullptr;
             ast_expr_t* cloned_cond = for_stmt->cond_expr != nullptr ? ast_expr_clone(for_stmt->cond_expr) : nullptr;
             ast_stmt_t* cloned_post = for_stmt->post_stmt != nullptr ? ast_stmt_clone(for_stmt->post_stmt) : nullptr;
-            return ast_for_stmt_create(cloned_init, cloned_cond, cloned_post, ast_stmt_clone(for_stmt->body));
+            ast_stmt_t* cloned = ast_for_stmt_create(cloned_init, cloned_cond, cloned_post,
+                ast_stmt_clone(for_stmt->body));
+            ((ast_for_stmt_t*)cloned)->hints = for_stmt->hints;
+            return cloned;
         }
         case AST_STMT_BREAK:
             return ast_break_stmt_create();
@@ -338,11 +374,8 @@ ast_stmt_t* ast_stmt_clone(ast_stmt_t* stmt)
     }
 }
 
-ast_decl_t* ast_decl_clone(ast_decl_t* decl)
+static ast_decl_t* clone_decl(ast_decl_t* decl)
 {
-    if (decl == nullptr)
-        return nullptr;
-
     switch (AST_KIND(decl))
     {
         case AST_DECL_VAR:
@@ -372,6 +405,26 @@ ast_decl_t* ast_decl_clone(ast_decl_t* decl)
     }
 }
 
+ast_stmt_t* ast_stmt_clone(ast_stmt_t* stmt)
+{
+    if (stmt == nullptr)
+        return nullptr;
+
+    ast_stmt_t* cloned = clone_stmt(stmt);
+    clone_source_location(cloned, stmt);
+    return cloned;
+}
+
+ast_decl_t* ast_decl_clone(ast_decl_t* decl)
+{
+    if (decl == nullptr)
+        return nullptr;
+
+    ast_decl_t* cloned = clone_decl(decl);
+    clone_source_location(cloned, decl);
+    return cloned;
+}
+
 ast_fn_def_t* ast_fn_def_clone(ast_fn_def_t* fn)
 {
     if (fn == nullptr)
@@ -398,8 +451,10 @@ ast_fn_def_t* ast_fn_def_clone(ast_fn_def_t* fn)
 
     cloned->type_params = cloned_type_params;
     cloned->overload_index = fn->overload_index;
+    ast_fn_def_copy_attributes(cloned, fn);
     if (fn->extern_abi != nullptr)
         cloned->extern_abi = strdup(fn->extern_abi);
+    clone_source_location(cloned, fn);
 
     return cloned;
 }
@@ -439,6 +494,9 @@ ast_class_def_t* ast_class_def_clone(ast_class_def_t* class_def)
 
         ast_method_def_t* cloned_method = (ast_method_def_t*)ast_method_def_create(method->base.base.name,
             &cloned_method_params, method->base.return_type, cloned_method_body);
+        ast_fn_def_copy_attributes(&cloned_method->base, &method->base);
+        cloned_method->is_trait_impl = method->is_trait_impl;
+        clone_source_location(cloned_method, method);
 
         vec_push(&cloned_methods, cloned_method);
     }
@@ -447,6 +505,7 @@ ast_class_def_t* ast_class_def_clone(ast_class_def_t* class_def)
         &cloned_methods, class_def->exported);
 
     cloned->type_params = cloned_type_params;
+    clone_source_location(cloned, class_def);
 
     return cloned;
 }
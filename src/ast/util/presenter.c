@@ -388,8 +388,9 @@ static void present_return_stmt(void* self_, ast_return_stmt_t* return_stmt, voi
 {
     PRELUDE
 
-    string_append_cstr(out, "return ");
-    ast_visitor_visit(self, return_stmt->value_expr, out);
+    string_append_cstr(out, return_stmt->tail_call ? "return @tail " : "return ");
+    if (return_stmt->value_expr != nullptr)
+        ast_visitor_visit(self, return_stmt->value_expr, out);
 }
 
 static void present_while_stmt(void* self_, ast_while_stmt_t* while_stmt, void* out_)
@@ -122,6 +122,22 @@ static void print_class_def(void* self_, ast_class_def_t* class_def, void* out_)
     self->indentation -= PRINT_INDENTATION_WIDTH;
 }
 
+static void print_fn_attributes(ast_fn_def_t* fn_def, string_t* out)
+{
+    if (fn_def->unchecked)
+        string_append_cstr(out, " unchecked");
+    if (fn_def->always_inline)
+        string_append_cstr(out, " inline");
+    if (fn_def->no_inline)
+        string_append_cstr(out, " noinline");
+    if (fn_def->hot)
+        string_append_cstr(out, " hot");
+    if (fn_def->cold)
+        string_append_cstr(out, " cold");
+    if (fn_def->flatten)
+        string_append_cstr(out, " flatten");
+}
+
 static void print_fn_def(void* self_, ast_fn_def_t* fn_def, void* out_)
 {
     string_t* out = out_;
@@ -132,6 +148,7 @@ static void print_fn_def(void* self_, ast_fn_def_t* fn_def, void* out_)
         string_append_cstr(out, ssprintf(" %s", ast_type_string(fn_def->return_type)));
     if (fn_def->exported)
         string_append_cstr(out, " exported");
+    print_fn_attributes(fn_def, out);
     print_source_location(self, fn_def, out);
     string_append_cstr(out, "\n");
 
@@ -151,6 +168,7 @@ static void print_method_def(void* self_, ast_method_def_t* method_def, void* ou
     string_append_cstr(out, ssprintf("%*sMethodDef '%s'", self->indentation, "", method_def->base.base.name));
     if (method_def->base.return_type != nullptr)
         string_append_cstr(out, ssprintf(" %s", ast_type_string(method_def->base.return_type)));
+    print_fn_attributes(&method_def->base, out);
     print_source_location(self, method_def, out);
     string_append_cstr(out, "\n");
 
@@ -504,12 +522,28 @@ static void print_expr_stmt(void* self_, ast_expr_stmt_t* expr_stmt, void* out_)
     self->indentation -= PRINT_INDENTATION_WIDTH;
 }
 
+static void print_loop_hints(ast_loop_hints_t* hints, string_t* out)
+{
+    if (hints->unroll == AST_LOOP_UNROLL_COUNT)
+        string_append_cstr(out, ssprintf(" unroll(%u)", hints->unroll_count));
+    else if (hints->unroll == AST_LOOP_UNROLL_FULL)
+        string_append_cstr(out, " unroll(full)");
+
+    if (hints->vectorize == AST_LOOP_VECTORIZE_ENABLE && hints->vectorize_width != 0)
+        string_append_cstr(out, ssprintf(" vectorize(width=%u)", hints->vectorize_width));
+    else if (hints->vectorize == AST_LOOP_VECTORIZE_ENABLE)
+        string_append_cstr(out, " vectorize");
+    else if (hints->vectorize == AST_LOOP_VECTORIZE_DISABLE)
+        string_append_cstr(out, " novectorize");
+}
+
 static void print_for_stmt(void* self_, ast_for_stmt_t* for_stmt, void* out_)
 {
     string_t* out = out_;
     ast_printer_t* self = self_;
 
     string_append_cstr(out, ssprintf("%*sForStmt", self->indentation, ""));
+    print_loop_hints(&for_stmt->hints, out);
     print_source_location(self, for_stmt, out);
     string_append_cstr(out, "\n");
 
@@ -564,11 +598,14 @@ static void print_return_stmt(void* self_, ast_return_stmt_t* return_stmt, void*
     ast_printer_t* self = self_;
 
     string_append_cstr(out, ssprintf("%*sReturnStmt", self->indentation, ""));
+    if (return_stmt->tail_call)
+        string_append_cstr(out, " tail");
     print_source_location(self, return_stmt, out);
     string_append_cstr(out, "\n");
 
     self->indentation += PRINT_INDENTATION_WIDTH;
-    ast_visitor_visit(self, return_stmt->value_expr, out);
+    if (return_stmt->value_expr != nullptr)
+        ast_visitor_visit(self, return_stmt->value_expr, out);
     self->indentation -= PRINT_INDENTATION_WIDTH;
 }
 
@@ -578,6 +615,7 @@ static void print_while_stmt(void* self_, ast_while_stmt_t* while_stmt, void* ou
     ast_printer_t* self = self_;
 
     string_append_cstr(out, ssprintf("%*sWhileStmt", self->indentation, ""));
+    print_loop_hints(&while_stmt->hints, out);
     print_source_location(self, while_stmt, out);
     string_append_cstr(out, "\n");
 
@@ -240,7 +240,8 @@ static void ast_visitor_visit_inc_dec_stmt(void* self_, ast_inc_dec_stmt_t* inc_
 
 static void ast_visitor_visit_return_stmt(void* self_, ast_return_stmt_t* return_stmt, void* out_)
 {
-    ast_visitor_visit(self_, return_stmt->value_expr, out_);
+    if (return_stmt->value_expr != nullptr)
+        ast_visitor_visit(self_, return_stmt->value_expr, out_);
 }
 
 static void ast_visitor_visit_while_stmt(void* self_, ast_while_stmt_t* while_stmt, void* out_)
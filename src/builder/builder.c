@@ -1,6 +1,7 @@
 #include "builder.h"
 
 #include "builder/module.h"
+#include "codegen/llvm/llvm_jit.h"
 #include "common/containers/hash_table.h"
 #include "common/containers/string.h"
 #include "common/containers/vec.h"
@@ -53,7 +54,7 @@ void dependency_destroy_void(void* dep)
     dependency_destroy(dep);
 }
 
-builder_t* builder_create(const char* root_dir, const char* compiler_path)
+builder_t* builder_create(const char* root_dir, const char* compiler_path, const compiler_options_t* options)
 {
     builder_t* builder = malloc(sizeof(*builder));
     panic_if(builder == nullptr);
@@ -65,6 +66,10 @@ builder_t* builder_create(const char* root_dir, const char* compiler_path)
         .bin_dir = nullptr,    // Set later once we know the project name
         .modules = HASH_TABLE_INIT(module_destroy_void),
         .dependencies = VEC_INIT(dependency_destroy_void),
+        .options = *options,
+        .target_cpu = nullptr,
+        .target_features = nullptr,
+        .quiet = false,
     };
 
     // TODO: This resolution is just for developing
@@ -115,6 +120,8 @@ void builder_destroy(builder_t* builder)
     free(builder->root_dir);
     free(builder->build_dir);
     free(builder->bin_dir);
+    free(builder->target_cpu);
+    free(builder->target_features);
     hash_table_deinit(&builder->modules);
     vec_deinit(&builder->dependencies);
     free(builder);
@@ -287,6 +294,14 @@ static bool extract_dependency(builder_t* builder, hash_table_t* section)
     return true;
 }
 
+// Look up a build option in the section of the active profile ([profile.debug] or [profile.release]), falling back to
+// the project section
+static const char* find_profile_option(hash_table_t* project_section, hash_table_t* profile_section, const char* key)
+{
+    const char* value = profile_section != nullptr ? hash_table_find(profile_section, key) : nullptr;
+    return value != nullptr ? value : hash_table_find(project_section, key);
+}
+
 static bool extract_build_instructions(builder_t* builder)
 {
     char* toml_path = nullptr;
@@ -324,7 +339,53 @@ static bool extract_build_instructions(builder_t* builder)
         goto cleanup;
     }
     builder->project = strdup(name);
-    printf("Building project %s\n", name);
+    if (!builder->quiet)
+        printf("Building project %s\n", name);
+
+    // Optional build options; the command line takes precedence
+    const char* bounds_checks = hash_table_find(project_section, "bounds-checks");
+    if (bounds_checks != nullptr && builder->options.bounds_checks == BOUNDS_CHECKS_DEFAULT &&
+        !compiler_options_parse_bounds_checks(bounds_checks, &builder->options.bounds_checks))
+    {
+        fprintf(stderr, "Error: invalid value '%s' for `bounds-checks` in `project` section\n", bounds_checks);
+        error = true;
+        goto cleanup;
+    }
+    const char* debug_info = hash_table_find(project_section, "debug-info");
+    if (debug_info != nullptr && builder->options.debug_info == DEBUG_INFO_DEFAULT &&
+        !compiler_options_parse_debug_info(debug_info, &builder->options.debug_info))
+    {
+        fprintf(stderr, "Error: invalid value '%s' for `debug-info` in `project` section\n", debug_info);
+        error = true;
+        goto cleanup;
+    }
+    const char* split_dwarf = hash_table_find(project_section, "split-dwarf");
+    if (split_dwarf != nullptr && !builder->options.split_dwarf &&
+        !compiler_options_parse_switch(split_dwarf, &builder->options.split_dwarf))
+    {
+        fprintf(stderr, "Error: invalid value '%s' for `split-dwarf` in `project` section\n", split_dwarf);
+        error = true;
+        goto cleanup;
+    }
+    const char* compress_debug_sections = hash_table_find(project_section, "compress-debug-sections");
+    if (compress_debug_sections != nullptr && !builder->options.compress_debug_sections &&
+        !compiler_options_parse_switch(compress_debug_sections, &builder->options.compress_debug_sections))
+    {
+        fprintf(stderr, "Error: invalid value '%s' for `compress-debug-sections` in `project` section\n",
+            compress_debug_sections);
+        error = true;
+        goto cleanup;
+    }
+
+    // Target options may differ per profile; the command line takes precedence here as well
+    hash_table_t* profile_section = toml_as_section(hash_table_find(toml_file,
+        builder->options.release ? "profile.release" : "profile.debug"));
+    const char* target_cpu = find_profile_option(project_section, profile_section, "target-cpu");
+    if (target_cpu != nullptr && builder->options.target_cpu == nullptr)
+        builder->options.target_cpu = builder->target_cpu = strdup(target_cpu);
+    const char* target_features = find_profile_option(project_section, profile_section, "target-features");
+    if (target_features != nullptr && builder->options.target_features == nullptr)
+        builder->options.target_features = builder->target_features = strdup(target_features);
 
     // Set build directory: ./build/<project_name>/
     builder->build_dir = join_path("build", name);
@@ -436,7 +497,8 @@ static bool builder_load_dependency(builder_t* builder, dependency_t* dep)
     }
 
     dep->project_name = strdup(project_name);
-    printf("Loading dependency %s (project: %s)\n", dep->name, project_name);
+    if (!builder->quiet)
+        printf("Loading dependency %s (project: %s)\n", dep->name, project_name);
 
     // Process [[bin]] modules from dependency
     vec_t* bins = toml_as_array_section(hash_table_find(toml_file, "bin"));
@@ -579,11 +641,13 @@ static bool inject_exports_into_module(module_t* module)
             nullptr);  // don't copy our exports, symbol_table_import will make appropriate clones
 
         symbol_table_import(module->sema_context->global, dep_mod->sema_context->exports, mod_ns);
+        semantic_context_import_template_scope(module->sema_context, mod_ns, dep_mod->sema_context->template_helpers);
     }
     return true;
 }
 
-bool builder_run(builder_t* builder)
+// Everything up to code generation: parse and collect symbols of all modules and resolve imports between them
+static bool builder_prepare(builder_t* builder)
 {
     if (!extract_build_instructions(builder))
         return false;
@@ -610,6 +674,14 @@ bool builder_run(builder_t* builder)
     if (!for_each_module(builder, inject_exports_into_module))
         return false;
 
+    return true;
+}
+
+bool builder_run(builder_t* builder)
+{
+    if (!builder_prepare(builder))
+        return false;
+
     // Compile dependency modules first
     for (size_t i = 0; i < vec_size(&builder->dependencies); ++i)
     {
@@ -644,3 +716,59 @@ bool builder_run(builder_t* builder)
 
     return true;
 }
+
+bool builder_run_jit(builder_t* builder, int* exit_code)
+{
+    builder->quiet = true;
+    if (!builder_prepare(builder))
+        return false;
+
+    // Every binary module defines main, so only one of them can be loaded
+    module_t* binary = nullptr;
+    hash_table_iter_t itr;
+    for (hash_table_iter_init(&itr, &builder->modules); hash_table_iter_has_elem(&itr); hash_table_iter_next(&itr))
+    {
+        module_t* module = hash_table_iter_current(&itr)->value;
+        if (module->is_dependency || module->kind != MODULE_BINARY)
+            continue;
+        if (binary != nullptr)
+        {
+            fprintf(stderr, "Error: project %s has more than one binary module to run\n", builder->project);
+            return false;
+        }
+        binary = module;
+    }
+    if (binary == nullptr)
+    {
+        fprintf(stderr, "Error: project %s has no binary module to run\n", builder->project);
+        return false;
+    }
+
+    llvm_jit_t* jit = llvm_jit_create();
+    if (jit == nullptr)
+        return false;
+
+    // All libraries are loaded in the order builder_run compiles them; the JIT only compiles what main reaches
+    bool success = true;
+    for (size_t i = 0; success && i < vec_size(&builder->dependencies); ++i)
+    {
+        dependency_t* dep = vec_get(&builder->dependencies, i);
+        for (size_t j = 0; success && j < vec_size(&dep->modules); ++j)
+        {
+            module_t* module = vec_get(&dep->modules, j);
+            if (module->kind == MODULE_LIBRARY)
+                success = module_add_to_jit(module, jit);
+        }
+    }
+    for (hash_table_iter_init(&itr, &builder->modules); success && hash_table_iter_has_elem(&itr);
+        hash_table_iter_next(&itr))
+    {
+        module_t* module = hash_table_iter_current(&itr)->value;
+        if (!module->is_dependency && module->kind == MODULE_LIBRARY)
+            success = module_add_to_jit(module, jit);
+    }
+
+    success = success && module_add_to_jit(binary, jit) && llvm_jit_run_main(jit, exit_code);
+    llvm_jit_destroy(jit);
+    return success;
+}
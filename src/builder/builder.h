@@ -3,6 +3,7 @@
 
 #include "common/containers/hash_table.h"
 #include "common/containers/vec.h"
+#include "compiler_options.h"
 
 /* Represents a dependency project loaded from [[dep]] in shiro.toml */
 typedef struct dependency
@@ -30,12 +31,20 @@ typedef struct builder
     char* bin_dir;    // Final executables
     hash_table_t modules;  // All modules to be built; name of module (char*) -> module_t*
     vec_t dependencies;    // dependency_t* - all loaded dependency projects
+    compiler_options_t options;  // command line options merged with options from shiro.toml
+    char* target_cpu;       // storage for options.target_cpu when read from shiro.toml
+    char* target_features;  // storage for options.target_features when read from shiro.toml
+    bool quiet;  // no progress output on stdout, which belongs to the program when it is run with the JIT
 } builder_t;
 
-builder_t* builder_create(const char* root_dir, const char* compiler_path);
+builder_t* builder_create(const char* root_dir, const char* compiler_path, const compiler_options_t* options);
 
 void builder_destroy(builder_t* builder);
 
 bool builder_run(builder_t* builder);
 
+// Build the project in memory and run its binary module with the JIT instead of writing an executable; exit_code
+// receives the result of main. The project must have exactly one binary module.
+bool builder_run_jit(builder_t* builder, int* exit_code);
+
 #endif
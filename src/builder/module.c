@@ -4,6 +4,7 @@
 #include "ast/root.h"
 #include "builder/builder.h"
 #include "codegen/llvm/llvm_codegen.h"
+#include "codegen/llvm/llvm_jit.h"
 #include "common/containers/string.h"
 #include "common/containers/vec.h"
 #include "common/debug/panic.h"
@@ -187,7 +188,8 @@ static bool parse_directory_recursive(module_t* module, parser_t* parser, const
             continue;
         }
 
-        printf("  %s\n", entry_path);
+        if (!module->builder->quiet)
+            printf("  %s\n", entry_path);
         parser_set_source(parser, entry_path, source);
         ast_root_t* ast = parser_parse(parser);
         bool failed_parse = vec_size(&parser->errors) > 0;
@@ -221,7 +223,8 @@ static bool parse_directory_recursive(module_t* module, parser_t* parser, const
 
 bool module_parse_src(module_t* module)
 {
-    printf("Parsing module %s\n", module->name);
+    if (!module->builder->quiet)
+        printf("Parsing module %s\n", module->name);
 
     parser_t* parser = parser_create();
     bool success = parse_directory_recursive(module, parser, module->src_dir);
@@ -232,7 +235,8 @@ bool module_parse_src(module_t* module)
 
 bool module_decl_collect(module_t* module)
 {
-    printf("Building symbols of module %s\n", module->name);
+    if (!module->builder->quiet)
+        printf("Building symbols of module %s\n", module->name);
 
     // Create semantic context now that module->is_dependency and module->project_name are set
     const char* proj_name = module->is_dependency ? module->project_name : nullptr;
@@ -253,6 +257,8 @@ bool module_decl_collect(module_t* module)
 
     if (!success)
         print_ast_errors(&module->sema_context->error_nodes);
+    else
+        decl_collector_collect_template_helpers(decl_collector);
 
     decl_collector_destroy(decl_collector);
 
@@ -361,9 +367,12 @@ bool module_populate_dependencies(module_t* module)
             vec_push(&module->dependencies, strdup(module_lookup_key));
     }
 
-    printf("Module %s depends on:\n", module->name);
-    for (size_t i = 0; i < vec_size(&module->dependencies); ++i)
-        printf("  - %s\n", (const char*)vec_get(&module->dependencies, i));
+    if (!module->builder->quiet)
+    {
+        printf("Module %s depends on:\n", module->name);
+        for (size_t i = 0; i < vec_size(&module->dependencies); ++i)
+            printf("  - %s\n", (const char*)vec_get(&module->dependencies, i));
+    }
 
     // Print and return false if any errors were added
     bool has_errors = vec_size(&module->sema_context->error_nodes) > initial_error_count;
@@ -373,10 +382,9 @@ bool module_populate_dependencies(module_t* module)
     return !has_errors;
 }
 
-bool module_compile(module_t* module)
+// Run semantic analysis on all sources, then generate one LLVM module from them; nullptr on errors
+static llvm_codegen_t* module_codegen(module_t* module)
 {
-    printf("Compiling module %s\n", module->name);
-
     semantic_analyzer_t* sema = semantic_analyzer_create(module->sema_context);
 
     // Run semantic analysis on all AST nodes
@@ -393,7 +401,7 @@ bool module_compile(module_t* module)
     if (!success)
     {
         print_ast_errors(&module->sema_context->error_nodes);
-        return false;
+        return nullptr;
     }
 
     // Warnings
@@ -401,9 +409,8 @@ bool module_compile(module_t* module)
         print_ast_errors(&module->sema_context->warning_nodes);
 
     // Generate LLVM IR for all sources into one module
-    mkdir(module->builder->build_dir, 0755);
     llvm_codegen_t* llvm = llvm_codegen_create(module->builder->project, module->name);
-    llvm_codegen_init(llvm, module->name, module->sema_context);
+    llvm_codegen_init(llvm, module->name, module->sema_context, &module->builder->options);
 
     for (size_t i = 0; i < vec_size(&module->sources); ++i)
     {
@@ -411,31 +418,88 @@ bool module_compile(module_t* module)
         llvm_codegen_add_ast(llvm, AST_NODE(src->ast), src->filepath);
     }
 
+    return llvm;
+}
+
+bool module_compile(module_t* module)
+{
+    printf("Compiling module %s\n", module->name);
+
+    llvm_codegen_t* llvm = module_codegen(module);
+    if (llvm == nullptr)
+        return false;
+
+    mkdir(module->builder->build_dir, 0755);
     char* ll_path = join_path(module->builder->build_dir, ssprintf("%s.ll", module->name));
     FILE* ll_file = fopen(ll_path, "w");
     panic_if(ll_file == nullptr);
     llvm_codegen_finalize(llvm, ll_file);
     fclose(ll_file);
 
+    if (module->builder->options.print_stats)
+        llvm_codegen_print_stats(llvm, stdout);
+
     llvm_codegen_destroy(llvm);
 
     // Compile .ll to .o
+    const compiler_options_t* options = &module->builder->options;
+    bool has_debug_info = compiler_options_debug_info(options) != DEBUG_INFO_NONE;
     char* obj_path = join_path(module->builder->build_dir, ssprintf("%s.o", module->name));
-    const char* llc_cmd = ssprintf("llc -filetype=obj -relocation-model=pic \"%s\" -o \"%s\"", ll_path, obj_path);
+    string_t llc_cmd = STRING_INIT;
+    string_append_cstr(&llc_cmd, ssprintf("llc -filetype=obj -relocation-model=pic \"%s\" -o \"%s\"", ll_path,
+        obj_path));
+
+    // llc resolves "native" to the host CPU and its features itself
+    if (options->target_cpu != nullptr)
+        string_append_cstr(&llc_cmd, ssprintf(" -mcpu=\"%s\"", options->target_cpu));
+    if (options->target_features != nullptr)
+        string_append_cstr(&llc_cmd, ssprintf(" -mattr=\"%s\"", options->target_features));
+
+    // With split DWARF the object only keeps a skeleton unit referring to the .dwo file; the path is relative to the
+    // compilation directory, which is the directory the build runs in
+    if (has_debug_info && options->split_dwarf)
+    {
+        char* dwo_path = join_path(module->builder->build_dir, ssprintf("%s.dwo", module->name));
+        string_append_cstr(&llc_cmd, ssprintf(" -split-dwarf-file=\"%s\" -split-dwarf-output=\"%s\"", dwo_path,
+            dwo_path));
+        free(dwo_path);
+    }
 
-    printf("  Running: %s\n", llc_cmd);
-    int ret = system(llc_cmd);
+    printf("  Running: %s\n", string_cstr(&llc_cmd));
+    int ret = system(string_cstr(&llc_cmd));
+    string_deinit(&llc_cmd);
+    if (ret != 0)
+        fprintf(stderr, "Error: llc failed\n");
+
+    // llc has no option for compressing debug sections, so they are compressed in place after emission
+    if (ret == 0 && has_debug_info && options->compress_debug_sections)
+    {
+        const char* objcopy_cmd = ssprintf("llvm-objcopy --compress-debug-sections=zlib \"%s\"", obj_path);
+        printf("  Running: %s\n", objcopy_cmd);
+        ret = system(objcopy_cmd);
+        if (ret != 0)
+            fprintf(stderr, "Error: llvm-objcopy failed\n");
+    }
 
     free(ll_path);
     free(obj_path);
 
-    if (ret != 0)
-    {
-        fprintf(stderr, "Error: llc failed\n");
+    return ret == 0;
+}
+
+bool module_add_to_jit(module_t* module, llvm_jit_t* jit)
+{
+    llvm_codegen_t* llvm = module_codegen(module);
+    if (llvm == nullptr)
         return false;
-    }
 
-    return true;
+    if (module->builder->options.print_stats)
+        llvm_codegen_print_stats(llvm, stdout);
+
+    const char* project = module->is_dependency ? module->project_name : module->builder->project;
+    bool success = llvm_jit_add_module(jit, llvm, ssprintf("%s.%s", project, module->name));
+    llvm_codegen_destroy(llvm);
+    return success;
 }
 
 bool module_link(module_t* module)
@@ -479,10 +543,23 @@ bool module_link(module_t* module)
         free(dep_obj_path);
     }
 
-    // Add builtins.c
+    // Add builtins.c, which starts threads for Std.Thread
     string_append_cstr(&link_cmd_str, " \"");
     string_append_cstr(&link_cmd_str, builtins_dest);
-    string_append_cstr(&link_cmd_str, "\"");
+    string_append_cstr(&link_cmd_str, "\" -pthread");
+
+    // Modules are instrumented by codegen already; this adds the profile runtime (and instruments the C runtime)
+    if (module->builder->options.profile_generate)
+        string_append_cstr(&link_cmd_str, " -fprofile-generate");
+
+    // Tune the runtime for the same CPU
+    if (module->builder->options.target_cpu != nullptr)
+        string_append_cstr(&link_cmd_str, ssprintf(" -march=\"%s\"", module->builder->options.target_cpu));
+
+    // Let the linker keep the executable's debug sections compressed as well
+    if (compiler_options_debug_info(&module->builder->options) != DEBUG_INFO_NONE &&
+        module->builder->options.compress_debug_sections)
+        string_append_cstr(&link_cmd_str, " -gz");
 
     // Add output path
     char* exe_path = join_path(module->builder->bin_dir, module->name);
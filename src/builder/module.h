@@ -6,6 +6,7 @@
 #include "sema/semantic_context.h"
 
 typedef struct builder builder_t;
+typedef struct llvm_jit llvm_jit_t;
 
 typedef enum module_kind
 {
@@ -50,6 +51,9 @@ bool module_populate_dependencies(module_t* module);
 // Compile module into objects
 bool module_compile(module_t* module);
 
+// Compile module in memory and add it to jit as its own JITDylib
+bool module_add_to_jit(module_t* module, llvm_jit_t* jit);
+
 // Link module with dependencies, producing an executable
 // Should only be used for kind MODULE_BINARY
 bool module_link(module_t* module);
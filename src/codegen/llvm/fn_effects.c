@@ -0,0 +1,253 @@
+#include "fn_effects.h"
+
+#include "ast/node.h"
+#include "ast/type.h"
+#include "ast/visitor.h"
+#include "parser/lexer.h"
+
+#include <string.h>
+
+typedef struct fn_effects_finder
+{
+    ast_visitor_t base;
+    fn_effects_t effects;
+    bool bounds_checks;  // unproven subscripts and slices get runtime checks in this function
+} fn_effects_finder_t;
+
+// Whether the storage designated by expr may lie outside of the function's own stack frame
+static bool is_memory_place(ast_expr_t* expr)
+{
+    switch (AST_KIND(expr))
+    {
+        case AST_EXPR_PAREN:
+            return is_memory_place(((ast_paren_expr_t*)expr)->expr);
+        case AST_EXPR_MEMBER_ACCESS:
+        {
+            ast_member_access_t* access = (ast_member_access_t*)expr;
+            return access->instance->type->kind == AST_TYPE_POINTER || is_memory_place(access->instance);
+        }
+        case AST_EXPR_ARRAY_SUBSCRIPT:
+        {
+            ast_array_subscript_t* subscript = (ast_array_subscript_t*)expr;
+            return subscript->array->type->kind != AST_TYPE_ARRAY || is_memory_place(subscript->array);
+        }
+        case AST_EXPR_UNARY_OP:
+            return ((ast_unary_op_t*)expr)->op == TOKEN_STAR;
+        default:
+            return false;
+    }
+}
+
+static void mark_read(fn_effects_finder_t* finder, ast_expr_t* expr)
+{
+    if (is_memory_place(expr))
+        finder->effects.reads_memory = true;
+}
+
+static void mark_written(fn_effects_finder_t* finder, ast_expr_t* expr)
+{
+    if (is_memory_place(expr))
+        finder->effects.writes_memory = true;
+}
+
+// Locals and parameters with destructors make the function call the destructor when they go out of scope, passing it
+// their address
+static void mark_destructible(fn_effects_finder_t* finder, ast_type_t* type)
+{
+    if (ast_type_has_trait(type, TRAIT_EXPLICIT_DESTRUCTOR))
+    {
+        finder->effects.has_calls = true;
+        finder->effects.locals_escape = true;
+    }
+}
+
+// Views of arrays point into the array's storage, which may be a local
+static void mark_array_view(fn_effects_finder_t* finder, ast_expr_t* array)
+{
+    if (array->type->kind == AST_TYPE_ARRAY)
+        finder->effects.locals_escape = true;
+}
+
+static void mark_bounds_check(fn_effects_finder_t* finder, ast_expr_t* array, bool bounds_safe)
+{
+    if (array->type->kind != AST_TYPE_POINTER && !bounds_safe && finder->bounds_checks)
+        finder->effects.may_trap = true;
+}
+
+static void find_effects_param_decl(void* self_, ast_param_decl_t* param, void* out_)
+{
+    (void)out_;
+    mark_destructible(self_, param->type);
+}
+
+static void find_effects_var_decl(void* self_, ast_var_decl_t* var, void* out_)
+{
+    mark_destructible(self_, var->type);
+    if (var->init_expr != nullptr)
+        ast_visitor_visit(self_, var->init_expr, out_);
+}
+
+static void find_effects_array_slice(void* self_, ast_array_slice_t* slice, void* out_)
+{
+    mark_bounds_check(self_, slice->array, slice->bounds_safe);
+    mark_array_view(self_, slice->array);
+    ast_visitor_visit(self_, slice->array, out_);
+    if (slice->start != nullptr)
+        ast_visitor_visit(self_, slice->start, out_);
+    if (slice->end != nullptr)
+        ast_visitor_visit(self_, slice->end, out_);
+}
+
+static void find_effects_array_subscript(void* self_, ast_array_subscript_t* subscript, void* out_)
+{
+    mark_bounds_check(self_, subscript->array, subscript->bounds_safe);
+    mark_read(self_, (ast_expr_t*)subscript);
+    ast_visitor_visit(self_, subscript->array, out_);
+    ast_visitor_visit(self_, subscript->index, out_);
+}
+
+// Strings are compared and hashed by calls reading the bytes they point to
+static void mark_string_bytes_read(fn_effects_finder_t* finder)
+{
+    finder->effects.has_calls = true;
+    finder->effects.reads_memory = true;
+}
+
+static void find_effects_bin_op(void* self_, ast_bin_op_t* bin_op, void* out_)
+{
+    if (token_type_is_assignment_op(bin_op->op))
+        mark_written(self_, bin_op->lhs);
+    else if ((bin_op->op == TOKEN_EQ || bin_op->op == TOKEN_NEQ) && bin_op->lhs->type == ast_type_builtin(TYPE_STRING))
+        mark_string_bytes_read(self_);
+    ast_visitor_visit(self_, bin_op->lhs, out_);
+    ast_visitor_visit(self_, bin_op->rhs, out_);
+}
+
+static void find_effects_call_expr(void* self_, ast_call_expr_t* call, void* out_)
+{
+    fn_effects_finder_t* finder = self_;
+    finder->effects.has_calls = true;
+    for (size_t i = 0; i < vec_size(&call->arguments); ++i)
+        ast_visitor_visit(self_, vec_get(&call->arguments, i), out_);
+}
+
+static void find_effects_coercion_expr(void* self_, ast_coercion_expr_t* coercion, void* out_)
+{
+    if (coercion->target->kind == AST_TYPE_VIEW)
+        mark_array_view(self_, coercion->expr);
+    ast_visitor_visit(self_, coercion->expr, out_);
+}
+
+static void find_effects_member_access(void* self_, ast_member_access_t* access, void* out_)
+{
+    mark_read(self_, (ast_expr_t*)access);
+    ast_visitor_visit(self_, access->instance, out_);
+}
+
+static void find_effects_method_call(void* self_, ast_method_call_t* call, void* out_)
+{
+    fn_effects_finder_t* finder = self_;
+
+    // Builtin methods such as view.len() are emitted inline and only read the instance. The heap array methods that
+    // change the array access its storage and may pass its address to the runtime to grow it.
+    if (call->is_builtin_method && call->instance->type->kind == AST_TYPE_HEAP_ARRAY &&
+        strcmp(call->method_name, "len") != 0)
+    {
+        finder->effects.reads_memory = true;
+        finder->effects.writes_memory = true;
+        finder->effects.has_calls = true;
+        finder->effects.locals_escape = true;
+        if (strcmp(call->method_name, "pop") == 0 && finder->bounds_checks)
+            finder->effects.may_trap = true;
+    }
+    else if (call->is_builtin_method && call->instance->type->kind == AST_TYPE_POINTER)
+    {
+        // The atomic methods of integer pointers access what the pointer points to: load() reads it, store(),
+        // fetch_add() and compare_exchange() read and write it
+        finder->effects.has_atomics = true;
+        finder->effects.reads_memory = true;
+        if (strcmp(call->method_name, "load") != 0)
+            finder->effects.writes_memory = true;
+    }
+    else if (call->is_builtin_method && call->instance->type == ast_type_builtin(TYPE_STRING) &&
+        strcmp(call->method_name, "hash") == 0)
+    {
+        mark_string_bytes_read(finder);
+    }
+    else if (call->is_builtin_method)
+        mark_read(finder, call->instance);
+    else
+        finder->effects.has_calls = true;
+
+    // Methods called on an object rather than a pointer receive the object's address as self
+    if (!call->is_builtin_method && call->instance->type->kind != AST_TYPE_POINTER)
+        finder->effects.locals_escape = true;
+
+    ast_visitor_visit(self_, call->instance, out_);
+    for (size_t i = 0; i < vec_size(&call->arguments); ++i)
+        ast_visitor_visit(self_, vec_get(&call->arguments, i), out_);
+}
+
+static void find_effects_unary_op(void* self_, ast_unary_op_t* unary, void* out_)
+{
+    fn_effects_finder_t* finder = self_;
+    mark_read(finder, (ast_expr_t*)unary);
+    if (unary->op == TOKEN_AMPERSAND)
+        finder->effects.locals_escape = true;
+    ast_visitor_visit(self_, unary->expr, out_);
+}
+
+static void find_effects_inc_dec_stmt(void* self_, ast_inc_dec_stmt_t* stmt, void* out_)
+{
+    mark_written(self_, stmt->operand);
+    ast_visitor_visit(self_, stmt->operand, out_);
+}
+
+static void find_effects_for_stmt(void* self_, ast_for_stmt_t* stmt, void* out_)
+{
+    fn_effects_finder_t* finder = self_;
+    finder->effects.has_loops = true;
+    if (stmt->init_stmt != nullptr)
+        ast_visitor_visit(self_, stmt->init_stmt, out_);
+    if (stmt->cond_expr != nullptr)
+        ast_visitor_visit(self_, stmt->cond_expr, out_);
+    if (stmt->post_stmt != nullptr)
+        ast_visitor_visit(self_, stmt->post_stmt, out_);
+    ast_visitor_visit(self_, stmt->body, out_);
+}
+
+static void find_effects_while_stmt(void* self_, ast_while_stmt_t* stmt, void* out_)
+{
+    fn_effects_finder_t* finder = self_;
+    finder->effects.has_loops = true;
+    ast_visitor_visit(self_, stmt->condition, out_);
+    ast_visitor_visit(self_, stmt->body, out_);
+}
+
+fn_effects_t fn_effects_analyze(ast_fn_def_t* fn_def, bool bounds_checks)
+{
+    fn_effects_finder_t finder = {
+        .bounds_checks = bounds_checks && !fn_def->unchecked,
+    };
+    ast_visitor_init(&finder.base);
+    finder.base.visit_param_decl = find_effects_param_decl;
+    finder.base.visit_var_decl = find_effects_var_decl;
+    finder.base.visit_array_slice = find_effects_array_slice;
+    finder.base.visit_array_subscript = find_effects_array_subscript;
+    finder.base.visit_bin_op = find_effects_bin_op;
+    finder.base.visit_call_expr = find_effects_call_expr;
+    finder.base.visit_coercion_expr = find_effects_coercion_expr;
+    finder.base.visit_member_access = find_effects_member_access;
+    finder.base.visit_method_call = find_effects_method_call;
+    finder.base.visit_unary_op = find_effects_unary_op;
+    finder.base.visit_inc_dec_stmt = find_effects_inc_dec_stmt;
+    finder.base.visit_for_stmt = find_effects_for_stmt;
+    finder.base.visit_while_stmt = find_effects_while_stmt;
+
+    for (size_t i = 0; i < vec_size(&fn_def->params); ++i)
+        ast_visitor_visit(&finder, vec_get(&fn_def->params, i), nullptr);
+    if (fn_def->body != nullptr)
+        ast_visitor_visit(&finder, fn_def->body, nullptr);
+
+    return finder.effects;
+}
@@ -0,0 +1,22 @@
+#ifndef FN_EFFECTS_H
+#define FN_EFFECTS_H
+
+typedef struct ast_fn_def ast_fn_def_t;
+
+// What the body of a function or method may do besides computing its result. Memory that only lives in the function's
+// own stack frame (locals, parameters, the self pointer variable) does not count.
+typedef struct fn_effects
+{
+    bool reads_memory;   // loads through a pointer, view or self
+    bool writes_memory;  // stores through a pointer, view or self
+    bool has_calls;      // calls functions or methods, or has locals with destructors; effects of callees are unknown
+    bool has_loops;      // may not terminate
+    bool may_trap;       // contains runtime bounds checks
+    bool has_atomics;    // accesses memory atomically, which other threads may observe or be synchronized by
+    bool locals_escape;  // the address of a local or parameter may be handed to a callee or stored
+} fn_effects_t;
+
+// Analyze the body of fn_def; bounds_checks tells whether unproven accesses get runtime checks
+fn_effects_t fn_effects_analyze(ast_fn_def_t* fn_def, bool bounds_checks);
+
+#endif
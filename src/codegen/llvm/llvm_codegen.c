@@ -20,9 +20,12 @@
 #include "ast/util/presenter.h"
 #include "ast/visitor.h"
 #include "common/containers/hash_table.h"
+#include "common/containers/string.h"
 #include "common/containers/vec.h"
 #include "common/debug/panic.h"
 #include "common/util/ssprintf.h"
+#include "compiler_options.h"
+#include "fn_effects.h"
 #include "parser/lexer.h"
 #include "llvm_type_utils.h"
 #include "sema/semantic_context.h"
@@ -32,6 +35,10 @@
 #include <llvm-c/Types.h>
 #include <llvm-c/Core.h>
 #include <llvm-c/DebugInfo.h>
+#include <llvm-c/Target.h>
+#include <llvm-c/TargetMachine.h>
+#include <llvm-c/Transforms/PassBuilder.h>
+#include <llvm/Config/llvm-config.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -39,19 +46,46 @@ typedef struct class_layout class_layout_t;
 typedef struct loop_context loop_context_t;
 typedef struct destructor_scope destructor_scope_t;
 typedef struct destructible_var destructible_var_t;
+typedef struct cleanup_dest cleanup_dest_t;
+typedef struct codegen_stats codegen_stats_t;
+typedef struct hoisted_view hoisted_view_t;
+typedef struct loop_write_finder loop_write_finder_t;
 
 struct loop_context
 {
     LLVMBasicBlockRef continue_block;  // Block to jump to for continue
     LLVMBasicBlockRef break_block;     // Block to jump to for break
+    LLVMValueRef loop_id;              // llvm.loop metadata, attached to every backedge
+    bool continue_is_backedge;         // continue jumps straight to the loop header (while loops)
+    vec_t hoisted_views;               // char* - names of views hoisted by this loop
+    destructor_scope_t* scope;         // Innermost destructor scope still alive at continue_block and break_block
     loop_context_t* parent;            // Parent loop context for nested loops
 };
 
+// Length and data pointer of a view variable, loaded once in a loop preheader
+struct hoisted_view
+{
+    LLVMValueRef length;
+    LLVMValueRef data;
+};
+
 struct destructible_var
 {
     char* name;               // Variable name (for debugging)
     LLVMValueRef alloca;      // Pointer to the variable's alloca
     ast_type_t* type;         // Type of the variable (to find destructor)
+    LLVMBasicBlockRef cleanup_block;  // Destroys the variable for every exit leaving its scope; created by the first
+    vec_t cleanup_dests;      // vec<cleanup_dest_t*> - where control may continue after cleanup_block
+};
+
+// An exit (return, break, continue or the end of a scope) that runs destructors through shared cleanup blocks. The
+// exit stores index in the function's cleanup destination slot; each cleanup block then dispatches on it.
+struct cleanup_dest
+{
+    unsigned index;               // Value of the cleanup destination slot for this exit
+    LLVMBasicBlockRef block;      // Block to continue in once all cleanups ran
+    destructor_scope_t* scope;    // Innermost scope still alive in block; its variables are not destroyed
+    loop_context_t* backedge_of;  // Loop whose backedge the branch to block is (continue in while loops)
 };
 
 struct destructor_scope
@@ -60,28 +94,46 @@ struct destructor_scope
     destructor_scope_t* parent;  // Parent scope for nested scopes
 };
 
+struct codegen_stats
+{
+    size_t bounds_checks_emitted;     // runtime checks emitted
+    size_t bounds_checks_proven;      // accesses proven in-bounds during sema, so no check is needed
+    size_t bounds_checks_suppressed;  // checks omitted because of the bounds-check policy or @unchecked
+    size_t bounds_check_trap_blocks;  // shared trap blocks emitted (at most one per function)
+    vec_t unchecked_functions;        // char* - names of functions compiled without bounds checks
+};
+
 struct llvm_codegen
 {
     ast_visitor_t base;
 
+    LLVMOrcThreadSafeContextRef thread_safe_context;  // owns context; shared with the module once handed to the JIT
     LLVMContextRef context;
     LLVMModuleRef module;
     LLVMBuilderRef builder;
+    llvm_type_cache_t types;
     LLVMValueRef current_function;
+    LLVMBasicBlockRef bounds_trap_block;  // shared by all bounds checks in current_function; created lazily
 
     ast_presenter_t* presenter;
     hash_table_t* symbols;  // name (char*) -> LLVMValueRef (alloca)
+    hash_table_t* hoisted_views;  // name (char*) -> hoisted_view_t* for views that are invariant in current loops
+    loop_write_finder_t* loop_writes;  // what each loop of the current function may modify
+    ast_inc_dec_stmt_t* no_wrap_counter_step;  // post statement being emitted, if its counter is proven not to overflow
     semantic_context_t* sema_ctx;  // for looking up symbol source_module
 
     // Classes
     hash_table_t class_layouts;     // fully-qualified class name (char*) -> class_layout_t*
     ast_class_def_t* current_class; // set during method generation
+    size_t num_emitted_template_instances;  // prefix of sema_ctx->template_instances that is defined
 
     // Debug info
     LLVMDIBuilderRef di_builder;
     LLVMMetadataRef di_compile_unit;
     LLVMMetadataRef di_file;
     hash_table_t* di_scopes;  // function name (char*) -> LLVMMetadataRef (DISubprogram)
+    hash_table_t* di_class_types;  // fully-qualified class name (char*) -> LLVMMetadataRef (DICompositeType)
+    debug_info_level_t debug_info;  // di_builder is only created for line tables or full debug info
     LLVMMetadataRef current_di_scope;
 
     // Loop context for break/continue
@@ -89,6 +141,24 @@ struct llvm_codegen
 
     // Destructor scope tracking for automatic cleanup
     destructor_scope_t* destructor_scope;
+    LLVMValueRef cleanup_dest_slot;  // i32 selecting where a cleanup block continues; created lazily
+    vec_t cleanup_dest_blocks;       // LLVMBasicBlockRef - destination blocks of exits; position is the slot value
+    LLVMBasicBlockRef return_block;  // shared return for returns that run destructors; created lazily
+    LLVMValueRef return_slot;        // value returned by return_block (non-void functions)
+
+    // Target; the CPU and features are resolved ("native" is replaced by the host's) and empty when not chosen
+    LLVMTargetMachineRef target_machine;
+    char* target_cpu;
+    char* target_features;
+
+    // Build options
+    compiler_options_t options;
+    bool bounds_checks;         // runtime bounds checks enabled by the build-wide policy
+    bool current_fn_unchecked;  // function being generated is @unchecked
+    bool current_fn_flatten;    // function being generated is @flatten
+    bool current_fn_locals_escape;  // function being generated may hand out addresses of its locals
+
+    codegen_stats_t stats;
 
     bool lvalue;
     bool address_of_lvalue;
@@ -107,6 +177,18 @@ struct class_layout
     (symbol->data.function.overload_index == 0) ? symbol->fully_qualified_name : ssprintf("%s.%zu", \
         symbol->fully_qualified_name, symbol->data.function.overload_index)
 
+// External functions keep their C name
+#define FUNCTION_SYMBOL_NAME(symbol) \
+    (symbol->data.function.extern_abi != nullptr ? symbol->name : MANGLE_FUNCTION_NAME(symbol))
+
+// Fields of %heap_array, the lowering of every heap array type
+enum
+{
+    HEAP_ARRAY_DATA = 0,
+    HEAP_ARRAY_LENGTH = 1,
+    HEAP_ARRAY_CAPACITY = 2,
+};
+
 // Get or declare llvm.ubsantrap intrinsic
 static LLVMValueRef get_ubsantrap_intrinsic(llvm_codegen_t* llvm)
 {
@@ -121,31 +203,297 @@ static LLVMValueRef get_ubsantrap_intrinsic(llvm_codegen_t* llvm)
     return LLVMAddFunction(llvm->module, intrinsic_name, fn_type);
 }
 
-// Emit a bounds check failure trap
-static void emit_bounds_check_trap(llvm_codegen_t* llvm, LLVMValueRef condition, const char* safe_label)
+// Get or declare a function outside of the module, such as a runtime builtin or libc function
+static LLVMValueRef get_external_function(llvm_codegen_t* llvm, const char* name, LLVMTypeRef return_type,
+    LLVMTypeRef* param_types, unsigned param_count)
 {
-    LLVMBasicBlockRef trap_block = LLVMAppendBasicBlock(llvm->current_function, "bounds_check.trap");
-    LLVMBasicBlockRef safe_block = LLVMAppendBasicBlock(llvm->current_function, safe_label);
+    LLVMValueRef fn = LLVMGetNamedFunction(llvm->module, name);
+    if (fn != nullptr)
+        return fn;
 
-    LLVMBuildCondBr(llvm->builder, condition, safe_block, trap_block);
+    return LLVMAddFunction(llvm->module, name, LLVMFunctionType(return_type, param_types, param_count, false));
+}
+
+// declare void @shiro_heap_array_grow(ptr nocapture, i64, i64) from the runtime. The runtime does not keep the
+// address of the array, so stores to the elements of a local array can not modify the array itself and push loops
+// only reload its data pointer after growing.
+static LLVMValueRef get_heap_array_grow_function(llvm_codegen_t* llvm)
+{
+    const char* name = "shiro_heap_array_grow";
+    LLVMValueRef fn = LLVMGetNamedFunction(llvm->module, name);
+    if (fn != nullptr)
+        return fn;
 
-    // Emit trap block
+    LLVMTypeRef size_type = LLVMInt64TypeInContext(llvm->context);
+    LLVMTypeRef param_types[] = { LLVMPointerTypeInContext(llvm->context, 0), size_type, size_type };
+    fn = get_external_function(llvm, name, LLVMVoidTypeInContext(llvm->context), param_types, 3);
+    unsigned nocapture_kind = LLVMGetEnumAttributeKindForName("nocapture", 9);
+    LLVMAddAttributeAtIndex(fn, 1, LLVMCreateEnumAttribute(llvm->context, nocapture_kind, 0));
+    return fn;
+}
+
+// declare void @free(ptr)
+static LLVMValueRef get_free_function(llvm_codegen_t* llvm)
+{
+    LLVMTypeRef param_types[] = { LLVMPointerTypeInContext(llvm->context, 0) };
+    return get_external_function(llvm, "free", LLVMVoidTypeInContext(llvm->context), param_types, 1);
+}
+
+// declare i32 @memcmp(ptr, ptr, i64)
+static LLVMValueRef get_memcmp_function(llvm_codegen_t* llvm)
+{
+    LLVMTypeRef param_types[] = { LLVMPointerTypeInContext(llvm->context, 0),
+        LLVMPointerTypeInContext(llvm->context, 0), LLVMInt64TypeInContext(llvm->context) };
+    return get_external_function(llvm, "memcmp", LLVMInt32TypeInContext(llvm->context), param_types, 3);
+}
+
+// declare void @shiro_stdout_flush() from the runtime
+static LLVMValueRef get_stdout_flush_function(llvm_codegen_t* llvm)
+{
+    return get_external_function(llvm, "shiro_stdout_flush", LLVMVoidTypeInContext(llvm->context), nullptr, 0);
+}
+
+// Get the shared trap block for bounds check failures in the current function, creating it on first use
+static LLVMBasicBlockRef get_bounds_trap_block(llvm_codegen_t* llvm)
+{
+    if (llvm->bounds_trap_block != nullptr)
+        return llvm->bounds_trap_block;
+
+    LLVMBasicBlockRef insert_block = LLVMGetInsertBlock(llvm->builder);
+    LLVMBasicBlockRef trap_block = LLVMAppendBasicBlock(llvm->current_function, "bounds_check.trap");
     LLVMPositionBuilderAtEnd(llvm->builder, trap_block);
+
+    // Output buffered by the runtime would be lost when the trap kills the process
+    LLVMValueRef flush = get_stdout_flush_function(llvm);
+    LLVMBuildCall2(llvm->builder, LLVMGlobalGetValueType(flush), flush, nullptr, 0, "");
+
+    // Mark the trap as cold so the block is laid out away from the hot path
     LLVMValueRef ubsantrap = get_ubsantrap_intrinsic(llvm);
     LLVMValueRef trap_kind = LLVMConstInt(LLVMInt8TypeInContext(llvm->context), 5, false);  // 5 = out-of-bounds
-    LLVMBuildCall2(llvm->builder, LLVMGlobalGetValueType(ubsantrap), ubsantrap, &trap_kind, 1, "");
+    LLVMValueRef trap_call = LLVMBuildCall2(llvm->builder, LLVMGlobalGetValueType(ubsantrap), ubsantrap, &trap_kind,
+        1, "");
+    unsigned cold_kind = LLVMGetEnumAttributeKindForName("cold", 4);
+    LLVMAddCallSiteAttribute(trap_call, (LLVMAttributeIndex)LLVMAttributeFunctionIndex,
+        LLVMCreateEnumAttribute(llvm->context, cold_kind, 0));
     LLVMBuildUnreachable(llvm->builder);
 
+    LLVMPositionBuilderAtEnd(llvm->builder, insert_block);
+    llvm->bounds_trap_block = trap_block;
+    ++llvm->stats.bounds_check_trap_blocks;
+    return trap_block;
+}
+
+// Branch weights making the in-bounds successor the expected one (same weights as LLVM uses for __builtin_expect)
+static LLVMValueRef get_likely_branch_weights(llvm_codegen_t* llvm)
+{
+    LLVMTypeRef i32_type = LLVMInt32TypeInContext(llvm->context);
+    LLVMMetadataRef weights[] = {
+        LLVMMDStringInContext2(llvm->context, "branch_weights", strlen("branch_weights")),
+        LLVMValueAsMetadata(LLVMConstInt(i32_type, (1 << 20) - 1, false)),
+        LLVMValueAsMetadata(LLVMConstInt(i32_type, 1, false)),
+    };
+    return LLVMMetadataAsValue(llvm->context, LLVMMDNodeInContext2(llvm->context, weights, 3));
+}
+
+// Emit a bounds check: branch to the function's trap block unless condition holds
+static void emit_bounds_check_trap(llvm_codegen_t* llvm, LLVMValueRef condition, const char* safe_label)
+{
+    LLVMBasicBlockRef trap_block = get_bounds_trap_block(llvm);
+    LLVMBasicBlockRef safe_block = LLVMAppendBasicBlock(llvm->current_function, safe_label);
+
+    LLVMValueRef branch = LLVMBuildCondBr(llvm->builder, condition, safe_block, trap_block);
+    LLVMSetMetadata(branch, LLVMGetMDKindIDInContext(llvm->context, "prof", 4), get_likely_branch_weights(llvm));
+
     // Continue with safe block
     LLVMPositionBuilderAtEnd(llvm->builder, safe_block);
 }
 
+// Whether a bounds check that could not be proven safe at compile-time should be emitted; updates statistics
+static bool should_emit_bounds_check(llvm_codegen_t* llvm)
+{
+    if (llvm->bounds_checks && !llvm->current_fn_unchecked)
+    {
+        ++llvm->stats.bounds_checks_emitted;
+        return true;
+    }
+
+    ++llvm->stats.bounds_checks_suppressed;
+    return false;
+}
+
+// Record the bounds-check policy applied to a function about to be generated
+static void begin_function_bounds_checks(llvm_codegen_t* llvm, ast_fn_def_t* fn_def, const char* name)
+{
+    llvm->bounds_trap_block = nullptr;
+    llvm->current_fn_unchecked = fn_def->unchecked;
+    if (fn_def->unchecked || !llvm->bounds_checks)
+        vec_push(&llvm->stats.unchecked_functions, strdup(name));
+}
+
+// Move the shared trap block (if any) to the end of the function, out of the way of the hot path
+static void end_function_bounds_checks(llvm_codegen_t* llvm)
+{
+    if (llvm->bounds_trap_block == nullptr)
+        return;
+
+    LLVMBasicBlockRef last_block = LLVMGetLastBasicBlock(llvm->current_function);
+    if (last_block != llvm->bounds_trap_block)
+        LLVMMoveBasicBlockAfter(llvm->bounds_trap_block, last_block);
+    llvm->bounds_trap_block = nullptr;
+}
+
+static void add_fn_attribute(llvm_codegen_t* llvm, LLVMValueRef fn, const char* name)
+{
+    unsigned kind = LLVMGetEnumAttributeKindForName(name, strlen(name));
+    LLVMAddAttributeAtIndex(fn, (LLVMAttributeIndex)LLVMAttributeFunctionIndex,
+        LLVMCreateEnumAttribute(llvm->context, kind, 0));
+}
+
+static void add_fn_string_attribute(llvm_codegen_t* llvm, LLVMValueRef fn, const char* name, const char* value)
+{
+    LLVMAddAttributeAtIndex(fn, (LLVMAttributeIndex)LLVMAttributeFunctionIndex,
+        LLVMCreateStringAttribute(llvm->context, name, (unsigned)strlen(name), value, (unsigned)strlen(value)));
+}
+
+// Map the user attributes of a function or method (@inline, @cold, ...) to LLVM function attributes. Imported
+// symbols have no AST; attributes only matter where the body is emitted.
+static void add_fn_def_attributes(llvm_codegen_t* llvm, LLVMValueRef fn, symbol_t* fn_symb)
+{
+    if (fn_symb->ast == nullptr || (AST_KIND(fn_symb->ast) != AST_DEF_FN && AST_KIND(fn_symb->ast) != AST_DEF_METHOD))
+        return;
+
+    // Like clang, record the target on every definition so that any backend (llc, clang, a JIT) selects instructions
+    // for it, whatever its own defaults
+    if (llvm->target_cpu[0] != '\0')
+        add_fn_string_attribute(llvm, fn, "target-cpu", llvm->target_cpu);
+    if (llvm->target_features[0] != '\0')
+        add_fn_string_attribute(llvm, fn, "target-features", llvm->target_features);
+
+    ast_fn_def_t* fn_def = (ast_fn_def_t*)fn_symb->ast;
+    if (fn_def->always_inline)
+        add_fn_attribute(llvm, fn, "alwaysinline");
+    if (fn_def->no_inline)
+        add_fn_attribute(llvm, fn, "noinline");
+    if (fn_def->hot)
+        add_fn_attribute(llvm, fn, "hot");
+    if (fn_def->cold)
+        add_fn_attribute(llvm, fn, "cold");
+}
+
+// Function-level memory effects: readnone/readonly before LLVM 16, memory(...) after. The latter is an int attribute
+// with two mod/ref bits per memory location, so the encoding depends on the locations known to the LLVM version.
+static void add_memory_effects_attribute(llvm_codegen_t* llvm, LLVMValueRef fn, bool reads_memory)
+{
+#if LLVM_VERSION_MAJOR >= 16
+    uint64_t effects = 0;  // memory(none)
+    if (reads_memory)
+    {
+#if LLVM_VERSION_MAJOR <= 20
+        effects = 0x15;  // memory(read): ref on argmem, inaccessiblemem and other
+#elif LLVM_VERSION_MAJOR == 21
+        effects = 0x55;  // memory(read): ref on argmem, inaccessiblemem, errnomem and other
+#else
+        return;  // locations of this LLVM version are unknown; memory(none) is the only safe encoding
+#endif
+    }
+    unsigned kind = LLVMGetEnumAttributeKindForName("memory", 6);
+    LLVMAddAttributeAtIndex(fn, (LLVMAttributeIndex)LLVMAttributeFunctionIndex,
+        LLVMCreateEnumAttribute(llvm->context, kind, effects));
+#else
+    add_fn_attribute(llvm, fn, reads_memory ? "readonly" : "readnone");
+#endif
+}
+
+// declare i64 @shiro_hash_bytes(ptr nocapture, i64) from the runtime. It only reads the bytes, so hashing the same
+// string twice in a loop is done once.
+static LLVMValueRef get_hash_bytes_function(llvm_codegen_t* llvm)
+{
+    const char* name = "shiro_hash_bytes";
+    LLVMValueRef fn = LLVMGetNamedFunction(llvm->module, name);
+    if (fn != nullptr)
+        return fn;
+
+    LLVMTypeRef size_type = LLVMInt64TypeInContext(llvm->context);
+    LLVMTypeRef param_types[] = { LLVMPointerTypeInContext(llvm->context, 0), size_type };
+    fn = get_external_function(llvm, name, size_type, param_types, 2);
+    unsigned nocapture_kind = LLVMGetEnumAttributeKindForName("nocapture", 9);
+    LLVMAddAttributeAtIndex(fn, 1, LLVMCreateEnumAttribute(llvm->context, nocapture_kind, 0));
+    add_fn_attribute(llvm, fn, "nounwind");
+    add_memory_effects_attribute(llvm, fn, true);
+    return fn;
+}
+
+// Attributes inferred from what a function may do. Shiro has no exceptions, so nothing it generates unwinds; the
+// remaining attributes need the body, which imported symbols do not have.
+static void add_inferred_fn_attributes(llvm_codegen_t* llvm, LLVMValueRef fn, symbol_t* fn_symb)
+{
+    add_fn_attribute(llvm, fn, "nounwind");
+
+    if (fn_symb->ast == nullptr || (AST_KIND(fn_symb->ast) != AST_DEF_FN && AST_KIND(fn_symb->ast) != AST_DEF_METHOD))
+        return;
+
+    // Bounds-check traps, calls and atomics are side effects the optimizer must not drop or reorder
+    fn_effects_t effects = fn_effects_analyze((ast_fn_def_t*)fn_symb->ast, llvm->bounds_checks);
+    if (effects.has_calls || effects.may_trap || effects.has_atomics)
+        return;
+
+    if (!effects.has_loops)
+        add_fn_attribute(llvm, fn, "willreturn");
+    if (!effects.writes_memory)
+        add_memory_effects_attribute(llvm, fn, effects.reads_memory);
+}
+
+// Methods are only called on an instance, so self always points to a whole object of the class
+static void add_self_param_attributes(llvm_codegen_t* llvm, LLVMValueRef fn, symbol_t* class_symb)
+{
+    LLVMAttributeIndex self_index = 1;
+    unsigned nonnull_kind = LLVMGetEnumAttributeKindForName("nonnull", 7);
+    LLVMAddAttributeAtIndex(fn, self_index, LLVMCreateEnumAttribute(llvm->context, nonnull_kind, 0));
+
+    // A class holding another class by value is unsized until that class' body is declared
+    LLVMTypeRef class_type = LLVMGetTypeByName2(llvm->context, class_symb->fully_qualified_name);
+    if (class_type == nullptr || !LLVMTypeIsSized(class_type))
+        return;
+
+    unsigned long long size = LLVMABISizeOfType(LLVMGetModuleDataLayout(llvm->module), class_type);
+    if (size == 0)
+        return;
+    unsigned dereferenceable_kind = LLVMGetEnumAttributeKindForName("dereferenceable", 15);
+    LLVMAddAttributeAtIndex(fn, self_index, LLVMCreateEnumAttribute(llvm->context, dereferenceable_kind, size));
+}
+
+// LLVM has no function-level flatten; like clang, calls made directly from a @flatten function are marked
+// alwaysinline instead. Callees that are @noinline are left alone.
+static void add_call_attributes(llvm_codegen_t* llvm, LLVMValueRef call, LLVMValueRef callee)
+{
+    if (!llvm->current_fn_flatten)
+        return;
+
+    unsigned noinline_kind = LLVMGetEnumAttributeKindForName("noinline", 8);
+    if (LLVMGetEnumAttributeAtIndex(callee, (LLVMAttributeIndex)LLVMAttributeFunctionIndex, noinline_kind) != nullptr)
+        return;
+
+    unsigned kind = LLVMGetEnumAttributeKindForName("alwaysinline", 12);
+    LLVMAddCallSiteAttribute(call, (LLVMAttributeIndex)LLVMAttributeFunctionIndex,
+        LLVMCreateEnumAttribute(llvm->context, kind, 0));
+}
+
+// Call a function or method declared in this module, using the calling convention of its declaration
+static LLVMValueRef build_direct_call(llvm_codegen_t* llvm, LLVMValueRef fn, LLVMValueRef* args, unsigned arg_count,
+    const char* name)
+{
+    LLVMValueRef call = LLVMBuildCall2(llvm->builder, LLVMGlobalGetValueType(fn), fn, args, arg_count, name);
+    LLVMSetInstructionCallConv(call, LLVMGetFunctionCallConv(fn));
+    return call;
+}
+
 // Destructor scope management functions
 static void destructible_var_destroy(destructible_var_t* var)
 {
     if (var == nullptr)
         return;
     free(var->name);
+    vec_deinit(&var->cleanup_dests);
     free(var);
 }
 
@@ -176,7 +524,7 @@ static void pop_destructor_scope(llvm_codegen_t* llvm)
 
 static symbol_t* find_destructor_method(symbol_t* class_symbol)
 {
-    if (class_symbol == nullptr || class_symbol->kind != SYMBOL_CLASS)
+    if (class_symbol == nullptr || !symbol_is_class(class_symbol))
         return nullptr;
 
     // Look for @destruct method in the class's symbol table
@@ -188,13 +536,66 @@ static symbol_t* find_destructor_method(symbol_t* class_symbol)
     return vec_get(methods, 0);
 }
 
-static void emit_destructor_call(llvm_codegen_t* llvm, destructible_var_t* var)
+static LLVMValueRef heap_array_field_ptr(llvm_codegen_t* llvm, LLVMValueRef array_addr, unsigned field,
+    const char* name)
 {
-    ast_type_t* type = var->type;
+    return LLVMBuildStructGEP2(llvm->builder, llvm->types.heap_array_type, array_addr, field, name);
+}
 
-    // Handle pointer types - get the pointee type
-    if (type->kind == AST_TYPE_POINTER)
-        type = type->data.pointer.pointee;
+static LLVMValueRef load_heap_array_field(llvm_codegen_t* llvm, LLVMValueRef array_addr, unsigned field,
+    const char* name)
+{
+    LLVMTypeRef field_type = field == HEAP_ARRAY_DATA ? LLVMPointerTypeInContext(llvm->context, 0) :
+        LLVMInt64TypeInContext(llvm->context);
+    return LLVMBuildLoad2(llvm->builder, field_type, heap_array_field_ptr(llvm, array_addr, field, ""), name);
+}
+
+static void emit_object_destruction(llvm_codegen_t* llvm, LLVMValueRef address, ast_type_t* type);
+
+// Destroy the elements of a heap array, if its element type has a destructor
+static void emit_heap_array_elements_destruction(llvm_codegen_t* llvm, LLVMValueRef array_addr,
+    ast_type_t* element_type)
+{
+    if (!ast_type_has_trait(element_type, TRAIT_EXPLICIT_DESTRUCTOR))
+        return;
+
+    LLVMTypeRef size_type = LLVMInt64TypeInContext(llvm->context);
+    LLVMValueRef length = load_heap_array_field(llvm, array_addr, HEAP_ARRAY_LENGTH, "length");
+    LLVMValueRef data = load_heap_array_field(llvm, array_addr, HEAP_ARRAY_DATA, "data");
+    LLVMValueRef zero = LLVMConstInt(size_type, 0, false);
+
+    LLVMBasicBlockRef entry_block = LLVMGetInsertBlock(llvm->builder);
+    LLVMBasicBlockRef loop_block = LLVMAppendBasicBlock(llvm->current_function, "heap_array.destroy");
+    LLVMBasicBlockRef done_block = LLVMAppendBasicBlock(llvm->current_function, "heap_array.destroy.done");
+    LLVMBuildCondBr(llvm->builder, LLVMBuildICmp(llvm->builder, LLVMIntNE, length, zero, "not_empty"), loop_block,
+        done_block);
+
+    LLVMPositionBuilderAtEnd(llvm->builder, loop_block);
+    LLVMValueRef index = LLVMBuildPhi(llvm->builder, size_type, "index");
+    LLVMValueRef element = LLVMBuildInBoundsGEP2(llvm->builder, llvm_type(&llvm->types, element_type), data, &index,
+        1, "element");
+    emit_object_destruction(llvm, element, element_type);
+    LLVMValueRef next = LLVMBuildNUWAdd(llvm->builder, index, LLVMConstInt(size_type, 1, false), "next");
+    LLVMBasicBlockRef latch_block = LLVMGetInsertBlock(llvm->builder);  // nested arrays add blocks of their own
+    LLVMBuildCondBr(llvm->builder, LLVMBuildICmp(llvm->builder, LLVMIntULT, next, length, "more"), loop_block,
+        done_block);
+    LLVMAddIncoming(index, (LLVMValueRef[]){ zero, next }, (LLVMBasicBlockRef[]){ entry_block, latch_block }, 2);
+
+    LLVMPositionBuilderAtEnd(llvm->builder, done_block);
+}
+
+// Destroy the object at address of the given type: call the @destruct method of a class, or destroy the elements of
+// a heap array and free its storage
+static void emit_object_destruction(llvm_codegen_t* llvm, LLVMValueRef address, ast_type_t* type)
+{
+    if (type->kind == AST_TYPE_HEAP_ARRAY)
+    {
+        emit_heap_array_elements_destruction(llvm, address, type->data.heap_array.element_type);
+        LLVMValueRef free_fn = get_free_function(llvm);
+        LLVMValueRef args[] = { load_heap_array_field(llvm, address, HEAP_ARRAY_DATA, "data") };
+        build_direct_call(llvm, free_fn, args, 1, "");
+        return;
+    }
 
     // Only user types (classes) can have destructors
     if (type->kind != AST_TYPE_CLASS)
@@ -212,33 +613,20 @@ static void emit_destructor_call(llvm_codegen_t* llvm, destructible_var_t* var)
     if (destructor_fn == nullptr)
         return;
 
-    // Call destructor with pointer to the variable
-    LLVMValueRef args[] = { var->alloca };
-    LLVMBuildCall2(llvm->builder, LLVMGlobalGetValueType(destructor_fn), destructor_fn, args, 1, "");
+    // Call destructor with pointer to the object
+    LLVMValueRef args[] = { address };
+    build_direct_call(llvm, destructor_fn, args, 1, "");
 }
 
-static void emit_scope_destructors(llvm_codegen_t* llvm, destructor_scope_t* scope)
+static void emit_destructor_call(llvm_codegen_t* llvm, destructible_var_t* var)
 {
-    if (scope == nullptr)
-        return;
+    ast_type_t* type = var->type;
 
-    // Destroy in reverse order (LIFO)
-    for (size_t i = vec_size(&scope->variables); i > 0; --i)
-    {
-        destructible_var_t* var = vec_get(&scope->variables, i - 1);
-        emit_destructor_call(llvm, var);
-    }
-}
+    // Handle pointer types - get the pointee type
+    if (type->kind == AST_TYPE_POINTER)
+        type = type->data.pointer.pointee;
 
-static void emit_all_scope_destructors(llvm_codegen_t* llvm)
-{
-    // Emit destructors for all scopes (used before return)
-    destructor_scope_t* scope = llvm->destructor_scope;
-    while (scope != nullptr)
-    {
-        emit_scope_destructors(llvm, scope);
-        scope = scope->parent;
-    }
+    emit_object_destruction(llvm, var->alloca, type);
 }
 
 static void register_variable_for_destruction(llvm_codegen_t* llvm, const char* name, LLVMValueRef alloca,
@@ -254,29 +642,831 @@ static void register_variable_for_destruction(llvm_codegen_t* llvm, const char*
     var->name = strdup(name);
     var->alloca = alloca;
     var->type = type;
+    var->cleanup_block = nullptr;
+    var->cleanup_dests = VEC_INIT(free);
 
     vec_push(&llvm->destructor_scope->variables, var);
 }
 
-// Register builtin functions that are implemented in the runtime
-static void register_builtins(llvm_codegen_t* llvm)
+// What a loop may modify: variables that are assigned, incremented/decremented, have their address taken or are
+// (re)declared in it, nested loops included. Also the views it subscripts or calls len() on by name.
+typedef struct loop_writes
+{
+    ast_node_t* loop;
+    hash_table_t written;    // variable name (char*) -> nullptr
+    hash_table_t view_refs;  // variable name (char*) -> nullptr
+    bool counter_written;    // for loops: the condition or body may modify the variable the post statement steps
+} loop_writes_t;
+
+// Finds the writes of all loops of a function in one pass over its body, before any of it is emitted. Nodes are
+// marked in the innermost loop around them, whose sets are merged into the enclosing loop's when it ends.
+struct loop_write_finder
+{
+    ast_visitor_t base;
+    vec_t loops;                 // loop_writes_t*, in the order the loops start, which is the order they are emitted
+    vec_t open_loops;            // loop_writes_t* around the node being visited, innermost last
+    hash_table_t address_taken;  // variable name (char*) -> nullptr, anywhere in the function
+    size_t next_loop;            // index in loops of the next loop to be emitted
+};
+
+// The variable expr refers to, looking through parentheses; nullptr if it is not a variable
+static const char* referenced_name(ast_expr_t* expr)
+{
+    while (AST_KIND(expr) == AST_EXPR_PAREN)
+        expr = ((ast_paren_expr_t*)expr)->expr;
+    return AST_KIND(expr) == AST_EXPR_REF ? ((ast_ref_expr_t*)expr)->name : nullptr;
+}
+
+// The variable a for loop's post statement increments or decrements, if that is all the statement does
+static const char* loop_counter_name(ast_for_stmt_t* stmt)
+{
+    if (stmt->post_stmt == nullptr || AST_KIND(stmt->post_stmt) != AST_STMT_INC_DEC)
+        return nullptr;
+    return referenced_name(((ast_inc_dec_stmt_t*)stmt->post_stmt)->operand);
+}
+
+static void mark_name(hash_table_t* names, ast_expr_t* expr)
+{
+    const char* name = referenced_name(expr);
+    if (name != nullptr && !hash_table_contains(names, name))
+        hash_table_insert(names, name, nullptr);
+}
+
+static loop_writes_t* innermost_loop(loop_write_finder_t* finder)
+{
+    size_t count = vec_size(&finder->open_loops);
+    return count > 0 ? vec_get(&finder->open_loops, count - 1) : nullptr;
+}
+
+static void mark_written(loop_write_finder_t* finder, ast_expr_t* expr)
+{
+    loop_writes_t* loop = innermost_loop(finder);
+    if (loop != nullptr)
+        mark_name(&loop->written, expr);
+}
+
+static void mark_view_ref(loop_write_finder_t* finder, ast_expr_t* expr)
+{
+    loop_writes_t* loop = innermost_loop(finder);
+    if (loop == nullptr || AST_KIND(expr) != AST_EXPR_REF || expr->type->kind != AST_TYPE_VIEW)
+        return;
+    const char* name = ((ast_ref_expr_t*)expr)->name;
+    if (!hash_table_contains(&loop->view_refs, name))
+        hash_table_insert(&loop->view_refs, name, nullptr);
+}
+
+static void merge_names(hash_table_t* names, hash_table_t* from)
+{
+    hash_table_iter_t iter;
+    for (hash_table_iter_init(&iter, from); hash_table_iter_has_elem(&iter); hash_table_iter_next(&iter))
+    {
+        const char* name = hash_table_iter_current(&iter)->key;
+        if (!hash_table_contains(names, name))
+            hash_table_insert(names, name, nullptr);
+    }
+}
+
+static void begin_loop_writes(loop_write_finder_t* finder, ast_node_t* loop_node)
+{
+    loop_writes_t* loop = malloc(sizeof(*loop));
+    *loop = (loop_writes_t){
+        .loop = loop_node,
+        .written = HASH_TABLE_INIT(nullptr),
+        .view_refs = HASH_TABLE_INIT(nullptr),
+    };
+    vec_push(&finder->loops, loop);
+    vec_push(&finder->open_loops, loop);
+}
+
+static void end_loop_writes(loop_write_finder_t* finder)
+{
+    loop_writes_t* loop = vec_pop(&finder->open_loops);
+    loop_writes_t* parent = innermost_loop(finder);
+    if (parent == nullptr)
+        return;
+    merge_names(&parent->written, &loop->written);
+    merge_names(&parent->view_refs, &loop->view_refs);
+}
+
+static void find_writes_bin_op(void* self_, ast_bin_op_t* bin_op, void* out_)
+{
+    if (token_type_is_assignment_op(bin_op->op))
+        mark_written(self_, bin_op->lhs);
+    ast_visitor_visit(self_, bin_op->lhs, out_);
+    ast_visitor_visit(self_, bin_op->rhs, out_);
+}
+
+static void find_writes_unary_op(void* self_, ast_unary_op_t* unary, void* out_)
+{
+    loop_write_finder_t* finder = self_;
+    if (unary->op == TOKEN_AMPERSAND)
+    {
+        mark_written(finder, unary->expr);
+        mark_name(&finder->address_taken, unary->expr);
+    }
+    ast_visitor_visit(self_, unary->expr, out_);
+}
+
+static void find_writes_inc_dec_stmt(void* self_, ast_inc_dec_stmt_t* stmt, void* out_)
+{
+    mark_written(self_, stmt->operand);
+    ast_visitor_visit(self_, stmt->operand, out_);
+}
+
+static void find_writes_var_decl(void* self_, ast_var_decl_t* var, void* out_)
+{
+    loop_writes_t* loop = innermost_loop(self_);
+    if (loop != nullptr && !hash_table_contains(&loop->written, var->name))
+        hash_table_insert(&loop->written, var->name, nullptr);
+    if (var->init_expr != nullptr)
+        ast_visitor_visit(self_, var->init_expr, out_);
+}
+
+static void find_writes_array_subscript(void* self_, ast_array_subscript_t* subscript, void* out_)
+{
+    mark_view_ref(self_, subscript->array);
+    ast_visitor_visit(self_, subscript->array, out_);
+    ast_visitor_visit(self_, subscript->index, out_);
+}
+
+static void find_writes_method_call(void* self_, ast_method_call_t* call, void* out_)
+{
+    mark_view_ref(self_, call->instance);
+    ast_visitor_visit(self_, call->instance, out_);
+    for (size_t i = 0; i < vec_size(&call->arguments); ++i)
+        ast_visitor_visit(self_, vec_get(&call->arguments, i), out_);
+}
+
+static void find_writes_for_stmt(void* self_, ast_for_stmt_t* stmt, void* out_)
+{
+    begin_loop_writes(self_, AST_NODE(stmt));
+    loop_writes_t* loop = innermost_loop(self_);
+    if (stmt->cond_expr != nullptr)
+        ast_visitor_visit(self_, stmt->cond_expr, out_);
+    ast_visitor_visit(self_, stmt->body, out_);
+
+    // The init and post statements write the counter themselves, so it is looked up before they are visited
+    const char* counter = loop_counter_name(stmt);
+    loop->counter_written = counter == nullptr || hash_table_contains(&loop->written, counter);
+
+    if (stmt->init_stmt != nullptr)
+        ast_visitor_visit(self_, stmt->init_stmt, out_);
+    if (stmt->post_stmt != nullptr)
+        ast_visitor_visit(self_, stmt->post_stmt, out_);
+    end_loop_writes(self_);
+}
+
+static void find_writes_while_stmt(void* self_, ast_while_stmt_t* stmt, void* out_)
+{
+    begin_loop_writes(self_, AST_NODE(stmt));
+    ast_visitor_visit(self_, stmt->condition, out_);
+    ast_visitor_visit(self_, stmt->body, out_);
+    end_loop_writes(self_);
+}
+
+static void loop_writes_destroy(void* loop_)
+{
+    loop_writes_t* loop = loop_;
+    hash_table_deinit(&loop->written);
+    hash_table_deinit(&loop->view_refs);
+    free(loop);
+}
+
+static loop_write_finder_t* loop_write_finder_create(ast_stmt_t* fn_body)
+{
+    loop_write_finder_t* finder = malloc(sizeof(*finder));
+    ast_visitor_init(&finder->base);
+    finder->base.visit_bin_op = find_writes_bin_op;
+    finder->base.visit_unary_op = find_writes_unary_op;
+    finder->base.visit_inc_dec_stmt = find_writes_inc_dec_stmt;
+    finder->base.visit_var_decl = find_writes_var_decl;
+    finder->base.visit_array_subscript = find_writes_array_subscript;
+    finder->base.visit_method_call = find_writes_method_call;
+    finder->base.visit_for_stmt = find_writes_for_stmt;
+    finder->base.visit_while_stmt = find_writes_while_stmt;
+    finder->loops = VEC_INIT(loop_writes_destroy);
+    finder->open_loops = VEC_INIT(nullptr);
+    finder->address_taken = HASH_TABLE_INIT(nullptr);
+    finder->next_loop = 0;
+    if (fn_body != nullptr)
+        ast_visitor_visit(finder, fn_body, nullptr);
+    return finder;
+}
+
+static void loop_write_finder_destroy(loop_write_finder_t* finder)
+{
+    vec_deinit(&finder->loops);
+    vec_deinit(&finder->open_loops);
+    hash_table_deinit(&finder->address_taken);
+    free(finder);
+}
+
+// The writes found for loop, which is emitted after the loops found before it; loops in unreachable code may have
+// been skipped
+static loop_writes_t* find_loop_writes(loop_write_finder_t* finder, ast_node_t* loop)
+{
+    while (true)
+    {
+        panic_if(finder->next_loop >= vec_size(&finder->loops));
+        loop_writes_t* writes = vec_get(&finder->loops, finder->next_loop++);
+        if (writes->loop == loop)
+            return writes;
+    }
+}
+
+// Load the length and data pointer of views used by a loop once, in the loop preheader, when the loop can not
+// modify the view itself. Writes through the view's data pointer do not affect either.
+static void hoist_loop_invariant_views(llvm_codegen_t* llvm, loop_writes_t* writes, loop_context_t* loop_ctx)
+{
+    hash_table_iter_t iter;
+    for (hash_table_iter_init(&iter, &writes->view_refs); hash_table_iter_has_elem(&iter); hash_table_iter_next(&iter))
+    {
+        // Views whose address is taken anywhere in the function could be modified through a pointer
+        const char* name = hash_table_iter_current(&iter)->key;
+        LLVMValueRef view_addr = hash_table_find(llvm->symbols, name);
+        if (view_addr == nullptr || hash_table_contains(&writes->written, name) ||
+            hash_table_contains(llvm->hoisted_views, name) ||
+            hash_table_contains(&llvm->loop_writes->address_taken, name))
+            continue;
+
+        // Views are laid out as {i64 length, ptr data}
+        LLVMTypeRef view_type = llvm->types.view_type;
+        LLVMValueRef length_ptr = LLVMBuildStructGEP2(llvm->builder, view_type, view_addr, 0, "length_ptr");
+        LLVMValueRef data_ptr = LLVMBuildStructGEP2(llvm->builder, view_type, view_addr, 1, "data_ptr");
+
+        hoisted_view_t* hoisted = malloc(sizeof(*hoisted));
+        hoisted->length = LLVMBuildLoad2(llvm->builder, LLVMInt64TypeInContext(llvm->context), length_ptr,
+            ssprintf("%s.len", name));
+        hoisted->data = LLVMBuildLoad2(llvm->builder, LLVMPointerTypeInContext(llvm->context, 0), data_ptr,
+            ssprintf("%s.data", name));
+        hash_table_insert(llvm->hoisted_views, name, hoisted);
+        vec_push(&loop_ctx->hoisted_views, strdup(name));
+    }
+}
+
+static hoisted_view_t* find_hoisted_view(llvm_codegen_t* llvm, ast_expr_t* expr)
+{
+    if (llvm->hoisted_views == nullptr || AST_KIND(expr) != AST_EXPR_REF || expr->type->kind != AST_TYPE_VIEW)
+        return nullptr;
+    return hash_table_find(llvm->hoisted_views, ((ast_ref_expr_t*)expr)->name);
+}
+
+// Build a loop property such as !{!"llvm.loop.unroll.count", i32 4}; value may be nullptr for flag properties
+static LLVMMetadataRef build_loop_property(llvm_codegen_t* llvm, const char* name, LLVMValueRef value)
+{
+    LLVMMetadataRef operands[] = {
+        LLVMMDStringInContext2(llvm->context, name, strlen(name)),
+        value != nullptr ? LLVMValueAsMetadata(value) : nullptr
+    };
+    return LLVMMDNodeInContext2(llvm->context, operands, value != nullptr ? 2 : 1);
+}
+
+// Signed overflow wraps like unsigned overflow, so arithmetic is only emitted with nsw where it can not overflow. That
+// is the case for the counter of `for (...; i < n; i++)` when only the post statement modifies it: i < n <= max before
+// every increment. Likewise for i > n and i--. The nsw flag lets LLVM widen such a counter once instead of extending it
+// at every array access.
+static bool loop_counter_cannot_wrap(llvm_codegen_t* llvm, ast_for_stmt_t* stmt, loop_writes_t* writes)
+{
+    const char* counter = loop_counter_name(stmt);
+    if (counter == nullptr || writes->counter_written ||
+        hash_table_contains(&llvm->loop_writes->address_taken, counter))
+        return false;
+
+    ast_inc_dec_stmt_t* step = (ast_inc_dec_stmt_t*)stmt->post_stmt;
+    if (!ast_type_is_signed(step->operand->type) || stmt->cond_expr == nullptr ||
+        AST_KIND(stmt->cond_expr) != AST_EXPR_BIN_OP)
+        return false;
+
+    ast_bin_op_t* cond = (ast_bin_op_t*)stmt->cond_expr;
+    if (cond->lhs->type != step->operand->type || cond->rhs->type != step->operand->type)
+        return false;
+
+    // The counter has to be compared against the bound it is stepped towards
+    const char* lhs = referenced_name(cond->lhs);
+    const char* rhs = referenced_name(cond->rhs);
+    token_type_t counter_first = step->increment ? TOKEN_LT : TOKEN_GT;
+    token_type_t bound_first = step->increment ? TOKEN_GT : TOKEN_LT;
+    return (cond->op == counter_first && lhs != nullptr && strcmp(lhs, counter) == 0) ||
+        (cond->op == bound_first && rhs != nullptr && strcmp(rhs, counter) == 0);
+}
+
+// Create the llvm.loop metadata node identifying a loop, carrying the loop's unroll/vectorize hints
+static LLVMValueRef build_loop_id(llvm_codegen_t* llvm, ast_loop_hints_t* hints)
+{
+    LLVMMetadataRef properties[4];
+    size_t count = 0;
+    LLVMTypeRef i1 = LLVMInt1TypeInContext(llvm->context);
+    LLVMTypeRef i32 = LLVMInt32TypeInContext(llvm->context);
+
+    // The first operand of a loop ID is the node itself; use a placeholder until the node is created
+    LLVMMetadataRef placeholder = LLVMTemporaryMDNode(llvm->context, nullptr, 0);
+    properties[count++] = placeholder;
+
+    if (hints->unroll == AST_LOOP_UNROLL_FULL)
+        properties[count++] = build_loop_property(llvm, "llvm.loop.unroll.full", nullptr);
+    else if (hints->unroll == AST_LOOP_UNROLL_COUNT && hints->unroll_count == 1)
+        properties[count++] = build_loop_property(llvm, "llvm.loop.unroll.disable", nullptr);
+    else if (hints->unroll == AST_LOOP_UNROLL_COUNT)
+    {
+        properties[count++] = build_loop_property(llvm, "llvm.loop.unroll.count",
+            LLVMConstInt(i32, hints->unroll_count, false));
+    }
+
+    if (hints->vectorize != AST_LOOP_VECTORIZE_DEFAULT)
+    {
+        properties[count++] = build_loop_property(llvm, "llvm.loop.vectorize.enable",
+            LLVMConstInt(i1, hints->vectorize == AST_LOOP_VECTORIZE_ENABLE, false));
+    }
+
+    // Sema warns about widths that are not a power of two; they are dropped here
+    uint32_t width = hints->vectorize_width;
+    if (hints->vectorize == AST_LOOP_VECTORIZE_ENABLE && width != 0 && (width & (width - 1)) == 0)
+        properties[count++] = build_loop_property(llvm, "llvm.loop.vectorize.width", LLVMConstInt(i32, width, false));
+
+    LLVMMetadataRef loop_id = LLVMMDNodeInContext2(llvm->context, properties, count);
+    LLVMMetadataReplaceAllUsesWith(placeholder, loop_id);
+    return LLVMMetadataAsValue(llvm->context, loop_id);
+}
+
+// Attach the loop's metadata to a backedge branch
+static void set_loop_metadata(llvm_codegen_t* llvm, LLVMValueRef branch, loop_context_t* loop_ctx)
+{
+    LLVMSetMetadata(branch, LLVMGetMDKindIDInContext(llvm->context, "llvm.loop", 9), loop_ctx->loop_id);
+}
+
+// Leave a loop: forget views hoisted by it and restore the parent loop context
+static void end_loop(llvm_codegen_t* llvm, loop_context_t* loop_ctx)
+{
+    for (size_t i = 0; i < vec_size(&loop_ctx->hoisted_views); ++i)
+        hash_table_remove(llvm->hoisted_views, vec_get(&loop_ctx->hoisted_views, i));
+    vec_deinit(&loop_ctx->hoisted_views);
+
+    llvm->loop_context = loop_ctx->parent;
+}
+
+// Shared cleanup blocks: every destructible variable gets at most one block calling its destructor, entered by all
+// exits that leave its scope while it is alive. Control continues in the cleanup block of the previously declared
+// variable until the exit's destination is reached, which the blocks select by the cleanup destination slot.
+
+// The variable destroyed first when leaving the scopes inside target_scope, if any
+static destructible_var_t* find_first_cleanup(destructor_scope_t* scope, destructor_scope_t* target_scope)
+{
+    for (; scope != target_scope; scope = scope->parent)
+    {
+        if (vec_size(&scope->variables) > 0)
+            return vec_last(&scope->variables);
+    }
+    return nullptr;
+}
+
+static bool has_pending_destructors(llvm_codegen_t* llvm)
+{
+    return find_first_cleanup(llvm->destructor_scope, nullptr) != nullptr;
+}
+
+// Create an alloca in the entry block, so it is allocated once however often the current block runs
+static LLVMValueRef build_entry_alloca(llvm_codegen_t* llvm, LLVMTypeRef type, const char* name)
+{
+    LLVMBasicBlockRef entry_block = LLVMGetEntryBasicBlock(llvm->current_function);
+    LLVMBuilderRef builder = LLVMCreateBuilderInContext(llvm->context);
+    LLVMValueRef first = LLVMGetFirstInstruction(entry_block);
+    if (first != nullptr)
+        LLVMPositionBuilderBefore(builder, first);
+    else
+        LLVMPositionBuilderAtEnd(builder, entry_block);
+
+    LLVMValueRef alloca = LLVMBuildAlloca(builder, type, name);
+    LLVMDisposeBuilder(builder);
+    return alloca;
+}
+
+static LLVMValueRef get_cleanup_dest_slot(llvm_codegen_t* llvm)
+{
+    if (llvm->cleanup_dest_slot == nullptr)
+    {
+        llvm->cleanup_dest_slot = build_entry_alloca(llvm, LLVMInt32TypeInContext(llvm->context),
+            "cleanup.dest.slot");
+    }
+    return llvm->cleanup_dest_slot;
+}
+
+static LLVMBasicBlockRef get_cleanup_block(llvm_codegen_t* llvm, destructible_var_t* var)
+{
+    if (var->cleanup_block == nullptr)
+        var->cleanup_block = LLVMAppendBasicBlock(llvm->current_function, "cleanup");
+    return var->cleanup_block;
+}
+
+// Slot value of exits to block; all exits to the same block share it
+static unsigned get_cleanup_dest_index(llvm_codegen_t* llvm, LLVMBasicBlockRef block)
+{
+    for (size_t i = 0; i < vec_size(&llvm->cleanup_dest_blocks); ++i)
+    {
+        if (vec_get(&llvm->cleanup_dest_blocks, i) == block)
+            return (unsigned)i;
+    }
+
+    vec_push(&llvm->cleanup_dest_blocks, block);
+    return (unsigned)vec_size(&llvm->cleanup_dest_blocks) - 1;
+}
+
+// Route dest through var's cleanup block, unless it already is
+static void add_cleanup_dest(destructible_var_t* var, cleanup_dest_t* dest)
+{
+    for (size_t i = 0; i < vec_size(&var->cleanup_dests); ++i)
+    {
+        if (((cleanup_dest_t*)vec_get(&var->cleanup_dests, i))->index == dest->index)
+            return;
+    }
+
+    cleanup_dest_t* added = malloc(sizeof(cleanup_dest_t));
+    *added = *dest;
+    vec_push(&var->cleanup_dests, added);
+}
+
+// Branch to the cleanup block of first, continuing in block once the variables inside target_scope are destroyed
+static void emit_cleanup_entry(llvm_codegen_t* llvm, destructible_var_t* first, destructor_scope_t* target_scope,
+    LLVMBasicBlockRef block, loop_context_t* backedge_of)
+{
+    cleanup_dest_t dest = {
+        .index = get_cleanup_dest_index(llvm, block),
+        .block = block,
+        .scope = target_scope,
+        .backedge_of = backedge_of,
+    };
+    add_cleanup_dest(first, &dest);
+
+    LLVMTypeRef i32_type = LLVMInt32TypeInContext(llvm->context);
+    LLVMBuildStore(llvm->builder, LLVMConstInt(i32_type, dest.index, false), get_cleanup_dest_slot(llvm));
+    LLVMBuildBr(llvm->builder, get_cleanup_block(llvm, first));
+}
+
+// Leave the scopes inside target_scope and continue in block, destroying their variables on the way
+static void emit_scope_exit(llvm_codegen_t* llvm, destructor_scope_t* target_scope, LLVMBasicBlockRef block,
+    loop_context_t* backedge_of)
+{
+    destructible_var_t* first = find_first_cleanup(llvm->destructor_scope, target_scope);
+    if (first != nullptr)
+    {
+        emit_cleanup_entry(llvm, first, target_scope, block, backedge_of);
+        return;
+    }
+
+    LLVMValueRef branch = LLVMBuildBr(llvm->builder, block);
+    if (backedge_of != nullptr)
+        set_loop_metadata(llvm, branch, backedge_of);
+}
+
+// Emit the cleanup block of the variable at index in scope: destroy it, then branch on to the next cleanup block or
+// to the destination, switching on the cleanup destination slot when exits diverge
+static void emit_cleanup_block(llvm_codegen_t* llvm, destructor_scope_t* scope, size_t index)
+{
+    destructible_var_t* var = vec_get(&scope->variables, index);
+    LLVMPositionBuilderAtEnd(llvm->builder, var->cleanup_block);
+    emit_destructor_call(llvm, var);
+
+    size_t dest_count = vec_size(&var->cleanup_dests);
+    LLVMBasicBlockRef* targets = malloc(dest_count * sizeof(LLVMBasicBlockRef));
+    loop_context_t* backedge_of = nullptr;
+    bool same_target = true;
+    for (size_t i = 0; i < dest_count; ++i)
+    {
+        cleanup_dest_t* dest = vec_get(&var->cleanup_dests, i);
+        destructible_var_t* next = index > 0 ? vec_get(&scope->variables, index - 1) :
+            find_first_cleanup(scope->parent, dest->scope);
+        if (next != nullptr)
+        {
+            add_cleanup_dest(next, dest);
+            targets[i] = get_cleanup_block(llvm, next);
+        }
+        else
+        {
+            targets[i] = dest->block;
+            if (dest->backedge_of != nullptr)
+                backedge_of = dest->backedge_of;
+        }
+        same_target = same_target && targets[i] == targets[0];
+    }
+
+    LLVMValueRef terminator;
+    if (same_target)
+    {
+        terminator = LLVMBuildBr(llvm->builder, targets[0]);
+    }
+    else
+    {
+        LLVMTypeRef i32_type = LLVMInt32TypeInContext(llvm->context);
+        LLVMValueRef dest_index = LLVMBuildLoad2(llvm->builder, i32_type, get_cleanup_dest_slot(llvm),
+            "cleanup.dest");
+        terminator = LLVMBuildSwitch(llvm->builder, dest_index, targets[dest_count - 1], (unsigned)dest_count - 1);
+        for (size_t i = 0; i + 1 < dest_count; ++i)
+        {
+            cleanup_dest_t* dest = vec_get(&var->cleanup_dests, i);
+            LLVMAddCase(terminator, LLVMConstInt(i32_type, dest->index, false), targets[i]);
+        }
+    }
+    if (backedge_of != nullptr)
+        set_loop_metadata(llvm, terminator, backedge_of);
+
+    free(targets);
+}
+
+static bool is_reachable_block(llvm_codegen_t* llvm, LLVMBasicBlockRef block)
+{
+    return block == LLVMGetEntryBasicBlock(llvm->current_function) ||
+        LLVMGetFirstUse(LLVMBasicBlockAsValue(block)) != nullptr;
+}
+
+// End the current destructor scope. When control reaches the end of the scope, variables declared since the last
+// exit are destroyed inline and the rest through the cleanup blocks the exits already created.
+static void end_destructor_scope(llvm_codegen_t* llvm)
+{
+    destructor_scope_t* scope = llvm->destructor_scope;
+    LLVMBasicBlockRef insert_block = LLVMGetInsertBlock(llvm->builder);
+    LLVMBasicBlockRef cont_block = nullptr;
+
+    if (LLVMGetBasicBlockTerminator(insert_block) == nullptr && is_reachable_block(llvm, insert_block))
+    {
+        size_t i = vec_size(&scope->variables);
+        for (; i > 0 && ((destructible_var_t*)vec_get(&scope->variables, i - 1))->cleanup_block == nullptr; --i)
+            emit_destructor_call(llvm, vec_get(&scope->variables, i - 1));
+        insert_block = LLVMGetInsertBlock(llvm->builder);  // destroying array elements loops over them in new blocks
+
+        if (i > 0)
+        {
+            cont_block = LLVMAppendBasicBlock(llvm->current_function, "cleanup.cont");
+            emit_cleanup_entry(llvm, vec_get(&scope->variables, i - 1), scope->parent, cont_block, nullptr);
+        }
+    }
+
+    // Later variables forward their exits to earlier ones, so emit the cleanup blocks last to first
+    for (size_t i = vec_size(&scope->variables); i > 0; --i)
+    {
+        if (((destructible_var_t*)vec_get(&scope->variables, i - 1))->cleanup_block != nullptr)
+            emit_cleanup_block(llvm, scope, i - 1);
+    }
+
+    LLVMPositionBuilderAtEnd(llvm->builder, cont_block != nullptr ? cont_block : insert_block);
+    pop_destructor_scope(llvm);
+}
+
+// Reset the cleanup state for a function about to be generated
+static void begin_function_cleanups(llvm_codegen_t* llvm)
+{
+    llvm->cleanup_dest_slot = nullptr;
+    llvm->cleanup_dest_blocks = VEC_INIT(nullptr);
+    llvm->return_block = nullptr;
+    llvm->return_slot = nullptr;
+}
+
+// Emit the return shared by all returns that ran destructors, if any did
+static void end_function_cleanups(llvm_codegen_t* llvm)
+{
+    vec_deinit(&llvm->cleanup_dest_blocks);
+    if (llvm->return_block == nullptr)
+        return;
+
+    LLVMPositionBuilderAtEnd(llvm->builder, llvm->return_block);
+    if (llvm->return_slot != nullptr)
+    {
+        LLVMValueRef value = LLVMBuildLoad2(llvm->builder, LLVMGetAllocatedType(llvm->return_slot),
+            llvm->return_slot, "retval");
+        LLVMBuildRet(llvm->builder, value);
+    }
+    else
+    {
+        LLVMBuildRetVoid(llvm->builder);
+    }
+}
+
+// Register builtin functions that are implemented in the runtime
+static void register_builtins(llvm_codegen_t* llvm)
+{
+    // printI32(i32) -> void
+    LLVMTypeRef print_i32_param_types[] = { LLVMInt32TypeInContext(llvm->context) };
+    LLVMTypeRef print_i32_type = LLVMFunctionType(LLVMVoidTypeInContext(llvm->context), print_i32_param_types, 1,
+        false);
+    LLVMAddFunction(llvm->module, "printI32", print_i32_type);
+}
+
+// Helper function to set debug location for the next instruction(s)
+static void set_debug_location(llvm_codegen_t* llvm, ast_node_t* node)
+{
+    if (llvm->di_builder == nullptr || llvm->current_di_scope == nullptr)
+        return;
+
+    LLVMMetadataRef debug_loc = LLVMDIBuilderCreateDebugLocation(llvm->context, (unsigned int)node->source_begin.line,
+        (unsigned int)node->source_begin.column, llvm->current_di_scope, nullptr);
+    LLVMSetCurrentDebugLocation2(llvm->builder, debug_loc);
+}
+
+// DWARF base type encodings (DW_ATE_*)
+enum
+{
+    DWARF_ENCODING_BOOLEAN = 0x02,
+    DWARF_ENCODING_FLOAT = 0x04,
+    DWARF_ENCODING_SIGNED = 0x05,
+    DWARF_ENCODING_UNSIGNED = 0x08,
+};
+
+static LLVMMetadataRef di_type(llvm_codegen_t* llvm, ast_type_t* type);
+
+// Member of a struct debug type laid out like the LLVM struct struct_type
+static LLVMMetadataRef di_member(llvm_codegen_t* llvm, LLVMMetadataRef scope, LLVMTypeRef struct_type, unsigned index,
+    const char* name, LLVMMetadataRef member_type)
+{
+    LLVMTargetDataRef layout = LLVMGetModuleDataLayout(llvm->module);
+    LLVMTypeRef element_type = LLVMStructGetTypeAtIndex(struct_type, index);
+    return LLVMDIBuilderCreateMemberType(llvm->di_builder, scope, name, strlen(name), llvm->di_file, 0,
+        LLVMSizeOfTypeInBits(layout, element_type), LLVMABIAlignmentOfType(layout, element_type) * 8,
+        LLVMOffsetOfElement(layout, struct_type, index) * 8, LLVMDIFlagZero, member_type);
+}
+
+// Struct debug type for a builtin struct (strings, views and heap arrays) with the given field names and types
+static LLVMMetadataRef di_builtin_struct_type(llvm_codegen_t* llvm, ast_type_t* type, const char** field_names,
+    LLVMMetadataRef* field_types, unsigned field_count)
+{
+    LLVMTargetDataRef layout = LLVMGetModuleDataLayout(llvm->module);
+    LLVMTypeRef struct_type = llvm_type(&llvm->types, type);
+    const char* name = ast_type_string(type);
+    LLVMMetadataRef members[3];
+    panic_if(field_count > 3);
+    for (unsigned i = 0; i < field_count; ++i)
+        members[i] = di_member(llvm, llvm->di_compile_unit, struct_type, i, field_names[i], field_types[i]);
+    return LLVMDIBuilderCreateStructType(llvm->di_builder, llvm->di_compile_unit, name, strlen(name), llvm->di_file,
+        0, LLVMSizeOfTypeInBits(layout, struct_type), LLVMABIAlignmentOfType(layout, struct_type) * 8, LLVMDIFlagZero,
+        nullptr, members, field_count, 0, nullptr, "", 0);
+}
+
+// Classes may refer to themselves through pointers, so a class is first cached as a temporary forward declaration
+// that is replaced once its members are known
+static LLVMMetadataRef di_class_type(llvm_codegen_t* llvm, symbol_t* class_symb)
+{
+    LLVMMetadataRef cached = hash_table_find(llvm->di_class_types, class_symb->fully_qualified_name);
+    if (cached != nullptr)
+        return cached;
+
+    class_layout_t* class_layout = hash_table_find(&llvm->class_layouts, class_symb->fully_qualified_name);
+    if (class_layout == nullptr)
+        return nullptr;
+
+    LLVMTargetDataRef layout = LLVMGetModuleDataLayout(llvm->module);
+    LLVMTypeRef struct_type = LLVMGetTypeByName2(llvm->context, class_symb->fully_qualified_name);
+    const char* name = class_symb->name;
+    const char* unique_id = class_symb->fully_qualified_name;
+    uint64_t size_bits = LLVMSizeOfTypeInBits(layout, struct_type);
+    uint32_t align_bits = LLVMABIAlignmentOfType(layout, struct_type) * 8;
+    unsigned line = class_symb->ast != nullptr ? (unsigned)class_symb->ast->source_begin.line : 0;
+
+    const unsigned dw_tag_structure_type = 0x13;
+    LLVMMetadataRef forward = LLVMDIBuilderCreateReplaceableCompositeType(llvm->di_builder, dw_tag_structure_type,
+        name, strlen(name), llvm->di_compile_unit, llvm->di_file, line, 0, size_bits, align_bits, LLVMDIFlagZero,
+        unique_id, strlen(unique_id));
+    hash_table_insert(llvm->di_class_types, class_symb->fully_qualified_name, forward);
+
+    size_t member_count = vec_size(&class_layout->member_names);
+    LLVMMetadataRef* members = malloc((member_count + 1) * sizeof(LLVMMetadataRef));
+    for (size_t i = 0; i < member_count; ++i)
+    {
+        members[i] = di_member(llvm, forward, struct_type, (unsigned)i, vec_get(&class_layout->member_names, i),
+            di_type(llvm, vec_get(&class_layout->member_types, i)));
+    }
+
+    LLVMMetadataRef class_type = LLVMDIBuilderCreateStructType(llvm->di_builder, llvm->di_compile_unit, name,
+        strlen(name), llvm->di_file, line, size_bits, align_bits, LLVMDIFlagZero, nullptr, members,
+        (unsigned)member_count, 0, nullptr, unique_id, strlen(unique_id));
+    free(members);
+
+    LLVMMetadataReplaceAllUsesWith(forward, class_type);
+    hash_table_remove(llvm->di_class_types, class_symb->fully_qualified_name);
+    hash_table_insert(llvm->di_class_types, class_symb->fully_qualified_name, class_type);
+    return class_type;
+}
+
+// Debug type describing values of type; nullptr for void and for types without a debug description
+static LLVMMetadataRef di_type(llvm_codegen_t* llvm, ast_type_t* type)
+{
+    if (type == nullptr)
+        return nullptr;
+
+    LLVMTargetDataRef layout = LLVMGetModuleDataLayout(llvm->module);
+    uint64_t pointer_bits = LLVMPointerSize(layout) * 8;
+    switch (type->kind)
+    {
+        case AST_TYPE_BUILTIN:
+        {
+            type_t builtin = type->data.builtin.type;
+            if (builtin == TYPE_VOID || builtin == TYPE_UNINIT || builtin == TYPE_END)
+                return nullptr;
+            if (builtin == TYPE_NULL)
+                return LLVMDIBuilderCreatePointerType(llvm->di_builder, nullptr, pointer_bits, 0, 0, "", 0);
+            if (builtin == TYPE_STRING)
+            {
+                LLVMMetadataRef data_type = LLVMDIBuilderCreatePointerType(llvm->di_builder,
+                    di_type(llvm, ast_type_builtin(TYPE_U8)), pointer_bits, 0, 0, "", 0);
+                return di_builtin_struct_type(llvm, type, (const char*[]){ "data", "len" },
+                    (LLVMMetadataRef[]){ data_type, di_type(llvm, ast_type_builtin(TYPE_USIZE)) }, 2);
+            }
+
+            LLVMDWARFTypeEncoding encoding = DWARF_ENCODING_UNSIGNED;
+            if (builtin == TYPE_BOOL)
+                encoding = DWARF_ENCODING_BOOLEAN;
+            else if (builtin == TYPE_F32 || builtin == TYPE_F64)
+                encoding = DWARF_ENCODING_FLOAT;
+            else if (ast_type_is_signed(type))
+                encoding = DWARF_ENCODING_SIGNED;
+
+            // bool is an i1 in registers but occupies a byte in memory
+            uint64_t size_bits = builtin == TYPE_BOOL ? 8 : LLVMSizeOfTypeInBits(layout, llvm_type(&llvm->types, type));
+            const char* name = type_to_str(builtin);
+            return LLVMDIBuilderCreateBasicType(llvm->di_builder, name, strlen(name), size_bits, encoding,
+                LLVMDIFlagZero);
+        }
+        case AST_TYPE_POINTER:
+            return LLVMDIBuilderCreatePointerType(llvm->di_builder, di_type(llvm, type->data.pointer.pointee),
+                pointer_bits, 0, 0, "", 0);
+        case AST_TYPE_ARRAY:
+        {
+            LLVMTypeRef array_type = llvm_type(&llvm->types, type);
+            LLVMMetadataRef subrange = LLVMDIBuilderGetOrCreateSubrange(llvm->di_builder, 0,
+                (int64_t)type->data.array.size);
+            return LLVMDIBuilderCreateArrayType(llvm->di_builder, LLVMSizeOfTypeInBits(layout, array_type),
+                LLVMABIAlignmentOfType(layout, array_type) * 8, di_type(llvm, type->data.array.element_type),
+                &subrange, 1);
+        }
+        case AST_TYPE_VIEW:
+        {
+            LLVMMetadataRef data_type = LLVMDIBuilderCreatePointerType(llvm->di_builder,
+                di_type(llvm, type->data.view.element_type), pointer_bits, 0, 0, "", 0);
+            return di_builtin_struct_type(llvm, type, (const char*[]){ "len", "data" },
+                (LLVMMetadataRef[]){ di_type(llvm, ast_type_builtin(TYPE_USIZE)), data_type }, 2);
+        }
+        case AST_TYPE_HEAP_ARRAY:
+        {
+            LLVMMetadataRef data_type = LLVMDIBuilderCreatePointerType(llvm->di_builder,
+                di_type(llvm, type->data.heap_array.element_type), pointer_bits, 0, 0, "", 0);
+            LLVMMetadataRef size_type = di_type(llvm, ast_type_builtin(TYPE_USIZE));
+            return di_builtin_struct_type(llvm, type, (const char*[]){ "data", "len", "cap" },
+                (LLVMMetadataRef[]){ data_type, size_type, size_type }, 3);
+        }
+        case AST_TYPE_CLASS:
+            return di_class_type(llvm, type->data.class.class_symbol);
+        default:
+            return nullptr;
+    }
+}
+
+// Subroutine type of a function or method (self_class is set for methods); line tables do not need the signature
+static LLVMMetadataRef di_subroutine_type(llvm_codegen_t* llvm, ast_fn_def_t* fn_def, symbol_t* self_class)
 {
-    // printI32(i32) -> void
-    LLVMTypeRef print_i32_param_types[] = { LLVMInt32TypeInContext(llvm->context) };
-    LLVMTypeRef print_i32_type = LLVMFunctionType(LLVMVoidTypeInContext(llvm->context), print_i32_param_types, 1,
-        false);
-    LLVMAddFunction(llvm->module, "printI32", print_i32_type);
+    if (llvm->debug_info != DEBUG_INFO_FULL)
+        return LLVMDIBuilderCreateSubroutineType(llvm->di_builder, llvm->di_file, nullptr, 0, LLVMDIFlagZero);
+
+    // The first element is the return type, followed by the parameters
+    size_t param_count = vec_size(&fn_def->params);
+    LLVMMetadataRef* types = malloc((param_count + 2) * sizeof(LLVMMetadataRef));
+    unsigned count = 0;
+    types[count++] = di_type(llvm, fn_def->return_type);
+    if (self_class != nullptr)
+    {
+        LLVMTargetDataRef layout = LLVMGetModuleDataLayout(llvm->module);
+        types[count++] = LLVMDIBuilderCreateObjectPointerType(llvm->di_builder,
+            LLVMDIBuilderCreatePointerType(llvm->di_builder, di_class_type(llvm, self_class),
+                LLVMPointerSize(layout) * 8, 0, 0, "", 0));
+    }
+    for (size_t i = 0; i < param_count; ++i)
+        types[count++] = di_type(llvm, ((ast_param_decl_t*)vec_get(&fn_def->params, i))->type);
+
+    LLVMMetadataRef fn_type = LLVMDIBuilderCreateSubroutineType(llvm->di_builder, llvm->di_file, types, count,
+        LLVMDIFlagZero);
+    free(types);
+    return fn_type;
 }
 
-// Helper function to set debug location for the next instruction(s)
-static void set_debug_location(llvm_codegen_t* llvm, ast_node_t* node)
+// Describe a parameter (arg_no > 0) or local variable stored in storage, with full debug info only
+static void declare_di_variable(llvm_codegen_t* llvm, const char* name, LLVMValueRef storage, ast_type_t* type,
+    ast_node_t* node, unsigned arg_no)
 {
-    if (llvm->di_builder == nullptr || llvm->current_di_scope == nullptr)
+    if (llvm->debug_info != DEBUG_INFO_FULL || llvm->current_di_scope == nullptr)
         return;
 
-    LLVMMetadataRef debug_loc = LLVMDIBuilderCreateDebugLocation(llvm->context, (unsigned int)node->source_begin.line,
-        (unsigned int)node->source_begin.column, llvm->current_di_scope, nullptr);
-    LLVMSetCurrentDebugLocation2(llvm->builder, debug_loc);
+    LLVMMetadataRef var_type = type != nullptr ? di_type(llvm, type) : nullptr;
+    unsigned line = (unsigned)node->source_begin.line;
+    LLVMMetadataRef var_info = arg_no > 0 ?
+        LLVMDIBuilderCreateParameterVariable(llvm->di_builder, llvm->current_di_scope, name, strlen(name), arg_no,
+            llvm->di_file, line, var_type, true, LLVMDIFlagZero) :
+        LLVMDIBuilderCreateAutoVariable(llvm->di_builder, llvm->current_di_scope, name, strlen(name), llvm->di_file,
+            line, var_type, true, LLVMDIFlagZero, 0);
+    LLVMMetadataRef location = LLVMDIBuilderCreateDebugLocation(llvm->context, line,
+        (unsigned)node->source_begin.column, llvm->current_di_scope, nullptr);
+    LLVMMetadataRef expr = LLVMDIBuilderCreateExpression(llvm->di_builder, nullptr, 0);
+#if LLVM_VERSION_MAJOR >= 19
+    LLVMDIBuilderInsertDeclareRecordAtEnd(llvm->di_builder, storage, var_info, expr, location,
+        LLVMGetInsertBlock(llvm->builder));
+#else
+    LLVMDIBuilderInsertDeclareAtEnd(llvm->di_builder, storage, var_info, expr, location,
+        LLVMGetInsertBlock(llvm->builder));
+#endif
 }
 
 // Forward declarations for three-pass approach
@@ -286,6 +1476,7 @@ static void declare_class_methods(llvm_codegen_t* llvm, symbol_t* class_symb);
 static void declare_class_members(llvm_codegen_t* llvm, symbol_t* class_symb);
 static void emit_method_bodies(llvm_codegen_t* llvm, ast_class_def_t* class_def);
 static void declare_function(llvm_codegen_t* llvm, symbol_t* fn_symb);
+static void declare_template_helpers(llvm_codegen_t* llvm, symbol_table_t* helpers);
 static void define_function(llvm_codegen_t* llvm, ast_fn_def_t* fn_def);
 
 static void emit_root(void* self_, ast_root_t* root, void* out_)
@@ -325,27 +1516,70 @@ static void emit_root(void* self_, ast_root_t* root, void* out_)
             {
                 declare_function(llvm, symbol);
             }
+            else if (symbol->kind == SYMBOL_NAMESPACE && symbol->data.namespace.template_helpers != nullptr)
+            {
+                declare_template_helpers(llvm, symbol->data.namespace.template_helpers);
+            }
             else if (symbol->kind == SYMBOL_CLASS)
             {
                 if (!hash_table_contains(&llvm->class_layouts, symbol->fully_qualified_name))
                 {
                     create_class_layout(llvm, symbol);
-                    declare_class_methods(llvm, symbol);
                     declare_class_members(llvm, symbol);
+                    declare_class_methods(llvm, symbol);
                 }
             }
         }
     }
 
+    // Template instances are not in the global table; all class instances are declared in pass 1 first since their
+    // members may refer to each other
+    vec_t* instances = &llvm->sema_ctx->template_instances;
+    for (size_t i = 0; i < vec_size(instances); ++i)
+    {
+        ast_node_t* instance = vec_get(instances, i);
+        if (AST_KIND(instance) != AST_DEF_CLASS)
+            continue;
+        symbol_t* symbol = ((ast_class_def_t*)instance)->symbol;
+        if (LLVMGetTypeByName2(llvm->context, symbol->fully_qualified_name) == nullptr)
+            declare_class_type(llvm, symbol);
+    }
+    for (size_t i = 0; i < vec_size(instances); ++i)
+    {
+        ast_node_t* instance = vec_get(instances, i);
+        if (AST_KIND(instance) == AST_DEF_FN)
+        {
+            declare_function(llvm, ((ast_fn_def_t*)instance)->symbol);
+            continue;
+        }
+        symbol_t* symbol = ((ast_class_def_t*)instance)->symbol;
+        if (!hash_table_contains(&llvm->class_layouts, symbol->fully_qualified_name))
+        {
+            create_class_layout(llvm, symbol);
+            declare_class_members(llvm, symbol);
+            declare_class_methods(llvm, symbol);
+        }
+    }
+
     // Pass 3: Define all function and method bodies (only for local definitions in this AST)
     for (size_t i = 0; i < vec_size(&root->tl_defs); ++i)
     {
         ast_node_t* node = vec_get(&root->tl_defs, i);
-        if (AST_KIND(node) == AST_DEF_FN)
+        if (AST_KIND(node) == AST_DEF_FN && ((ast_fn_def_t*)node)->symbol->kind == SYMBOL_FUNCTION)
             define_function(llvm, (ast_fn_def_t*)node);
-        else if (AST_KIND(node) == AST_DEF_CLASS)
+        else if (AST_KIND(node) == AST_DEF_CLASS && ((ast_class_def_t*)node)->symbol->kind == SYMBOL_CLASS)
             emit_method_bodies(llvm, (ast_class_def_t*)node);
     }
+
+    // Every module that uses a template instance defines it (with internal linkage), once
+    for (; llvm->num_emitted_template_instances < vec_size(instances); ++llvm->num_emitted_template_instances)
+    {
+        ast_node_t* instance = vec_get(instances, llvm->num_emitted_template_instances);
+        if (AST_KIND(instance) == AST_DEF_FN)
+            define_function(llvm, (ast_fn_def_t*)instance);
+        else
+            emit_method_bodies(llvm, (ast_class_def_t*)instance);
+    }
 }
 
 static void emit_param_decl(void* self_, ast_param_decl_t* param, void* out_)
@@ -354,10 +1588,16 @@ static void emit_param_decl(void* self_, ast_param_decl_t* param, void* out_)
     llvm_codegen_t* llvm = self_;
     LLVMValueRef original_param_ref = out_;  // out_ is actually in here...
 
-    LLVMValueRef alloc_ref = LLVMBuildAlloca(llvm->builder, llvm_type(llvm->context, param->type),
+    LLVMValueRef alloc_ref = LLVMBuildAlloca(llvm->builder, llvm_type(&llvm->types, param->type),
         ssprintf("%s.addr", param->name));
     LLVMBuildStore(llvm->builder, original_param_ref, alloc_ref);
 
+    // Debug info numbers the arguments from 1 (self included for methods)
+    unsigned arg_no = 0;
+    while (LLVMGetParam(llvm->current_function, arg_no) != original_param_ref)
+        ++arg_no;
+    declare_di_variable(llvm, param->name, alloc_ref, param->type, AST_NODE(param), arg_no + 1);
+
     hash_table_insert(llvm->symbols, param->name, alloc_ref);
     register_variable_for_destruction(llvm, param->name, alloc_ref, param->type);
 }
@@ -368,7 +1608,8 @@ static void emit_var_decl(void* self_, ast_var_decl_t* var, void* out_)
     LLVMValueRef* out_ref = out_;
 
     set_debug_location(llvm, AST_NODE(var));
-    LLVMValueRef alloc_ref = LLVMBuildAlloca(llvm->builder, llvm_type(llvm->context, var->type), var->name);
+    LLVMValueRef alloc_ref = build_entry_alloca(llvm, llvm_type(&llvm->types, var->type), var->name);
+    declare_di_variable(llvm, var->name, alloc_ref, var->type, AST_NODE(var), 0);
 
     if (var->init_expr != nullptr)
     {
@@ -378,6 +1619,11 @@ static void emit_var_decl(void* self_, ast_var_decl_t* var, void* out_)
         if (init_value != nullptr)
             LLVMBuildStore(llvm->builder, init_value, alloc_ref);
     }
+    else if (var->type->kind == AST_TYPE_HEAP_ARRAY)
+    {
+        // Heap arrays start out empty, without storage
+        LLVMBuildStore(llvm->builder, LLVMConstNull(llvm_type(&llvm->types, var->type)), alloc_ref);
+    }
 
     hash_table_insert(llvm->symbols, var->name, alloc_ref);
     register_variable_for_destruction(llvm, var->name, alloc_ref, var->type);
@@ -428,7 +1674,7 @@ static void create_class_layout(llvm_codegen_t* llvm, symbol_t* class_symb)
 // Pass 2: Declare class methods (both local and imported classes)
 static void declare_class_methods(llvm_codegen_t* llvm, symbol_t* class_symb)
 {
-    panic_if(class_symb->kind != SYMBOL_CLASS);
+    panic_if(!symbol_is_class(class_symb));
 
     hash_table_iter_t itr;
     for (hash_table_iter_init(&itr, &class_symb->data.class.symbols->map); hash_table_iter_has_elem(&itr);
@@ -454,13 +1700,18 @@ static void declare_class_methods(llvm_codegen_t* llvm, symbol_t* class_symb)
             for (size_t j = 0; j < user_param_count; ++j)
             {
                 symbol_t* param = vec_get(&method_symb->data.function.parameters, j);
-                param_types[j + 1] = llvm_type(llvm->context, param->type);
+                param_types[j + 1] = llvm_type(&llvm->types, param->type);
             }
 
             // Declare function signature
-            LLVMTypeRef fn_type = LLVMFunctionType(llvm_type(llvm->context, method_symb->data.function.return_type),
+            LLVMTypeRef fn_type = LLVMFunctionType(llvm_type(&llvm->types, method_symb->data.function.return_type),
                 param_types, total_param_count, false);
-            LLVMAddFunction(llvm->module, mangled_name, fn_type);
+            LLVMValueRef fn = LLVMAddFunction(llvm->module, mangled_name, fn_type);
+            if (symbol_is_module_local_function(method_symb))
+                LLVMSetFunctionCallConv(fn, LLVMFastCallConv);
+            add_fn_def_attributes(llvm, fn, method_symb);
+            add_inferred_fn_attributes(llvm, fn, method_symb);
+            add_self_param_attributes(llvm, fn, class_symb);
             free(param_types);
         }
     }
@@ -496,7 +1747,7 @@ static void declare_class_members(llvm_codegen_t* llvm, symbol_t* class_symb)
 
         panic_if(vec_size(overloads) != 1);
 
-        LLVMTypeRef member_type = llvm_type(llvm->context, member_symb->type);
+        LLVMTypeRef member_type = llvm_type(&llvm->types, member_symb->type);
         member_types[i] = member_type;
         ++i;
     }
@@ -526,7 +1777,7 @@ static LLVMCallConv lookup_call_conv(const char* str)
 static void declare_function(llvm_codegen_t* llvm, symbol_t* fn_symb)
 {
     bool external = fn_symb->data.function.extern_abi != nullptr;
-    const char* mangled_fn_name = external ? fn_symb->name : MANGLE_FUNCTION_NAME(fn_symb);
+    const char* mangled_fn_name = FUNCTION_SYMBOL_NAME(fn_symb);
 
     if (LLVMGetNamedFunction(llvm->module, mangled_fn_name) != nullptr)
         return;  // already declared by previous AST in this module
@@ -537,17 +1788,41 @@ static void declare_function(llvm_codegen_t* llvm, symbol_t* fn_symb)
     for (size_t i = 0; i < param_count; ++i)
     {
         symbol_t* param = vec_get(&fn_symb->data.function.parameters, i);
-        param_types[i] = llvm_type(llvm->context, param->type);
+        param_types[i] = llvm_type(&llvm->types, param->type);
     }
 
     // Declare function signature
-    LLVMTypeRef fn_type = LLVMFunctionType(llvm_type(llvm->context, fn_symb->data.function.return_type), param_types,
+    LLVMTypeRef fn_type = LLVMFunctionType(llvm_type(&llvm->types, fn_symb->data.function.return_type), param_types,
         param_count, false);
     LLVMValueRef func = LLVMAddFunction(llvm->module, mangled_fn_name, fn_type);
     free(param_types);
 
     if (external)
         LLVMSetFunctionCallConv(func, lookup_call_conv(fn_symb->data.function.extern_abi));
+    else
+        add_inferred_fn_attributes(llvm, func, fn_symb);
+    add_fn_def_attributes(llvm, func, fn_symb);
+
+    // Unless its address is taken, every call to a module-local function is a direct call emitted here and it can use
+    // the fast calling convention
+    if (symbol_is_module_local_function(fn_symb) && !fn_symb->data.function.address_taken)
+        LLVMSetFunctionCallConv(func, LLVMFastCallConv);
+}
+
+// The private functions of an imported module that the instances of its templates may call
+static void declare_template_helpers(llvm_codegen_t* llvm, symbol_table_t* helpers)
+{
+    hash_table_iter_t iter;
+    for (hash_table_iter_init(&iter, &helpers->map); hash_table_iter_has_elem(&iter); hash_table_iter_next(&iter))
+    {
+        vec_t* symbols = hash_table_iter_current(&iter)->value;
+        for (size_t i = 0; i < vec_size(symbols); ++i)
+        {
+            symbol_t* symbol = vec_get(symbols, i);
+            if (symbol->kind == SYMBOL_FUNCTION)
+                declare_function(llvm, symbol);
+        }
+    }
 }
 
 // Pass 3: Define function body
@@ -557,20 +1832,23 @@ static void define_function(llvm_codegen_t* llvm, ast_fn_def_t* fn_def)
         return;
 
     llvm->symbols = hash_table_create(nullptr);
+    llvm->hoisted_views = hash_table_create(free);
+    llvm->loop_writes = loop_write_finder_create(fn_def->body);
 
     // Get the declared function
     const char* mangled_name = MANGLE_FUNCTION_NAME(fn_def->symbol);
     LLVMValueRef fn_val = LLVMGetNamedFunction(llvm->module, mangled_name);
     panic_if(fn_val == nullptr);
     llvm->current_function = fn_val;
+    begin_function_bounds_checks(llvm, fn_def, fn_def->symbol->fully_qualified_name);
+    begin_function_cleanups(llvm);
+    llvm->current_fn_flatten = fn_def->flatten;
+    llvm->current_fn_locals_escape = fn_effects_analyze(fn_def, llvm->bounds_checks).locals_escape;
 
     // Create debug info for this function
     if (llvm->di_builder != nullptr)
     {
-        // Create subroutine type (simplified - just mark as unspecified)
-        LLVMMetadataRef di_param_types[] = {nullptr};
-        LLVMMetadataRef di_fn_type = LLVMDIBuilderCreateSubroutineType(llvm->di_builder, llvm->di_file,
-            di_param_types, 0, LLVMDIFlagZero);
+        LLVMMetadataRef di_fn_type = di_subroutine_type(llvm, fn_def, nullptr);
 
         // Create subprogram (function debug info)
         LLVMMetadataRef di_subprogram = LLVMDIBuilderCreateFunction(llvm->di_builder, llvm->di_file, fn_def->base.name,
@@ -589,7 +1867,7 @@ static void define_function(llvm_codegen_t* llvm, ast_fn_def_t* fn_def)
     // Add entry block and position builder
     LLVMBasicBlockRef entry_block = LLVMAppendBasicBlock(fn_val, "entry");
     // FIXME: The compiler should export the function it wants to be entry point
-    if (!fn_def->exported && strcmp(fn_def->base.name, "main") != 0)
+    if (symbol_is_module_local_function(fn_def->symbol))
         LLVMSetLinkage(fn_val, LLVMInternalLinkage);
     LLVMPositionBuilderAtEnd(llvm->builder, entry_block);
 
@@ -606,21 +1884,26 @@ static void define_function(llvm_codegen_t* llvm, ast_fn_def_t* fn_def)
     LLVMValueRef out_val;
     ast_visitor_visit(llvm, fn_def->body, &out_val);
 
-    // Add implicit return for void functions, with destructors
-    if (fn_def->return_type == ast_type_builtin(TYPE_VOID))
+    // Destroy parameters, then add implicit return for void functions
+    end_destructor_scope(llvm);
+    if (fn_def->return_type == ast_type_builtin(TYPE_VOID) &&
+        LLVMGetBasicBlockTerminator(LLVMGetInsertBlock(llvm->builder)) == nullptr)
     {
-        emit_scope_destructors(llvm, llvm->destructor_scope);
         LLVMBuildRetVoid(llvm->builder);
     }
 
-    // Pop destructor scope
-    pop_destructor_scope(llvm);
+    end_function_cleanups(llvm);
+    end_function_bounds_checks(llvm);
 
     // Clear current scope when leaving function
     llvm->current_di_scope = nullptr;
 
     hash_table_destroy(llvm->symbols);
     llvm->symbols = nullptr;
+    hash_table_destroy(llvm->hoisted_views);
+    llvm->hoisted_views = nullptr;
+    loop_write_finder_destroy(llvm->loop_writes);
+    llvm->loop_writes = nullptr;
 }
 
 static void emit_import_def(void* self_, ast_import_def_t* import, void* out_)
@@ -638,6 +1921,8 @@ static void emit_method_def(void* self_, ast_method_def_t* method, void* out_)
     panic_if(llvm->current_class == nullptr);
 
     llvm->symbols = hash_table_create(nullptr);
+    llvm->hoisted_views = hash_table_create(free);
+    llvm->loop_writes = loop_write_finder_create(method->base.body);
 
     // Mangle method name: ClassName.methodName.N
     const char* mangled_name = MANGLE_FUNCTION_NAME(method->symbol);
@@ -646,16 +1931,17 @@ static void emit_method_def(void* self_, ast_method_def_t* method, void* out_)
     LLVMValueRef fn_val = LLVMGetNamedFunction(llvm->module, mangled_name);
     panic_if(fn_val == nullptr);
     llvm->current_function = fn_val;
+    begin_function_bounds_checks(llvm, &method->base, method->symbol->fully_qualified_name);
+    begin_function_cleanups(llvm);
+    llvm->current_fn_flatten = method->base.flatten;
+    llvm->current_fn_locals_escape = fn_effects_analyze(&method->base, llvm->bounds_checks).locals_escape;
 
     LLVMTypeRef class_ptr_type = LLVMPointerTypeInContext(llvm->context, 0);
 
     // Create debug info for this method
     if (llvm->di_builder != nullptr)
     {
-        // Create subroutine type (simplified - just mark as unspecified)
-        LLVMMetadataRef di_param_types[] = {nullptr};
-        LLVMMetadataRef di_fn_type = LLVMDIBuilderCreateSubroutineType(llvm->di_builder, llvm->di_file,
-            di_param_types, 0, LLVMDIFlagZero);
+        LLVMMetadataRef di_fn_type = di_subroutine_type(llvm, &method->base, llvm->current_class->symbol);
 
         // Create subprogram (method debug info)
         char* debug_name = ssprintf("%s.%s", llvm->current_class->base.name, method->base.base.name);
@@ -673,6 +1959,8 @@ static void emit_method_def(void* self_, ast_method_def_t* method, void* out_)
 
     // Add entry block and position builder
     LLVMBasicBlockRef entry_block = LLVMAppendBasicBlock(fn_val, "entry");
+    if (symbol_is_module_local_function(method->symbol))
+        LLVMSetLinkage(fn_val, LLVMInternalLinkage);
     LLVMPositionBuilderAtEnd(llvm->builder, entry_block);
 
     set_debug_location(llvm, AST_NODE(method));
@@ -684,6 +1972,8 @@ static void emit_method_def(void* self_, ast_method_def_t* method, void* out_)
     LLVMValueRef self_param = LLVMGetParam(fn_val, 0);
     LLVMValueRef self_alloc = LLVMBuildAlloca(llvm->builder, class_ptr_type, "self.addr");
     LLVMBuildStore(llvm->builder, self_param, self_alloc);
+    declare_di_variable(llvm, "self", self_alloc, ast_type_pointer(llvm->current_class->symbol->type),
+        AST_NODE(method), 1);
     hash_table_insert(llvm->symbols, "self", self_alloc);
 
     // Allocate space for all user parameters
@@ -694,20 +1984,25 @@ static void emit_method_def(void* self_, ast_method_def_t* method, void* out_)
     LLVMValueRef out_val;
     ast_visitor_visit(llvm, method->base.body, &out_val);
 
-    // Add implicit return for void methods, with destructors
-    if (method->base.return_type == ast_type_builtin(TYPE_VOID))
+    // Destroy parameters, then add implicit return for void methods
+    end_destructor_scope(llvm);
+    if (method->base.return_type == ast_type_builtin(TYPE_VOID) &&
+        LLVMGetBasicBlockTerminator(LLVMGetInsertBlock(llvm->builder)) == nullptr)
     {
-        emit_scope_destructors(llvm, llvm->destructor_scope);
         LLVMBuildRetVoid(llvm->builder);
     }
 
-    // Pop destructor scope
-    pop_destructor_scope(llvm);
+    end_function_cleanups(llvm);
+    end_function_bounds_checks(llvm);
 
     llvm->current_di_scope = nullptr;
 
     hash_table_destroy(llvm->symbols);
     llvm->symbols = nullptr;
+    hash_table_destroy(llvm->hoisted_views);
+    llvm->hoisted_views = nullptr;
+    loop_write_finder_destroy(llvm->loop_writes);
+    llvm->loop_writes = nullptr;
 }
 
 static void emit_bool_lit(void* self_, ast_bool_lit_t* lit, void* out_)
@@ -715,7 +2010,7 @@ static void emit_bool_lit(void* self_, ast_bool_lit_t* lit, void* out_)
     llvm_codegen_t* llvm = self_;
     LLVMValueRef* out_val = out_;
 
-    *out_val = LLVMConstInt(llvm_type(llvm->context, lit->base.type), lit->value ? 1 : 0, false);
+    *out_val = LLVMConstInt(llvm_type(&llvm->types, lit->base.type), lit->value ? 1 : 0, false);
 }
 
 static void emit_float_lit(void* self_, ast_float_lit_t* lit, void* out_)
@@ -723,7 +2018,7 @@ static void emit_float_lit(void* self_, ast_float_lit_t* lit, void* out_)
     llvm_codegen_t* llvm = self_;
     LLVMValueRef* out_val = out_;
 
-    *out_val = LLVMConstReal(llvm_type(llvm->context, lit->base.type), lit->value);
+    *out_val = LLVMConstReal(llvm_type(&llvm->types, lit->base.type), lit->value);
 }
 
 static void emit_int_lit(void* self_, ast_int_lit_t* lit, void* out_)
@@ -731,7 +2026,7 @@ static void emit_int_lit(void* self_, ast_int_lit_t* lit, void* out_)
     llvm_codegen_t* llvm = self_;
     LLVMValueRef* out_val = out_;
 
-    *out_val = LLVMConstInt(llvm_type(llvm->context, lit->base.type), lit->value.as_unsigned,
+    *out_val = LLVMConstInt(llvm_type(&llvm->types, lit->base.type), lit->value.as_unsigned,
         ast_type_is_signed(lit->base.type));
 }
 
@@ -762,8 +2057,8 @@ static void emit_str_lit(void* self_, ast_str_lit_t* lit, void* out_)
     LLVMValueRef str_ptr = LLVMBuildInBoundsGEP2(llvm->builder, str_array_type, global_str, indices, 2, "str_ptr");
 
     // Create the string struct { u8* data, usize len }
-    LLVMTypeRef string_type = llvm_type(llvm->context, lit->base.type);
-    LLVMValueRef string_alloc = LLVMBuildAlloca(llvm->builder, string_type, "string_lit");
+    LLVMTypeRef string_type = llvm_type(&llvm->types, lit->base.type);
+    LLVMValueRef string_alloc = build_entry_alloca(llvm, string_type, "string_lit");
 
     // Store pointer to data in field 0
     LLVMValueRef data_field_ptr = LLVMBuildStructGEP2(llvm->builder, string_type, string_alloc, 0, "data_field_ptr");
@@ -821,14 +2116,14 @@ static void emit_member_access(void* self_, ast_member_access_t* access, void* o
     panic_if(!hash_table_contains(&layout->member_indices, access->member_name));
     intptr_t index = (intptr_t)hash_table_find(&layout->member_indices, access->member_name);
 
-    LLVMValueRef ptr_to_member = LLVMBuildStructGEP2(llvm->builder, llvm_type(llvm->context, class_type),
+    LLVMValueRef ptr_to_member = LLVMBuildStructGEP2(llvm->builder, llvm_type(&llvm->types, class_type),
         instance_ptr, index, fq_class_name);
 
     if (ret_lvalue)
         *out_val = ptr_to_member;
     else
     {
-        LLVMTypeRef member_type = llvm_type(llvm->context, (ast_type_t*)vec_get(&layout->member_types, (size_t)index));
+        LLVMTypeRef member_type = llvm_type(&llvm->types, (ast_type_t*)vec_get(&layout->member_types, (size_t)index));
         *out_val = LLVMBuildLoad2(llvm->builder, member_type, ptr_to_member, "member_val");
     }
 }
@@ -840,11 +2135,201 @@ static void emit_member_init(void* self_, ast_member_init_t* init, void* out_)
     ast_visitor_visit(llvm, init->init_expr, out_);
 }
 
+// push(), pop(), reserve(), clear() and len() of a heap array; returns nullptr for the methods returning void
+static LLVMValueRef emit_heap_array_method_call(llvm_codegen_t* llvm, ast_method_call_t* call,
+    LLVMValueRef array_addr)
+{
+    const char* method_name = call->method_name;
+    ast_type_t* element_type = call->instance->type->data.heap_array.element_type;
+    LLVMTypeRef llvm_element_type = llvm_type(&llvm->types, element_type);
+    LLVMTypeRef size_type = LLVMInt64TypeInContext(llvm->context);
+    LLVMValueRef one = LLVMConstInt(size_type, 1, false);
+
+    LLVMValueRef argument = nullptr;
+    if (vec_size(&call->arguments) > 0)
+        ast_visitor_visit(llvm, vec_get(&call->arguments, 0), &argument);
+
+    if (strcmp(method_name, "len") == 0)
+        return load_heap_array_field(llvm, array_addr, HEAP_ARRAY_LENGTH, "length");
+    if (strcmp(method_name, "push") == 0)
+    {
+        // Storage only has to grow when the array is full, which becomes rare as the capacity doubles
+        LLVMValueRef length = load_heap_array_field(llvm, array_addr, HEAP_ARRAY_LENGTH, "length");
+        LLVMValueRef capacity = load_heap_array_field(llvm, array_addr, HEAP_ARRAY_CAPACITY, "capacity");
+        LLVMValueRef new_length = LLVMBuildNUWAdd(llvm->builder, length, one, "new_length");
+
+        LLVMBasicBlockRef grow_block = LLVMAppendBasicBlock(llvm->current_function, "push.grow");
+        LLVMBasicBlockRef store_block = LLVMAppendBasicBlock(llvm->current_function, "push.store");
+        LLVMValueRef has_room = LLVMBuildICmp(llvm->builder, LLVMIntULT, length, capacity, "has_room");
+        LLVMValueRef branch = LLVMBuildCondBr(llvm->builder, has_room, store_block, grow_block);
+        LLVMSetMetadata(branch, LLVMGetMDKindIDInContext(llvm->context, "prof", 4), get_likely_branch_weights(llvm));
+
+        LLVMPositionBuilderAtEnd(llvm->builder, grow_block);
+        LLVMValueRef grow_fn = get_heap_array_grow_function(llvm);
+        LLVMValueRef element_size = LLVMConstInt(size_type,
+            LLVMABISizeOfType(LLVMGetModuleDataLayout(llvm->module), llvm_element_type), false);
+        build_direct_call(llvm, grow_fn, (LLVMValueRef[]){ array_addr, element_size, new_length }, 3, "");
+        LLVMBuildBr(llvm->builder, store_block);
+
+        LLVMPositionBuilderAtEnd(llvm->builder, store_block);
+        LLVMValueRef data = load_heap_array_field(llvm, array_addr, HEAP_ARRAY_DATA, "data");
+        LLVMValueRef element = LLVMBuildInBoundsGEP2(llvm->builder, llvm_element_type, data, &length, 1, "element");
+        LLVMBuildStore(llvm->builder, argument, element);
+        LLVMBuildStore(llvm->builder, new_length, heap_array_field_ptr(llvm, array_addr, HEAP_ARRAY_LENGTH, ""));
+        return nullptr;
+    }
+    if (strcmp(method_name, "pop") == 0)
+    {
+        // Popping an empty array is checked like an out of bounds subscript
+        LLVMValueRef length = load_heap_array_field(llvm, array_addr, HEAP_ARRAY_LENGTH, "length");
+        if (should_emit_bounds_check(llvm))
+        {
+            LLVMValueRef not_empty = LLVMBuildICmp(llvm->builder, LLVMIntNE, length, LLVMConstInt(size_type, 0, false),
+                "not_empty");
+            emit_bounds_check_trap(llvm, not_empty, "pop.safe");
+        }
+
+        // The element is moved out, so it is not destroyed
+        LLVMValueRef new_length = LLVMBuildSub(llvm->builder, length, one, "new_length");
+        LLVMBuildStore(llvm->builder, new_length, heap_array_field_ptr(llvm, array_addr, HEAP_ARRAY_LENGTH, ""));
+        LLVMValueRef data = load_heap_array_field(llvm, array_addr, HEAP_ARRAY_DATA, "data");
+        LLVMValueRef element = LLVMBuildInBoundsGEP2(llvm->builder, llvm_element_type, data, &new_length, 1,
+            "element");
+        return LLVMBuildLoad2(llvm->builder, llvm_element_type, element, "popped");
+    }
+    if (strcmp(method_name, "reserve") == 0)
+    {
+        // The runtime does nothing if the capacity is already large enough
+        LLVMValueRef grow_fn = get_heap_array_grow_function(llvm);
+        LLVMValueRef element_size = LLVMConstInt(size_type,
+            LLVMABISizeOfType(LLVMGetModuleDataLayout(llvm->module), llvm_element_type), false);
+        build_direct_call(llvm, grow_fn, (LLVMValueRef[]){ array_addr, element_size, argument }, 3, "");
+        return nullptr;
+    }
+    if (strcmp(method_name, "clear") == 0)
+    {
+        // The storage is kept for reuse
+        emit_heap_array_elements_destruction(llvm, array_addr, element_type);
+        LLVMBuildStore(llvm->builder, LLVMConstInt(size_type, 0, false),
+            heap_array_field_ptr(llvm, array_addr, HEAP_ARRAY_LENGTH, ""));
+        return nullptr;
+    }
+
+    panic("Unknown heap array method '%s'", method_name);
+}
+
+static LLVMAtomicOrdering llvm_atomic_ordering(memory_order_t order)
+{
+    switch (order)
+    {
+        case MEMORY_ORDER_RELAXED: return LLVMAtomicOrderingMonotonic;
+        case MEMORY_ORDER_ACQUIRE: return LLVMAtomicOrderingAcquire;
+        case MEMORY_ORDER_RELEASE: return LLVMAtomicOrderingRelease;
+        case MEMORY_ORDER_ACQ_REL: return LLVMAtomicOrderingAcquireRelease;
+        case MEMORY_ORDER_SEQ_CST: return LLVMAtomicOrderingSequentiallyConsistent;
+        default: panic("Invalid memory order %d", order);
+    }
+}
+
+// load(), store(), fetch_add() and compare_exchange() of an integer pointer as atomic instructions; returns nullptr for
+// store()
+static LLVMValueRef emit_atomic_method_call(llvm_codegen_t* llvm, ast_method_call_t* call)
+{
+    const char* method_name = call->method_name;
+    LLVMTypeRef value_type = llvm_type(&llvm->types, call->instance->type->data.pointer.pointee);
+    LLVMAtomicOrdering ordering = llvm_atomic_ordering(call->memory_order);
+
+    LLVMValueRef ptr = nullptr;
+    ast_visitor_visit(llvm, call->instance, &ptr);
+
+    // The ordering is the last argument and only selects the instruction
+    LLVMValueRef operands[2] = { nullptr, nullptr };
+    size_t operand_count = vec_size(&call->arguments) - 1;
+    panic_if(operand_count > 2);
+    for (size_t i = 0; i < operand_count; ++i)
+        ast_visitor_visit(llvm, vec_get(&call->arguments, i), &operands[i]);
+
+    if (strcmp(method_name, "load") == 0)
+    {
+        LLVMValueRef load = LLVMBuildLoad2(llvm->builder, value_type, ptr, "atomic_load");
+        LLVMSetOrdering(load, ordering);
+        return load;
+    }
+    if (strcmp(method_name, "store") == 0)
+    {
+        LLVMValueRef store = LLVMBuildStore(llvm->builder, operands[0], ptr);
+        LLVMSetOrdering(store, ordering);
+        return nullptr;
+    }
+    if (strcmp(method_name, "fetch_add") == 0)
+        return LLVMBuildAtomicRMW(llvm->builder, LLVMAtomicRMWBinOpAdd, ptr, operands[0], ordering, false);
+    if (strcmp(method_name, "compare_exchange") == 0)
+    {
+        // A failed exchange only loads, so it can neither release nor be stronger than the exchange itself
+        LLVMAtomicOrdering failure_ordering = ordering;
+        if (ordering == LLVMAtomicOrderingRelease)
+            failure_ordering = LLVMAtomicOrderingMonotonic;
+        else if (ordering == LLVMAtomicOrderingAcquireRelease)
+            failure_ordering = LLVMAtomicOrderingAcquire;
+
+        LLVMValueRef exchange = LLVMBuildAtomicCmpXchg(llvm->builder, ptr, operands[0], operands[1], ordering,
+            failure_ordering, false);
+        return LLVMBuildExtractValue(llvm->builder, exchange, 1, "exchanged");
+    }
+
+    panic("Unknown atomic method '%s'", method_name);
+}
+
+// hash() of an integer or a string. Integers are multiplied by 2^64 / golden ratio, which leaves the high bits well
+// mixed, and the high half is folded into the low half so that both ends of the hash can be used. Strings are hashed
+// by the runtime.
+static LLVMValueRef emit_hash(llvm_codegen_t* llvm, ast_type_t* type, LLVMValueRef value)
+{
+    LLVMTypeRef hash_type = LLVMInt64TypeInContext(llvm->context);
+    if (type == ast_type_builtin(TYPE_STRING))
+    {
+        LLVMValueRef data = LLVMBuildExtractValue(llvm->builder, value, 0, "str_raw");
+        LLVMValueRef len = LLVMBuildExtractValue(llvm->builder, value, 1, "str_len");
+        return build_direct_call(llvm, get_hash_bytes_function(llvm), (LLVMValueRef[]){ data, len }, 2, "hash");
+    }
+
+    LLVMValueRef widened = value;
+    if (LLVMTypeOf(value) != hash_type)
+    {
+        widened = ast_type_is_signed(type) ? LLVMBuildSExt(llvm->builder, value, hash_type, "widened") :
+            LLVMBuildZExt(llvm->builder, value, hash_type, "widened");
+    }
+    LLVMValueRef product = LLVMBuildMul(llvm->builder, widened, LLVMConstInt(hash_type, 0x9E3779B97F4A7C15u, false),
+        "product");
+    LLVMValueRef high = LLVMBuildLShr(llvm->builder, product, LLVMConstInt(hash_type, 32, false), "high");
+    return LLVMBuildXor(llvm->builder, product, high, "hash");
+}
+
 static void emit_builtin_method_call(llvm_codegen_t* llvm, ast_method_call_t* call, LLVMValueRef* out_val)
 {
     ast_type_t* instance_type = call->instance->type;
     const char* method_name = call->method_name;
 
+    if (strcmp(method_name, "hash") == 0)
+    {
+        llvm->lvalue = false;
+        LLVMValueRef value = nullptr;
+        ast_visitor_visit(llvm, call->instance, &value);
+        if (out_val != nullptr)
+            *out_val = emit_hash(llvm, instance_type, value);
+        return;
+    }
+
+    // The builtin methods of pointers are atomic accesses to what they point to
+    if (instance_type->kind == AST_TYPE_POINTER)
+    {
+        llvm->lvalue = false;
+        LLVMValueRef result = emit_atomic_method_call(llvm, call);
+        if (out_val != nullptr && result != nullptr)
+            *out_val = result;
+        return;
+    }
+
     // Get the instance as an lvalue (address of the variable/expression)
     llvm->lvalue = true;
     LLVMValueRef instance_addr = nullptr;
@@ -862,7 +2347,7 @@ static void emit_builtin_method_call(llvm_codegen_t* llvm, ast_method_call_t* ca
             // Extract length field (field 1)
             LLVMValueRef indices[] = { LLVMConstInt(LLVMInt32TypeInContext(llvm->context), 0, false),
                 LLVMConstInt(LLVMInt32TypeInContext(llvm->context), 1, false) };
-            LLVMValueRef len_ptr = LLVMBuildInBoundsGEP2(llvm->builder, llvm_type(llvm->context, instance_type),
+            LLVMValueRef len_ptr = LLVMBuildInBoundsGEP2(llvm->builder, llvm_type(&llvm->types, instance_type),
                 instance_addr, indices, 2, "str_len_ptr");
             result = LLVMBuildLoad2(llvm->builder, LLVMInt64TypeInContext(llvm->context), len_ptr, "str_len");
         }
@@ -871,7 +2356,7 @@ static void emit_builtin_method_call(llvm_codegen_t* llvm, ast_method_call_t* ca
             // Extract raw pointer field (field 0)
             LLVMValueRef indices[] = { LLVMConstInt(LLVMInt32TypeInContext(llvm->context), 0, false),
                 LLVMConstInt(LLVMInt32TypeInContext(llvm->context), 0, false) };
-            LLVMValueRef ptr_field = LLVMBuildInBoundsGEP2(llvm->builder, llvm_type(llvm->context, instance_type),
+            LLVMValueRef ptr_field = LLVMBuildInBoundsGEP2(llvm->builder, llvm_type(&llvm->types, instance_type),
                 instance_addr, indices, 2, "str_raw_ptr");
             result = LLVMBuildLoad2(llvm->builder, LLVMPointerTypeInContext(llvm->context, 0), ptr_field,
                 "str_raw");
@@ -886,16 +2371,26 @@ static void emit_builtin_method_call(llvm_codegen_t* llvm, ast_method_call_t* ca
     // view.len()
     else if (instance_type->kind == AST_TYPE_VIEW)
     {
-        if (strcmp(method_name, "len") == 0)
+        hoisted_view_t* hoisted = find_hoisted_view(llvm, call->instance);
+        if (strcmp(method_name, "len") == 0 && hoisted != nullptr)
+            result = hoisted->length;
+        else if (strcmp(method_name, "len") == 0)
         {
             // Extract length field (field 0 for view)
             LLVMValueRef indices[] = { LLVMConstInt(LLVMInt32TypeInContext(llvm->context), 0, false),
                 LLVMConstInt(LLVMInt32TypeInContext(llvm->context), 0, false) };
-            LLVMValueRef len_ptr = LLVMBuildInBoundsGEP2(llvm->builder, llvm_type(llvm->context, instance_type),
+            LLVMValueRef len_ptr = LLVMBuildInBoundsGEP2(llvm->builder, llvm_type(&llvm->types, instance_type),
                 instance_addr, indices, 2, "view_len_ptr");
             result = LLVMBuildLoad2(llvm->builder, LLVMInt64TypeInContext(llvm->context), len_ptr, "view_len");
         }
     }
+    // array.push(value), array.pop(), ... for heap arrays
+    else if (instance_type->kind == AST_TYPE_HEAP_ARRAY)
+    {
+        result = emit_heap_array_method_call(llvm, call, instance_addr);
+        if (result == nullptr)
+            return;
+    }
 
     panic_if(result == nullptr);
 
@@ -958,9 +2453,9 @@ static void emit_method_call(void* self_, ast_method_call_t* call, void* out_)
     // Emit call
     LLVMValueRef fn = LLVMGetNamedFunction(llvm->module, mangled_name);
     panic_if(fn == nullptr);
-    LLVMTypeRef fn_type = LLVMGlobalGetValueType(fn);
-    LLVMValueRef call_result = LLVMBuildCall2(llvm->builder, fn_type, fn, args, (unsigned int)total_arg_count,
+    LLVMValueRef call_result = build_direct_call(llvm, fn, args, (unsigned int)total_arg_count,
         call->base.type == ast_type_builtin(TYPE_VOID) ? "" : "method_call");
+    add_call_attributes(llvm, call_result, fn);
 
     if (out_val != nullptr)
         *out_val = call_result;
@@ -994,6 +2489,28 @@ static void emit_simple_assignment(void* self_, ast_bin_op_t* bin_op, void* out_
     LLVMBuildStore(llvm->builder, rhs_value, lhs_addr);
 }
 
+// Strings are equal when they have the same bytes. The lengths are compared first, and memcmp is given no bytes to
+// compare when they differ, so that no branch is needed.
+static LLVMValueRef emit_string_equality(llvm_codegen_t* llvm, LLVMValueRef lhs, LLVMValueRef rhs)
+{
+    LLVMTypeRef size_type = LLVMInt64TypeInContext(llvm->context);
+    LLVMValueRef lhs_len = LLVMBuildExtractValue(llvm->builder, lhs, 1, "lhs_len");
+    LLVMValueRef rhs_len = LLVMBuildExtractValue(llvm->builder, rhs, 1, "rhs_len");
+    LLVMValueRef same_len = LLVMBuildICmp(llvm->builder, LLVMIntEQ, lhs_len, rhs_len, "same_len");
+    LLVMValueRef compared_len = LLVMBuildSelect(llvm->builder, same_len, lhs_len, LLVMConstInt(size_type, 0, false),
+        "compared_len");
+
+    LLVMValueRef args[] = {
+        LLVMBuildExtractValue(llvm->builder, lhs, 0, "lhs_raw"),
+        LLVMBuildExtractValue(llvm->builder, rhs, 0, "rhs_raw"),
+        compared_len,
+    };
+    LLVMValueRef order = build_direct_call(llvm, get_memcmp_function(llvm), args, 3, "order");
+    LLVMValueRef same_bytes = LLVMBuildICmp(llvm->builder, LLVMIntEQ, order,
+        LLVMConstInt(LLVMInt32TypeInContext(llvm->context), 0, false), "same_bytes");
+    return LLVMBuildAnd(llvm->builder, same_len, same_bytes, "eq");
+}
+
 static void emit_other_bin_op(void* self_, ast_bin_op_t* bin_op, void* out_)
 {
     llvm_codegen_t* llvm = self_;
@@ -1011,65 +2528,74 @@ static void emit_other_bin_op(void* self_, ast_bin_op_t* bin_op, void* out_)
     token_type_t op = bin_op->op;
     bool is_float = ast_type_is_real(bin_op->base.type);
 
+    if ((op == TOKEN_EQ || op == TOKEN_NEQ) && bin_op->lhs->type == ast_type_builtin(TYPE_STRING))
+    {
+        result = emit_string_equality(llvm, lhs_value, rhs_value);
+        if (op == TOKEN_NEQ)
+            result = LLVMBuildNot(llvm->builder, result, "ne");
+        if (out_val != nullptr)
+            *out_val = result;
+        return;
+    }
+
+    bool is_signed = !is_float && ast_type_is_signed(bin_op->base.type);
+
+    // Comparisons are typed bool, so they go by the type of their operands; pointers compare as unsigned
+    bool compares_float = ast_type_is_real(bin_op->lhs->type);
+    bool compares_signed = !compares_float && ast_type_is_signed(bin_op->lhs->type);
+
     switch (op)
     {
         case TOKEN_PLUS_ASSIGN:
         case TOKEN_PLUS:
-            result = is_float ?
-                LLVMBuildFAdd(llvm->builder, lhs_value, rhs_value, "add") :
+            result = is_float ? LLVMBuildFAdd(llvm->builder, lhs_value, rhs_value, "add") :
                 LLVMBuildAdd(llvm->builder, lhs_value, rhs_value, "add");
             break;
         case TOKEN_MINUS_ASSIGN:
         case TOKEN_MINUS:
-            result = is_float ?
-                LLVMBuildFSub(llvm->builder, lhs_value, rhs_value, "sub") :
+            result = is_float ? LLVMBuildFSub(llvm->builder, lhs_value, rhs_value, "sub") :
                 LLVMBuildSub(llvm->builder, lhs_value, rhs_value, "sub");
             break;
         case TOKEN_MUL_ASSIGN:
         case TOKEN_STAR:
-            result = is_float ?
-                LLVMBuildFMul(llvm->builder, lhs_value, rhs_value, "mul") :
+            result = is_float ? LLVMBuildFMul(llvm->builder, lhs_value, rhs_value, "mul") :
                 LLVMBuildMul(llvm->builder, lhs_value, rhs_value, "mul");
             break;
         case TOKEN_DIV_ASSIGN:
         case TOKEN_DIV:
-            result = is_float ?
-                LLVMBuildFDiv(llvm->builder, lhs_value, rhs_value, "div") :
-                LLVMBuildSDiv(llvm->builder, lhs_value, rhs_value, "div");
+            result = is_float ? LLVMBuildFDiv(llvm->builder, lhs_value, rhs_value, "div") :
+                is_signed ? LLVMBuildSDiv(llvm->builder, lhs_value, rhs_value, "div") :
+                LLVMBuildUDiv(llvm->builder, lhs_value, rhs_value, "div");
             break;
         case TOKEN_MODULO_ASSIGN:
         case TOKEN_MODULO:
-            result = is_float ?
-                LLVMBuildFRem(llvm->builder, lhs_value, rhs_value, "rem") :
-                LLVMBuildSRem(llvm->builder, lhs_value, rhs_value, "rem");
+            result = is_float ? LLVMBuildFRem(llvm->builder, lhs_value, rhs_value, "rem") :
+                is_signed ? LLVMBuildSRem(llvm->builder, lhs_value, rhs_value, "rem") :
+                LLVMBuildURem(llvm->builder, lhs_value, rhs_value, "rem");
             break;
         case TOKEN_LT:
-            result = is_float ?
-                LLVMBuildFCmp(llvm->builder, LLVMRealOLT, lhs_value, rhs_value, "lt") :
-                LLVMBuildICmp(llvm->builder, LLVMIntSLT, lhs_value, rhs_value, "lt");
+            result = compares_float ? LLVMBuildFCmp(llvm->builder, LLVMRealOLT, lhs_value, rhs_value, "lt") :
+                LLVMBuildICmp(llvm->builder, compares_signed ? LLVMIntSLT : LLVMIntULT, lhs_value, rhs_value, "lt");
             break;
         case TOKEN_LTE:
-            result = is_float ?
-                LLVMBuildFCmp(llvm->builder, LLVMRealOLE, lhs_value, rhs_value, "lte") :
-                LLVMBuildICmp(llvm->builder, LLVMIntSLE, lhs_value, rhs_value, "lte");
+            result = compares_float ? LLVMBuildFCmp(llvm->builder, LLVMRealOLE, lhs_value, rhs_value, "lte") :
+                LLVMBuildICmp(llvm->builder, compares_signed ? LLVMIntSLE : LLVMIntULE, lhs_value, rhs_value, "lte");
             break;
         case TOKEN_GT:
-            result = is_float ?
-                LLVMBuildFCmp(llvm->builder, LLVMRealOGT, lhs_value, rhs_value, "gt") :
-                LLVMBuildICmp(llvm->builder, LLVMIntSGT, lhs_value, rhs_value, "gt");
+            result = compares_float ? LLVMBuildFCmp(llvm->builder, LLVMRealOGT, lhs_value, rhs_value, "gt") :
+                LLVMBuildICmp(llvm->builder, compares_signed ? LLVMIntSGT : LLVMIntUGT, lhs_value, rhs_value, "gt");
             break;
         case TOKEN_GTE:
-            result = is_float ?
-                LLVMBuildFCmp(llvm->builder, LLVMRealOGE, lhs_value, rhs_value, "gte") :
-                LLVMBuildICmp(llvm->builder, LLVMIntSGE, lhs_value, rhs_value, "gte");
+            result = compares_float ? LLVMBuildFCmp(llvm->builder, LLVMRealOGE, lhs_value, rhs_value, "gte") :
+                LLVMBuildICmp(llvm->builder, compares_signed ? LLVMIntSGE : LLVMIntUGE, lhs_value, rhs_value, "gte");
             break;
         case TOKEN_EQ:
-            result = is_float ?
+            result = compares_float ?
                 LLVMBuildFCmp(llvm->builder, LLVMRealOEQ, lhs_value, rhs_value, "eq") :
                 LLVMBuildICmp(llvm->builder, LLVMIntEQ, lhs_value, rhs_value, "eq");
             break;
         case TOKEN_NEQ:
-            result = is_float ?
+            result = compares_float ?
                 LLVMBuildFCmp(llvm->builder, LLVMRealONE, lhs_value, rhs_value, "ne") :
                 LLVMBuildICmp(llvm->builder, LLVMIntNE, lhs_value, rhs_value, "ne");
             break;
@@ -1096,8 +2622,8 @@ static void emit_array_lit(void* self_, ast_array_lit_t* lit, void* out_)
     LLVMValueRef* out_val = out_;
     bool ret_lvalue = llvm->lvalue;
 
-    LLVMTypeRef array_type = llvm_type(llvm->context, lit->base.type);
-    LLVMValueRef array_alloc = LLVMBuildAlloca(llvm->builder, array_type, "array_lit");
+    LLVMTypeRef array_type = llvm_type(&llvm->types, lit->base.type);
+    LLVMValueRef array_alloc = build_entry_alloca(llvm, array_type, "array_lit");
 
     for (size_t i = 0; i < vec_size(&lit->exprs); ++i)
     {
@@ -1135,8 +2661,8 @@ static LLVMValueRef emit_ptr_to_array_elem(llvm_codegen_t* llvm, ast_type_t* arr
         case AST_TYPE_VIEW:
         {
             // For views: extract pointer from 2nd struct field and index into it
-            LLVMTypeRef view_type = llvm_type(llvm->context, array_type);
-            LLVMTypeRef elem_type = llvm_type(llvm->context, array_type->data.view.element_type);
+            LLVMTypeRef view_type = llvm_type(&llvm->types, array_type);
+            LLVMTypeRef elem_type = llvm_type(&llvm->types, array_type->data.view.element_type);
             LLVMValueRef view_indices[] = {
                 LLVMConstInt(LLVMInt32TypeInContext(llvm->context), 0, false),
                 LLVMConstInt(LLVMInt32TypeInContext(llvm->context), 1, false),
@@ -1148,22 +2674,27 @@ static LLVMValueRef emit_ptr_to_array_elem(llvm_codegen_t* llvm, ast_type_t* arr
             elem_ptr = LLVMBuildInBoundsGEP2(llvm->builder, elem_type, loaded_ptr, &index, 1, "elem_ptr");
             break;
         }
+        case AST_TYPE_HEAP_ARRAY:
+        {
+            // For heap arrays: load the data pointer from the 1st struct field and index into it
+            LLVMTypeRef elem_type = llvm_type(&llvm->types, array_type->data.heap_array.element_type);
+            LLVMValueRef data = load_heap_array_field(llvm, array_ptr, HEAP_ARRAY_DATA, "array_ptr");
+            elem_ptr = LLVMBuildInBoundsGEP2(llvm->builder, elem_type, data, &index, 1, "elem_ptr");
+            break;
+        }
         case AST_TYPE_ARRAY:
         {
             // For arrays: use two indices (dereference + index)
-            // Note: semantic analyzer enforces that index is i32, so extend to i64 for GEP
-            // FIXME: There should be a coercion node + type should be usize
-            LLVMTypeRef fixed_array_type = llvm_type(llvm->context, array_type);
-            LLVMValueRef index_i64 = LLVMBuildSExt(llvm->builder, index, LLVMInt64TypeInContext(llvm->context),
-                "index_i64");
-            LLVMValueRef indices[] = { LLVMConstInt(LLVMInt64TypeInContext(llvm->context), 0, false), index_i64 };
+            // Note: semantic analyzer coerces the index to usize, so it is already i64
+            LLVMTypeRef fixed_array_type = llvm_type(&llvm->types, array_type);
+            LLVMValueRef indices[] = { LLVMConstInt(LLVMInt64TypeInContext(llvm->context), 0, false), index };
             elem_ptr = LLVMBuildInBoundsGEP2(llvm->builder, fixed_array_type, array_ptr, indices, 2, "elem_ptr");
             break;
         }
         case AST_TYPE_POINTER:
         {
             // For pointers: use the element type that the pointer points to
-            LLVMTypeRef elem_type = llvm_type(llvm->context, array_type->data.pointer.pointee);
+            LLVMTypeRef elem_type = llvm_type(&llvm->types, array_type->data.pointer.pointee);
             elem_ptr = LLVMBuildGEP2(llvm->builder, elem_type, array_ptr, &index, 1, "elem_ptr");
             break;
         }
@@ -1187,11 +2718,13 @@ static LLVMValueRef emit_size_of_array(llvm_codegen_t* llvm, ast_type_t* array_t
         case AST_TYPE_VIEW:
         {
             // Views store their length in field 0 of the struct {i64 length, *element_type data}
-            LLVMTypeRef view_type = llvm_type(llvm->context, array_type);
+            LLVMTypeRef view_type = llvm_type(&llvm->types, array_type);
             LLVMTypeRef length_type = LLVMInt64TypeInContext(llvm->context);
             LLVMValueRef length_ptr = LLVMBuildStructGEP2(llvm->builder, view_type, array_ptr, 0, "length_ptr");
             return LLVMBuildLoad2(llvm->builder, length_type, length_ptr, "view_length");
         }
+        case AST_TYPE_HEAP_ARRAY:
+            return load_heap_array_field(llvm, array_ptr, HEAP_ARRAY_LENGTH, "heap_array_length");
         default:
             panic("Unhandled type %s", ast_type_string(array_type));
     }
@@ -1200,7 +2733,7 @@ static LLVMValueRef emit_size_of_array(llvm_codegen_t* llvm, ast_type_t* array_t
 static LLVMValueRef build_view_struct(llvm_codegen_t* llvm, ast_type_t* view_type, LLVMValueRef length,
     LLVMValueRef first_elem_ptr)
 {
-    LLVMTypeRef llvm_view_type = llvm_type(llvm->context, view_type);
+    LLVMTypeRef llvm_view_type = llvm_type(&llvm->types, view_type);
     LLVMValueRef view_struct = LLVMGetUndef(llvm_view_type);
     view_struct = LLVMBuildInsertValue(llvm->builder, view_struct, length, 0, "view_with_len");
     view_struct = LLVMBuildInsertValue(llvm->builder, view_struct, first_elem_ptr, 1, "view_with_data");
@@ -1216,8 +2749,8 @@ static void emit_array_slice(void* self_, ast_array_slice_t* slice, void* out_)
     LLVMValueRef end = nullptr;    // exclusive
     LLVMValueRef array_length = nullptr;  // only computed if needed for bounds checks
 
-    // Get value of array
-    llvm->lvalue = true;
+    // Get storage of array, or the value of a pointer
+    llvm->lvalue = slice->array->type->kind != AST_TYPE_POINTER;
     LLVMValueRef array_ptr = nullptr;
     ast_visitor_visit(llvm, slice->array, &array_ptr);
     llvm->lvalue = false;
@@ -1225,8 +2758,15 @@ static void emit_array_slice(void* self_, ast_array_slice_t* slice, void* out_)
     // Can only compute array length for arrays and views, not raw pointers
     bool can_bounds_check = slice->array->type->kind != AST_TYPE_POINTER;
 
+    // Runtime checks are needed if the slice was not verified at compile-time, unless they are turned off
+    bool emit_checks = false;
+    if (can_bounds_check && slice->bounds_safe)
+        ++llvm->stats.bounds_checks_proven;
+    else if (can_bounds_check)
+        emit_checks = should_emit_bounds_check(llvm);
+
     // Compute array length if we'll need it for bounds checks or if end is not specified
-    if (can_bounds_check && (!slice->bounds_safe || slice->end == nullptr))
+    if (can_bounds_check && (emit_checks || slice->end == nullptr))
         array_length = emit_size_of_array(llvm, slice->array->type, array_ptr);
 
     if (slice->start == nullptr)
@@ -1251,7 +2791,7 @@ static void emit_array_slice(void* self_, ast_array_slice_t* slice, void* out_)
 
     // Emit bounds checks if not verified at compile-time
     // Note: we don't bounds-check raw pointer slices (only arrays and views)
-    if (!slice->bounds_safe && can_bounds_check)
+    if (emit_checks)
     {
         // Check: start <= end (ensures size >= 0)
         LLVMValueRef start_le_end = LLVMBuildICmp(llvm->builder, LLVMIntULE, start, end, "start_le_end");
@@ -1265,7 +2805,10 @@ static void emit_array_slice(void* self_, ast_array_slice_t* slice, void* out_)
         }
     }
 
-    LLVMValueRef length = LLVMBuildSub(llvm->builder, end, start, "view_size");
+    // start <= end has been verified when checks are emitted, so the length can not wrap
+    LLVMValueRef length = emit_checks ?
+        LLVMBuildNUWSub(llvm->builder, end, start, "view_size") :
+        LLVMBuildSub(llvm->builder, end, start, "view_size");
     LLVMValueRef elem_ptr = emit_ptr_to_array_elem(llvm, slice->array->type, array_ptr, start);
 
     LLVMValueRef view = build_view_struct(llvm, slice->base.type, length, elem_ptr);
@@ -1282,38 +2825,44 @@ static void emit_array_subscript(void* self_, ast_array_subscript_t* subscript,
     set_debug_location(llvm, AST_NODE(subscript));
 
     ast_type_kind_t arr_kind = subscript->array->type->kind;
-    panic_if(arr_kind != AST_TYPE_ARRAY && arr_kind != AST_TYPE_VIEW && arr_kind != AST_TYPE_POINTER);
+    panic_if(arr_kind != AST_TYPE_ARRAY && arr_kind != AST_TYPE_HEAP_ARRAY && arr_kind != AST_TYPE_VIEW &&
+        arr_kind != AST_TYPE_POINTER);
 
-    // Get value of array
-    llvm->lvalue = true;
+    // Get storage of array, or the value of a pointer (ptr[index] indexes what it points to, wherever it is stored)
+    llvm->lvalue = arr_kind != AST_TYPE_POINTER;
     LLVMValueRef array_ptr = nullptr;
     ast_visitor_visit(llvm, subscript->array, &array_ptr);
     llvm->lvalue = false;
 
-    // If the array expression is a reference to a pointer variable, load it
-    if (subscript->array->type->kind == AST_TYPE_POINTER &&
-        subscript->array->base.kind == AST_EXPR_REF)
-    {
-        // This is ptr_var[index] - load the pointer value
-        LLVMTypeRef ptr_type = llvm_type(llvm->context, subscript->array->type);
-        array_ptr = LLVMBuildLoad2(llvm->builder, ptr_type, array_ptr, "ptr_val");
-    }
-
     // Get value of index
     LLVMValueRef index = nullptr;
     ast_visitor_visit(llvm, subscript->index, &index);
 
+    // Views that are invariant in the enclosing loops have their length and data loaded in the loop preheader
+    hoisted_view_t* hoisted = find_hoisted_view(llvm, subscript->array);
+
     // Emit bounds check if not verified at compile-time
     // Note: we don't bounds-check raw pointer subscripts (only arrays and views)
-    if (!subscript->bounds_safe && subscript->array->type->kind != AST_TYPE_POINTER)
+    bool can_bounds_check = subscript->array->type->kind != AST_TYPE_POINTER;
+    if (can_bounds_check && subscript->bounds_safe)
+        ++llvm->stats.bounds_checks_proven;
+    else if (can_bounds_check && should_emit_bounds_check(llvm))
     {
-        LLVMValueRef array_length = emit_size_of_array(llvm, subscript->array->type, array_ptr);
+        LLVMValueRef array_length = hoisted != nullptr ? hoisted->length :
+            emit_size_of_array(llvm, subscript->array->type, array_ptr);
         // Check: index < array_length (index is already usize/i64 from sema)
         LLVMValueRef in_bounds = LLVMBuildICmp(llvm->builder, LLVMIntULT, index, array_length, "in_bounds");
         emit_bounds_check_trap(llvm, in_bounds, "subscript.safe");
     }
 
-    LLVMValueRef elem_ptr = emit_ptr_to_array_elem(llvm, subscript->array->type, array_ptr, index);
+    LLVMValueRef elem_ptr;
+    if (hoisted != nullptr)
+    {
+        LLVMTypeRef elem_type = llvm_type(&llvm->types, subscript->array->type->data.view.element_type);
+        elem_ptr = LLVMBuildInBoundsGEP2(llvm->builder, elem_type, hoisted->data, &index, 1, "elem_ptr");
+    }
+    else
+        elem_ptr = emit_ptr_to_array_elem(llvm, subscript->array->type, array_ptr, index);
 
     if (ret_lvalue)
     {
@@ -1322,7 +2871,7 @@ static void emit_array_subscript(void* self_, ast_array_subscript_t* subscript,
     }
     else
     {
-        LLVMValueRef element = LLVMBuildLoad2(llvm->builder, llvm_type(llvm->context, subscript->base.type), elem_ptr,
+        LLVMValueRef element = LLVMBuildLoad2(llvm->builder, llvm_type(&llvm->types, subscript->base.type), elem_ptr,
             "arr_elem");
         if (out_val != nullptr)
             *out_val = element;
@@ -1345,7 +2894,7 @@ static void emit_call_expr(void* self_, ast_call_expr_t* call, void* out_)
     set_debug_location(llvm, AST_NODE(call));
 
     // Get function name from symbol and construct mangled name
-    panic_if(call->function_symbol == nullptr || call->function_symbol->kind != SYMBOL_FUNCTION);
+    panic_if(call->function_symbol == nullptr || !symbol_is_function(call->function_symbol));
     const char* fn_name = MANGLE_FUNCTION_NAME(call->function_symbol);
     LLVMValueRef fn = LLVMGetNamedFunction(llvm->module, fn_name);
     panic_if(fn == nullptr);
@@ -1364,9 +2913,9 @@ static void emit_call_expr(void* self_, ast_call_expr_t* call, void* out_)
         }
     }
 
-    LLVMTypeRef fn_type = LLVMGlobalGetValueType(fn);
-    LLVMValueRef call_result = LLVMBuildCall2(llvm->builder, fn_type, fn, args, (unsigned int)arg_count,
+    LLVMValueRef call_result = build_direct_call(llvm, fn, args, (unsigned int)arg_count,
         call->base.type == ast_type_builtin(TYPE_VOID) ? "" : "call");
+    add_call_attributes(llvm, call_result, fn);
 
     if (out != nullptr)
         *out = call_result;
@@ -1387,7 +2936,7 @@ static void emit_cast_expr(void* self_, ast_cast_expr_t* cast, void* out_)
     ast_type_t* from = cast->expr->type;
     ast_type_t* to = cast->target;
 
-    LLVMTypeRef target_llvm_type = llvm_type(llvm->context, to);
+    LLVMTypeRef target_llvm_type = llvm_type(&llvm->types, to);
     LLVMValueRef result = nullptr;
 
     // Pointer to pointer cast
@@ -1467,7 +3016,7 @@ static void emit_cast_expr(void* self_, ast_cast_expr_t* cast, void* out_)
     // Integer to bool cast
     else if (ast_type_is_integer(from) && to == ast_type_builtin(TYPE_BOOL))
     {
-        LLVMValueRef zero = LLVMConstInt(llvm_type(llvm->context, from), 0, false);
+        LLVMValueRef zero = LLVMConstInt(llvm_type(&llvm->types, from), 0, false);
         result = LLVMBuildICmp(llvm->builder, LLVMIntNE, value, zero, "int2bool");
     }
     else
@@ -1504,7 +3053,7 @@ static void emit_coercion_expr(void* self_, ast_coercion_expr_t* coercion, void*
             LLVMConstInt(LLVMInt32TypeInContext(llvm->context), 0, false)
         };
         LLVMValueRef first_elem_ptr = LLVMBuildInBoundsGEP2(llvm->builder,
-            llvm_type(llvm->context, from_type), array_ptr, indices, 2, "array_first_elem");
+            llvm_type(&llvm->types, from_type), array_ptr, indices, 2, "array_first_elem");
 
         LLVMValueRef view_struct = build_view_struct(llvm, to_type, length, first_elem_ptr);
 
@@ -1512,6 +3061,22 @@ static void emit_coercion_expr(void* self_, ast_coercion_expr_t* coercion, void*
             *out_val = view_struct;
         return;
     }
+    else if (from_type->kind == AST_TYPE_HEAP_ARRAY && to_type->kind == AST_TYPE_VIEW)
+    {
+        // Heap array to view coercion: the view borrows the array's storage, nothing is copied
+        llvm->lvalue = true;
+        LLVMValueRef array_ptr = nullptr;
+        ast_visitor_visit(llvm, coercion->expr, &array_ptr);
+        llvm->lvalue = false;
+
+        LLVMValueRef length = load_heap_array_field(llvm, array_ptr, HEAP_ARRAY_LENGTH, "heap_array_length");
+        LLVMValueRef data = load_heap_array_field(llvm, array_ptr, HEAP_ARRAY_DATA, "heap_array_data");
+        LLVMValueRef view_struct = build_view_struct(llvm, to_type, length, data);
+
+        if (out_val != nullptr)
+            *out_val = view_struct;
+        return;
+    }
     else if (from_type == ast_type_builtin(TYPE_UNINIT))
     {
         // From "uninit" coercion
@@ -1529,7 +3094,7 @@ static void emit_coercion_expr(void* self_, ast_coercion_expr_t* coercion, void*
         LLVMValueRef value = nullptr;
         ast_visitor_visit(llvm, coercion->expr, &value);
 
-        LLVMTypeRef target_llvm_type = llvm_type(llvm->context, to_type);
+        LLVMTypeRef target_llvm_type = llvm_type(&llvm->types, to_type);
         size_t from_size = ast_type_sizeof(from_type);
         size_t to_size = ast_type_sizeof(to_type);
 
@@ -1587,8 +3152,8 @@ static void emit_construct_expr(void* self_, ast_construct_expr_t* construct, vo
     class_layout_t* layout = hash_table_find(&llvm->class_layouts, fq_class_name);
     panic_if(layout == nullptr);
 
-    LLVMTypeRef class_type = llvm_type(llvm->context, construct->class_type);
-    LLVMValueRef instance = LLVMBuildAlloca(llvm->builder, class_type, "construct");
+    LLVMTypeRef class_type = llvm_type(&llvm->types, construct->class_type);
+    LLVMValueRef instance = build_entry_alloca(llvm, class_type, "construct");
 
     for (size_t i = 0; i < vec_size(&construct->member_inits); ++i)
     {
@@ -1651,7 +3216,7 @@ static void emit_ref_expr(void* self_, ast_ref_expr_t* ref, void* out_)
     else
     {
         // Otherwise, load the value from the alloca
-        LLVMTypeRef var_type = llvm_type(llvm->context, ref->base.type);
+        LLVMTypeRef var_type = llvm_type(&llvm->types, ref->base.type);
         *out = LLVMBuildLoad2(llvm->builder, var_type, alloca_ref, ref->name);
     }
 }
@@ -1675,7 +3240,7 @@ static void emit_self_expr(void* self_, ast_self_expr_t* self_expr, void* out_)
     else
     {
         // Otherwise, load the self pointer value from the alloca
-        LLVMTypeRef self_type = llvm_type(llvm->context, self_expr->base.type);
+        LLVMTypeRef self_type = llvm_type(&llvm->types, self_expr->base.type);
         *out_val = LLVMBuildLoad2(llvm->builder, self_type, self_alloc, "self");
     }
 }
@@ -1690,6 +3255,14 @@ static void emit_unary_op(void* self_, ast_unary_op_t* unary, void* out_)
     {
         case TOKEN_AMPERSAND:
         {
+            // The address of a function is the function itself
+            if (unary->function_symbol != nullptr)
+            {
+                *out = LLVMGetNamedFunction(llvm->module, FUNCTION_SYMBOL_NAME(unary->function_symbol));
+                panic_if(*out == nullptr);
+                break;
+            }
+
             llvm->lvalue = true;
             ast_visitor_visit(llvm, unary->expr, out);
             llvm->lvalue = false;
@@ -1711,7 +3284,7 @@ static void emit_unary_op(void* self_, ast_unary_op_t* unary, void* out_)
             else
             {
                 // Load from the pointer
-                LLVMTypeRef deref_type = llvm_type(llvm->context, unary->base.type);
+                LLVMTypeRef deref_type = llvm_type(&llvm->types, unary->base.type);
                 *out = LLVMBuildLoad2(llvm->builder, deref_type, ptr_value, "deref");
             }
             break;
@@ -1742,13 +3315,8 @@ static void emit_compound_stmt(void* self_, ast_compound_stmt_t* block, void* ou
     for (size_t i = 0; i < vec_size(&block->inner_stmts); ++i)
         ast_visitor_visit(self_, vec_get(&block->inner_stmts, i), out_);
 
-    // Emit destructors for variables declared in this block (if block doesn't have terminator)
-    LLVMBasicBlockRef current_block = LLVMGetInsertBlock(llvm->builder);
-    if (LLVMGetBasicBlockTerminator(current_block) == nullptr)
-        emit_scope_destructors(llvm, llvm->destructor_scope);
-
-    // Pop destructor scope
-    pop_destructor_scope(llvm);
+    // Destroy variables declared in this block
+    end_destructor_scope(llvm);
 }
 
 static void emit_decl_stmt(void* self_, ast_decl_stmt_t* stmt, void* out_)
@@ -1813,16 +3381,50 @@ static void emit_inc_dec_stmt(void* self_, ast_inc_dec_stmt_t* stmt, void* out_)
     ast_visitor_visit(llvm, stmt->operand, &operand_addr);
     llvm->lvalue = false;
 
-    LLVMTypeRef operand_type = llvm_type(llvm->context, stmt->operand->type);
+    LLVMTypeRef operand_type = llvm_type(&llvm->types, stmt->operand->type);
     LLVMValueRef current_value = LLVMBuildLoad2(llvm->builder, operand_type, operand_addr, "inc_dec.load");
     LLVMValueRef one = LLVMConstInt(operand_type, 1, false);
-    LLVMValueRef new_value = stmt->increment ?
-        LLVMBuildAdd(llvm->builder, current_value, one, "inc") :
-        LLVMBuildSub(llvm->builder, current_value, one, "dec");
+    LLVMValueRef new_value;
+    if (stmt == llvm->no_wrap_counter_step)
+    {
+        new_value = stmt->increment ?
+            LLVMBuildNSWAdd(llvm->builder, current_value, one, "inc") :
+            LLVMBuildNSWSub(llvm->builder, current_value, one, "dec");
+    }
+    else
+    {
+        new_value = stmt->increment ?
+            LLVMBuildAdd(llvm->builder, current_value, one, "inc") :
+            LLVMBuildSub(llvm->builder, current_value, one, "dec");
+    }
 
     LLVMBuildStore(llvm->builder, new_value, operand_addr);
 }
 
+// Whether value is a call that is immediately followed by the return being emitted
+static bool is_last_call(llvm_codegen_t* llvm, LLVMValueRef value)
+{
+    return value != nullptr && LLVMIsACallInst(value) != nullptr &&
+        LLVMGetLastInstruction(LLVMGetInsertBlock(llvm->builder)) == value;
+}
+
+// A call in tail position may reuse the caller's frame when the callee can not access the caller's locals. For
+// `return @tail` sema has checked that this holds and that the prototypes match, so the call is made a guaranteed
+// tail call; otherwise it is only a hint, given when no local's address has been handed out.
+static void mark_tail_call(llvm_codegen_t* llvm, LLVMValueRef call, bool guaranteed)
+{
+    if (guaranteed)
+    {
+        // Sema rejects @tail between functions whose calling conventions may differ
+        panic_if(LLVMGetInstructionCallConv(call) != LLVMGetFunctionCallConv(llvm->current_function));
+        LLVMSetTailCallKind(call, LLVMTailCallKindMustTail);
+    }
+    else if (!llvm->current_fn_locals_escape)
+    {
+        LLVMSetTailCall(call, true);
+    }
+}
+
 static void emit_return_stmt(void* self_, ast_return_stmt_t* stmt, void* out_)
 {
     llvm_codegen_t* llvm = self_;
@@ -1830,13 +3432,30 @@ static void emit_return_stmt(void* self_, ast_return_stmt_t* stmt, void* out_)
 
     set_debug_location(llvm, AST_NODE(stmt));
 
-    // Emit destructors for all scopes before returning
-    emit_all_scope_destructors(llvm);
-
+    LLVMValueRef return_val = nullptr;
     if (stmt->value_expr != nullptr)
-    {
-        LLVMValueRef return_val = nullptr;
         ast_visitor_visit(llvm, stmt->value_expr, &return_val);
+
+    // With destructors pending, the value is stored and all scopes are left through their cleanup blocks to the
+    // function's shared return block
+    if (has_pending_destructors(llvm))
+    {
+        if (return_val != nullptr)
+        {
+            if (llvm->return_slot == nullptr)
+                llvm->return_slot = build_entry_alloca(llvm, LLVMTypeOf(return_val), "retval.slot");
+            LLVMBuildStore(llvm->builder, return_val, llvm->return_slot);
+        }
+        if (llvm->return_block == nullptr)
+            llvm->return_block = LLVMAppendBasicBlock(llvm->current_function, "return");
+        emit_scope_exit(llvm, nullptr, llvm->return_block, nullptr);
+        return;
+    }
+
+    if (return_val != nullptr)
+    {
+        if (is_last_call(llvm, return_val))
+            mark_tail_call(llvm, return_val, stmt->tail_call);
         LLVMBuildRet(llvm->builder, return_val);
     }
     else
@@ -1852,11 +3471,8 @@ static void emit_break_stmt(void* self_, ast_break_stmt_t* stmt, void* out_)
 
     set_debug_location(llvm, AST_NODE(stmt));
 
-    // Emit destructors for all scopes before breaking out of loop
-    emit_all_scope_destructors(llvm);
-
-    // Jump to the break block of the current loop
-    LLVMBuildBr(llvm->builder, llvm->loop_context->break_block);
+    // Jump to the break block of the current loop, destroying variables declared inside the loop
+    emit_scope_exit(llvm, llvm->loop_context->scope, llvm->loop_context->break_block, nullptr);
 }
 
 static void emit_continue_stmt(void* self_, ast_continue_stmt_t* stmt, void* out_)
@@ -1866,11 +3482,10 @@ static void emit_continue_stmt(void* self_, ast_continue_stmt_t* stmt, void* out
 
     set_debug_location(llvm, AST_NODE(stmt));
 
-    // Emit destructors for all scopes before continuing to next iteration
-    emit_all_scope_destructors(llvm);
-
-    // Jump to the continue block of the current loop
-    LLVMBuildBr(llvm->builder, llvm->loop_context->continue_block);
+    // Jump to the continue block of the current loop, destroying variables declared in the loop body
+    loop_context_t* loop_ctx = llvm->loop_context;
+    emit_scope_exit(llvm, loop_ctx->scope, loop_ctx->continue_block,
+        loop_ctx->continue_is_backedge ? loop_ctx : nullptr);
 }
 
 static void emit_while_stmt(void* self_, ast_while_stmt_t* stmt, void* out_)
@@ -1889,11 +3504,17 @@ static void emit_while_stmt(void* self_, ast_while_stmt_t* stmt, void* out_)
     {
         .continue_block = cond_block,
         .break_block = end_block,
+        .loop_id = build_loop_id(llvm, &stmt->hints),
+        .continue_is_backedge = true,
+        .hoisted_views = VEC_INIT(free),
+        .scope = llvm->destructor_scope,
         .parent = llvm->loop_context
     };
     llvm->loop_context = &loop_ctx;
 
-    // Branch to condition block
+    // Load invariant views in the preheader, then branch to condition block
+    loop_writes_t* writes = find_loop_writes(llvm->loop_writes, AST_NODE(stmt));
+    hoist_loop_invariant_views(llvm, writes, &loop_ctx);
     LLVMBuildBr(llvm->builder, cond_block);
 
     // Emit condition block
@@ -1909,10 +3530,10 @@ static void emit_while_stmt(void* self_, ast_while_stmt_t* stmt, void* out_)
     // Note: after emitting body, builder may be in a different block (e.g., bounds check safe block)
     LLVMBasicBlockRef current_block = LLVMGetInsertBlock(llvm->builder);
     if (LLVMGetBasicBlockTerminator(current_block) == nullptr)
-        LLVMBuildBr(llvm->builder, cond_block);
+        set_loop_metadata(llvm, LLVMBuildBr(llvm->builder, cond_block), &loop_ctx);
 
     // Restore parent loop context
-    llvm->loop_context = loop_ctx.parent;
+    end_loop(llvm, &loop_ctx);
 
     // Continue after while loop
     LLVMPositionBuilderAtEnd(llvm->builder, end_block);
@@ -1942,11 +3563,16 @@ static void emit_for_stmt(void* self_, ast_for_stmt_t* stmt, void* out_)
     {
         .continue_block = post_block,
         .break_block = end_block,
+        .loop_id = build_loop_id(llvm, &stmt->hints),
+        .hoisted_views = VEC_INIT(free),
+        .scope = llvm->destructor_scope,
         .parent = llvm->loop_context
     };
     llvm->loop_context = &loop_ctx;
 
-    // Branch to condition block
+    // Load invariant views in the preheader, then branch to condition block
+    loop_writes_t* writes = find_loop_writes(llvm->loop_writes, AST_NODE(stmt));
+    hoist_loop_invariant_views(llvm, writes, &loop_ctx);
     LLVMBuildBr(llvm->builder, cond_block);
 
     // Emit condition block
@@ -1972,21 +3598,23 @@ static void emit_for_stmt(void* self_, ast_for_stmt_t* stmt, void* out_)
     // Emit post block
     LLVMPositionBuilderAtEnd(llvm->builder, post_block);
     if (stmt->post_stmt != nullptr)
+    {
+        if (loop_counter_cannot_wrap(llvm, stmt, writes))
+            llvm->no_wrap_counter_step = (ast_inc_dec_stmt_t*)stmt->post_stmt;
         ast_visitor_visit(llvm, stmt->post_stmt, out_);
+        llvm->no_wrap_counter_step = nullptr;
+    }
     // Branch back to condition
-    LLVMBuildBr(llvm->builder, cond_block);
+    set_loop_metadata(llvm, LLVMBuildBr(llvm->builder, cond_block), &loop_ctx);
 
     // Restore parent loop context
-    llvm->loop_context = loop_ctx.parent;
+    end_loop(llvm, &loop_ctx);
 
     // Continue after for loop
     LLVMPositionBuilderAtEnd(llvm->builder, end_block);
 
     // Destroy init variables when loop exits
-    emit_scope_destructors(llvm, llvm->destructor_scope);
-
-    // Pop destructor scope
-    pop_destructor_scope(llvm);
+    end_destructor_scope(llvm);
 }
 
 static void class_layout_destroy(void* layout_)
@@ -2006,19 +3634,24 @@ llvm_codegen_t* llvm_codegen_create(const char* project_name, const char* module
 {
     llvm_codegen_t* llvm = malloc(sizeof(*llvm));
 
-    // Initialize LLVM C API objects
-    llvm->context = LLVMContextCreate();
+    // Initialize LLVM C API objects; the context is created thread-safe so that the module can be handed to the JIT
+    llvm->thread_safe_context = LLVMOrcCreateNewThreadSafeContext();
+    llvm->context = LLVMOrcThreadSafeContextGetContext(llvm->thread_safe_context);
     llvm->module = LLVMModuleCreateWithNameInContext(ssprintf("%s.%s", project_name, module_name), llvm->context);
     llvm->builder = LLVMCreateBuilderInContext(llvm->context);
     llvm->current_function = nullptr;
 
     // NOTE: We do not need to init the visitor because we override every implementation
     *llvm = (llvm_codegen_t){
+        .thread_safe_context = llvm->thread_safe_context,
         .context = llvm->context,
         .module = llvm->module,
         .builder = llvm->builder,
         .presenter = ast_presenter_create(),
         .class_layouts = HASH_TABLE_INIT(class_layout_destroy),
+        .options = compiler_options_default(),
+        .bounds_checks = true,
+        .stats.unchecked_functions = VEC_INIT(free),
         .base = (ast_visitor_t){
             .visit_root = emit_root,
             // Declarations
@@ -2063,6 +3696,7 @@ llvm_codegen_t* llvm_codegen_create(const char* project_name, const char* module
             .visit_while_stmt = emit_while_stmt,
         },
     };
+    llvm_type_cache_init(&llvm->types, llvm->context);
 
     return llvm;
 }
@@ -2075,42 +3709,147 @@ void llvm_codegen_destroy(llvm_codegen_t* llvm)
     // Clean up debug info (if initialized)
     if (llvm->di_scopes != nullptr)
         hash_table_destroy(llvm->di_scopes);
+    if (llvm->di_class_types != nullptr)
+        hash_table_destroy(llvm->di_class_types);
     if (llvm->di_builder != nullptr)
         LLVMDisposeDIBuilder(llvm->di_builder);
 
     // Clean up LLVM C API objects
+    if (llvm->target_machine != nullptr)
+        LLVMDisposeTargetMachine(llvm->target_machine);
+    free(llvm->target_cpu);
+    free(llvm->target_features);
+    llvm_type_cache_deinit(&llvm->types);
     if (llvm->builder != nullptr)
         LLVMDisposeBuilder(llvm->builder);
     if (llvm->module != nullptr)
         LLVMDisposeModule(llvm->module);
-    if (llvm->context != nullptr)
-        LLVMContextDispose(llvm->context);
+    if (llvm->thread_safe_context != nullptr)
+        LLVMOrcDisposeThreadSafeContext(llvm->thread_safe_context);
 
     ast_presenter_destroy(llvm->presenter);
     hash_table_deinit(&llvm->class_layouts);
+    vec_deinit(&llvm->stats.unchecked_functions);
 
     free(llvm);
 }
 
-void llvm_codegen_init(llvm_codegen_t* llvm, const char* module_name, semantic_context_t* sema_ctx)
+// Target the host triple with the CPU and features chosen in the options. The module takes its data layout from the
+// target machine, so that type sizes computed during codegen match the emitted code.
+static void init_target(llvm_codegen_t* llvm)
+{
+    LLVMInitializeNativeTarget();
+
+    char* triple = LLVMGetDefaultTargetTriple();
+    LLVMTargetRef target = nullptr;
+    char* error = nullptr;
+    if (LLVMGetTargetFromTriple(triple, &target, &error))
+        panic("No LLVM target for %s: %s", triple, error);
+
+    bool native = llvm->options.target_cpu != nullptr && strcmp(llvm->options.target_cpu, "native") == 0;
+    if (native)
+    {
+        char* host_cpu = LLVMGetHostCPUName();
+        llvm->target_cpu = strdup(host_cpu);
+        LLVMDisposeMessage(host_cpu);
+    }
+    else
+        llvm->target_cpu = strdup(llvm->options.target_cpu != nullptr ? llvm->options.target_cpu : "");
+
+    // Explicit features are appended to the host's, so they can also turn host features off
+    string_t features = STRING_INIT;
+    if (native)
+    {
+        char* host_features = LLVMGetHostCPUFeatures();
+        string_append_cstr(&features, host_features);
+        LLVMDisposeMessage(host_features);
+    }
+    if (llvm->options.target_features != nullptr && llvm->options.target_features[0] != '\0')
+    {
+        if (string_len(&features) > 0)
+            string_append_char(&features, ',');
+        string_append_cstr(&features, llvm->options.target_features);
+    }
+    llvm->target_features = string_release(&features);
+
+    llvm->target_machine = LLVMCreateTargetMachine(target, triple, llvm->target_cpu, llvm->target_features,
+        llvm->options.release ? LLVMCodeGenLevelDefault : LLVMCodeGenLevelNone, LLVMRelocPIC, LLVMCodeModelDefault);
+    LLVMSetTarget(llvm->module, triple);
+    LLVMTargetDataRef layout = LLVMCreateTargetDataLayout(llvm->target_machine);
+    LLVMSetModuleDataLayout(llvm->module, layout);
+    LLVMDisposeTargetData(layout);
+    LLVMDisposeMessage(triple);
+}
+
+// The C API has no PGO options; pgo-instr-use takes the profile from its command line option instead. LLVM options are
+// process-wide, which is fine as all modules of a build share one profile.
+static void set_profile_use_file(const char* path)
+{
+    static bool is_set = false;
+    if (is_set)
+        return;
+
+    const char* args[] = { "shiro", ssprintf("-pgo-test-profile-file=%s", path) };
+    LLVMParseCommandLineOptions(2, args, nullptr);
+    is_set = true;
+}
+
+// Instrument the module, or annotate it with the branch weights and entry counts of a profile, before it is handed to
+// the optimizer. Both happen on the IR exactly as emitted, so the control-flow hashes recorded by --profile-generate
+// match what --profile-use computes.
+static void run_profile_passes(llvm_codegen_t* llvm)
+{
+    const char* pipeline = nullptr;
+    if (llvm->options.profile_generate)
+        pipeline = "pgo-instr-gen,instrprof";
+    else if (llvm->options.profile_use != nullptr)
+    {
+        set_profile_use_file(llvm->options.profile_use);
+        pipeline = "pgo-instr-use";
+    }
+    else
+        return;
+
+    LLVMPassBuilderOptionsRef pass_options = LLVMCreatePassBuilderOptions();
+    LLVMErrorRef error = LLVMRunPasses(llvm->module, pipeline, llvm->target_machine, pass_options);
+    LLVMDisposePassBuilderOptions(pass_options);
+    if (error != nullptr)
+    {
+        char* message = LLVMGetErrorMessage(error);
+        panic("Running %s failed: %s", pipeline, message);
+    }
+}
+
+void llvm_codegen_init(llvm_codegen_t* llvm, const char* module_name, semantic_context_t* sema_ctx,
+    const compiler_options_t* options)
 {
     llvm->sema_ctx = sema_ctx;
+    llvm->options = *options;
+    llvm->bounds_checks = compiler_options_bounds_checks_enabled(options);
+    init_target(llvm);
 
     // Register builtin functions
     register_builtins(llvm);
 
-    // Initialize debug info
+    // Initialize debug info; without it no debug metadata is created at all
+    llvm->debug_info = compiler_options_debug_info(options);
+    llvm->current_di_scope = nullptr;
+    if (llvm->debug_info == DEBUG_INFO_NONE)
+        return;
+
     llvm->di_builder = LLVMCreateDIBuilder(llvm->module);
 
     // Create a synthetic file for the module compile unit
     LLVMMetadataRef module_file = LLVMDIBuilderCreateFile(llvm->di_builder, module_name, strlen(module_name), ".", 1);
 
     // Create compile unit for the whole module
+    LLVMDWARFEmissionKind emission = llvm->debug_info == DEBUG_INFO_FULL ? LLVMDWARFEmissionFull :
+        LLVMDWARFEmissionLineTablesOnly;
     llvm->di_compile_unit = LLVMDIBuilderCreateCompileUnit(llvm->di_builder, LLVMDWARFSourceLanguageC, module_file,
-        "ShiroC Compiler", 16, 0, "", 0, 0, "", 0, LLVMDWARFEmissionFull, 0, 0, 0, "", 0, "", 0);
+        "ShiroC Compiler", 16, 0, "", 0, 0, "", 0, emission, 0, 0, 0, "", 0, "", 0);
 
     llvm->di_scopes = hash_table_create(nullptr);
-    llvm->current_di_scope = nullptr;
+    llvm->di_class_types = hash_table_create(nullptr);
 }
 
 void llvm_codegen_add_ast(llvm_codegen_t* llvm, ast_node_t* root, const char* source_filename)
@@ -2125,7 +3864,11 @@ void llvm_codegen_add_ast(llvm_codegen_t* llvm, ast_node_t* root, const char* so
     char* directory = dir_len > 0 ? strndup(source_filename, dir_len) : strdup(".");
 
     // Create debug info file for this specific source
-    llvm->di_file = LLVMDIBuilderCreateFile(llvm->di_builder, filename, strlen(filename), directory, strlen(directory));
+    if (llvm->di_builder != nullptr)
+    {
+        llvm->di_file = LLVMDIBuilderCreateFile(llvm->di_builder, filename, strlen(filename), directory,
+            strlen(directory));
+    }
 
     // Generate the LLVM IR into the module (accumulates with previous ASTs)
     ast_visitor_visit(llvm, root, nullptr);
@@ -2133,21 +3876,71 @@ void llvm_codegen_add_ast(llvm_codegen_t* llvm, ast_node_t* root, const char* so
     free(directory);
 }
 
-void llvm_codegen_finalize(llvm_codegen_t* llvm, FILE* out)
+// Complete the module once all ASTs are added: finalize debug info and apply the profile passes
+static void finish_module(llvm_codegen_t* llvm)
 {
     // Finalize debug info
-    LLVMDIBuilderFinalize(llvm->di_builder);
+    if (llvm->di_builder != nullptr)
+    {
+        LLVMDIBuilderFinalize(llvm->di_builder);
+
+        // Add module flags for debug info version (required by LLVM)
+        LLVMMetadataRef debug_info_version = LLVMValueAsMetadata(
+            LLVMConstInt(LLVMInt32TypeInContext(llvm->context), 3, false));
+        LLVMMetadataRef dwarf_version = LLVMValueAsMetadata(
+            LLVMConstInt(LLVMInt32TypeInContext(llvm->context), 4, false));
+        LLVMAddModuleFlag(llvm->module, LLVMModuleFlagBehaviorWarning, "Dwarf Version", 13, dwarf_version);
+        LLVMAddModuleFlag(llvm->module, LLVMModuleFlagBehaviorWarning, "Debug Info Version", 18,
+            debug_info_version);
+    }
+
+    run_profile_passes(llvm);
+}
 
-    // Add module flags for debug info version (required by LLVM)
-    LLVMMetadataRef debug_info_version = LLVMValueAsMetadata(
-        LLVMConstInt(LLVMInt32TypeInContext(llvm->context), 3, false));
-    LLVMMetadataRef dwarf_version = LLVMValueAsMetadata(
-        LLVMConstInt(LLVMInt32TypeInContext(llvm->context), 4, false));
-    LLVMAddModuleFlag(llvm->module, LLVMModuleFlagBehaviorWarning, "Dwarf Version", 13, dwarf_version);
-    LLVMAddModuleFlag(llvm->module, LLVMModuleFlagBehaviorWarning, "Debug Info Version", 18, debug_info_version);
+void llvm_codegen_finalize(llvm_codegen_t* llvm, FILE* out)
+{
+    finish_module(llvm);
 
     // Print the module to a string
     char* ir_string = LLVMPrintModuleToString(llvm->module);
     fprintf(out, "%s", ir_string);
     LLVMDisposeMessage(ir_string);
 }
+
+LLVMOrcThreadSafeModuleRef llvm_codegen_release_module(llvm_codegen_t* llvm)
+{
+    finish_module(llvm);
+
+    // Nothing runs clang on the module, so the optimizations it would apply for --release are run here
+    if (llvm->options.release)
+    {
+        LLVMPassBuilderOptionsRef pass_options = LLVMCreatePassBuilderOptions();
+        LLVMErrorRef error = LLVMRunPasses(llvm->module, "default<O2>", llvm->target_machine, pass_options);
+        LLVMDisposePassBuilderOptions(pass_options);
+        if (error != nullptr)
+        {
+            char* message = LLVMGetErrorMessage(error);
+            panic("Running default<O2> failed: %s", message);
+        }
+    }
+
+    LLVMOrcThreadSafeModuleRef module = LLVMOrcCreateNewThreadSafeModule(llvm->module, llvm->thread_safe_context);
+    llvm->module = nullptr;
+    return module;
+}
+
+void llvm_codegen_print_stats(llvm_codegen_t* llvm, FILE* out)
+{
+    size_t name_len;
+    const char* module_name = LLVMGetModuleIdentifier(llvm->module, &name_len);
+    fprintf(out, "Codegen statistics for %s:\n", module_name);
+    fprintf(out, "  bounds-check policy:      %s%s (%s)\n", bounds_check_policy_str(llvm->options.bounds_checks),
+        llvm->options.release ? ", release" : "", llvm->bounds_checks ? "checks enabled" : "checks disabled");
+    fprintf(out, "  bounds checks emitted:    %zu\n", llvm->stats.bounds_checks_emitted);
+    fprintf(out, "  bounds checks proven:     %zu\n", llvm->stats.bounds_checks_proven);
+    fprintf(out, "  bounds checks suppressed: %zu\n", llvm->stats.bounds_checks_suppressed);
+    fprintf(out, "  bounds-check trap blocks: %zu\n", llvm->stats.bounds_check_trap_blocks);
+    fprintf(out, "  unchecked functions:      %zu\n", vec_size(&llvm->stats.unchecked_functions));
+    for (size_t i = 0; i < vec_size(&llvm->stats.unchecked_functions); ++i)
+        fprintf(out, "    %s\n", (char*)vec_get(&llvm->stats.unchecked_functions, i));
+}
@@ -2,9 +2,11 @@
 #define LLVM_CODEGEN__H
 
 #include <llvm-c/Core.h>
+#include <llvm-c/Orc.h>
 #include <stdio.h>
 
 typedef struct ast_node ast_node_t;
+typedef struct compiler_options compiler_options_t;
 typedef struct semantic_context semantic_context_t;
 typedef struct llvm_codegen llvm_codegen_t;
 
@@ -12,10 +14,19 @@ llvm_codegen_t* llvm_codegen_create(const char* project_name, const char* module
 
 void llvm_codegen_destroy(llvm_codegen_t* llvm);
 
-void llvm_codegen_init(llvm_codegen_t* llvm, const char* module_name, semantic_context_t* sema_ctx);
+void llvm_codegen_init(llvm_codegen_t* llvm, const char* module_name, semantic_context_t* sema_ctx,
+    const compiler_options_t* options);
 
 void llvm_codegen_add_ast(llvm_codegen_t* llvm, ast_node_t* root, const char* source_filename);
 
 void llvm_codegen_finalize(llvm_codegen_t* llvm, FILE* out);
 
+// Alternative to llvm_codegen_finalize for running the module in-process: completes the module like finalize, applies
+// the --release optimizations clang would otherwise apply, and hands it over to the caller (e.g. llvm_jit_add_module).
+// Statistics have to be printed before, as the codegen no longer has a module afterwards.
+LLVMOrcThreadSafeModuleRef llvm_codegen_release_module(llvm_codegen_t* llvm);
+
+// Print statistics gathered during code generation (bounds-check policy, checks emitted/suppressed, etc.)
+void llvm_codegen_print_stats(llvm_codegen_t* llvm, FILE* out);
+
 #endif
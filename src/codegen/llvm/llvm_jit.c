@@ -0,0 +1,285 @@
+#include "llvm_jit.h"
+
+#include "codegen/llvm/llvm_codegen.h"
+#include "common/containers/hash_table.h"
+#include "common/debug/panic.h"
+#include "runtime/builtins.h"
+
+#include <llvm-c/Error.h>
+#include <llvm-c/LLJIT.h>
+#include <llvm-c/Orc.h>
+#include <llvm-c/Target.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct llvm_jit
+{
+    LLVMOrcLLJITRef lljit;
+    LLVMOrcExecutionSessionRef session;
+    LLVMOrcLazyCallThroughManagerRef call_through;  // with stubs, backs the lazy re-exports between JITDylibs
+    LLVMOrcIndirectStubsManagerRef stubs;
+    hash_table_t exports;  // function name (char*) -> LLVMOrcJITDylibRef of the module defining it
+};
+
+typedef struct runtime_symbol
+{
+    const char* name;
+    void (*address)(void);
+} runtime_symbol_t;
+
+// The runtime builtins are linked into the compiler, but executables do not export their symbols, so they can not be
+// found by searching the process like libc functions are
+static const runtime_symbol_t RUNTIME_SYMBOLS[] = {
+    { "printI32", (void (*)(void))printI32 },
+    { "shiro_abort", (void (*)(void))shiro_abort },
+    { "shiro_format_i64", (void (*)(void))shiro_format_i64 },
+    { "shiro_format_u64", (void (*)(void))shiro_format_u64 },
+    { "shiro_format_f64", (void (*)(void))shiro_format_f64 },
+    { "shiro_hash_bytes", (void (*)(void))shiro_hash_bytes },
+    { "shiro_heap_array_grow", (void (*)(void))shiro_heap_array_grow },
+    { "shiro_mutex_create", (void (*)(void))shiro_mutex_create },
+    { "shiro_mutex_destroy", (void (*)(void))shiro_mutex_destroy },
+    { "shiro_mutex_lock", (void (*)(void))shiro_mutex_lock },
+    { "shiro_mutex_unlock", (void (*)(void))shiro_mutex_unlock },
+    { "shiro_parallel_for", (void (*)(void))shiro_parallel_for },
+    { "shiro_parallel_set_threads", (void (*)(void))shiro_parallel_set_threads },
+    { "shiro_parallel_threads", (void (*)(void))shiro_parallel_threads },
+    { "shiro_read", (void (*)(void))shiro_read },
+    { "shiro_stdout_flush", (void (*)(void))shiro_stdout_flush },
+    { "shiro_thread_join", (void (*)(void))shiro_thread_join },
+    { "shiro_thread_spawn", (void (*)(void))shiro_thread_spawn },
+    { "shiro_write", (void (*)(void))shiro_write },
+};
+
+typedef struct module_exports
+{
+    llvm_jit_t* jit;
+    LLVMOrcJITDylibRef dylib;
+    bool success;
+} module_exports_t;
+
+static bool check_error(LLVMErrorRef error, const char* action)
+{
+    if (error == nullptr)
+        return true;
+
+    char* message = LLVMGetErrorMessage(error);
+    fprintf(stderr, "Error: %s: %s\n", action, message);
+    LLVMDisposeErrorMessage(message);
+    return false;
+}
+
+static void report_session_error(void* ctx, LLVMErrorRef error)
+{
+    (void)ctx;
+    check_error(error, "JIT session");
+}
+
+// Called by a lazy re-export stub when the function behind it can not be compiled; there is no way to return to the
+// caller at this point
+static void report_lazy_compile_failure(void)
+{
+    fprintf(stderr, "Error: JIT compilation of a called function failed\n");
+    exit(70);
+}
+
+static LLVMOrcExecutorAddress find_runtime_symbol(const char* name)
+{
+    for (size_t i = 0; i < sizeof(RUNTIME_SYMBOLS) / sizeof(RUNTIME_SYMBOLS[0]); ++i)
+    {
+        if (strcmp(RUNTIME_SYMBOLS[i].name, name) == 0)
+            return (LLVMOrcExecutorAddress)(uintptr_t)RUNTIME_SYMBOLS[i].address;
+    }
+    return 0;
+}
+
+// Both name fields are taken over by the materialization unit, so the entry is retained once for each
+static LLVMOrcMaterializationUnitRef reexport_function(llvm_jit_t* jit, LLVMOrcJITDylibRef source,
+    LLVMOrcSymbolStringPoolEntryRef name)
+{
+    LLVMOrcRetainSymbolStringPoolEntry(name);
+    LLVMOrcRetainSymbolStringPoolEntry(name);
+    LLVMOrcCSymbolAliasMapPair alias = {
+        .Name = name,
+        .Entry = {
+            .Name = name,
+            .Flags = { .GenericFlags = LLVMJITSymbolGenericFlagsExported | LLVMJITSymbolGenericFlagsCallable },
+        },
+    };
+    return LLVMOrcLazyReexports(jit->call_through, jit->stubs, source, &alias, 1);
+}
+
+static LLVMOrcMaterializationUnitRef absolute_symbol(LLVMOrcSymbolStringPoolEntryRef name,
+    LLVMOrcExecutorAddress address)
+{
+    LLVMOrcRetainSymbolStringPoolEntry(name);
+    LLVMJITCSymbolMapPair symbol = {
+        .Name = name,
+        .Sym = {
+            .Address = address,
+            .Flags = { .GenericFlags = LLVMJITSymbolGenericFlagsExported | LLVMJITSymbolGenericFlagsCallable },
+        },
+    };
+    return LLVMOrcAbsoluteSymbols(&symbol, 1);
+}
+
+// Definition generator of every JITDylib: defines the symbols a lookup could not find as re-exports of the module that
+// exports them, or as the runtime builtin of that name. Anything else is left to the process search generator.
+static LLVMErrorRef generate_definitions(LLVMOrcDefinitionGeneratorRef generator, void* ctx,
+    LLVMOrcLookupStateRef* lookup_state, LLVMOrcLookupKind kind, LLVMOrcJITDylibRef dylib,
+    LLVMOrcJITDylibLookupFlags dylib_flags, LLVMOrcCLookupSet symbols, size_t symbol_count)
+{
+    (void)generator;
+    (void)lookup_state;
+    (void)kind;
+    (void)dylib_flags;
+    llvm_jit_t* jit = ctx;
+
+    for (size_t i = 0; i < symbol_count; ++i)
+    {
+        LLVMOrcSymbolStringPoolEntryRef name = symbols[i].Name;
+        const char* name_str = LLVMOrcSymbolStringPoolEntryStr(name);
+
+        LLVMOrcMaterializationUnitRef unit = nullptr;
+        LLVMOrcJITDylibRef source = hash_table_find(&jit->exports, name_str);
+        LLVMOrcExecutorAddress runtime_address = find_runtime_symbol(name_str);
+        if (source != nullptr && source != dylib)
+            unit = reexport_function(jit, source, name);
+        else if (runtime_address != 0)
+            unit = absolute_symbol(name, runtime_address);
+        else
+            continue;
+
+        LLVMErrorRef error = LLVMOrcJITDylibDefine(dylib, unit);
+        if (error != nullptr)
+        {
+            LLVMOrcDisposeMaterializationUnit(unit);
+            return error;
+        }
+    }
+
+    return nullptr;
+}
+
+static bool add_generators(llvm_jit_t* jit, LLVMOrcJITDylibRef dylib)
+{
+    // The generator's context is the JIT itself, which outlives the generator, so there is nothing to dispose
+    LLVMOrcJITDylibAddGenerator(dylib,
+        LLVMOrcCreateCustomCAPIDefinitionGenerator(generate_definitions, jit, nullptr));
+
+    LLVMOrcDefinitionGeneratorRef process_symbols;
+    LLVMErrorRef error = LLVMOrcCreateDynamicLibrarySearchGeneratorForProcess(&process_symbols,
+        LLVMOrcLLJITGetGlobalPrefix(jit->lljit), nullptr, nullptr);
+    if (!check_error(error, "can not search the process for symbols"))
+        return false;
+    LLVMOrcJITDylibAddGenerator(dylib, process_symbols);
+    return true;
+}
+
+llvm_jit_t* llvm_jit_create(void)
+{
+    LLVMInitializeNativeTarget();
+    LLVMInitializeNativeAsmPrinter();
+
+    LLVMOrcLLJITRef lljit;
+    if (!check_error(LLVMOrcCreateLLJIT(&lljit, nullptr), "can not create JIT"))
+        return nullptr;
+
+    llvm_jit_t* jit = malloc(sizeof(*jit));
+    panic_if(jit == nullptr);
+    *jit = (llvm_jit_t){
+        .lljit = lljit,
+        .session = LLVMOrcLLJITGetExecutionSession(lljit),
+        .stubs = LLVMOrcCreateLocalIndirectStubsManager(LLVMOrcLLJITGetTripleString(lljit)),
+        .exports = HASH_TABLE_INIT(nullptr),
+    };
+    LLVMOrcExecutionSessionSetErrorReporter(jit->session, report_session_error, nullptr);
+
+    LLVMErrorRef error = LLVMOrcCreateLocalLazyCallThroughManager(LLVMOrcLLJITGetTripleString(lljit), jit->session,
+        (LLVMOrcJITTargetAddress)(uintptr_t)report_lazy_compile_failure, &jit->call_through);
+    if (!check_error(error, "can not create JIT call-through manager") ||
+        !add_generators(jit, LLVMOrcLLJITGetMainJITDylib(lljit)))
+    {
+        llvm_jit_destroy(jit);
+        return nullptr;
+    }
+
+    return jit;
+}
+
+void llvm_jit_destroy(llvm_jit_t* jit)
+{
+    if (jit == nullptr)
+        return;
+
+    // The lazy re-exports refer to the stubs and the call-through manager, so the JIT goes first
+    check_error(LLVMOrcDisposeLLJIT(jit->lljit), "can not shut down JIT");
+    if (jit->call_through != nullptr)
+        LLVMOrcDisposeLazyCallThroughManager(jit->call_through);
+    LLVMOrcDisposeIndirectStubsManager(jit->stubs);
+    hash_table_deinit(&jit->exports);
+    free(jit);
+}
+
+static LLVMErrorRef record_exports(void* ctx, LLVMModuleRef module)
+{
+    module_exports_t* exports = ctx;
+    for (LLVMValueRef fn = LLVMGetFirstFunction(module); fn != nullptr; fn = LLVMGetNextFunction(fn))
+    {
+        LLVMLinkage linkage = LLVMGetLinkage(fn);
+        if (LLVMIsDeclaration(fn) || linkage == LLVMInternalLinkage || linkage == LLVMPrivateLinkage)
+            continue;
+
+        size_t name_len;
+        const char* name = LLVMGetValueName2(fn, &name_len);
+        if (hash_table_contains(&exports->jit->exports, name))
+        {
+            fprintf(stderr, "Error: function '%s' is defined by more than one module\n", name);
+            exports->success = false;
+            continue;
+        }
+        hash_table_insert(&exports->jit->exports, name, exports->dylib);
+    }
+    return nullptr;
+}
+
+bool llvm_jit_add_module(llvm_jit_t* jit, llvm_codegen_t* llvm, const char* name)
+{
+    LLVMOrcThreadSafeModuleRef module = llvm_codegen_release_module(llvm);
+
+    LLVMOrcJITDylibRef dylib;
+    if (!check_error(LLVMOrcExecutionSessionCreateJITDylib(jit->session, &dylib, name), "can not create JITDylib") ||
+        !add_generators(jit, dylib))
+    {
+        LLVMOrcDisposeThreadSafeModule(module);
+        return false;
+    }
+
+    module_exports_t exports = { .jit = jit, .dylib = dylib, .success = true };
+    LLVMOrcThreadSafeModuleWithModuleDo(module, record_exports, &exports);
+    if (!exports.success)
+    {
+        LLVMOrcDisposeThreadSafeModule(module);
+        return false;
+    }
+
+    // The JIT takes ownership of the module even when adding it fails
+    return check_error(LLVMOrcLLJITAddLLVMIRModule(jit->lljit, dylib, module), "can not add module to JIT");
+}
+
+bool llvm_jit_run_main(llvm_jit_t* jit, int* exit_code)
+{
+    // main is looked up in the main JITDylib, which re-exports it from the module defining it
+    LLVMOrcExecutorAddress address;
+    if (!check_error(LLVMOrcLLJITLookup(jit->lljit, &address, "main"), "can not find main"))
+        return false;
+
+    int (*main_fn)(void) = (int (*)(void))(uintptr_t)address;
+    *exit_code = main_fn();
+
+    // The program's buffered stdout would otherwise only be written when the compiler exits
+    shiro_stdout_flush();
+    return true;
+}
@@ -0,0 +1,20 @@
+#ifndef LLVM_JIT_H
+#define LLVM_JIT_H
+
+typedef struct llvm_codegen llvm_codegen_t;
+typedef struct llvm_jit llvm_jit_t;
+
+// Runs generated modules in-process with ORC LLJIT instead of writing and linking objects. Every module gets its own
+// JITDylib; functions one module exports are reachable from the others through lazy re-exports, and functions no module
+// defines are resolved from the runtime builtins compiled into the compiler and from the host process (libc).
+llvm_jit_t* llvm_jit_create(void);
+
+void llvm_jit_destroy(llvm_jit_t* jit);
+
+// Take over the module generated by llvm (see llvm_codegen_release_module) as the JITDylib named name
+bool llvm_jit_add_module(llvm_jit_t* jit, llvm_codegen_t* llvm, const char* name);
+
+// Compile main on first call and run it; exit_code receives its result
+bool llvm_jit_run_main(llvm_jit_t* jit, int* exit_code);
+
+#endif
@@ -1,14 +1,66 @@
 #include "llvm_type_utils.h"
 
 #include "ast/type.h"
+#include "common/containers/hash_table.h"
 #include "common/debug/panic.h"
+#include "common/util/ssprintf.h"
 #include "sema/symbol.h"
 
 #include <llvm-c/Types.h>
 #include <llvm-c/Core.h>
 
-LLVMTypeRef llvm_type(LLVMContextRef ctx, ast_type_t* type)
+static LLVMTypeRef named_struct_type(LLVMContextRef ctx, const char* name, LLVMTypeRef first, LLVMTypeRef second)
 {
+    LLVMTypeRef struct_type = LLVMStructCreateNamed(ctx, name);
+    LLVMStructSetBody(struct_type, (LLVMTypeRef[]){ first, second }, 2, false);
+    return struct_type;
+}
+
+void llvm_type_cache_init(llvm_type_cache_t* cache, LLVMContextRef context)
+{
+    LLVMTypeRef ptr_type = LLVMPointerTypeInContext(context, 0);
+    LLVMTypeRef size_type = LLVMInt64TypeInContext(context);  // FIXME: word-sized & unsigned
+    *cache = (llvm_type_cache_t){
+        .context = context,
+        .string_type = named_struct_type(context, "string", ptr_type, size_type),
+        .view_type = named_struct_type(context, "view", size_type, ptr_type),
+        .heap_array_type = LLVMStructCreateNamed(context, "heap_array"),
+        .types = hash_table_create(nullptr),
+    };
+    LLVMStructSetBody(cache->heap_array_type, (LLVMTypeRef[]){ ptr_type, size_type, size_type }, 3, false);
+}
+
+void llvm_type_cache_deinit(llvm_type_cache_t* cache)
+{
+    hash_table_destroy(cache->types);
+    cache->types = nullptr;
+}
+
+// Arrays and classes are the only lowerings that are not a constant-time lookup in the LLVM context
+static LLVMTypeRef lower_cached_type(llvm_type_cache_t* cache, ast_type_t* type)
+{
+    switch (type->kind)
+    {
+        case AST_TYPE_ARRAY:
+        {
+            LLVMTypeRef element_type = llvm_type(cache, type->data.array.element_type);
+            return LLVMArrayType(element_type, (unsigned int)type->data.array.size);
+        }
+        case AST_TYPE_CLASS:
+        {
+            LLVMTypeRef class_type = LLVMGetTypeByName2(cache->context,
+                type->data.class.class_symbol->fully_qualified_name);
+            panic_if(class_type == nullptr);
+            return class_type;
+        }
+        default:
+            panic("Type kind %d is not cached", type->kind);
+    }
+}
+
+LLVMTypeRef llvm_type(llvm_type_cache_t* cache, ast_type_t* type)
+{
+    LLVMContextRef ctx = cache->context;
     if (type == nullptr)
         return LLVMVoidTypeInContext(ctx);
 
@@ -41,13 +93,7 @@ LLVMTypeRef llvm_type(LLVMContextRef ctx, ast_type_t* type)
                 case TYPE_F64:
                     return LLVMDoubleTypeInContext(ctx);
                 case TYPE_STRING:
-                {
-                    // string is a struct { u8* data, usize len }
-                    LLVMTypeRef ptr_type = LLVMPointerTypeInContext(ctx, 0);
-                    LLVMTypeRef size_type = LLVMInt64TypeInContext(ctx);
-                    LLVMTypeRef fields[] = { ptr_type, size_type };
-                    return LLVMStructTypeInContext(ctx, fields, 2, false);
-                }
+                    return cache->string_type;  // string is a struct { u8* data, usize len }
                 case TYPE_NULL:
                     // TODO: Should SEMA output TYPE_NULL or the actual pointer type?
                     return LLVMPointerTypeInContext(ctx, 0);
@@ -62,26 +108,29 @@ LLVMTypeRef llvm_type(LLVMContextRef ctx, ast_type_t* type)
         {
             return LLVMPointerTypeInContext(ctx, 0);
         }
-        case AST_TYPE_ARRAY:
+        case AST_TYPE_VIEW:
         {
-            LLVMTypeRef element_type = llvm_type(ctx, type->data.array.element_type);
-            return LLVMArrayType(element_type, (unsigned int)type->data.array.size);
+            // Pointers are opaque, so views of every element type share the same layout
+            return cache->view_type;
         }
-        case AST_TYPE_VIEW:
+        case AST_TYPE_HEAP_ARRAY:
         {
-            LLVMTypeRef size_type = LLVMInt64TypeInContext(ctx);  // FIXME: word-sized & unsigned
-            LLVMTypeRef element_type = LLVMPointerTypeInContext(ctx, 0);
-            LLVMTypeRef fields[] = { size_type, element_type };
-            return LLVMStructTypeInContext(ctx, fields, 2, false);
+            // Heap arrays of every element type share one layout too, which the runtime relies on when growing them
+            return cache->heap_array_type;
         }
+        case AST_TYPE_ARRAY:
         case AST_TYPE_CLASS:
         {
-            LLVMTypeRef class_type = LLVMGetTypeByName2(ctx, type->data.class.class_symbol->fully_qualified_name);
-            panic_if(class_type == nullptr);
-            return class_type;
+            const char* key = ssprintf("%p", type);
+            LLVMTypeRef cached = hash_table_find(cache->types, key);
+            if (cached == nullptr)
+            {
+                cached = lower_cached_type(cache, type);
+                hash_table_insert(cache->types, key, cached);
+            }
+            return cached;
         }
         case AST_TYPE_INVALID:
-        case AST_TYPE_HEAP_ARRAY:
             panic("Unsupported type kind for LLVM codegen: %d", type->kind);
     }
 
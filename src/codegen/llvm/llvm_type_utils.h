@@ -4,8 +4,24 @@
 #include <llvm-c/Core.h>
 
 typedef struct ast_type ast_type_t;
+typedef struct hash_table hash_table_t;
+
+// Lowers AST types to LLVM types within one LLVM context. Lowered arrays and classes are cached by their interned
+// ast_type_t, and string, all views and all heap arrays share one named struct type each.
+typedef struct llvm_type_cache
+{
+    LLVMContextRef context;
+    LLVMTypeRef string_type;      // %string = type { ptr, i64 }
+    LLVMTypeRef view_type;        // %view = type { i64, ptr }
+    LLVMTypeRef heap_array_type;  // %heap_array = type { ptr, i64, i64 }: data, length and capacity
+    hash_table_t* types;          // ast type address (char*) -> LLVMTypeRef, for arrays and classes
+} llvm_type_cache_t;
+
+void llvm_type_cache_init(llvm_type_cache_t* cache, LLVMContextRef context);
+
+void llvm_type_cache_deinit(llvm_type_cache_t* cache);
 
 // Convert AST type to LLVM type
-LLVMTypeRef llvm_type(LLVMContextRef ctx, ast_type_t* type);
+LLVMTypeRef llvm_type(llvm_type_cache_t* cache, ast_type_t* type);
 
 #endif
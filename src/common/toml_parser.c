@@ -134,6 +134,31 @@ static void string_value_destroy(void* ptr)
     free(ptr);
 }
 
+// Dotted names such as profile.release are kept as one name rather than nested tables
+static char* parse_section_name(toml_parser_t* parser)
+{
+    char* part = parse_identifier(parser);
+    if (!part)
+        return nullptr;
+
+    string_t name = STRING_INIT;
+    string_append_cstr(&name, part);
+    free(part);
+    while (consume_char(parser, '.'))
+    {
+        part = parse_identifier(parser);
+        if (!part)
+        {
+            string_deinit(&name);
+            return nullptr;
+        }
+        string_append_char(&name, '.');
+        string_append_cstr(&name, part);
+        free(part);
+    }
+    return string_release(&name);
+}
+
 static bool parse_section_header(toml_parser_t* parser)
 {
     bool is_array = false;
@@ -141,7 +166,7 @@ static bool parse_section_header(toml_parser_t* parser)
         return false;
     if (consume_char(parser, '['))
         is_array = true;
-    char* section_name = parse_identifier(parser);
+    char* section_name = parse_section_name(parser);
     if (!section_name)
         return false;
     if (!consume_char(parser, ']'))
@@ -8,14 +8,14 @@
  * The most underdeveloped TOML parser for simple configuration files.
  *
  * Supported:
- *   - Section headers: [name]
+ *   - Section headers: [name], and [name.sub] stored under the dotted name "name.sub"
  *   - Array-of-tables: [[name]]
  *   - String key-value pairs: key = "value"
  *   - Comments: # comment
  *
  * Not supported:
  *   - Numbers, booleans, dates, arrays
- *   - Nested tables, dotted keys
+ *   - Nested tables (dotted section names are not split), dotted keys
  *   - Inline tables
  *   - Multi-line strings
  *   - Full escape sequences
@@ -0,0 +1,109 @@
+#include "compiler_options.h"
+
+#include <string.h>
+
+compiler_options_t compiler_options_default()
+{
+    return (compiler_options_t){
+        .release = false,
+        .bounds_checks = BOUNDS_CHECKS_DEFAULT,
+        .debug_info = DEBUG_INFO_DEFAULT,
+        .split_dwarf = false,
+        .compress_debug_sections = false,
+        .target_cpu = nullptr,
+        .target_features = nullptr,
+        .profile_generate = false,
+        .profile_use = nullptr,
+        .print_stats = false,
+    };
+}
+
+bool compiler_options_parse_bounds_checks(const char* value, bounds_check_policy_t* out)
+{
+    if (strcmp(value, "on") == 0)
+        *out = BOUNDS_CHECKS_ON;
+    else if (strcmp(value, "off") == 0)
+        *out = BOUNDS_CHECKS_OFF;
+    else if (strcmp(value, "debug-only") == 0)
+        *out = BOUNDS_CHECKS_DEBUG_ONLY;
+    else
+        return false;
+    return true;
+}
+
+const char* bounds_check_policy_str(bounds_check_policy_t policy)
+{
+    switch (policy)
+    {
+        case BOUNDS_CHECKS_DEFAULT:
+        case BOUNDS_CHECKS_ON:
+            return "on";
+        case BOUNDS_CHECKS_OFF:
+            return "off";
+        case BOUNDS_CHECKS_DEBUG_ONLY:
+            return "debug-only";
+    }
+    return "unknown";
+}
+
+bool compiler_options_bounds_checks_enabled(const compiler_options_t* options)
+{
+    switch (options->bounds_checks)
+    {
+        case BOUNDS_CHECKS_DEFAULT:
+        case BOUNDS_CHECKS_ON:
+            return true;
+        case BOUNDS_CHECKS_OFF:
+            return false;
+        case BOUNDS_CHECKS_DEBUG_ONLY:
+            return !options->release;
+    }
+    return true;
+}
+
+bool compiler_options_parse_debug_info(const char* value, debug_info_level_t* out)
+{
+    if (strcmp(value, "none") == 0)
+        *out = DEBUG_INFO_NONE;
+    else if (strcmp(value, "line-tables-only") == 0)
+        *out = DEBUG_INFO_LINE_TABLES_ONLY;
+    else if (strcmp(value, "full") == 0)
+        *out = DEBUG_INFO_FULL;
+    else
+        return false;
+    return true;
+}
+
+const char* debug_info_level_str(debug_info_level_t level)
+{
+    switch (level)
+    {
+        case DEBUG_INFO_DEFAULT:
+            return "default";
+        case DEBUG_INFO_NONE:
+            return "none";
+        case DEBUG_INFO_LINE_TABLES_ONLY:
+            return "line-tables-only";
+        case DEBUG_INFO_FULL:
+            return "full";
+    }
+    return "unknown";
+}
+
+bool compiler_options_parse_switch(const char* value, bool* out)
+{
+    if (strcmp(value, "on") == 0)
+        *out = true;
+    else if (strcmp(value, "off") == 0)
+        *out = false;
+    else
+        return false;
+    return true;
+}
+
+debug_info_level_t compiler_options_debug_info(const compiler_options_t* options)
+{
+    if (options->debug_info == DEBUG_INFO_DEFAULT)
+        return options->release ? DEBUG_INFO_NONE : DEBUG_INFO_FULL;
+    return options->debug_info;
+}
@@ -0,0 +1,57 @@
+#ifndef COMPILER_OPTIONS__H
+#define COMPILER_OPTIONS__H
+
+typedef enum bounds_check_policy
+{
+    BOUNDS_CHECKS_DEFAULT,     // not chosen explicitly; behaves like BOUNDS_CHECKS_ON
+    BOUNDS_CHECKS_ON,          // always emit runtime bounds checks
+    BOUNDS_CHECKS_OFF,         // never emit runtime bounds checks
+    BOUNDS_CHECKS_DEBUG_ONLY,  // emit runtime bounds checks unless building in release mode
+} bounds_check_policy_t;
+
+typedef enum debug_info_level
+{
+    DEBUG_INFO_DEFAULT,           // not chosen explicitly; full debug info unless building in release mode
+    DEBUG_INFO_NONE,              // -g0: no debug info at all
+    DEBUG_INFO_LINE_TABLES_ONLY,  // -gline-tables-only: functions and source locations only
+    DEBUG_INFO_FULL,              // -g: also types, parameters and local variables
+} debug_info_level_t;
+
+// Options controlling code generation, set from the command line and (for projects) from shiro.toml.
+// Command line options take precedence over shiro.toml.
+typedef struct compiler_options
+{
+    bool release;
+    bounds_check_policy_t bounds_checks;
+    debug_info_level_t debug_info;
+    bool split_dwarf;              // move debug info into .dwo files next to the objects, out of the link
+    bool compress_debug_sections;  // zlib-compress the debug sections of objects and executables
+    const char* target_cpu;        // nullptr for generic tuning, "native" for the host CPU; not owned
+    const char* target_features;   // LLVM feature list such as "+avx2,-avx512f", added to the CPU's; not owned
+    bool profile_generate;         // instrument generated code to write a profile (.profraw) when run
+    const char* profile_use;       // merged profile (.profdata) to annotate branch weights from; not owned
+    bool print_stats;  // print codegen statistics for every compiled module
+} compiler_options_t;
+
+compiler_options_t compiler_options_default();
+
+// Parse "on", "off" or "debug-only"; returns false for any other value
+bool compiler_options_parse_bounds_checks(const char* value, bounds_check_policy_t* out);
+
+const char* bounds_check_policy_str(bounds_check_policy_t policy);
+
+// Whether the options result in runtime bounds checks being emitted (disregarding @unchecked functions)
+bool compiler_options_bounds_checks_enabled(const compiler_options_t* options);
+
+// Parse "none", "line-tables-only" or "full"; returns false for any other value
+bool compiler_options_parse_debug_info(const char* value, debug_info_level_t* out);
+
+const char* debug_info_level_str(debug_info_level_t level);
+
+// Parse "on" or "off"; returns false for any other value
+bool compiler_options_parse_switch(const char* value, bool* out);
+
+// The debug info level the options result in, resolving DEBUG_INFO_DEFAULT
+debug_info_level_t compiler_options_debug_info(const compiler_options_t* options);
+
+#endif
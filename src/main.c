@@ -1,8 +1,11 @@
 #include "ast/node.h"
 #include "builder/builder.h"
 #include "codegen/llvm/llvm_codegen.h"
+#include "codegen/llvm/llvm_jit.h"
 #include "common/debug/panic.h"
 #include "compiler_error.h"
+#include "common/util/ssprintf.h"
+#include "compiler_options.h"
 #include "parser/parser.h"
 #include "sema/decl_collector.h"
 #include "sema/semantic_analyzer.h"
@@ -66,6 +69,18 @@ static void print_ast_errors(vec_t* vec)
     }
 }
 
+static FILE* open_output_file(char** output_path)
+{
+    FILE *file = fopen(*output_path, "w");
+    if (!file) {
+        fprintf(stderr, "Unable to open %s for writing", *output_path);
+        free(*output_path);
+        return nullptr;
+    }
+
+    return file;
+}
+
 static FILE* open_output_file_for(const char* sourcefile, char** output_path)
 {
     // Extract just the filename (after the last '/')
@@ -95,18 +110,11 @@ static FILE* open_output_file_for(const char* sourcefile, char** output_path)
         strcat(*output_path, ".ll");
     }
 
-    FILE *file = fopen(*output_path, "w");
-    if (!file) {
-        fprintf(stderr, "Unable to open %s for writing", *output_path);
-        free(*output_path);
-        return nullptr;
-    }
-
-    return file;
+    return open_output_file(output_path);
 }
 
 static int compile_with_clang(const char* ll_filepath, const char* output_redirect,
-    const char* compiler_path)
+    const char* compiler_path, const compiler_options_t* options)
 {
     char *output_name;
     if (output_redirect == nullptr)
@@ -132,47 +140,179 @@ static int compile_with_clang(const char* ll_filepath, const char* output_redire
     snprintf(runtime_path, runtime_path_len, "%s/builtins.c", dir);
     free(compiler_path_copy);
 
-    size_t cmd_len = strlen("clang   -o  -Wno-override-module") + strlen(ll_filepath) + strlen(runtime_path) +
-        strlen(output_name) + 1;
-    char *command = malloc(cmd_len);
-    snprintf(command, cmd_len, "clang %s %s -o %s -Wno-override-module", ll_filepath, runtime_path, output_name);
+    const char* opt_flag = options->release ? " -O2" : "";
+
+    // The IR already carries the debug info; -g only lets clang honor -gsplit-dwarf for IR input. The .dwo file is
+    // written next to the executable, and -gz compresses the debug sections of both the object and the executable.
+    bool has_debug_info = compiler_options_debug_info(options) != DEBUG_INFO_NONE;
+    const char* split_flag = has_debug_info && options->split_dwarf ? " -g -gsplit-dwarf" : "";
+    const char* compress_flag = has_debug_info && options->compress_debug_sections ? " -gz" : "";
+
+    // Functions in the IR carry their CPU and features as attributes; -march also tunes the runtime
+    const char* march_flag = options->target_cpu != nullptr ? " -march=" : "";
+    const char* target_cpu = options->target_cpu != nullptr ? options->target_cpu : "";
+
+    const char* flags = ssprintf("%s%s%s%s%s", opt_flag, split_flag, compress_flag, march_flag, target_cpu);
+
+    // With --profile-generate the IR is already instrumented, and passing -fprofile-generate along with it would
+    // instrument it a second time. It is compiled on its own first; the flag then only reaches the runtime's C code
+    // and the link, where it adds the profile runtime.
+    const char* input_path = ll_filepath;
+    char* obj_path = nullptr;
+    int result = 0;
+    if (options->profile_generate)
+    {
+        obj_path = strdup(ssprintf("%s.o", output_name));
+        result = system(ssprintf("clang%s -c %s -o %s -Wno-override-module", flags, ll_filepath, obj_path));
+        input_path = obj_path;
+    }
 
     // Execute
-    int result = system(command);
+    if (result == 0)
+        result = system(ssprintf("clang%s%s %s %s -o %s -Wno-override-module", flags,
+            options->profile_generate ? " -fprofile-generate" : "", input_path, runtime_path, output_name));
+
+    if (obj_path != nullptr)
+    {
+        remove(obj_path);
+        free(obj_path);
+    }
 
     if (result == -1) {
         fprintf(stderr, "failed to execute clang\n");
         return 5;
     }
 
-    free(command);
     free(output_name);
     free(runtime_path);
     return WEXITSTATUS(result);
 }
 
-int main(int argc, char** argv)
+static void print_usage(const char* program)
+{
+    fprintf(stderr, "Usage: %s [run] <file.shiro|project-dir> [options]\n", program);
+    fprintf(stderr, "  run                              Compile in memory and run the program instead of writing an\n");
+    fprintf(stderr, "                                   executable; exits with the program's exit code\n");
+    fprintf(stderr, "Options:\n");
+    fprintf(stderr, "  -o FILE                          Write executable to FILE (single file only)\n");
+    fprintf(stderr, "  --emit-llvm                      Write the LLVM IR that clang would compile to NAME.ll, or to\n");
+    fprintf(stderr, "                                   the -o FILE, instead of an executable (single file only)\n");
+    fprintf(stderr, "  --release                        Optimized build\n");
+    fprintf(stderr, "  --bounds-checks=on|off|debug-only  Runtime bounds-check policy (default: on)\n");
+    fprintf(stderr, "  -g0 | -gline-tables-only | -g    Debug info level (default: -g, or -g0 with --release)\n");
+    fprintf(stderr, "  --split-dwarf                    Write debug info to .dwo files instead of the objects\n");
+    fprintf(stderr, "  --compress-debug-sections        Compress debug info in objects and executables\n");
+    fprintf(stderr, "  --target-cpu=NAME|native         CPU to tune and select instructions for (default: generic)\n");
+    fprintf(stderr, "  --target-features=+F,-F,...      Enable or disable CPU features on top of the CPU's\n");
+    fprintf(stderr, "  --profile-generate               Instrument the program to write an execution profile\n");
+    fprintf(stderr, "  --profile-use=FILE               Optimize using a profile merged with llvm-profdata\n");
+    fprintf(stderr, "  --stats                          Print codegen statistics\n");
+}
+
+static bool parse_arguments(int argc, char** argv, bool* run, const char** filepath, const char** output_redirect,
+    bool* emit_llvm, compiler_options_t* options)
 {
-    if (argc < 2)
+    for (int i = 1; i < argc; ++i)
     {
-        fprintf(stderr, "Usage: %s <file.shiro> [-o FILE]\n", argv[0]);
-        return 1;
+        const char* arg = argv[i];
+        if (i == 1 && strcmp(arg, "run") == 0)
+            *run = true;
+        else if (strcmp(arg, "-o") == 0 && i + 1 < argc)
+            *output_redirect = argv[++i];
+        else if (strcmp(arg, "--emit-llvm") == 0)
+            *emit_llvm = true;
+        else if (strcmp(arg, "--release") == 0)
+            options->release = true;
+        else if (strcmp(arg, "--stats") == 0)
+            options->print_stats = true;
+        else if (strcmp(arg, "-g0") == 0)
+            options->debug_info = DEBUG_INFO_NONE;
+        else if (strcmp(arg, "-gline-tables-only") == 0)
+            options->debug_info = DEBUG_INFO_LINE_TABLES_ONLY;
+        else if (strcmp(arg, "-g") == 0)
+            options->debug_info = DEBUG_INFO_FULL;
+        else if (strcmp(arg, "--split-dwarf") == 0)
+            options->split_dwarf = true;
+        else if (strcmp(arg, "--compress-debug-sections") == 0)
+            options->compress_debug_sections = true;
+        else if (strcmp(arg, "--profile-generate") == 0)
+            options->profile_generate = true;
+        else if (strncmp(arg, "--profile-use=", strlen("--profile-use=")) == 0)
+            options->profile_use = arg + strlen("--profile-use=");
+        else if (strncmp(arg, "--target-cpu=", strlen("--target-cpu=")) == 0)
+            options->target_cpu = arg + strlen("--target-cpu=");
+        else if (strncmp(arg, "--target-features=", strlen("--target-features=")) == 0)
+            options->target_features = arg + strlen("--target-features=");
+        else if (strncmp(arg, "--bounds-checks=", strlen("--bounds-checks=")) == 0)
+        {
+            const char* value = arg + strlen("--bounds-checks=");
+            if (!compiler_options_parse_bounds_checks(value, &options->bounds_checks))
+            {
+                fprintf(stderr, "Error: invalid value '%s' for --bounds-checks\n", value);
+                return false;
+            }
+        }
+        else if (arg[0] != '-' && *filepath == nullptr)
+            *filepath = arg;
+        else
+        {
+            fprintf(stderr, "Error: unknown argument '%s'\n", arg);
+            return false;
+        }
     }
 
+    if (options->profile_generate && options->profile_use != nullptr)
+    {
+        fprintf(stderr, "Error: --profile-generate and --profile-use can not be combined\n");
+        return false;
+    }
+    if (*run && (*output_redirect != nullptr || options->profile_generate))
+    {
+        fprintf(stderr, "Error: run writes no executable and can not be combined with -o or --profile-generate\n");
+        return false;
+    }
+    if (*run && *emit_llvm)
+    {
+        fprintf(stderr, "Error: run compiles in memory and can not be combined with --emit-llvm\n");
+        return false;
+    }
+    if (options->profile_use != nullptr && access(options->profile_use, R_OK) != 0)
+    {
+        fprintf(stderr, "Error: can not read profile '%s'\n", options->profile_use);
+        return false;
+    }
+
+    return *filepath != nullptr;
+}
+
+int main(int argc, char** argv)
+{
+    bool run = false;
     const char* output_redirect = nullptr;
-    const char* filepath = argv[1];
+    const char* filepath = nullptr;
+    bool emit_llvm = false;
+    compiler_options_t options = compiler_options_default();
 
-    if (argc == 4 && strcmp(argv[2], "-o") == 0)
-        output_redirect = argv[3];
+    if (!parse_arguments(argc, argv, &run, &filepath, &output_redirect, &emit_llvm, &options))
+    {
+        print_usage(argv[0]);
+        return 1;
+    }
 
     // Use builder if target is a directory
     struct stat path_stat;
     if (stat(filepath, &path_stat) == 0 && S_ISDIR(path_stat.st_mode))
     {
-        builder_t* builder = builder_create(filepath, argv[0]);
-        bool success = builder_run(builder);
+        if (emit_llvm)
+        {
+            fprintf(stderr, "Error: --emit-llvm is only supported for single files\n");
+            return 1;
+        }
+        builder_t* builder = builder_create(filepath, argv[0], &options);
+        int exit_code = 0;
+        bool success = run ? builder_run_jit(builder, &exit_code) : builder_run(builder);
         builder_destroy(builder);
-        return success ? 0 : 64;
+        return success ? exit_code : 64;
     }
 
     // Read source file
@@ -238,22 +378,60 @@ int main(int argc, char** argv)
     if (vec_size(&ctx->warning_nodes) > 0)
         print_ast_errors(&ctx->warning_nodes);
 
-    // Code Generation:
+    // Code Generation, either run in-process right away:
+    if (run)
+    {
+        llvm_codegen_t* llvm = llvm_codegen_create("unknown", "unnamed");
+        llvm_codegen_init(llvm, "unnamed", ctx, &options);
+        llvm_codegen_add_ast(llvm, AST_NODE(ast), filepath);
+        if (options.print_stats)
+            llvm_codegen_print_stats(llvm, stdout);
+
+        int exit_code = 0;
+        llvm_jit_t* jit = llvm_jit_create();
+        bool success = jit != nullptr && llvm_jit_add_module(jit, llvm, "unknown.unnamed");
+        llvm_codegen_destroy(llvm);
+        success = success && llvm_jit_run_main(jit, &exit_code);
+
+        llvm_jit_destroy(jit);
+        semantic_context_destroy(ctx);
+        ast_node_destroy(ast);
+        free(source);
+        return success ? exit_code : 5;
+    }
+
+    // or written out as IR and compiled with clang, unless the IR is all that was asked for:
     char* ir_path;
-    FILE* fout = open_output_file_for(filepath, &ir_path);
+    FILE* fout;
+    if (emit_llvm && output_redirect != nullptr)
+    {
+        ir_path = strdup(output_redirect);
+        fout = open_output_file(&ir_path);
+    }
+    else
+        fout = open_output_file_for(filepath, &ir_path);
+    if (fout == nullptr)
+    {
+        semantic_context_destroy(ctx);
+        ast_node_destroy(ast);
+        free(source);
+        return 1;
+    }
     llvm_codegen_t* llvm = llvm_codegen_create("unknown", "unnamed");
-    llvm_codegen_init(llvm, "unnamed", ctx);
+    llvm_codegen_init(llvm, "unnamed", ctx, &options);
     llvm_codegen_add_ast(llvm, AST_NODE(ast), filepath);
     llvm_codegen_finalize(llvm, fout);
     fflush(fout);
     fclose(fout);
+    if (options.print_stats)
+        llvm_codegen_print_stats(llvm, stdout);
     llvm_codegen_destroy(llvm);
 
     // Invoke clang to compile LLVM IR into binary:
-    int clang_res = compile_with_clang(ir_path, output_redirect, argv[0]);
+    int clang_res = emit_llvm ? 0 : compile_with_clang(ir_path, output_redirect, argv[0], &options);
 
     // Cleanup
-    if (output_redirect != nullptr)
+    if (output_redirect != nullptr && !emit_llvm)
         remove(ir_path);
     free(ir_path);
     semantic_context_destroy(ctx);
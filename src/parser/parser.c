@@ -665,9 +665,26 @@ static ast_stmt_t* parse_return_stmt(parser_t* parser)
     if (tok_return == nullptr)
         return nullptr;
 
+    // return @tail f(...)
+    bool tail_call = false;
+    if (lexer_peek_token(parser->lexer)->type == TOKEN_AT)
+    {
+        lexer_next_token(parser->lexer);  // consume '@'
+
+        token_t* tok_name = lexer_next_token_iff(parser->lexer, TOKEN_IDENTIFIER);
+        if (tok_name == nullptr)
+            return nullptr;
+
+        if (strcmp(tok_name->value, "tail") == 0)
+            tail_call = true;
+        else
+            lexer_emit_token_malformed(parser->lexer, tok_name, "unknown return attribute");
+    }
+
     ast_expr_t* expr = parser_parse_expr(parser);
 
     ast_stmt_t* stmt = ast_return_stmt_create(expr);
+    ((ast_return_stmt_t*)stmt)->tail_call = tail_call;
 
     parser_set_source_tok_to_current(parser, stmt, tok_return);
 
@@ -797,6 +814,126 @@ error:
     return nullptr;
 }
 
+// Parse the positive integer argument of an attribute, e.g. the `4` in `@unroll(4)`
+static bool parse_attribute_count(parser_t* parser, uint32_t* count)
+{
+    token_t* tok = lexer_next_token_iff(parser->lexer, TOKEN_INTEGER);
+    if (tok == nullptr)
+        return false;
+
+    errno = 0;
+    char* endptr;
+    uint64_t value = strtoull(tok->value, &endptr, 0);
+    if (errno == ERANGE || endptr == tok->value || *endptr != '\0' || tok->suffix[0] != '\0' || value == 0 ||
+        value > UINT32_MAX)
+    {
+        lexer_emit_token_malformed(parser->lexer, tok, "expected a positive integer");
+        return false;
+    }
+
+    *count = (uint32_t)value;
+    return true;
+}
+
+// Attributes that can prefix a loop: @unroll(N), @unroll(full), @vectorize, @vectorize(width=N), @novectorize
+static bool parse_loop_attributes(parser_t* parser, ast_loop_hints_t* hints)
+{
+    *hints = (ast_loop_hints_t){};
+
+    while (lexer_peek_token(parser->lexer)->type == TOKEN_AT)
+    {
+        lexer_next_token(parser->lexer);  // consume '@'
+
+        token_t* tok_name = lexer_next_token_iff(parser->lexer, TOKEN_IDENTIFIER);
+        if (tok_name == nullptr)
+            return false;
+
+        if (strcmp(tok_name->value, "unroll") == 0)
+        {
+            if (hints->unroll != AST_LOOP_UNROLL_DEFAULT)
+                lexer_emit_token_malformed(parser->lexer, tok_name, "duplicate loop attribute");
+
+            if (!lexer_next_token_iff(parser->lexer, TOKEN_LPAREN))
+                return false;
+
+            token_t* tok_arg = lexer_peek_token(parser->lexer);
+            if (tok_arg->type == TOKEN_IDENTIFIER && strcmp(tok_arg->value, "full") == 0)
+            {
+                lexer_next_token(parser->lexer);
+                hints->unroll = AST_LOOP_UNROLL_FULL;
+            }
+            else if (parse_attribute_count(parser, &hints->unroll_count))
+                hints->unroll = AST_LOOP_UNROLL_COUNT;
+            else
+                return false;
+
+            if (!lexer_next_token_iff(parser->lexer, TOKEN_RPAREN))
+                return false;
+        }
+        else if (strcmp(tok_name->value, "vectorize") == 0 || strcmp(tok_name->value, "novectorize") == 0)
+        {
+            if (hints->vectorize != AST_LOOP_VECTORIZE_DEFAULT)
+                lexer_emit_token_malformed(parser->lexer, tok_name, "conflicting loop attribute");
+
+            if (strcmp(tok_name->value, "novectorize") == 0)
+            {
+                hints->vectorize = AST_LOOP_VECTORIZE_DISABLE;
+                continue;
+            }
+
+            hints->vectorize = AST_LOOP_VECTORIZE_ENABLE;
+            if (lexer_peek_token(parser->lexer)->type != TOKEN_LPAREN)
+                continue;
+            lexer_next_token(parser->lexer);  // consume '('
+
+            token_t* tok_key = lexer_next_token_iff(parser->lexer, TOKEN_IDENTIFIER);
+            if (tok_key == nullptr)
+                return false;
+            if (strcmp(tok_key->value, "width") != 0)
+                lexer_emit_token_malformed(parser->lexer, tok_key, "unknown vectorize parameter");
+
+            if (!lexer_next_token_iff(parser->lexer, TOKEN_ASSIGN))
+                return false;
+            if (!parse_attribute_count(parser, &hints->vectorize_width))
+                return false;
+            if (!lexer_next_token_iff(parser->lexer, TOKEN_RPAREN))
+                return false;
+        }
+        else
+            lexer_emit_token_malformed(parser->lexer, tok_name, "unknown loop attribute");
+    }
+
+    return true;
+}
+
+static ast_stmt_t* parse_attributed_loop_stmt(parser_t* parser)
+{
+    ast_loop_hints_t hints;
+    if (!parse_loop_attributes(parser, &hints))
+        return nullptr;
+
+    ast_stmt_t* stmt = nullptr;
+    token_t* tok = lexer_peek_token(parser->lexer);
+    switch (tok->type)
+    {
+        case TOKEN_WHILE:
+            stmt = parse_while_stmt(parser);
+            if (stmt != nullptr)
+                ((ast_while_stmt_t*)stmt)->hints = hints;
+            break;
+        case TOKEN_FOR:
+            stmt = parse_for_stmt(parser);
+            if (stmt != nullptr)
+                ((ast_for_stmt_t*)stmt)->hints = hints;
+            break;
+        default:
+            lexer_emit_token_malformed(parser->lexer, tok, "loop attributes must be followed by a for or while loop");
+            break;
+    }
+
+    return stmt;
+}
+
 static ast_stmt_t* parse_compound_stmt(parser_t* parser)
 {
     token_t* tok_lbrace = lexer_next_token_iff(parser->lexer, TOKEN_LBRACE);
@@ -1088,6 +1225,8 @@ ast_stmt_t* parser_parse_stmt(parser_t* parser)
             return parse_while_stmt(parser);
         case TOKEN_FOR:
             return parse_for_stmt(parser);
+        case TOKEN_AT:
+            return parse_attributed_loop_stmt(parser);
         case TOKEN_PLUSPLUS:
         case TOKEN_MINUSMINUS:
             return parse_inc_dec_stmt(parser);
@@ -1168,6 +1307,64 @@ static bool parse_type_arguments(parser_t* parser, vec_t* type_args)
     return true;
 }
 
+// Attributes that can prefix a function or method definition, e.g. `@unchecked fn foo() { ... }`
+typedef struct fn_attributes
+{
+    bool unchecked;
+    bool always_inline;
+    bool no_inline;
+    bool hot;
+    bool cold;
+    bool flatten;
+} fn_attributes_t;
+
+static bool parse_fn_attributes(parser_t* parser, fn_attributes_t* attributes)
+{
+    *attributes = (fn_attributes_t){};
+
+    while (lexer_peek_token(parser->lexer)->type == TOKEN_AT)
+    {
+        lexer_next_token(parser->lexer);  // consume '@'
+
+        token_t* tok_name = lexer_next_token_iff(parser->lexer, TOKEN_IDENTIFIER);
+        if (tok_name == nullptr)
+            return false;
+
+        if (strcmp(tok_name->value, "unchecked") == 0)
+            attributes->unchecked = true;
+        else if (strcmp(tok_name->value, "inline") == 0)
+            attributes->always_inline = true;
+        else if (strcmp(tok_name->value, "noinline") == 0)
+            attributes->no_inline = true;
+        else if (strcmp(tok_name->value, "hot") == 0)
+            attributes->hot = true;
+        else if (strcmp(tok_name->value, "cold") == 0)
+            attributes->cold = true;
+        else if (strcmp(tok_name->value, "flatten") == 0)
+            attributes->flatten = true;
+        else
+        {
+            lexer_emit_token_malformed(parser->lexer, tok_name, "unknown function attribute");
+            continue;
+        }
+
+        if ((attributes->always_inline && attributes->no_inline) || (attributes->hot && attributes->cold))
+            lexer_emit_token_malformed(parser->lexer, tok_name, "conflicting function attribute");
+    }
+
+    return true;
+}
+
+static void apply_fn_attributes(ast_fn_def_t* fn_def, fn_attributes_t* attributes)
+{
+    fn_def->unchecked = attributes->unchecked;
+    fn_def->always_inline = attributes->always_inline;
+    fn_def->no_inline = attributes->no_inline;
+    fn_def->hot = attributes->hot;
+    fn_def->cold = attributes->cold;
+    fn_def->flatten = attributes->flatten;
+}
+
 static ast_def_t* parse_fn_def(parser_t* parser, bool exported, bool external, bool* trait_marker)
 {
     token_t* id = nullptr;
@@ -1265,10 +1462,14 @@ static ast_decl_t* parse_member_decl(parser_t* parser)
 static ast_def_t* parse_method_def(parser_t* parser)
 {
     token_t* tok_start = lexer_peek_token(parser->lexer);
+    fn_attributes_t attributes;
+    if (!parse_fn_attributes(parser, &attributes))
+        return nullptr;
     bool is_trait = false;
     ast_fn_def_t* fn_def = (ast_fn_def_t*)parse_fn_def(parser, false, false, &is_trait);
     if (fn_def == nullptr)
         return nullptr;
+    apply_fn_attributes(fn_def, &attributes);
     ast_method_def_t* method = (ast_method_def_t*)ast_method_def_create_from(fn_def);
     method->is_trait_impl = is_trait;
     parser_set_source_tok_to_current(parser, method, tok_start);
@@ -1309,6 +1510,7 @@ static ast_def_t* parse_class_def(parser_t* parser, bool exported)
                 vec_push(&members, decl);
                 break;
             }
+            case TOKEN_AT:
             case TOKEN_FN:
             {
                 ast_def_t* def = parse_method_def(parser);
@@ -1387,6 +1589,25 @@ static ast_def_t* parse_extern_def(parser_t* parser)
     return (ast_def_t*)fn;
 }
 
+static ast_def_t* parse_top_level_fn_def(parser_t* parser, bool exported)
+{
+    fn_attributes_t attributes;
+    if (!parse_fn_attributes(parser, &attributes))
+        return nullptr;
+
+    // Attributes come first, e.g. `@unchecked export fn foo()`
+    if (!exported && lexer_peek_token(parser->lexer)->type == TOKEN_EXPORT)
+    {
+        lexer_next_token(parser->lexer);
+        exported = true;
+    }
+
+    ast_fn_def_t* fn_def = (ast_fn_def_t*)parse_fn_def(parser, exported, false, nullptr);
+    if (fn_def != nullptr)
+        apply_fn_attributes(fn_def, &attributes);
+    return (ast_def_t*)fn_def;
+}
+
 static ast_def_t* parse_top_level_definition(parser_t* parser)
 {
     bool export = false;
@@ -1394,9 +1615,13 @@ static ast_def_t* parse_top_level_definition(parser_t* parser)
 parse:
     switch (lexer_peek_token(parser->lexer)->type)
     {
+        case TOKEN_AT:
+            if (export)
+                lexer_emit_token_malformed(parser->lexer, lexer_peek_token(parser->lexer), "Expected fn or class");
+            [[fallthrough]];
         case TOKEN_FN:
             parser->state = PARSER_STATE_REST;
-            return parse_fn_def(parser, export, false, nullptr);
+            return parse_top_level_fn_def(parser, export);
         case TOKEN_CLASS:
             parser->state = PARSER_STATE_REST;
             return parse_class_def(parser, export);
@@ -0,0 +1,48 @@
+#ifndef RUNTIME_BUILTINS_H
+#define RUNTIME_BUILTINS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Declarations of the runtime functions in builtins.c, for the compiler itself; builtins.c is also compiled into every
+// executable and does not include this header, so signatures have to be kept in sync by hand
+
+void printI32(int32_t value);
+
+size_t shiro_format_i64(int64_t value, uint8_t* out);
+
+size_t shiro_format_u64(uint64_t value, uint8_t* out);
+
+size_t shiro_format_f64(double value, uint8_t* out);
+
+void shiro_heap_array_grow(void* array, size_t element_size, size_t min_capacity);
+
+uint64_t shiro_hash_bytes(const uint8_t* data, size_t len);
+
+int64_t shiro_read(int32_t fd, uint8_t* data, size_t len);
+
+void shiro_stdout_flush(void);
+
+void shiro_abort(void);
+
+void shiro_write(int32_t fd, const uint8_t* data, size_t len);
+
+void* shiro_thread_spawn(void* entry, void* context);
+
+void shiro_thread_join(void* thread);
+
+void* shiro_mutex_create(void);
+
+void shiro_mutex_destroy(void* mutex);
+
+void shiro_mutex_lock(void* mutex);
+
+void shiro_mutex_unlock(void* mutex);
+
+size_t shiro_parallel_threads(void);
+
+void shiro_parallel_set_threads(size_t count);
+
+void shiro_parallel_for(uint8_t* data, size_t count, size_t element_size, size_t grain, void* body, void* context);
+
+#endif
@@ -97,13 +97,18 @@ static ast_expr_t* transform_ref_expr(semantic_analyzer_t* sema, ast_ref_expr_t*
     else
     {
         // If type of symbol is instance of class or pointer to instance of class (auto-deref),
-        // symbol table should now be the class's symbols
+        // symbol table should now be the class's symbols. Pointers with methods of their own (the atomic methods of
+        // integer pointers) are not dereferenced.
         ast_type_t* symb_type = (selected->kind == SYMBOL_METHOD || selected->kind == SYMBOL_FUNCTION) ?
             selected->data.function.return_type : selected->type;
-        if (symb_type->kind == AST_TYPE_POINTER)
+        symbol_table_t* pointer_methods = symb_type->kind == AST_TYPE_POINTER ?
+            semantic_context_builtin_methods_for_type(sema->ctx, symb_type) : nullptr;
+        if (symb_type->kind == AST_TYPE_POINTER && pointer_methods == nullptr)
             symb_type = symb_type->data.pointer.pointee;
 
-        if (symb_type->kind == AST_TYPE_CLASS)
+        if (pointer_methods != nullptr)
+            *symbol_table = pointer_methods;
+        else if (symb_type->kind == AST_TYPE_CLASS)
         {
             symbol_t* class_symbol = symb_type->data.class.class_symbol;
             *symbol_table = class_symbol->data.class.symbols;
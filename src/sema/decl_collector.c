@@ -8,6 +8,7 @@
 #include "ast/def/method_def.h"
 #include "ast/node.h"
 #include "ast/type.h"
+#include "ast/util/cloner.h"
 #include "ast/visitor.h"
 #include "common/containers/vec.h"
 #include "common/debug/panic.h"
@@ -16,6 +17,7 @@
 #include "sema/semantic_context.h"
 #include "sema/symbol.h"
 #include "sema/symbol_table.h"
+#include "sema/template_instantiator.h"
 #include "sema/type_resolver.h"
 #include <bits/types/cookie_io_functions_t.h>
 #include <stddef.h>
@@ -29,6 +31,13 @@ struct decl_collector
     expr_evaluator_t* expr_eval;
 };
 
+typedef struct template_helper_finder
+{
+    ast_visitor_t base;
+    semantic_context_t* ctx;
+    vec_t pending;  // vec<symbol_t*>: templates whose definitions are still to be searched
+} template_helper_finder_t;
+
 // Pass 1: Register all user types
 static void register_class_symbol(decl_collector_t* collector, ast_class_def_t* class_def)
 {
@@ -62,10 +71,11 @@ static void register_class_symbol(decl_collector_t* collector, ast_class_def_t*
     symbol_t* parent_namespace = class_def->exported ? collector->ctx->module_namespace : nullptr;
     class_def->symbol = symbol_create(class_def->base.name, symbol_kind, class_def, parent_namespace);
 
-    // If template, register type parameters
+    // If template, register type parameters. Instances are cloned from a copy taken before any of the template's types
+    // are resolved.
     if (is_template)
     {
-        class_def->symbol->data.template_class.template_ast = AST_NODE(class_def);
+        class_def->symbol->data.template_class.template_ast = AST_NODE(ast_class_def_clone(class_def));
         for (size_t i = 0; i < vec_size(&class_def->type_params); ++i)
         {
             ast_type_param_decl_t* type_param = vec_get(&class_def->type_params, i);
@@ -108,6 +118,10 @@ static void collect_class_def(void* self_, ast_class_def_t* class_def, void* out
             symbol_table_insert(class_def->symbol->data.class.symbols, type_param);
         }
     }
+    else if (class_def->symbol->kind == SYMBOL_TEMPLATE_CLASS_INST)
+    {
+        template_bind_type_arguments(class_def->symbol, class_def->symbol->data.class.symbols);
+    }
 
     for (size_t i = 0; i < vec_size(&class_def->members); ++i)
         ast_visitor_visit(collector, vec_get(&class_def->members, i), nullptr);
@@ -157,11 +171,40 @@ static bool is_valid_overload(vec_t* symbols, vec_t* parameters)
     return true;
 }
 
+// The signature of a template function instance is resolved with the template's type parameters bound to its type
+// arguments. Instances are not in the global scope: calls reach them through their template.
+static void collect_template_fn_instance(decl_collector_t* collector, ast_fn_def_t* fn_def)
+{
+    symbol_t* symbol = fn_def->symbol;
+
+    semantic_context_push_scope(collector->ctx, SCOPE_FUNCTION);
+    template_bind_type_arguments(symbol, collector->ctx->current);
+
+    for (size_t i = 0; i < vec_size(&fn_def->params); ++i)
+        ast_visitor_visit(collector, vec_get(&fn_def->params, i), symbol);
+
+    if (fn_def->return_type == nullptr)
+        fn_def->return_type = ast_type_builtin(TYPE_VOID);
+    else
+        fn_def->return_type = type_resolver_solve(collector->ctx, fn_def->return_type, fn_def, true);
+
+    semantic_context_pop_scope(collector->ctx);
+
+    symbol->type = ast_type_invalid();  // TODO: actual function type
+    symbol->data.function.return_type = fn_def->return_type;
+}
+
 static void collect_fn_def(void* self_, ast_fn_def_t* fn_def, void* out_)
 {
     (void)out_;
     decl_collector_t* collector = self_;
 
+    if (fn_def->symbol != nullptr && fn_def->symbol->kind == SYMBOL_TEMPLATE_FN_INST)
+    {
+        collect_template_fn_instance(collector, fn_def);
+        return;
+    }
+
     // Check if this is a template function
     bool is_template = vec_size(&fn_def->type_params) > 0;
     symbol_kind_t symbol_kind = is_template ? SYMBOL_TEMPLATE_FN : SYMBOL_FUNCTION;
@@ -170,11 +213,12 @@ static void collect_fn_def(void* self_, ast_fn_def_t* fn_def, void* out_)
     symbol_t* parent_namespace = fn_def->exported ? collector->ctx->module_namespace : nullptr;
     symbol_t* symbol = symbol_create(fn_def->base.name, symbol_kind, fn_def, parent_namespace);
 
-    // If template, we need a function scope for type parameters, and we need to register them
+    // If template, we need a function scope for type parameters, and we need to register them. Instances are cloned
+    // from a copy taken before any of the template's types are resolved.
     if (is_template)
     {
         semantic_context_push_scope(collector->ctx, SCOPE_FUNCTION);
-        symbol->data.template_fn.template_ast = AST_NODE(fn_def);
+        symbol->data.template_fn.template_ast = AST_NODE(ast_fn_def_clone(fn_def));
 
         for (size_t i = 0; i < vec_size(&fn_def->type_params); ++i)
         {
@@ -182,17 +226,14 @@ static void collect_fn_def(void* self_, ast_fn_def_t* fn_def, void* out_)
             symbol_t* type_param_symbol = symbol_create(type_param->name, SYMBOL_TYPE_PARAMETER, type_param, nullptr);
             type_param_symbol->type = ast_type_variable(type_param->name);
             vec_push(&symbol->data.template_fn.type_parameters, type_param_symbol);
-            symbol_table_insert(collector->ctx->current, type_param_symbol);
+            symbol_table_insert(collector->ctx->current, symbol_clone(type_param_symbol, true, nullptr));
             type_param->symbol = type_param_symbol;
         }
     }
 
+    // The parameters of a template are typed with its type parameters, calls infer the type arguments from them
     for (size_t i = 0; i < vec_size(&fn_def->params); ++i)
-        ast_visitor_visit(collector, vec_get(&fn_def->params, i), is_template ? nullptr : symbol);
-
-    // Pop template scope
-    if (is_template)
-        semantic_context_pop_scope(collector->ctx);
+        ast_visitor_visit(collector, vec_get(&fn_def->params, i), symbol);
 
     // Handle function clashes with overloading rules (skip templates until instantiation)
     vec_t* symbols = symbol_table_overloads(collector->ctx->global, fn_def->base.name);
@@ -208,25 +249,27 @@ static void collect_fn_def(void* self_, ast_fn_def_t* fn_def, void* out_)
         return;
     }
 
-    // Resolve return type
+    // Resolve return type (a template's may be one of its type parameters)
     if (fn_def->return_type == nullptr)
         fn_def->return_type = ast_type_builtin(TYPE_VOID);
     else
-    {
         fn_def->return_type = type_resolver_solve(collector->ctx, fn_def->return_type, fn_def, false);
-        if (fn_def->return_type == ast_type_invalid())
-        {
-            symbol_destroy(symbol);
-            return;
-        }
+
+    // Pop template scope
+    if (is_template)
+        semantic_context_pop_scope(collector->ctx);
+
+    if (fn_def->return_type == ast_type_invalid())
+    {
+        symbol_destroy(symbol);
+        return;
     }
 
-    // Fill in rest of symbol data (only for non-templates)
+    // Fill in rest of symbol data
+    symbol->type = ast_type_invalid();  // TODO: actual function type
+    symbol->data.function.return_type = fn_def->return_type;
     if (!is_template)
     {
-        symbol->type = ast_type_invalid();  // TODO: actual function type
-        symbol->data.function.return_type = fn_def->return_type == nullptr ?
-            ast_type_builtin(TYPE_VOID) : fn_def->return_type;
         fn_def->overload_index = num_prev_defs;
         symbol->data.function.overload_index = fn_def->overload_index;
         symbol->data.function.extern_abi = fn_def->extern_abi ? strdup(fn_def->extern_abi) : nullptr;
@@ -422,6 +465,87 @@ static void collect_param_decl(void* self_, ast_param_decl_t* param_decl, void*
     }
 }
 
+static bool is_exported_definition(symbol_t* symbol)
+{
+    if (AST_KIND(symbol->ast) == AST_DEF_CLASS)
+        return ((ast_class_def_t*)symbol->ast)->exported;
+    return ((ast_fn_def_t*)symbol->ast)->exported;
+}
+
+// Every private function and template of a name used in a template is a helper, whether the name is a call or not
+static void find_helpers_ref_expr(void* self_, ast_ref_expr_t* ref, void* out_)
+{
+    (void)out_;
+    template_helper_finder_t* finder = self_;
+
+    vec_t* symbols = symbol_table_overloads(finder->ctx->global, ref->name);
+    if (symbols == nullptr || symbol_table_overloads(finder->ctx->template_helpers, ref->name) != nullptr)
+        return;  // no definition or already collected
+
+    for (size_t i = 0; i < vec_size(symbols); ++i)
+    {
+        symbol_t* symbol = vec_get(symbols, i);
+        if (symbol->ast == nullptr || semantic_context_is_builtin(finder->ctx, symbol) ||
+            is_exported_definition(symbol))
+        {
+            continue;
+        }
+
+        if (symbol->kind == SYMBOL_FUNCTION)
+        {
+            // Instances in other modules link to it, so it is named after the module like an export
+            if (symbol->data.function.extern_abi == nullptr)
+            {
+                symbol->data.function.called_by_templates = true;
+                symbol_set_parent_namespace(symbol, finder->ctx->module_namespace);
+            }
+        }
+        else if (symbol->kind == SYMBOL_TEMPLATE_FN || symbol->kind == SYMBOL_TEMPLATE_CLASS)
+            vec_push(&finder->pending, symbol);
+        else
+            continue;
+
+        symbol_table_insert(finder->ctx->template_helpers, symbol);
+    }
+}
+
+void decl_collector_collect_template_helpers(decl_collector_t* collector)
+{
+    template_helper_finder_t finder = {
+        .ctx = collector->ctx,
+        .pending = VEC_INIT(nullptr),
+    };
+    ast_visitor_init(&finder.base);
+    finder.base.visit_ref_expr = find_helpers_ref_expr;
+
+    hash_table_iter_t itr;
+    for (hash_table_iter_init(&itr, &collector->ctx->global->map); hash_table_iter_has_elem(&itr);
+        hash_table_iter_next(&itr))
+    {
+        vec_t* symbols = hash_table_iter_current(&itr)->value;
+        for (size_t i = 0; i < vec_size(symbols); ++i)
+        {
+            symbol_t* symbol = vec_get(symbols, i);
+            if ((symbol->kind == SYMBOL_TEMPLATE_FN || symbol->kind == SYMBOL_TEMPLATE_CLASS) &&
+                symbol->ast != nullptr && is_exported_definition(symbol))
+            {
+                vec_push(&finder.pending, symbol);
+            }
+        }
+    }
+
+    // The private templates found are searched too, their instances are made in the same modules
+    while (vec_size(&finder.pending) > 0)
+    {
+        symbol_t* template_symbol = vec_pop(&finder.pending);
+        ast_node_t* template_ast = template_symbol->kind == SYMBOL_TEMPLATE_FN ?
+            template_symbol->data.template_fn.template_ast : template_symbol->data.template_class.template_ast;
+        ast_visitor_visit(&finder, template_ast, nullptr);
+    }
+
+    vec_deinit(&finder.pending);
+}
+
 decl_collector_t* decl_collector_create(semantic_context_t* ctx)
 {
     decl_collector_t* collector = malloc(sizeof(*collector));
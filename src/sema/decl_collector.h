@@ -16,4 +16,9 @@ void decl_collector_destroy(decl_collector_t* collector);
 // Returns false if decl symbols are not valid (ctx contains errors)
 bool decl_collector_run(decl_collector_t* collector, ast_node_t* node);
 
+// Collect the private functions and templates that the module's exported templates use into the context's template
+// helpers, once every source of the module is collected. Other modules emit the instances of the templates, which call
+// these helpers there (see semantic_context_import_template_scope).
+void decl_collector_collect_template_helpers(decl_collector_t* collector);
+
 #endif
@@ -15,6 +15,7 @@
 #include "ast/expr/method_call.h"
 #include "ast/expr/ref_expr.h"
 #include "ast/expr/self_expr.h"
+#include "ast/expr/str_lit.h"
 #include "ast/expr/unary_op.h"
 #include "ast/node.h"
 #include "ast/stmt/compound_stmt.h"
@@ -114,6 +115,12 @@ static ast_coercion_kind_t check_coercion_with_expr(semantic_analyzer_t* sema, v
         error = "cannot create view into array literal";
         coercion = COERCION_INVALID;
     }
+    else if (coercion == COERCION_ALWAYS && to_type->kind == AST_TYPE_VIEW &&
+        from_expr->type->kind == AST_TYPE_HEAP_ARRAY && !from_expr->is_lvalue)
+    {
+        error = "cannot create view into temporary heap array";
+        coercion = COERCION_INVALID;
+    }
 
     if (coercion == COERCION_INVALID && emit_error)
     {
@@ -131,6 +138,21 @@ static void* analyze_root(void* self_, ast_root_t* root, void* out_)
     for (size_t i = 0; i < vec_size(&root->tl_defs); ++i)
         AST_TRANSFORMER_TRANSFORM_VEC(sema, &root->tl_defs, i, out_);
 
+    // Template instances made while analyzing, including those made by other instances, each in the scope of the module
+    // defining its template
+    vec_t* instances = &sema->ctx->template_instances;
+    for (; sema->ctx->num_analyzed_template_instances < vec_size(instances);
+        ++sema->ctx->num_analyzed_template_instances)
+    {
+        ast_node_t* instance = vec_get(instances, sema->ctx->num_analyzed_template_instances);
+        symbol_t* instance_symbol = AST_KIND(instance) == AST_DEF_FN ?
+            ((ast_fn_def_t*)instance)->symbol : ((ast_class_def_t*)instance)->symbol;
+        symbol_table_t* global = semantic_context_enter_template_scope(sema->ctx,
+            template_instance_template(instance_symbol));
+        AST_TRANSFORMER_TRANSFORM_VEC(sema, instances, sema->ctx->num_analyzed_template_instances, out_);
+        semantic_context_leave_template_scope(sema->ctx, global);
+    }
+
     return root;
 }
 
@@ -298,9 +320,11 @@ static void* analyze_var_decl(void* self_, ast_var_decl_t* var, void* out_)
     }
 
     var->type = actual_type;
+    // Heap arrays declared without initializer start out empty
     symbol_t* symbol = add_variable_to_scope(sema, var, var->name, actual_type);
     if (symbol != nullptr)
-        init_tracker_set_initialized(sema->init_tracker, symbol, var->init_expr != nullptr);
+        init_tracker_set_initialized(sema->init_tracker, symbol,
+            var->init_expr != nullptr || actual_type->kind == AST_TYPE_HEAP_ARRAY);
     return var;
 }
 
@@ -308,9 +332,10 @@ static void* analyze_class_def(void* self_, ast_class_def_t* class_def, void* ou
 {
     semantic_analyzer_t* sema = self_;
 
-    // Locate self in global scope
-    symbol_t* class_symb = symbol_table_lookup(sema->ctx->global, class_def->base.name);
-    panic_if(class_symb == nullptr);
+    // Symbol registered by decl collector (an instance of a template is not in the global scope)
+    symbol_t* class_symb = class_def->symbol;
+    if (class_symb == nullptr)
+        return class_def;  // redeclaration, reported by decl collector
     panic_if(class_symb->ast != AST_NODE(class_def));
 
     semantic_context_push_scope(sema->ctx, SCOPE_CLASS);
@@ -327,6 +352,10 @@ static void* analyze_class_def(void* self_, ast_class_def_t* class_def, void* ou
             symbol_table_insert(sema->ctx->current, symbol_clone(type_param->symbol, true, class_symb));
         }
     }
+    else if (class_symb->kind == SYMBOL_TEMPLATE_CLASS_INST)
+    {
+        template_bind_type_arguments(class_symb, sema->ctx->current);
+    }
 
     // Add "self" to scope
     ast_decl_t* self_decl = ast_member_decl_create("self", ast_type_user(class_symb), nullptr);
@@ -382,6 +411,10 @@ static void* analyze_fn_def(void* self_, ast_fn_def_t* fn, void* out_)
             symbol_table_insert(sema->ctx->current, symbol_clone(type_param_symb, false, nullptr));
         }
     }
+    else if (fn->symbol->kind == SYMBOL_TEMPLATE_FN_INST)
+    {
+        template_bind_type_arguments(fn->symbol, sema->ctx->current);
+    }
 
     for (size_t i = 0; i < vec_size(&fn->params); ++i)
         AST_TRANSFORMER_TRANSFORM_VEC(sema, &fn->params, i, out_);
@@ -399,6 +432,7 @@ static void* analyze_fn_def(void* self_, ast_fn_def_t* fn, void* out_)
     init_tracker_destroy(sema->init_tracker);
     sema->init_tracker = init_tracker_create();
     semantic_context_pop_scope(sema->ctx);
+    sema->is_in_template_context = false;
     sema->current_function = nullptr;
     sema->current_function_scope = nullptr;
     return fn;
@@ -800,9 +834,10 @@ static void* analyze_bin_op_assignment(semantic_analyzer_t* sema, ast_bin_op_t*
     return bin_op;
 }
 
+// Type variables are accepted with any operator in a template definition; each instance is checked with its types
 static bool is_type_valid_for_operator(ast_type_t* type, token_type_t operator, ast_type_t** result_type)
 {
-    if (type->kind != AST_TYPE_BUILTIN && type->kind != AST_TYPE_POINTER)
+    if (type->kind != AST_TYPE_BUILTIN && type->kind != AST_TYPE_POINTER && type->kind != AST_TYPE_VARIABLE)
     {
         *result_type = ast_type_invalid();
         return false;
@@ -949,21 +984,24 @@ static symbol_t* function_overload_resolution(semantic_analyzer_t* sema, void* n
     return match;
 }
 
-static symbol_t* analyze_call_and_method_shared(semantic_analyzer_t* sema, void* node, vec_t* fn_symbols,
-    vec_t* arguments)
+static bool analyze_arguments(semantic_analyzer_t* sema, vec_t* arguments)
 {
-    // Resolve arguments before overload resolution
-    size_t num_args = vec_size(arguments);
-    for (size_t i = 0; i < num_args; ++i)
+    for (size_t i = 0; i < vec_size(arguments); ++i)
     {
         ast_expr_t* expr = vec_get(arguments, i);
         ast_expr_t* replacement = ast_transformer_transform(sema, expr, nullptr);
         if (expr != replacement)
             vec_replace(arguments, i, replacement);
         if (replacement->type == ast_type_invalid())
-            return nullptr;
+            return false;
     }
+    return true;
+}
 
+// Choose the overload matching the analyzed arguments and coerce them to its parameter types
+static symbol_t* resolve_call(semantic_analyzer_t* sema, void* node, vec_t* fn_symbols, vec_t* arguments)
+{
+    size_t num_args = vec_size(arguments);
     symbol_t* function = nullptr;
     if (vec_size(fn_symbols) == 1)
         function = vec_get(fn_symbols, 0);
@@ -998,48 +1036,147 @@ static symbol_t* analyze_call_and_method_shared(semantic_analyzer_t* sema, void*
             return nullptr;
         }
 
-        // Check copyability when passing an l-value argument (r-values can be moved)
-        if (arg_expr->is_lvalue && !require_type_copyable(sema, arg_expr->type, arg_expr))
-            return nullptr;
-
         if (coercion != COERCION_EQUAL)
         {
             // Wrap arg in coercion expr (don't free the return of replace)
-            vec_replace(arguments, (size_t)i, ast_coercion_expr_create(arg_expr, param_symb->type));
+            arg_expr = ast_coercion_expr_create(arg_expr, param_symb->type);
+            vec_replace(arguments, (size_t)i, arg_expr);
         }
+
+        // Check copyability when passing an l-value argument (r-values can be moved, and a coerced argument such as
+        // a view of a heap array is a new value)
+        if (arg_expr->is_lvalue && !require_type_copyable(sema, arg_expr->type, arg_expr))
+            return nullptr;
     }
 
     return function;
 }
 
+static symbol_t* analyze_call_and_method_shared(semantic_analyzer_t* sema, void* node, vec_t* fn_symbols,
+    vec_t* arguments)
+{
+    // Resolve arguments before overload resolution
+    if (!analyze_arguments(sema, arguments))
+        return nullptr;
+    return resolve_call(sema, node, fn_symbols, arguments);
+}
+
+// Infer the type parameters in param_type from the type of the argument passed for it. A type parameter matches any
+// type; pointers, views and arrays match by element type, and an array or heap array passed for a view can be viewed.
+static bool infer_type_arguments(semantic_analyzer_t* sema, ast_call_expr_t* call, symbol_t* template_symbol,
+    ast_type_t* param_type, ast_type_t* arg_type, vec_t* inferred_types)
+{
+    switch (param_type->kind)
+    {
+        case AST_TYPE_VARIABLE:
+        {
+            const char* type_var_name = param_type->data.type_variable.name;
+            for (size_t i = 0; i < vec_size(inferred_types); ++i)
+            {
+                symbol_t* type_param = vec_get(&template_symbol->data.template_fn.type_parameters, i);
+                if (strcmp(type_param->name, type_var_name) != 0)
+                    continue;
+
+                ast_type_t* inferred = vec_get(inferred_types, i);
+                if (inferred == nullptr)
+                    vec_replace(inferred_types, i, arg_type);
+                else if (inferred != arg_type)
+                {
+                    semantic_context_add_error(sema->ctx, call, ssprintf(
+                        "conflicting types for type parameter '%s': '%s' vs '%s'",
+                        type_var_name, ast_type_string(inferred), ast_type_string(arg_type)));
+                    return false;
+                }
+                break;
+            }
+            return true;
+        }
+        case AST_TYPE_POINTER:
+            if (arg_type->kind != AST_TYPE_POINTER)
+                return true;
+            return infer_type_arguments(sema, call, template_symbol, param_type->data.pointer.pointee,
+                arg_type->data.pointer.pointee, inferred_types);
+        case AST_TYPE_VIEW:
+        {
+            ast_type_t* element_type = nullptr;
+            if (arg_type->kind == AST_TYPE_VIEW)
+                element_type = arg_type->data.view.element_type;
+            else if (arg_type->kind == AST_TYPE_ARRAY)
+                element_type = arg_type->data.array.element_type;
+            else if (arg_type->kind == AST_TYPE_HEAP_ARRAY)
+                element_type = arg_type->data.heap_array.element_type;
+            if (element_type == nullptr)
+                return true;
+            return infer_type_arguments(sema, call, template_symbol, param_type->data.view.element_type,
+                element_type, inferred_types);
+        }
+        case AST_TYPE_HEAP_ARRAY:
+            if (arg_type->kind != AST_TYPE_HEAP_ARRAY)
+                return true;
+            return infer_type_arguments(sema, call, template_symbol, param_type->data.heap_array.element_type,
+                arg_type->data.heap_array.element_type, inferred_types);
+        case AST_TYPE_ARRAY:
+            if (arg_type->kind != AST_TYPE_ARRAY)
+                return true;
+            return infer_type_arguments(sema, call, template_symbol, param_type->data.array.element_type,
+                arg_type->data.array.element_type, inferred_types);
+        default:
+            return true;  // mismatches are reported when the arguments are checked against the instance
+    }
+}
+
+// Replace the type parameters of template_symbol in type by type_args
+static ast_type_t* substitute_type_parameters(symbol_t* template_symbol, ast_type_t* type, vec_t* type_args)
+{
+    switch (type->kind)
+    {
+        case AST_TYPE_VARIABLE:
+        {
+            vec_t* type_params = &template_symbol->data.template_fn.type_parameters;
+            for (size_t i = 0; i < vec_size(type_params); ++i)
+            {
+                symbol_t* type_param = vec_get(type_params, i);
+                if (strcmp(type_param->name, type->data.type_variable.name) == 0)
+                    return vec_get(type_args, i);
+            }
+            return type;
+        }
+        case AST_TYPE_POINTER:
+            return ast_type_pointer(substitute_type_parameters(template_symbol, type->data.pointer.pointee, type_args));
+        case AST_TYPE_VIEW:
+            return ast_type_view(substitute_type_parameters(template_symbol, type->data.view.element_type, type_args));
+        case AST_TYPE_HEAP_ARRAY:
+            return ast_type_heap_array(substitute_type_parameters(template_symbol, type->data.heap_array.element_type,
+                type_args));
+        case AST_TYPE_ARRAY:
+            return ast_type_array(substitute_type_parameters(template_symbol, type->data.array.element_type,
+                type_args), type->data.array.size);
+        default:
+            return type;
+    }
+}
+
 // Helper function to infer type arguments and instantiate a template function
 // Returns the instantiated function symbol, or nullptr on error
 static symbol_t* infer_and_instantiate_template_function(semantic_analyzer_t* sema, symbol_t* template_symbol,
     ast_call_expr_t* call)
 {
-    ast_fn_def_t* template_fn_def = (ast_fn_def_t*)template_symbol->data.template_fn.template_ast;
+    vec_t* params = &template_symbol->data.template_fn.fn.parameters;
     size_t num_type_params = vec_size(&template_symbol->data.template_fn.type_parameters);
     vec_t inferred_types = VEC_INIT(nullptr);
 
     for (size_t i = 0; i < num_type_params; ++i)
         vec_push(&inferred_types, nullptr);
 
-    // FIXME: This ends up visiting the parameters twice (also later in call_expr analysis)
-    // Analyze arguments to get their types for inference
-    for (size_t i = 0; i < vec_size(&call->arguments); ++i)
-    {
-        ast_expr_t* arg = vec_get(&call->arguments, i);
-        arg = ast_transformer_transform(sema, arg, nullptr);
-        vec_replace(&call->arguments, i, arg);
-        if (arg->type == ast_type_invalid())
-            goto cleanup;
-    }
+    // Analyze arguments to get their types for inference; the call to the instance uses them as they are
+    if (!analyze_arguments(sema, &call->arguments))
+        goto cleanup;
 
     // Verify argument count
-    if (num_type_params != vec_size(&call->arguments))
+    if (vec_size(params) != vec_size(&call->arguments))
     {
         semantic_context_add_error(sema->ctx, call, ssprintf("template function '%s' expects %zu argument%s, got %zu",
-            template_symbol->name, num_type_params, num_type_params == 1 ? "" : "s", vec_size(&call->arguments)));
+            template_symbol->name, vec_size(params), vec_size(params) == 1 ? "" : "s", vec_size(&call->arguments)));
         goto cleanup;
     }
 
@@ -1047,33 +1184,9 @@ static symbol_t* infer_and_instantiate_template_function(semantic_analyzer_t* se
     for (size_t i = 0; i < vec_size(&call->arguments); ++i)
     {
         ast_expr_t* arg = vec_get(&call->arguments, i);
-        ast_param_decl_t* param = vec_get(&template_fn_def->params, i);
-
-        if (param->type->kind != AST_TYPE_VARIABLE)
-            continue;
-
-        // Find which type parameter this is
-        const char* type_var_name = param->type->data.type_variable.name;
-        for (size_t j = 0; j < num_type_params; ++j)
-        {
-            symbol_t* type_param = vec_get(&template_symbol->data.template_fn.type_parameters, j);
-            if (strcmp(type_param->name, type_var_name) != 0)
-                continue;
-
-            if (vec_get(&inferred_types, i) == nullptr)
-            {
-                vec_replace(&inferred_types, j, arg->type);
-            }
-            else if (vec_get(&inferred_types, i) != arg->type)
-            {
-                semantic_context_add_error(sema->ctx, call, ssprintf(
-                    "conflicting types for type parameter '%s': '%s' vs '%s'",
-                    type_var_name, ast_type_string(vec_get(&inferred_types, i)), ast_type_string(arg->type)));
-                goto cleanup;
-            }
-            break;
-        }
-        // TODO: Handle more complex cases like pointers to type variables, arrays, etc.
+        symbol_t* param = vec_get(params, i);
+        if (!infer_type_arguments(sema, call, template_symbol, param->type, arg->type, &inferred_types))
+            goto cleanup;
     }
 
     // Check that all type parameters were inferred
@@ -1088,8 +1201,23 @@ static symbol_t* infer_and_instantiate_template_function(semantic_analyzer_t* se
         }
     }
 
+    // In a template definition, a call depending on its type parameters only gets a type; every instance of the
+    // definition instantiates the callee with its own types
+    if (sema->is_in_template_context)
+    {
+        for (size_t i = 0; i < num_type_params; ++i)
+        {
+            if (!type_resolver_is_dependent(vec_get(&inferred_types, i)))
+                continue;
+            call->base.type = substitute_type_parameters(template_symbol,
+                template_symbol->data.template_fn.fn.return_type, &inferred_types);
+            goto cleanup;
+        }
+    }
+
     // Instantiate the template function
     symbol_t* instance = instantiate_template_function(sema->ctx, template_symbol, &inferred_types);
+    vec_deinit(&inferred_types);
     return instance;
 
 cleanup:
@@ -1097,6 +1225,16 @@ cleanup:
     return nullptr;
 }
 
+// Whether expr is the name of a variable whose type is a type parameter of the template being defined
+static bool names_type_parameter_value(semantic_analyzer_t* sema, ast_expr_t* expr)
+{
+    if (!sema->is_in_template_context || AST_KIND(expr) != AST_EXPR_REF)
+        return false;
+    symbol_t* symbol = symbol_table_lookup(sema->ctx->current, ((ast_ref_expr_t*)expr)->name);
+    return symbol != nullptr && symbol->type != nullptr && symbol->type->kind == AST_TYPE_VARIABLE &&
+        (symbol->kind == SYMBOL_VARIABLE || symbol->kind == SYMBOL_PARAMETER);
+}
+
 static void* analyze_call_expr(void* self_, ast_call_expr_t* call, void* out_)
 {
     (void)out_;
@@ -1109,6 +1247,22 @@ static void* analyze_call_expr(void* self_, ast_call_expr_t* call, void* out_)
     if (AST_KIND(call->function) == AST_EXPR_ACCESS)
     {
         ast_access_expr_t* access = (ast_access_expr_t*)call->function;
+
+        // Only names are resolved through scopes; on any other expression, like (&x).load() or make().run(), this is
+        // a method call on the value of the expression. So is a method call on a variable whose type is a type
+        // parameter, which has no scope to resolve the method in.
+        if ((AST_KIND(access->outer) != AST_EXPR_REF && AST_KIND(access->outer) != AST_EXPR_ACCESS) ||
+            names_type_parameter_value(sema, access->outer))
+        {
+            ast_expr_t* replacement = ast_method_call_create(access->outer,
+                ((ast_ref_expr_t*)access->inner)->name, &call->arguments);
+            ast_node_set_source(replacement, &AST_NODE(call)->source_begin, &AST_NODE(call)->source_end);
+            access->outer = nullptr;
+            call->arguments = VEC_INIT(nullptr);  // transferred to method_call
+            ast_node_destroy(call);
+            return ast_transformer_transform(sema, replacement, out_);
+        }
+
         ast_expr_t* transformed = access_transformer_resolve(sema, access, true, &symbol);
         if (transformed->type == ast_type_invalid())
         {
@@ -1139,7 +1293,7 @@ static void* analyze_call_expr(void* self_, ast_call_expr_t* call, void* out_)
                 symbol_table = symbol->parent_namespace->data.namespace.exports;
             else
             {
-                panic_if(symbol->parent_namespace->kind != SYMBOL_CLASS);
+                panic_if(!symbol_is_class(symbol->parent_namespace));
                 symbol_table = symbol->parent_namespace->data.class.symbols;
             }
         }
@@ -1175,24 +1329,36 @@ static void* analyze_call_expr(void* self_, ast_call_expr_t* call, void* out_)
         symbol_t* instance = infer_and_instantiate_template_function(sema, symbol, call);
         if (instance == nullptr)
         {
-            call->base.type = ast_type_invalid();
+            if (call->base.type == nullptr)  // not a dependent call, which only has a type
+                call->base.type = ast_type_invalid();
+            call->base.is_lvalue = false;
             return call;
         }
         // Replace symbol with the instantiated function
         symbol = instance;
-        symbol_table = sema->ctx->global;  // Instances are registered globally
     }
 
-    vec_t* symbols = symbol_table_overloads(symbol_table, symbol->name);
-    panic_if(symbols == nullptr);
-
-    symbol_t* chosen_fn = analyze_call_and_method_shared(sema, call, symbols, &call->arguments);
+    symbol_t* chosen_fn = nullptr;
+    if (symbol->kind == SYMBOL_TEMPLATE_FN_INST)
+    {
+        // Instances are not in any scope, and the arguments were analyzed for inference
+        vec_t instances = VEC_INIT(nullptr);
+        vec_push(&instances, symbol);
+        chosen_fn = resolve_call(sema, call, &instances, &call->arguments);
+        vec_deinit(&instances);
+    }
+    else
+    {
+        vec_t* symbols = symbol_table_overloads(symbol_table, symbol->name);
+        panic_if(symbols == nullptr);
+        chosen_fn = analyze_call_and_method_shared(sema, call, symbols, &call->arguments);
+    }
     if (chosen_fn == nullptr)
     {
         call->base.type = ast_type_invalid();
         return call;
     }
-    panic_if(chosen_fn->kind != SYMBOL_FUNCTION);
+    panic_if(!symbol_is_function(chosen_fn));
 
     if (AST_KIND(call->function) == AST_EXPR_REF)
         ((ast_ref_expr_t*)call->function)->resolved_symbol = chosen_fn;
@@ -1221,13 +1387,19 @@ static void* analyzer_cast_expr(void* self_, ast_cast_expr_t* cast, void* out_)
         return cast;
     }
 
+    // A cast from or to a type variable in a template definition is checked for each instance
+    if (cast->expr->type->kind == AST_TYPE_VARIABLE || cast->target->kind == AST_TYPE_VARIABLE)
+    {
+        cast->base.type = cast->target;
+        return cast;
+    }
+
     switch (cast->expr->type->kind)
     {
         case AST_TYPE_CLASS:
         case AST_TYPE_ARRAY:
         case AST_TYPE_HEAP_ARRAY:
         case AST_TYPE_VIEW:
-        case AST_TYPE_VARIABLE:
         case AST_TYPE_TEMPLATE_INSTANCE:
             semantic_context_add_error(sema->ctx, cast, ssprintf("cannot cast '%s' to anything",
                 ast_type_string(cast->expr->type)));
@@ -1275,6 +1447,7 @@ static void* analyzer_cast_expr(void* self_, ast_cast_expr_t* cast, void* out_)
                 ast_type_string(cast->expr->type), ast_type_string(cast->target)));
             cast->base.type = ast_type_invalid();
             return cast;
+        case AST_TYPE_VARIABLE:  // handled above
         case AST_TYPE_INVALID:
             break;
     }
@@ -1303,7 +1476,7 @@ static void* analyze_construct_expr(void* self_, ast_construct_expr_t* construct
     }
 
     symbol_t* class_symbol = construct->class_type->data.class.class_symbol;
-    panic_if(class_symbol == nullptr || class_symbol->kind != SYMBOL_CLASS);
+    panic_if(class_symbol == nullptr || !symbol_is_class(class_symbol));
 
     // Visit every member initialization
     for (size_t i = 0; i < vec_size(&construct->member_inits); ++i)
@@ -1507,6 +1680,10 @@ static symbol_table_t* verify_method_instance(semantic_analyzer_t* sema, ast_exp
     if (instance->type == ast_type_invalid())
         return nullptr;
 
+    // In a template definition, what a type parameter has is only known for each instance, where it is checked
+    if (sema->is_in_template_context && instance->type->kind == AST_TYPE_VARIABLE)
+        return nullptr;
+
     // Expression before '.' must be a type with methods
     symbol_table_t* builtin_methods = semantic_context_builtin_methods_for_type(sema->ctx, instance->type);
     if (!(instance->type->kind == AST_TYPE_CLASS ||
@@ -1572,7 +1749,7 @@ static void* analyze_member_init(void* self_, ast_member_init_t* init, void* out
     panic_if(out == nullptr);
 
     symbol_t* class_symb = init->class_type->data.class.class_symbol;
-    panic_if(class_symb == nullptr || class_symb->kind != SYMBOL_CLASS);
+    panic_if(class_symb == nullptr || !symbol_is_class(class_symb));
 
     // Make sure member is defined in class
     symbol_t* member_symb = symbol_table_lookup_local(class_symb->data.class.symbols, init->member_name);
@@ -1617,11 +1794,71 @@ static void* analyze_member_init(void* self_, ast_member_init_t* init, void* out
     return init;
 }
 
+// The ordering of an atomic method selects the instruction that is emitted, so it has to be a literal. Loads can not
+// release and stores can not acquire.
+static bool analyze_memory_order(semantic_analyzer_t* sema, ast_method_call_t* call)
+{
+    static const struct
+    {
+        const char* name;
+        memory_order_t order;
+    } ORDERS[] = {
+        { "relaxed", MEMORY_ORDER_RELAXED },
+        { "acquire", MEMORY_ORDER_ACQUIRE },
+        { "release", MEMORY_ORDER_RELEASE },
+        { "acq_rel", MEMORY_ORDER_ACQ_REL },
+        { "seq_cst", MEMORY_ORDER_SEQ_CST },
+    };
+
+    ast_expr_t* order_expr = vec_last(&call->arguments);
+    if (AST_KIND(order_expr) != AST_EXPR_STR_LIT)
+    {
+        semantic_context_add_error(sema->ctx, order_expr, "memory order must be a string literal");
+        return false;
+    }
+
+    const char* name = ((ast_str_lit_t*)order_expr)->value;
+    memory_order_t order = MEMORY_ORDER_NONE;
+    for (size_t i = 0; i < sizeof(ORDERS) / sizeof(ORDERS[0]); ++i)
+    {
+        if (strcmp(ORDERS[i].name, name) == 0)
+            order = ORDERS[i].order;
+    }
+
+    bool is_load = strcmp(call->method_name, "load") == 0;
+    bool is_store = strcmp(call->method_name, "store") == 0;
+    if (order == MEMORY_ORDER_NONE ||
+        (is_load && (order == MEMORY_ORDER_RELEASE || order == MEMORY_ORDER_ACQ_REL)) ||
+        (is_store && (order == MEMORY_ORDER_ACQUIRE || order == MEMORY_ORDER_ACQ_REL)))
+    {
+        semantic_context_add_error(sema->ctx, order_expr, ssprintf("invalid memory order '%s' for %s", name,
+            call->method_name));
+        return false;
+    }
+
+    call->memory_order = order;
+    return true;
+}
+
 static void* analyze_method_call(void* self_, ast_method_call_t* call, void* out_)
 {
     semantic_analyzer_t* sema = self_;
 
     symbol_table_t* method_table = verify_method_instance(sema, &call->instance, out_);
+    if (method_table == nullptr && call->instance->type->kind == AST_TYPE_VARIABLE)
+    {
+        // Only each instance of the template knows the method; its result is a type of its own until then, which can
+        // be cast to what the definition expects
+        if (!analyze_arguments(sema, &call->arguments))
+        {
+            call->base.type = ast_type_invalid();
+            return call;
+        }
+        call->base.is_lvalue = false;
+        call->base.type = ast_type_variable(ssprintf("%s.%s()", ast_type_string(call->instance->type),
+            call->method_name));
+        return call;
+    }
     if (method_table == nullptr)
     {
         call->base.type = ast_type_invalid();
@@ -1645,6 +1882,14 @@ static void* analyze_method_call(void* self_, ast_method_call_t* call, void* out
         return call;
     }
 
+    // The only builtin methods of pointers are the atomic ones
+    if (chosen_method->data.function.is_builtin && call->instance->type->kind == AST_TYPE_POINTER &&
+        !analyze_memory_order(sema, call))
+    {
+        call->base.type = ast_type_invalid();
+        return call;
+    }
+
     call->is_builtin_method = chosen_method->data.function.is_builtin;
     call->method_symbol = chosen_method;
     call->base.is_lvalue = false;
@@ -1746,6 +1991,33 @@ static void* analyze_str_lit(void* self_, ast_str_lit_t* lit, void* out_)
     return lit;
 }
 
+// &name of a function is the address of its code, for handing it to the runtime or to C; it is called with the
+// arguments of its own signature, which nothing checks
+static void* analyze_function_address(semantic_analyzer_t* sema, ast_unary_op_t* unary_op, symbol_t* fn_symbol)
+{
+    unary_op->base.type = ast_type_invalid();
+
+    if (AST_KIND(unary_op->expr) != AST_EXPR_REF)
+    {
+        semantic_context_add_error(sema->ctx, unary_op, "function address can only be taken by its name");
+        return unary_op;
+    }
+
+    vec_t* overloads = symbol_table_overloads(sema->ctx->global, fn_symbol->name);
+    if (overloads != nullptr && vec_size(overloads) > 1)
+    {
+        semantic_context_add_error(sema->ctx, unary_op, ssprintf("cannot take address of overloaded function '%s'",
+            fn_symbol->name));
+        return unary_op;
+    }
+
+    fn_symbol->data.function.address_taken = true;
+    unary_op->function_symbol = fn_symbol;
+    unary_op->base.is_lvalue = false;
+    unary_op->base.type = ast_type_pointer(ast_type_builtin(TYPE_VOID));
+    return unary_op;
+}
+
 static void* analyze_unary_op(void* self_, ast_unary_op_t* unary_op, void* out_)
 {
     (void)out_;
@@ -1753,6 +2025,9 @@ static void* analyze_unary_op(void* self_, ast_unary_op_t* unary_op, void* out_)
 
     symbol_t* symbol = nullptr;  // can be nullptr after visit
     unary_op->expr = ast_transformer_transform(sema, unary_op->expr, &symbol);
+    if (unary_op->op == TOKEN_AMPERSAND && symbol != nullptr && symbol->kind == SYMBOL_FUNCTION)
+        return analyze_function_address(sema, unary_op, symbol);
+
     if (unary_op->expr->type == ast_type_invalid())
     {
         unary_op->base.type = ast_type_invalid();
@@ -1828,6 +2103,44 @@ static void* analyze_expr_stmt(void* self_, ast_expr_stmt_t* stmt, void* out_)
     return stmt;
 }
 
+// Warn about loop attributes that the optimizer can not act on. The hints are still emitted, LLVM ignores
+// the ones it can not honor.
+static void check_loop_hints(semantic_analyzer_t* sema, void* loop, ast_loop_hints_t* hints, ast_expr_t* condition,
+    bool has_early_exit)
+{
+    bool has_condition = condition != nullptr && AST_KIND(condition) != AST_EXPR_BOOL_LIT;
+    if (hints->unroll == AST_LOOP_UNROLL_FULL && !has_condition)
+        semantic_context_add_warning(sema->ctx, loop, "@unroll(full) ignored: loop has no terminating condition");
+
+    if (hints->vectorize != AST_LOOP_VECTORIZE_ENABLE)
+        return;
+
+    if (hints->vectorize_width != 0 && (hints->vectorize_width & (hints->vectorize_width - 1)) != 0)
+    {
+        semantic_context_add_warning(sema->ctx, loop,
+            ssprintf("@vectorize width %u ignored: must be a power of two", hints->vectorize_width));
+    }
+
+    if (has_early_exit)
+        semantic_context_add_warning(sema->ctx, loop, "@vectorize ignored: loop can exit early with break or return");
+}
+
+// Analyze a loop body, returning whether it contains a break or return that leaves the loop early
+static bool analyze_loop_body(semantic_analyzer_t* sema, ast_stmt_t** body, void* out_)
+{
+    bool outer_has_break = sema->loop_has_break;
+    int outer_return_count = sema->return_count;
+    sema->loop_has_break = false;
+
+    sema->loop_depth++;
+    *body = ast_transformer_transform(sema, *body, out_);
+    sema->loop_depth--;
+
+    bool has_early_exit = sema->loop_has_break || sema->return_count != outer_return_count;
+    sema->loop_has_break = outer_has_break;
+    return has_early_exit;
+}
+
 static void* analyze_for_stmt(void* self_, ast_for_stmt_t* for_stmt, void* out_)
 {
     semantic_analyzer_t* sema = self_;
@@ -1861,9 +2174,8 @@ static void* analyze_for_stmt(void* self_, ast_for_stmt_t* for_stmt, void* out_)
         for_stmt->post_stmt = ast_transformer_transform(sema, for_stmt->post_stmt, out_);
 
     // Body
-    sema->loop_depth++;
-    for_stmt->body = ast_transformer_transform(sema, for_stmt->body, out_);
-    sema->loop_depth--;
+    bool has_early_exit = analyze_loop_body(sema, &for_stmt->body, out_);
+    check_loop_hints(sema, for_stmt, &for_stmt->hints, for_stmt->cond_expr, has_early_exit);
 
 cleanup:
     // Discard init_tracker state changes inside for
@@ -1934,10 +2246,200 @@ static void* analyze_inc_dec_stmt(void* self_, ast_inc_dec_stmt_t* inc_dec, void
     return inc_dec;
 }
 
+// Whether expr designates storage in the current function's frame: a local variable, a parameter or part of one
+static bool expr_designates_local(ast_expr_t* expr)
+{
+    switch (AST_KIND(expr))
+    {
+        case AST_EXPR_PAREN:
+            return expr_designates_local(((ast_paren_expr_t*)expr)->expr);
+        case AST_EXPR_REF:
+            return true;  // references inside a function body are always to locals or parameters
+        case AST_EXPR_MEMBER_ACCESS:
+        {
+            ast_member_access_t* access = (ast_member_access_t*)expr;
+            return access->instance->type->kind != AST_TYPE_POINTER && expr_designates_local(access->instance);
+        }
+        case AST_EXPR_ARRAY_SUBSCRIPT:
+        {
+            ast_array_subscript_t* subscript = (ast_array_subscript_t*)expr;
+            return subscript->array->type->kind == AST_TYPE_ARRAY && expr_designates_local(subscript->array);
+        }
+        default:
+            return false;
+    }
+}
+
+// Whether the value of expr is the address of storage in the current function's frame
+static bool expr_is_local_address(ast_expr_t* expr)
+{
+    switch (AST_KIND(expr))
+    {
+        case AST_EXPR_PAREN:
+            return expr_is_local_address(((ast_paren_expr_t*)expr)->expr);
+        case AST_EXPR_CAST:
+            return expr_is_local_address(((ast_cast_expr_t*)expr)->expr);
+        case AST_EXPR_UNARY_OP:
+        {
+            ast_unary_op_t* unary = (ast_unary_op_t*)expr;
+            return unary->op == TOKEN_AMPERSAND && expr_designates_local(unary->expr);
+        }
+        case AST_EXPR_COERCION:
+        {
+            ast_coercion_expr_t* coercion = (ast_coercion_expr_t*)expr;
+            return coercion->expr->type->kind == AST_TYPE_ARRAY && coercion->target->kind == AST_TYPE_VIEW &&
+                expr_designates_local(coercion->expr);
+        }
+        case AST_EXPR_ARRAY_SLICE:
+        {
+            ast_array_slice_t* slice = (ast_array_slice_t*)expr;
+            return slice->array->type->kind == AST_TYPE_ARRAY && expr_designates_local(slice->array);
+        }
+        default:
+            return false;
+    }
+}
+
+static bool symbol_is_method(symbol_t* fn_symb)
+{
+    return fn_symb->kind == SYMBOL_METHOD || fn_symb->kind == SYMBOL_TRAIT_IMPL;
+}
+
+// Caller and callee of a guaranteed tail call must have the same prototype in LLVM
+static bool has_same_signature(symbol_t* caller, symbol_t* callee)
+{
+    if (symbol_is_method(caller) != symbol_is_method(callee) ||
+        caller->data.function.return_type != callee->data.function.return_type ||
+        vec_size(&caller->data.function.parameters) != vec_size(&callee->data.function.parameters))
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < vec_size(&caller->data.function.parameters); ++i)
+    {
+        symbol_t* caller_param = vec_get(&caller->data.function.parameters, i);
+        symbol_t* callee_param = vec_get(&callee->data.function.parameters, i);
+        if (caller_param->type != callee_param->type)
+            return false;
+    }
+    return true;
+}
+
+// A local variable or parameter in scope whose destructor would have to run after a call returned from here
+static symbol_t* find_pending_destructor(semantic_analyzer_t* sema)
+{
+    for (symbol_table_t* scope = sema->ctx->current; scope != nullptr; scope = scope->parent)
+    {
+        hash_table_iter_t itr;
+        for (hash_table_iter_init(&itr, &scope->map); hash_table_iter_has_elem(&itr); hash_table_iter_next(&itr))
+        {
+            vec_t* symbols = hash_table_iter_current(&itr)->value;
+            for (size_t i = 0; i < vec_size(symbols); ++i)
+            {
+                symbol_t* symb = vec_get(symbols, i);
+                if ((symb->kind == SYMBOL_VARIABLE || symb->kind == SYMBOL_PARAMETER) && symb->type != nullptr &&
+                    ast_type_has_trait(symb->type, TRAIT_EXPLICIT_DESTRUCTOR))
+                {
+                    return symb;
+                }
+            }
+        }
+
+        if (scope == sema->current_function_scope)
+            break;
+    }
+    return nullptr;
+}
+
+// A @tail call between module-local functions. Either one uses the C calling convention instead of fastcc if its address
+// is taken, which can happen anywhere in the module, so this part of the check waits until the whole module is analyzed.
+typedef struct tail_call
+{
+    ast_return_stmt_t* stmt;
+    symbol_t* caller;
+    symbol_t* callee;
+} tail_call_t;
+
+// `return @tail call` is emitted as a guaranteed tail call, which reuses the caller's frame: the call must be the
+// returned value, have the same prototype and calling convention as the caller, and nothing may be left to do in the
+// caller's frame afterwards. Pointers to locals that were stored elsewhere before the call must not be used by it.
+static void check_tail_call(semantic_analyzer_t* sema, ast_return_stmt_t* ret_stmt)
+{
+    if (sema->is_in_template_context)
+        return;  // checked for each instance
+
+    ast_expr_t* value = ret_stmt->value_expr;
+    while (value != nullptr && AST_KIND(value) == AST_EXPR_PAREN)
+        value = ((ast_paren_expr_t*)value)->expr;
+
+    symbol_t* callee = nullptr;
+    vec_t* arguments = nullptr;
+    ast_expr_t* instance = nullptr;
+    if (value != nullptr && AST_KIND(value) == AST_EXPR_CALL)
+    {
+        callee = ((ast_call_expr_t*)value)->function_symbol;
+        arguments = &((ast_call_expr_t*)value)->arguments;
+    }
+    else if (value != nullptr && AST_KIND(value) == AST_EXPR_METHOD_CALL &&
+        !((ast_method_call_t*)value)->is_builtin_method)
+    {
+        callee = ((ast_method_call_t*)value)->method_symbol;
+        arguments = &((ast_method_call_t*)value)->arguments;
+        instance = ((ast_method_call_t*)value)->instance;
+    }
+
+    if (callee == nullptr)
+    {
+        semantic_context_add_error(sema->ctx, ret_stmt, "@tail requires the returned value to be a function call");
+        return;
+    }
+
+    symbol_t* caller = sema->current_function ? sema->current_function : sema->current_method;
+    if (!has_same_signature(caller, callee))
+    {
+        semantic_context_add_error(sema->ctx, ret_stmt, ssprintf("@tail call to '%s' requires it to have the same "
+            "parameter and return types as '%s'", callee->name, caller->name));
+        return;
+    }
+
+    if (symbol_is_module_local_function(caller) != symbol_is_module_local_function(callee))
+    {
+        semantic_context_add_error(sema->ctx, ret_stmt, ssprintf("@tail call to '%s' requires it to be exported "
+            "if and only if '%s' is", callee->name, caller->name));
+        return;
+    }
+
+    if (symbol_is_module_local_function(caller))
+    {
+        tail_call_t* tail_call = malloc(sizeof(*tail_call));
+        *tail_call = (tail_call_t){ .stmt = ret_stmt, .caller = caller, .callee = callee };
+        vec_push(&sema->tail_calls, tail_call);
+    }
+
+    symbol_t* pending = find_pending_destructor(sema);
+    if (pending != nullptr)
+    {
+        semantic_context_add_error(sema->ctx, ret_stmt, ssprintf("@tail call not possible: destructor of '%s' "
+            "must run after the call", pending->name));
+        return;
+    }
+
+    bool passes_local = instance != nullptr && instance->type->kind != AST_TYPE_POINTER &&
+        expr_designates_local(instance);
+    for (size_t i = 0; i < vec_size(arguments) && !passes_local; ++i)
+        passes_local = expr_is_local_address(vec_get(arguments, i));
+    if (passes_local)
+    {
+        semantic_context_add_error(sema->ctx, ret_stmt,
+            "@tail call not possible: the address of a local variable is passed to the call");
+    }
+}
+
 static void* analyze_return_stmt(void* self_, ast_return_stmt_t* ret_stmt, void* out_)
 {
     semantic_analyzer_t* sema = self_;
     panic_if(sema->current_method == nullptr && sema->current_function == nullptr);
+    ++sema->return_count;
 
     // Get return type from either current function or current method
     ast_type_t* return_type = sema->current_function ? sema->current_function->data.function.return_type :
@@ -1947,6 +2449,8 @@ static void* analyze_return_stmt(void* self_, ast_return_stmt_t* ret_stmt, void*
     {
         if (return_type != ast_type_builtin(TYPE_VOID))
             semantic_context_add_error(sema->ctx, ret_stmt, "Non-void function must return a value");
+        if (ret_stmt->tail_call)
+            check_tail_call(sema, ret_stmt);
         return ret_stmt;
     }
 
@@ -1954,6 +2458,9 @@ static void* analyze_return_stmt(void* self_, ast_return_stmt_t* ret_stmt, void*
     if (ret_stmt->value_expr->type == ast_type_invalid())
         return ret_stmt;  // avoid propagating error
 
+    if (ret_stmt->tail_call)
+        check_tail_call(sema, ret_stmt);
+
     ast_coercion_kind_t coercion = check_coercion_with_expr(sema, ret_stmt->value_expr, ret_stmt->value_expr,
         return_type, true);
     if (coercion == COERCION_INVALID)
@@ -1996,9 +2503,8 @@ static void* analyze_while_stmt(void* self_, ast_while_stmt_t* while_stmt, void*
     init_tracker_t* body_tracker = init_tracker_clone(sema->init_tracker);
     sema->init_tracker = body_tracker;
 
-    sema->loop_depth++;
-    while_stmt->body = ast_transformer_transform(sema, while_stmt->body, out_);
-    sema->loop_depth--;
+    bool has_early_exit = analyze_loop_body(sema, &while_stmt->body, out_);
+    check_loop_hints(sema, while_stmt, &while_stmt->hints, while_stmt->condition, has_early_exit);
 
     // Discard init_tracker state changes inside while
     init_tracker_destroy(sema->init_tracker);
@@ -2013,6 +2519,7 @@ static void* analyze_break_stmt(void* self_, ast_break_stmt_t* break_stmt, void*
 
     if (sema->loop_depth == 0)
         semantic_context_add_error(sema->ctx, break_stmt, "break statement not in loop");
+    sema->loop_has_break = true;
 
     return break_stmt;
 }
@@ -2036,6 +2543,7 @@ semantic_analyzer_t* semantic_analyzer_create(semantic_context_t* ctx)
     *sema = (semantic_analyzer_t){
         .ctx = ctx,
         .init_tracker = init_tracker_create(),
+        .tail_calls = VEC_INIT(free),
         .base = (ast_transformer_t){
             .transform_root = analyze_root,
             // Declarations
@@ -2092,12 +2600,30 @@ void semantic_analyzer_destroy(semantic_analyzer_t* sema)
         return;
 
     init_tracker_destroy(sema->init_tracker);
+    vec_deinit(&sema->tail_calls);
     free(sema);
 }
 
+static void check_tail_call_conventions(semantic_analyzer_t* sema)
+{
+    for (size_t i = 0; i < vec_size(&sema->tail_calls); ++i)
+    {
+        tail_call_t* tail_call = vec_get(&sema->tail_calls, i);
+        symbol_t* taken = tail_call->caller->data.function.address_taken ? tail_call->caller :
+            tail_call->callee->data.function.address_taken ? tail_call->callee : nullptr;
+        if (taken != nullptr)
+        {
+            semantic_context_add_error(sema->ctx, tail_call->stmt, ssprintf("@tail call to '%s' not possible: the "
+                "address of '%s' is taken, so it uses the C calling convention", tail_call->callee->name, taken->name));
+        }
+    }
+    vec_deinit(&sema->tail_calls);
+}
+
 bool semantic_analyzer_run(semantic_analyzer_t* sema, ast_node_t* root)
 {
     size_t errors = vec_size(&sema->ctx->error_nodes);
     ast_transformer_transform(sema, root, nullptr);
+    check_tail_call_conventions(sema);
     return errors == vec_size(&sema->ctx->error_nodes);  // no new errors
 }
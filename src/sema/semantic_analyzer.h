@@ -25,6 +25,9 @@ typedef struct semantic_analyzer
     bool is_lvalue_context;
     bool is_in_template_context;  // Track when analyzing template definitions (not instances)
     int loop_depth;  // Track nesting depth of loops for break/continue validation
+    bool loop_has_break;  // Innermost loop being analyzed contains a break
+    int return_count;     // Number of return statements analyzed, used to find loops that can exit early
+    vec_t tail_calls;     // tail_call_t*: @tail calls between module-local functions, checked at the end of a run
 } semantic_analyzer_t;
 
 semantic_analyzer_t* semantic_analyzer_create(semantic_context_t* ctx);
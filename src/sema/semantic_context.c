@@ -8,6 +8,7 @@
 #include "common/containers/hash_table.h"
 #include "common/containers/vec.h"
 #include "common/debug/panic.h"
+#include "common/util/ssprintf.h"
 #include "compiler_error.h"
 #include "sema/symbol.h"
 #include "sema/symbol_table.h"
@@ -46,6 +47,9 @@ semantic_context_t* semantic_context_create(const char* project_name, const char
         .warning_nodes = VEC_INIT(nullptr),  // we do not own these nodes
         .builtin_ast_gc = VEC_INIT(ast_node_destroy),
         .imports = VEC_INIT(nullptr),        // we do not own these nodes
+        .heap_array_methods = HASH_TABLE_INIT(symbol_table_destroy_void),
+        .template_helpers = symbol_table_create(nullptr, SCOPE_EXPORT),
+        .template_instances = VEC_INIT(ast_node_destroy),
     };
 
     vec_push(&ctx->scope_stack, global_scope);
@@ -65,16 +69,22 @@ void semantic_context_destroy(semantic_context_t* ctx)
     //       So we must explicitly destroy it here
     symbol_destroy(ctx->module_namespace);
     symbol_table_destroy(ctx->exports);
+    symbol_table_destroy(ctx->template_helpers);
     free(ctx->self_projectname);
     vec_deinit(&ctx->scope_stack);
     vec_deinit(&ctx->error_nodes);
     vec_deinit(&ctx->warning_nodes);
     vec_deinit(&ctx->builtin_ast_gc);
+    vec_deinit(&ctx->template_instances);
     vec_deinit(&ctx->imports);
     for (size_t i = 0; i < TYPE_END; ++i)
+    {
         symbol_table_destroy(ctx->builtin_methods[i]);
+        symbol_table_destroy(ctx->atomic_methods[i]);
+    }
     symbol_table_destroy(ctx->array_methods);
     symbol_table_destroy(ctx->view_methods);
+    hash_table_deinit(&ctx->heap_array_methods);
     free(ctx);
 }
 
@@ -101,6 +111,13 @@ void semantic_context_add_error(semantic_context_t* ctx, void* ast_node, const c
 void semantic_context_add_warning(semantic_context_t* ctx, void* ast_node, const char* description)
 {
     compiler_error_create_for_ast(true, description, ast_node);
+
+    // All warnings of a node are printed together, so only list each node once
+    for (size_t i = 0; i < vec_size(&ctx->warning_nodes); ++i)
+    {
+        if (vec_get(&ctx->warning_nodes, i) == ast_node)
+            return;
+    }
     vec_push(&ctx->warning_nodes, ast_node);
 }
 
@@ -124,6 +141,92 @@ void semantic_context_register_builtins(semantic_context_t* ctx)
     symbol_table_insert(ctx->global, print_i32);
 }
 
+bool semantic_context_is_builtin(semantic_context_t* ctx, symbol_t* symbol)
+{
+    for (size_t i = 0; i < vec_size(&ctx->builtin_ast_gc); ++i)
+    {
+        if (vec_get(&ctx->builtin_ast_gc, i) == symbol->ast)
+            return true;
+    }
+    return false;
+}
+
+static void insert_all(symbol_table_t* dst, symbol_table_t* src)
+{
+    hash_table_iter_t itr;
+    for (hash_table_iter_init(&itr, &src->map); hash_table_iter_has_elem(&itr); hash_table_iter_next(&itr))
+    {
+        vec_t* overloads = hash_table_iter_current(&itr)->value;
+        for (size_t i = 0; i < vec_size(overloads); ++i)
+            symbol_table_insert(dst, vec_get(overloads, i));
+    }
+}
+
+void semantic_context_import_template_scope(semantic_context_t* ctx, symbol_t* imported_namespace,
+    symbol_table_t* template_helpers)
+{
+    panic_if(imported_namespace->kind != SYMBOL_NAMESPACE);
+
+    // The helpers keep the names they have in their module; external functions are not named after it
+    symbol_table_t* helpers = symbol_table_create(nullptr, SCOPE_GLOBAL);
+    hash_table_iter_t itr;
+    for (hash_table_iter_init(&itr, &template_helpers->map); hash_table_iter_has_elem(&itr);
+        hash_table_iter_next(&itr))
+    {
+        vec_t* overloads = hash_table_iter_current(&itr)->value;
+        for (size_t i = 0; i < vec_size(overloads); ++i)
+        {
+            symbol_t* helper = vec_get(overloads, i);
+            symbol_t* clone = symbol_clone(helper, false, nullptr);
+            if (helper->kind != SYMBOL_FUNCTION || helper->data.function.extern_abi == nullptr)
+                symbol_set_parent_namespace(clone, imported_namespace);
+            symbol_table_insert(helpers, clone);
+        }
+    }
+
+    symbol_table_t* scope = symbol_table_create(nullptr, SCOPE_EXPORT);
+    insert_all(scope, imported_namespace->data.namespace.exports);
+    insert_all(scope, helpers);
+    for (hash_table_iter_init(&itr, &ctx->global->map); hash_table_iter_has_elem(&itr); hash_table_iter_next(&itr))
+    {
+        vec_t* overloads = hash_table_iter_current(&itr)->value;
+        for (size_t i = 0; i < vec_size(overloads); ++i)
+        {
+            symbol_t* symbol = vec_get(overloads, i);
+            if (semantic_context_is_builtin(ctx, symbol))
+                symbol_table_insert(scope, symbol);
+        }
+    }
+
+    imported_namespace->data.namespace.template_helpers = helpers;
+    imported_namespace->data.namespace.template_scope = scope;
+}
+
+symbol_table_t* semantic_context_enter_template_scope(semantic_context_t* ctx, symbol_t* template_symbol)
+{
+    symbol_t* defining_namespace = template_symbol->parent_namespace;
+    symbol_table_t* scope = ctx->global;
+    if (defining_namespace != nullptr && defining_namespace->kind == SYMBOL_NAMESPACE &&
+        defining_namespace->data.namespace.template_scope != nullptr)
+    {
+        scope = defining_namespace->data.namespace.template_scope;
+    }
+
+    // Neither are the scopes of the code that made the instance visible
+    symbol_table_t* global = ctx->global;
+    ctx->global = scope;
+    vec_push(&ctx->scope_stack, scope);
+    ctx->current = scope;
+    return global;
+}
+
+void semantic_context_leave_template_scope(semantic_context_t* ctx, symbol_table_t* global)
+{
+    vec_pop(&ctx->scope_stack);
+    ctx->current = vec_last(&ctx->scope_stack);
+    ctx->global = global;
+}
+
 static void inject_symbols_into_namespace(symbol_t* namespace, symbol_table_t* symbols)
 {
     panic_if(namespace->kind != SYMBOL_NAMESPACE);
@@ -171,6 +274,71 @@ symbol_t* semantic_context_register_namespace(semantic_context_t* ctx, symbol_t*
     return ns_symbol;
 }
 
+static symbol_t* create_builtin_method(symbol_table_t* table, const char* name, ast_type_t* return_type)
+{
+    symbol_t* method = symbol_create(name, SYMBOL_METHOD, nullptr, nullptr);
+    method->data.function.return_type = return_type;
+    method->data.function.is_builtin = true;
+    symbol_table_insert(table, method);
+    return method;
+}
+
+static void add_builtin_method_param(symbol_t* method, const char* name, ast_type_t* type)
+{
+    symbol_t* param = symbol_create(name, SYMBOL_PARAMETER, nullptr, nullptr);
+    param->type = type;
+    vec_push(&method->data.function.parameters, param);
+}
+
+// The signatures of push and pop depend on the element type, so every heap array type gets its own table
+static symbol_table_t* heap_array_methods(semantic_context_t* ctx, ast_type_t* element_type)
+{
+    const char* key = ssprintf("%p", element_type);
+    symbol_table_t* methods = hash_table_find(&ctx->heap_array_methods, key);
+    if (methods != nullptr)
+        return methods;
+
+    methods = symbol_table_create(nullptr, SCOPE_CLASS);
+    create_builtin_method(methods, "len", ast_type_builtin(TYPE_USIZE));
+    add_builtin_method_param(create_builtin_method(methods, "push", ast_type_builtin(TYPE_VOID)), "value",
+        element_type);
+    create_builtin_method(methods, "pop", element_type);
+    add_builtin_method_param(create_builtin_method(methods, "reserve", ast_type_builtin(TYPE_VOID)), "capacity",
+        ast_type_builtin(TYPE_USIZE));
+    create_builtin_method(methods, "clear", ast_type_builtin(TYPE_VOID));
+    hash_table_insert(&ctx->heap_array_methods, key, methods);
+    return methods;
+}
+
+// load(), store(), fetch_add() and compare_exchange() of integer pointers, lowered to atomic instructions; the
+// ordering of each access is given as a string literal ending the arguments
+static symbol_table_t* atomic_methods(semantic_context_t* ctx, ast_type_t* integer_type)
+{
+    symbol_table_t** methods = &ctx->atomic_methods[integer_type->data.builtin.type];
+    if (*methods != nullptr)
+        return *methods;
+
+    *methods = symbol_table_create(nullptr, SCOPE_CLASS);
+    ast_type_t* order_type = ast_type_builtin(TYPE_STRING);
+
+    symbol_t* load = create_builtin_method(*methods, "load", integer_type);
+    add_builtin_method_param(load, "order", order_type);
+
+    symbol_t* store = create_builtin_method(*methods, "store", ast_type_builtin(TYPE_VOID));
+    add_builtin_method_param(store, "value", integer_type);
+    add_builtin_method_param(store, "order", order_type);
+
+    symbol_t* fetch_add = create_builtin_method(*methods, "fetch_add", integer_type);
+    add_builtin_method_param(fetch_add, "value", integer_type);
+    add_builtin_method_param(fetch_add, "order", order_type);
+
+    symbol_t* compare_exchange = create_builtin_method(*methods, "compare_exchange", ast_type_builtin(TYPE_BOOL));
+    add_builtin_method_param(compare_exchange, "expected", integer_type);
+    add_builtin_method_param(compare_exchange, "desired", integer_type);
+    add_builtin_method_param(compare_exchange, "order", order_type);
+    return *methods;
+}
+
 symbol_table_t* semantic_context_builtin_methods_for_type(semantic_context_t* ctx, ast_type_t* type)
 {
     switch (type->kind)
@@ -181,6 +349,12 @@ symbol_table_t* semantic_context_builtin_methods_for_type(semantic_context_t* ct
             return ctx->array_methods;
         case AST_TYPE_VIEW:
             return ctx->view_methods;
+        case AST_TYPE_HEAP_ARRAY:
+            return heap_array_methods(ctx, type->data.heap_array.element_type);
+        case AST_TYPE_POINTER:
+            if (ast_type_is_integer(type->data.pointer.pointee))
+                return atomic_methods(ctx, type->data.pointer.pointee);
+            return nullptr;
         default:
             return nullptr;
     }
@@ -198,8 +372,18 @@ static void register_builtin_methods(semantic_context_t* ctx)
     str_raw_method->data.function.is_builtin = true;
     symbol_table_insert(string, str_len_method);
     symbol_table_insert(string, str_raw_method);
+    create_builtin_method(string, "hash", ast_type_builtin(TYPE_U64));
     ctx->builtin_methods[TYPE_STRING] = string;
 
+    // Integers have hash() like strings: equal values hash equally
+    for (type_t type = 0; type < TYPE_END; ++type)
+    {
+        if (!ast_type_is_integer(ast_type_builtin(type)))
+            continue;
+        ctx->builtin_methods[type] = symbol_table_create(nullptr, SCOPE_CLASS);
+        create_builtin_method(ctx->builtin_methods[type], "hash", ast_type_builtin(TYPE_U64));
+    }
+
     // ARRAY methods
     symbol_table_t* array = symbol_table_create(nullptr, SCOPE_CLASS);
     symbol_t* arr_len_method = symbol_create("len", SYMBOL_METHOD, nullptr, nullptr);
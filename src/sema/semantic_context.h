@@ -1,6 +1,7 @@
 #ifndef SEMA_SEMANTIC_CONTEXT__H
 #define SEMA_SEMANTIC_CONTEXT__H
 
+#include "common/containers/hash_table.h"
 #include "common/containers/vec.h"
 #include "sema/symbol_table.h"
 
@@ -21,8 +22,19 @@ typedef struct semantic_context
     symbol_table_t* builtin_methods[TYPE_END];  // For TYPE_STRING, etc.
     symbol_table_t* array_methods;              // For AST_TYPE_ARRAY
     symbol_table_t* view_methods;               // For AST_TYPE_VIEW
+    hash_table_t heap_array_methods;            // element type address (char*) -> symbol_table_t*, created on demand
+    symbol_table_t* atomic_methods[TYPE_END];   // For pointers to each integer type, created on demand
 
     vec_t builtin_ast_gc;     // AST that was injected with semantic_context_register_builtins
+
+    // Private functions and templates that the exported templates use (no ownership), see
+    // decl_collector_collect_template_helpers
+    symbol_table_t* template_helpers;
+
+    // Templates instantiated by this module: ast_class_def_t* or ast_fn_def_t* (owned), analyzed and emitted with the
+    // module
+    vec_t template_instances;
+    size_t num_analyzed_template_instances;
 } semantic_context_t;
 
 semantic_context_t* semantic_context_create(const char* project_name, const char* module_name);
@@ -46,6 +58,23 @@ void semantic_context_add_warning(semantic_context_t* ctx, void* ast_node, const
 symbol_t* semantic_context_register_namespace(semantic_context_t* ctx, symbol_t* parent_namespace, const char* name,
     symbol_table_t* symbols);
 
+// Whether symbol is one injected by semantic_context_register_builtins
+bool semantic_context_is_builtin(semantic_context_t* ctx, symbol_t* symbol);
+
+// Give the instances of the templates of an imported module the scope of that module, once its exports are imported
+// into imported_namespace. Instances are emitted by the modules using them, but their names must not resolve to what
+// those modules define: they see the exports and template helpers of the module defining the template and the
+// builtins, and the private helpers are cloned into imported_namespace for it.
+void semantic_context_import_template_scope(semantic_context_t* ctx, symbol_t* imported_namespace,
+    symbol_table_t* template_helpers);
+
+// Resolve names like the module defining template_symbol, to collect or analyze an instance of it: in the global scope
+// for a template of this module, in the template scope of the imported module otherwise. Returns the global scope to
+// pass to semantic_context_leave_template_scope.
+symbol_table_t* semantic_context_enter_template_scope(semantic_context_t* ctx, symbol_t* template_symbol);
+
+void semantic_context_leave_template_scope(semantic_context_t* ctx, symbol_table_t* global);
+
 symbol_table_t* semantic_context_builtin_methods_for_type(semantic_context_t* ctx, ast_type_t* type);
 
 #endif
@@ -1,4 +1,6 @@
 #include "symbol.h"
+#include "ast/def/class_def.h"
+#include "ast/def/fn_def.h"
 #include "ast/node.h"
 #include "ast/type.h"
 #include "ast/util/cloner.h"
@@ -41,13 +43,13 @@ symbol_t* symbol_create(const char* name, symbol_kind_t kind, void* ast, symbol_
         case SYMBOL_TEMPLATE_CLASS:
             symbol->data.template_class.cls.symbols = symbol_table_create(nullptr, SCOPE_CLASS);
             symbol->data.template_class.type_parameters = VEC_INIT(nullptr);
-            symbol->data.template_class.instantiations = VEC_INIT(nullptr);
+            symbol->data.template_class.instantiations = VEC_INIT(symbol_destroy_void);
             symbol->data.template_class.template_ast = nullptr;
             break;
         case SYMBOL_TEMPLATE_FN:
             symbol->data.template_fn.fn.parameters = VEC_INIT(symbol_destroy_void);
             symbol->data.template_fn.type_parameters = VEC_INIT(nullptr);
-            symbol->data.template_fn.instantiations = VEC_INIT(nullptr);
+            symbol->data.template_fn.instantiations = VEC_INIT(symbol_destroy_void);
             symbol->data.template_fn.template_ast = nullptr;
             break;
         case SYMBOL_TEMPLATE_CLASS_INST:
@@ -113,6 +115,32 @@ symbol_t* symbol_clone(symbol_t* source, bool include_ast, symbol_t* parent_name
             }
             break;
         }
+        case SYMBOL_TEMPLATE_CLASS:
+            // Instances are created by each module using the template, so only what is needed to instantiate it is
+            // cloned
+            for (size_t i = 0; i < vec_size(&source->data.template_class.type_parameters); ++i)
+            {
+                vec_push(&new_symb->data.template_class.type_parameters,
+                    vec_get(&source->data.template_class.type_parameters, i));
+            }
+            new_symb->data.template_class.template_ast = source->data.template_class.template_ast;
+            break;
+        case SYMBOL_TEMPLATE_FN:
+            // Like template classes; the parameters, typed with the type parameters, are needed to infer the type
+            // arguments of a call
+            for (size_t i = 0; i < vec_size(&source->data.template_fn.type_parameters); ++i)
+            {
+                vec_push(&new_symb->data.template_fn.type_parameters,
+                    vec_get(&source->data.template_fn.type_parameters, i));
+            }
+            for (size_t i = 0; i < vec_size(&source->data.template_fn.fn.parameters); ++i)
+            {
+                symbol_t* param = vec_get(&source->data.template_fn.fn.parameters, i);
+                vec_push(&new_symb->data.template_fn.fn.parameters, symbol_clone(param, include_ast, nullptr));
+            }
+            new_symb->data.template_fn.fn.return_type = source->data.template_fn.fn.return_type;
+            new_symb->data.template_fn.template_ast = source->data.template_fn.template_ast;
+            break;
         case SYMBOL_MEMBER:
             if (new_symb->data.member.default_value != nullptr)
                 new_symb->data.member.default_value = ast_expr_clone(new_symb->data.member.default_value);
@@ -149,13 +177,24 @@ void symbol_destroy(symbol_t* symbol)
             break;
         case SYMBOL_NAMESPACE:
             symbol_table_destroy(symbol->data.namespace.exports);
+            symbol_table_destroy(symbol->data.namespace.template_helpers);
+            symbol_table_destroy(symbol->data.namespace.template_scope);
             break;
         case SYMBOL_TEMPLATE_CLASS:
             vec_deinit(&symbol->data.template_class.type_parameters);
             vec_deinit(&symbol->data.template_class.instantiations);
             symbol_table_destroy(symbol->data.template_class.cls.symbols);
+            if (symbol->ast != nullptr)
+                ast_node_destroy(symbol->data.template_class.template_ast);
             break;
         case SYMBOL_TEMPLATE_FN:
+            if (symbol->ast != nullptr)
+            {
+                // Imported clones share the type parameters and the template AST of the original
+                for (size_t i = 0; i < vec_size(&symbol->data.template_fn.type_parameters); ++i)
+                    symbol_destroy(vec_get(&symbol->data.template_fn.type_parameters, i));
+                ast_node_destroy(symbol->data.template_fn.template_ast);
+            }
             vec_deinit(&symbol->data.template_fn.type_parameters);
             vec_deinit(&symbol->data.template_fn.instantiations);
             vec_deinit(&symbol->data.template_fn.fn.parameters);
@@ -177,11 +216,27 @@ void symbol_destroy(symbol_t* symbol)
     free(symbol);
 }
 
+void symbol_set_parent_namespace(symbol_t* symbol, symbol_t* parent_namespace)
+{
+    symbol->parent_namespace = parent_namespace;
+    fill_in_fully_qualified_name(symbol);
+}
+
 void symbol_destroy_void(void* symbol)
 {
     symbol_destroy((symbol_t*)symbol);
 }
 
+bool symbol_is_class(symbol_t* symbol)
+{
+    return symbol->kind == SYMBOL_CLASS || symbol->kind == SYMBOL_TEMPLATE_CLASS_INST;
+}
+
+bool symbol_is_function(symbol_t* symbol)
+{
+    return symbol->kind == SYMBOL_FUNCTION || symbol->kind == SYMBOL_TEMPLATE_FN_INST;
+}
+
 static void fill_in_fully_qualified_name(symbol_t* symbol)
 {
     free(symbol->fully_qualified_name);  // Free the old name before reassigning
@@ -208,3 +263,28 @@ static void fill_in_fully_qualified_name(symbol_t* symbol)
 
     symbol->fully_qualified_name = string_release(&str);
 }
+
+bool symbol_is_module_local_function(symbol_t* fn_symb)
+{
+    if (fn_symb->ast == nullptr || fn_symb->data.function.extern_abi != nullptr)
+        return false;  // imported or external
+
+    if (AST_KIND(fn_symb->ast) == AST_DEF_FN)
+    {
+        ast_fn_def_t* fn_def = (ast_fn_def_t*)fn_symb->ast;
+        return !fn_def->exported && !fn_symb->data.function.called_by_templates && fn_def->body != nullptr &&
+            strcmp(fn_def->base.name, "main") != 0;
+    }
+
+    // Every module emits its own copy of the template instances it uses
+    symbol_t* class_symb = fn_symb->parent_namespace;
+    if (AST_KIND(fn_symb->ast) == AST_DEF_METHOD && class_symb != nullptr &&
+        class_symb->kind == SYMBOL_TEMPLATE_CLASS_INST)
+    {
+        return true;
+    }
+
+    return AST_KIND(fn_symb->ast) == AST_DEF_METHOD && class_symb != nullptr && class_symb->kind == SYMBOL_CLASS &&
+        class_symb->ast != nullptr && AST_KIND(class_symb->ast) == AST_DEF_CLASS &&
+        !((ast_class_def_t*)class_symb->ast)->exported;
+}
@@ -43,6 +43,9 @@ typedef struct symbol
             size_t overload_index;
             char* extern_abi;         // nullpt if function is not extern decl
             bool is_builtin;
+            bool address_taken;       // used as a value by &name, so it may be called indirectly
+            bool called_by_templates; // not exported, but the module's templates call it from instances in other
+                                      // modules
         } function;  // used by function & method
 
         struct cls_dat
@@ -57,23 +60,29 @@ typedef struct symbol
 
         struct
         {
-            symbol_table_t* exports;  // memory owned by us
+            symbol_table_t* exports;           // memory owned by us
+            symbol_table_t* template_helpers;  // of an imported module: the private symbols its templates use (memory
+                                               // owned by us), nullptr otherwise
+            symbol_table_t* template_scope;    // of an imported module: what the instances of its templates resolve
+                                               // names in, its exports and template helpers (no ownership)
         } namespace;
 
         struct
         {
             struct fn_dat fn;          // MUST BE FIRST to align with data.function
             vec_t type_parameters;     // vec<symbol_t*> - type parameter symbols
-            vec_t instantiations;      // vec<symbol_t*> - cache of instantiated symbols
-            ast_node_t* template_ast;  // original template AST (not owned by symbol)
+            vec_t instantiations;      // vec<symbol_t*> - cache of instantiated symbols (owned)
+            ast_node_t* template_ast;  // unanalyzed copy of the function the instances are cloned from (owned by the
+                                       // symbol the decl collector created, shared by its imported clones)
         } template_fn;
 
         struct
         {
             struct cls_dat cls;        // MUST BE FIRST to align with data.class
             vec_t type_parameters;     // vec<symbol_t*> - type parameter symbols
-            vec_t instantiations;      // vec<symbol_t*> - cache of instantiated symbols
-            ast_node_t* template_ast;  // original template AST (not owned by symbol)
+            vec_t instantiations;      // vec<symbol_t*> - cache of instantiated symbols (owned)
+            ast_node_t* template_ast;  // unanalyzed copy of the class the instances are cloned from (owned by the
+                                       // symbol the decl collector created, shared by its imported clones)
         } template_class;
 
         struct
@@ -81,7 +90,7 @@ typedef struct symbol
             struct fn_dat fn;             // MUST BE FIRST to align with data.function
             symbol_t* template_symbol;    // pointer to template symbol
             vec_t type_arguments;         // vec<ast_type_t*> - concrete types
-            ast_node_t* instantiated_ast; // cloned and specialized AST (not owned - owned by AST tree)
+            ast_node_t* instantiated_ast; // cloned and specialized AST (owned by semantic_context)
         } template_fn_inst;
 
         struct
@@ -89,7 +98,7 @@ typedef struct symbol
             struct cls_dat cls;           // MUST BE FIRST to align with data.class
             symbol_t* template_symbol;    // pointer to template symbol
             vec_t type_arguments;         // vec<ast_type_t*> - concrete types
-            ast_node_t* instantiated_ast; // cloned and specialized AST (not owned - owned by AST tree)
+            ast_node_t* instantiated_ast; // cloned and specialized AST (owned by semantic_context)
         } template_class_inst;
     } data;
 } symbol_t;
@@ -105,6 +114,20 @@ symbol_t* symbol_clone(symbol_t* source, bool include_ast, symbol_t* parent_name
 
 void symbol_destroy(symbol_t* symbol);
 
+// Place symbol in a namespace without making it one of the namespace's exports, which changes its fully qualified name
+void symbol_set_parent_namespace(symbol_t* symbol, symbol_t* parent_namespace);
+
+// Whether symbol is a class with members and methods: a class or an instance of a template class
+bool symbol_is_class(symbol_t* symbol);
+
+// Whether symbol is a free function that can be called: a function or an instance of a template function
+bool symbol_is_function(symbol_t* symbol);
+
+// Whether a function or method can only be called from the module defining it: a function that is neither exported,
+// called by the module's templates, external nor main (which includes template function instances), or a method of a
+// class that is not exported or of a template instance
+bool symbol_is_module_local_function(symbol_t* fn_symb);
+
 void symbol_destroy_void(void* symbol);
 
 #endif
@@ -5,15 +5,29 @@
 #include "sema/symbol.h"
 
 typedef struct semantic_context semantic_context_t;
+typedef struct symbol_table symbol_table_t;
+
+// Every module emits the instances it uses, with internal linkage. Their names resolve like in the module defining the
+// template though, which may be another one: there the exports and the private helpers of that module are visible, but
+// not what the module using the template defines (see semantic_context_enter_template_scope).
 
 // Instantiate a template function with the given type arguments
-// Returns the instance symbol (cached if previously instantiated)
+// Returns the instance symbol (cached if previously instantiated), an ordinary function named e.g. max<i32>
 // Returns nullptr on error (errors added to semantic context)
+// The instance's signature is collected immediately, its body is analyzed along with the module
 symbol_t* instantiate_template_function(semantic_context_t* ctx, symbol_t* template_symbol, vec_t* type_args);
 
 // Instantiate a template class with the given type arguments
-// Returns the instance symbol (cached if previously instantiated)
+// Returns the instance symbol (cached if previously instantiated), an ordinary class whose type is its symbol's type
 // Returns nullptr on error (errors added to semantic context)
+// The instance's members and methods are collected immediately, its method bodies are analyzed along with the module
 symbol_t* instantiate_template_class(semantic_context_t* ctx, symbol_t* template_symbol, vec_t* type_args);
 
+// The template that an instance of a template function or class was made from
+symbol_t* template_instance_template(symbol_t* instance_symbol);
+
+// Declare the template's type parameters in scope as the instance's type arguments, so resolving the types of the
+// cloned template yields the types of the instance
+void template_bind_type_arguments(symbol_t* instance_symbol, symbol_table_t* scope);
+
 #endif
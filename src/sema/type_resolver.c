@@ -48,6 +48,9 @@ static symbol_t* lookup_class_symbol(semantic_context_t* ctx, const char* name,
     for (size_t i = 0; i < vec_size(overloads); ++i)
     {
         symbol_t* class_symb = vec_get(overloads, i);
+        if (class_symb->kind == SYMBOL_NAMESPACE)
+            continue;  // a module can export a class of its own name
+
         bool is_ours = class_symb->parent_namespace == nullptr || class_symb->parent_namespace == ctx->module_namespace;
         if (is_ours)
         {
@@ -66,9 +69,42 @@ static symbol_t* lookup_class_symbol(semantic_context_t* ctx, const char* name,
             break;
         }
     }
+
+    if (selected_class == nullptr && emit_errors)
+        semantic_context_add_error(ctx, node, ssprintf("undefined type '%s'", name));
     return selected_class;
 }
 
+bool type_resolver_is_dependent(ast_type_t* type)
+{
+    switch (type->kind)
+    {
+        case AST_TYPE_VARIABLE:
+        case AST_TYPE_TEMPLATE_INSTANCE:
+            return true;
+        case AST_TYPE_POINTER:
+            return type_resolver_is_dependent(type->data.pointer.pointee);
+        case AST_TYPE_ARRAY:
+            return type_resolver_is_dependent(type->data.array.element_type);
+        case AST_TYPE_HEAP_ARRAY:
+            return type_resolver_is_dependent(type->data.heap_array.element_type);
+        case AST_TYPE_VIEW:
+            return type_resolver_is_dependent(type->data.view.element_type);
+        default:
+            return false;
+    }
+}
+
+static bool has_type_variable(vec_t* types)
+{
+    for (size_t i = 0; i < vec_size(types); ++i)
+    {
+        if (type_resolver_is_dependent(vec_get(types, i)))
+            return true;
+    }
+    return false;
+}
+
 ast_type_t* type_resolver_solve(semantic_context_t* ctx, ast_type_t* type, void* node, bool emit_errors)
 {
     // TODO: We could consider cleaning up the no-longer used types already (when the inner type had expressions
@@ -101,20 +137,22 @@ ast_type_t* type_resolver_solve(semantic_context_t* ctx, ast_type_t* type, void*
                 return type;  // no changes
             return ast_type_pointer(inner_type);
         case AST_TYPE_VARIABLE:
+        {
             // Type variables are used in template contexts
             // During decl_collector, type parameters might not be in scope yet, so skip validation
             // During semantic_analyzer, validate that the type parameter exists in scope
+            // In a template instance, the parameter is bound to its type argument
+            symbol_t* type_param = symbol_table_lookup(ctx->current, type->data.type_variable.name);
+            if (type_param != nullptr && type_param->kind == SYMBOL_TYPE_PARAMETER)
+                return type_param->type;
             if (emit_errors)
             {
-                symbol_t* type_param = symbol_table_lookup(ctx->current, type->data.type_variable.name);
-                if (type_param == nullptr || type_param->kind != SYMBOL_TYPE_PARAMETER)
-                {
-                    semantic_context_add_error(ctx, node, ssprintf("undefined type parameter '%s'",
-                        type->data.type_variable.name));
-                    return ast_type_invalid();
-                }
+                semantic_context_add_error(ctx, node, ssprintf("undefined type parameter '%s'",
+                    type->data.type_variable.name));
+                return ast_type_invalid();
             }
             return type;
+        }
         case AST_TYPE_TEMPLATE_INSTANCE:
             // Template instances are already fully resolved
             return type;
@@ -164,19 +202,18 @@ ast_type_t* type_resolver_solve(semantic_context_t* ctx, ast_type_t* type, void*
                             return ast_type_invalid();
                         }
 
+                        // Inside a template definition the arguments may be type parameters: the instance type only
+                        // stands in for the instances made for every instance of the enclosing template
+                        if (has_type_variable(&resolved_args))
+                            return ast_type_template_instance(class_symb, &resolved_args);
+
                         // Instantiate the template (this ensures the instance symbol is created and cached)
                         symbol_t* instance = instantiate_template_class(ctx, class_symb, &resolved_args);
-
+                        vec_deinit(&resolved_args);
                         if (instance == nullptr)
-                        {
-                            vec_deinit(&resolved_args);
                             return ast_type_invalid();
-                        }
 
-                        // Create the template instance type pointing to the instance symbol
-                        ast_type_t* result = ast_type_template_instance(instance, &resolved_args);
-                        vec_deinit(&resolved_args);
-                        return result;
+                        return instance->type;
                     }
                     else
                     {
@@ -11,4 +11,7 @@
 // If emit_errors is false, failures are silent (useful during declaration collection).
 ast_type_t* type_resolver_solve(semantic_context_t* ctx, ast_type_t*, void* node, bool emit_errors);
 
+// Whether type refers to type parameters, so that it is only known in each instance of a template
+bool type_resolver_is_dependent(ast_type_t* type);
+
 #endif
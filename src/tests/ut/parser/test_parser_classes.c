@@ -573,3 +573,54 @@ TEST(parser_classes_fixture_t, parse_method_with_at_prefix_sets_is_trait_impl)
     ast_node_destroy(root);
     ast_node_destroy(expected);
 }
+
+TEST(parser_classes_fixture_t, parse_unchecked_method)
+{
+    parser_set_source(fix->parser, "test",
+        "class Buffer {\n"
+        "    @unchecked fn get(i: i32) -> i32 { return i; }\n"
+        "}");
+    ast_root_t* root = parser_parse(fix->parser);
+    ASSERT_NEQ(nullptr, root);
+    ASSERT_EQ(0, vec_size(parser_errors(fix->parser)));
+
+    ast_method_def_t* method = (ast_method_def_t*)ast_method_def_create_va("get", ast_type_builtin(TYPE_I32),
+        ast_compound_stmt_create_va(
+            ast_return_stmt_create(ast_ref_expr_create("i")),
+            nullptr),
+        ast_param_decl_create("i", ast_type_builtin(TYPE_I32)),
+        nullptr);
+    method->base.unchecked = true;
+    ast_root_t* expected = ast_root_create_va(
+        ast_class_def_create_va("Buffer", (ast_def_t*)method, nullptr),
+        nullptr);
+
+    ASSERT_TREES_EQUAL(expected, root);
+    ast_node_destroy(root);
+    ast_node_destroy(expected);
+}
+
+TEST(parser_classes_fixture_t, parse_inline_method)
+{
+    parser_set_source(fix->parser, "test",
+        "class Buffer {\n"
+        "    @inline fn size() -> i32 { return 0; }\n"
+        "}");
+    ast_root_t* root = parser_parse(fix->parser);
+    ASSERT_NEQ(nullptr, root);
+    ASSERT_EQ(0, vec_size(parser_errors(fix->parser)));
+
+    ast_method_def_t* method = (ast_method_def_t*)ast_method_def_create_va("size", ast_type_builtin(TYPE_I32),
+        ast_compound_stmt_create_va(
+            ast_return_stmt_create(ast_int_lit_val(0)),
+            nullptr),
+        nullptr);
+    method->base.always_inline = true;
+    ast_root_t* expected = ast_root_create_va(
+        ast_class_def_create_va("Buffer", (ast_def_t*)method, nullptr),
+        nullptr);
+
+    ASSERT_TREES_EQUAL(expected, root);
+    ast_node_destroy(root);
+    ast_node_destroy(expected);
+}
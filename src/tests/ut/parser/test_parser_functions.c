@@ -214,3 +214,84 @@ TEST(parser_functions_fixture_t, parse_extern_function_with_abi)
     ast_node_destroy(root);
     ast_node_destroy(expected);
 }
+
+// Parse function definitions prefixed with the @unchecked attribute
+TEST(parser_functions_fixture_t, parse_unchecked_function_attribute)
+{
+    parser_set_source(fix->parser, "test", "@unchecked fn foo() { } @unchecked export fn bar() { }");
+    ast_root_t* root = parser_parse(fix->parser);
+    ASSERT_NEQ(nullptr, root);
+    ASSERT_EQ(0, vec_size(parser_errors(fix->parser)));
+
+    vec_t empty_params = VEC_INIT(ast_node_destroy);
+    ast_fn_def_t* foo = (ast_fn_def_t*)ast_fn_def_create_va("foo", nullptr, ast_compound_stmt_create_empty(),
+        nullptr);
+    foo->unchecked = true;
+    ast_fn_def_t* bar = (ast_fn_def_t*)ast_fn_def_create("bar", &empty_params, nullptr,
+        ast_compound_stmt_create_empty(), true);
+    bar->unchecked = true;
+    ast_root_t* expected = ast_root_create_va((ast_def_t*)foo, (ast_def_t*)bar, nullptr);
+
+    ASSERT_TREES_EQUAL(expected, root);
+    ast_node_destroy(root);
+    ast_node_destroy(expected);
+}
+
+// Parse inlining and hotness attributes; several attributes can be combined
+TEST(parser_functions_fixture_t, parse_inlining_function_attributes)
+{
+    parser_set_source(fix->parser, "test",
+        "@inline @hot fn foo() { }\n"
+        "@noinline @cold fn bar() { }\n"
+        "@flatten fn baz() { }");
+    ast_root_t* root = parser_parse(fix->parser);
+    ASSERT_NEQ(nullptr, root);
+    ASSERT_EQ(0, vec_size(parser_errors(fix->parser)));
+
+    ast_fn_def_t* foo = (ast_fn_def_t*)ast_fn_def_create_va("foo", nullptr, ast_compound_stmt_create_empty(),
+        nullptr);
+    foo->always_inline = true;
+    foo->hot = true;
+    ast_fn_def_t* bar = (ast_fn_def_t*)ast_fn_def_create_va("bar", nullptr, ast_compound_stmt_create_empty(),
+        nullptr);
+    bar->no_inline = true;
+    bar->cold = true;
+    ast_fn_def_t* baz = (ast_fn_def_t*)ast_fn_def_create_va("baz", nullptr, ast_compound_stmt_create_empty(),
+        nullptr);
+    baz->flatten = true;
+    ast_root_t* expected = ast_root_create_va((ast_def_t*)foo, (ast_def_t*)bar, (ast_def_t*)baz, nullptr);
+
+    ASSERT_TREES_EQUAL(expected, root);
+    ast_node_destroy(root);
+    ast_node_destroy(expected);
+}
+
+TEST(parser_functions_fixture_t, parse_conflicting_function_attributes)
+{
+    parser_set_source(fix->parser, "test", "@inline @noinline fn foo() { }");
+    ast_root_t* root = parser_parse(fix->parser);
+    ASSERT_NEQ(nullptr, root);
+
+    vec_t* errors = parser_errors(fix->parser);
+    ASSERT_EQ(1, vec_size(errors));
+    compiler_error_t* err = vec_get(errors, 0);
+    ASSERT_EQ("identifier (noinline): conflicting function attribute", err->description);
+
+    ast_node_destroy(root);
+}
+
+TEST(parser_functions_fixture_t, parse_unknown_function_attribute)
+{
+    parser_set_source(fix->parser, "test", "@fast fn foo() { }");
+    ast_root_t* root = parser_parse(fix->parser);
+    ASSERT_NEQ(nullptr, root);
+
+    vec_t* errors = parser_errors(fix->parser);
+    ASSERT_EQ(1, vec_size(errors));
+    compiler_error_t* err = vec_get(errors, 0);
+    ASSERT_EQ(1, err->line);
+    ASSERT_EQ(2, err->column);
+    ASSERT_EQ("identifier (fast): unknown function attribute", err->description);
+
+    ast_node_destroy(root);
+}
@@ -12,6 +12,7 @@
 #include "ast/stmt/for_stmt.h"
 #include "ast/stmt/if_stmt.h"
 #include "ast/stmt/inc_dec_stmt.h"
+#include "ast/stmt/return_stmt.h"
 #include "ast/stmt/while_stmt.h"
 #include "ast/type.h"
 #include "compiler_error.h"
@@ -388,6 +389,109 @@ TEST(parser_statements_fixture_t, parse_break_stmt)
     ast_node_destroy(expected);
 }
 
+TEST(parser_statements_fixture_t, parse_for_stmt_with_loop_attributes)
+{
+    parser_set_source(fix->parser, "test",
+        "@unroll(4) @vectorize(width=8)\n"
+        "for (;;) {\n"
+        "}");
+
+    ast_stmt_t* stmt = parser_parse_stmt(fix->parser);
+    ASSERT_NEQ(nullptr, stmt);
+    ASSERT_EQ(0, vec_size(parser_errors(fix->parser)));
+
+    ast_stmt_t* expected = ast_for_stmt_create(nullptr, nullptr, nullptr, ast_compound_stmt_create_empty());
+    ((ast_for_stmt_t*)expected)->hints = (ast_loop_hints_t){
+        .unroll = AST_LOOP_UNROLL_COUNT,
+        .unroll_count = 4,
+        .vectorize = AST_LOOP_VECTORIZE_ENABLE,
+        .vectorize_width = 8,
+    };
+
+    ASSERT_TREES_EQUAL(expected, stmt);
+    ast_node_destroy(expected);
+    ast_node_destroy(stmt);
+}
+
+TEST(parser_statements_fixture_t, parse_while_stmt_with_loop_attributes)
+{
+    parser_set_source(fix->parser, "test",
+        "@unroll(full) @novectorize while (flag) {\n"
+        "}");
+
+    ast_stmt_t* stmt = parser_parse_stmt(fix->parser);
+    ASSERT_NEQ(nullptr, stmt);
+    ASSERT_EQ(0, vec_size(parser_errors(fix->parser)));
+
+    ast_stmt_t* expected = ast_while_stmt_create(ast_ref_expr_create("flag"), ast_compound_stmt_create_empty());
+    ((ast_while_stmt_t*)expected)->hints = (ast_loop_hints_t){
+        .unroll = AST_LOOP_UNROLL_FULL,
+        .vectorize = AST_LOOP_VECTORIZE_DISABLE,
+    };
+
+    ASSERT_TREES_EQUAL(expected, stmt);
+    ast_node_destroy(expected);
+    ast_node_destroy(stmt);
+}
+
+TEST(parser_statements_fixture_t, parse_loop_attribute_zero_unroll_count)
+{
+    parser_set_source(fix->parser, "test", "@unroll(0) while (flag) { }");
+
+    ast_stmt_t* stmt = parser_parse_stmt(fix->parser);
+
+    vec_t* errors = parser_errors(fix->parser);
+    ASSERT_EQ(1, vec_size(errors));
+    compiler_error_t* err = vec_get(errors, 0);
+    ASSERT_EQ("number (0): expected a positive integer", err->description);
+
+    ast_node_destroy(stmt);
+}
+
+TEST(parser_statements_fixture_t, parse_loop_attribute_without_loop)
+{
+    parser_set_source(fix->parser, "test", "@unroll(2) var x = 1;");
+
+    ast_stmt_t* stmt = parser_parse_stmt(fix->parser);
+    ASSERT_EQ(nullptr, stmt);
+
+    vec_t* errors = parser_errors(fix->parser);
+    ASSERT_EQ(1, vec_size(errors));
+    compiler_error_t* err = vec_get(errors, 0);
+    ASSERT_EQ("var: loop attributes must be followed by a for or while loop", err->description);
+}
+
+TEST(parser_statements_fixture_t, parse_return_stmt_with_tail_attribute)
+{
+    parser_set_source(fix->parser, "test", "return @tail f(n)");
+
+    ast_stmt_t* stmt = parser_parse_stmt(fix->parser);
+    ASSERT_NEQ(nullptr, stmt);
+    ASSERT_EQ(0, vec_size(parser_errors(fix->parser)));
+
+    ast_stmt_t* expected = ast_return_stmt_create(
+        ast_call_expr_create_va(ast_ref_expr_create("f"), ast_ref_expr_create("n"), nullptr));
+    ((ast_return_stmt_t*)expected)->tail_call = true;
+
+    ASSERT_TREES_EQUAL(expected, stmt);
+    ast_node_destroy(expected);
+    ast_node_destroy(stmt);
+}
+
+TEST(parser_statements_fixture_t, parse_return_stmt_unknown_attribute)
+{
+    parser_set_source(fix->parser, "test", "return @fast f(n)");
+
+    ast_stmt_t* stmt = parser_parse_stmt(fix->parser);
+
+    vec_t* errors = parser_errors(fix->parser);
+    ASSERT_EQ(1, vec_size(errors));
+    compiler_error_t* err = vec_get(errors, 0);
+    ASSERT_EQ("identifier (fast): unknown return attribute", err->description);
+
+    ast_node_destroy(stmt);
+}
+
 TEST(parser_statements_fixture_t, parse_continue_stmt)
 {
     parser_set_source(fix->parser, "test", "continue");
@@ -413,6 +413,7 @@ TEST(ut_sema_classes_fixture_t, chained_member_access)
     ast_node_destroy(root);
 }
 
+// Types without builtin methods (integers have hash()) have no members either
 TEST(ut_sema_classes_fixture_t, member_access_on_non_class_type)
 {
     ast_expr_t* error_node = ast_ref_expr_create("x");
@@ -420,7 +421,7 @@ TEST(ut_sema_classes_fixture_t, member_access_on_non_class_type)
     ast_root_t* root = ast_root_create_va(
         ast_fn_def_create_va("main", nullptr,
             ast_compound_stmt_create_va(
-                ast_decl_stmt_create(ast_var_decl_create("x", ast_type_builtin(TYPE_I32), ast_int_lit_val(5))),
+                ast_decl_stmt_create(ast_var_decl_create("x", ast_type_builtin(TYPE_BOOL), ast_bool_lit_create(true))),
                 ast_expr_stmt_create(ast_member_access_create(error_node, "field")),
                 nullptr),
             nullptr),
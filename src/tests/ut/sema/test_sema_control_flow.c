@@ -332,3 +332,58 @@ TEST(ut_sema_cf_fixture_t, continue_outside_loop_error)
 
     ast_node_destroy(block);
 }
+
+// @vectorize can not be honored for loops with an early exit
+TEST(ut_sema_cf_fixture_t, vectorize_loop_with_break_warns)
+{
+    ast_stmt_t* while_stmt = ast_while_stmt_create(
+        ast_bool_lit_create(true),
+        ast_compound_stmt_create_va(
+            ast_break_stmt_create(),
+            nullptr));
+    ((ast_while_stmt_t*)while_stmt)->hints.vectorize = AST_LOOP_VECTORIZE_ENABLE;
+
+    bool res = semantic_analyzer_run(fix->sema, AST_NODE(while_stmt));
+    ASSERT_TRUE(res);
+    ASSERT_EQ(1, vec_size(&fix->ctx->warning_nodes));
+    ASSERT_EQ(while_stmt, vec_get(&fix->ctx->warning_nodes, 0));
+    compiler_error_t* warning = vec_get(AST_NODE(while_stmt)->errors, 0);
+    ASSERT_TRUE(warning->is_warning);
+    ASSERT_NEQ(nullptr, strstr(warning->description, "loop can exit early"));
+
+    ast_node_destroy(while_stmt);
+}
+
+// A break in a nested loop does not exit the outer loop
+TEST(ut_sema_cf_fixture_t, vectorize_loop_with_nested_break_is_valid)
+{
+    ast_stmt_t* while_stmt = ast_while_stmt_create(
+        ast_bool_lit_create(true),
+        ast_compound_stmt_create_va(
+            ast_while_stmt_create(ast_bool_lit_create(true), ast_compound_stmt_create_va(
+                ast_break_stmt_create(),
+                nullptr)),
+            nullptr));
+    ((ast_while_stmt_t*)while_stmt)->hints.vectorize = AST_LOOP_VECTORIZE_ENABLE;
+
+    bool res = semantic_analyzer_run(fix->sema, AST_NODE(while_stmt));
+    ASSERT_TRUE(res);
+    ASSERT_EQ(0, vec_size(&fix->ctx->warning_nodes));
+
+    ast_node_destroy(while_stmt);
+}
+
+// @unroll(full) needs a loop condition
+TEST(ut_sema_cf_fixture_t, unroll_full_without_condition_warns)
+{
+    ast_stmt_t* for_stmt = ast_for_stmt_create(nullptr, nullptr, nullptr, ast_compound_stmt_create_empty());
+    ((ast_for_stmt_t*)for_stmt)->hints.unroll = AST_LOOP_UNROLL_FULL;
+
+    bool res = semantic_analyzer_run(fix->sema, AST_NODE(for_stmt));
+    ASSERT_TRUE(res);
+    ASSERT_EQ(1, vec_size(&fix->ctx->warning_nodes));
+    compiler_error_t* warning = vec_get(AST_NODE(for_stmt)->errors, 0);
+    ASSERT_NEQ(nullptr, strstr(warning->description, "@unroll(full) ignored"));
+
+    ast_node_destroy(for_stmt);
+}
@@ -5,7 +5,9 @@
 #include "ast/def/fn_def.h"
 #include "ast/def/method_def.h"
 #include "ast/expr/call_expr.h"
+#include "ast/expr/cast_expr.h"
 #include "ast/expr/member_access.h"
+#include "ast/expr/method_call.h"
 #include "ast/expr/ref_expr.h"
 #include "ast/expr/self_expr.h"
 #include "ast/node.h"
@@ -22,6 +24,8 @@
 #include "test_runner.h"
 #include "sema_shared.h"
 
+#include <string.h>
+
 TEST_FIXTURE(ut_sema_templates_fixture_t)
 {
     semantic_analyzer_t* sema;
@@ -195,6 +199,36 @@ TEST(ut_sema_templates_fixture_t, templated_class_with_methods)
     ast_node_destroy(root);
 }
 
+// A method of a type parameter is only known in each instance; in the definition its result is cast to a known type
+TEST(ut_sema_templates_fixture_t, templated_class_calls_method_of_type_parameter)
+{
+    // Create: class Keyed<T> { var key: T; fn hash() -> u64 { return self.key.hash() as u64; } }
+    vec_t type_params = VEC_INIT(ast_node_destroy);
+    vec_push(&type_params, ast_type_param_decl_create("T"));
+
+    vec_t members = VEC_INIT(ast_node_destroy);
+    vec_push(&members, ast_member_decl_create("key", ast_type_variable("T"), nullptr));
+
+    ast_expr_t* hash_call = ast_method_call_create_va(ast_member_access_create(ast_self_expr_create(false), "key"),
+        "hash", nullptr);
+    vec_t methods = VEC_INIT(ast_node_destroy);
+    vec_push(&methods, ast_method_def_create_va("hash", ast_type_builtin(TYPE_U64),
+        ast_compound_stmt_create_va(
+            ast_return_stmt_create(ast_cast_expr_create(hash_call, ast_type_builtin(TYPE_U64))),
+            nullptr),
+        nullptr));
+
+    ast_class_def_t* class_def = (ast_class_def_t*)ast_class_def_create("Keyed", &members, &methods, false);
+    class_def->type_params = type_params;
+
+    ast_root_t* root = ast_root_create_va((ast_def_t*)class_def, nullptr);
+
+    ASSERT_SEMA_SUCCESS_WITH_DECL_COLLECTOR(AST_NODE(root));
+    ASSERT_EQ(AST_TYPE_VARIABLE, hash_call->type->kind);
+
+    ast_node_destroy(root);
+}
+
 // Test that type variables are only valid within template scope
 TEST(ut_sema_templates_fixture_t, type_variable_outside_template_scope_error)
 {
@@ -303,3 +337,108 @@ TEST(ut_sema_templates_fixture_t, template_function_multiple_type_params)
 
     ast_node_destroy(root);
 }
+
+// Test that instantiating a template class yields an ordinary class with the type arguments substituted
+TEST(ut_sema_templates_fixture_t, template_class_instantiation)
+{
+    // Create: class Container<T> { var data: T; fn get() -> T { return self.data; } }
+    vec_t type_params = VEC_INIT(ast_node_destroy);
+    vec_push(&type_params, ast_type_param_decl_create("T"));
+
+    vec_t members = VEC_INIT(ast_node_destroy);
+    vec_push(&members, ast_member_decl_create("data", ast_type_variable("T"), nullptr));
+
+    vec_t methods = VEC_INIT(ast_node_destroy);
+    vec_push(&methods, ast_method_def_create_va("get", ast_type_variable("T"),
+        ast_compound_stmt_create_va(
+            ast_return_stmt_create(
+                ast_member_access_create(ast_self_expr_create(false), "data")),
+            nullptr),
+        nullptr));
+
+    ast_class_def_t* class_def = (ast_class_def_t*)ast_class_def_create("Container", &members, &methods, false);
+    class_def->type_params = type_params;
+
+    ast_root_t* root = ast_root_create_va((ast_def_t*)class_def, nullptr);
+
+    bool res = decl_collector_run(fix->collector, AST_NODE(root));
+    ASSERT_TRUE(res);
+
+    symbol_t* template_symbol = symbol_table_lookup(fix->ctx->global, "Container");
+    ASSERT_NEQ(nullptr, template_symbol);
+
+    vec_t type_args = VEC_INIT(nullptr);
+    vec_push(&type_args, ast_type_builtin(TYPE_I32));
+    symbol_t* instance = instantiate_template_class(fix->ctx, template_symbol, &type_args);
+    ASSERT_NEQ(nullptr, instance);
+    ASSERT_EQ(SYMBOL_TEMPLATE_CLASS_INST, instance->kind);
+    ASSERT_EQ(0, strcmp("Container<i32>", instance->name));
+    ASSERT_TRUE(symbol_is_class(instance));
+
+    // Members are collected with the type arguments in place of the type parameters
+    symbol_t* member = symbol_table_lookup(instance->data.template_class_inst.cls.symbols, "data");
+    ASSERT_NEQ(nullptr, member);
+    ASSERT_EQ(ast_type_builtin(TYPE_I32), member->type);
+
+    // Instances are cached per type arguments
+    ASSERT_EQ(instance, instantiate_template_class(fix->ctx, template_symbol, &type_args));
+    vec_deinit(&type_args);
+
+    // The instance's method bodies are analyzed with the module
+    res = semantic_analyzer_run(fix->sema, AST_NODE(root));
+    ASSERT_TRUE(res);
+    ASSERT_EQ(1, vec_size(&fix->ctx->template_instances));
+
+    ast_node_destroy(root);
+}
+
+// Test that instantiating a template function yields a callable function with the type arguments substituted
+TEST(ut_sema_templates_fixture_t, template_function_instantiation)
+{
+    // Create: fn identity<T>(value: T) -> T { return value; }
+    vec_t type_params = VEC_INIT(ast_node_destroy);
+    vec_push(&type_params, ast_type_param_decl_create("T"));
+
+    vec_t params = VEC_INIT(ast_node_destroy);
+    vec_push(&params, ast_param_decl_create("value", ast_type_variable("T")));
+
+    ast_fn_def_t* fn_def = (ast_fn_def_t*)ast_fn_def_create("identity", &params, ast_type_variable("T"),
+        ast_compound_stmt_create_va(
+            ast_return_stmt_create(ast_ref_expr_create("value")),
+            nullptr),
+        false);
+    fn_def->type_params = type_params;
+
+    ast_root_t* root = ast_root_create_va((ast_def_t*)fn_def, nullptr);
+
+    bool res = decl_collector_run(fix->collector, AST_NODE(root));
+    ASSERT_TRUE(res);
+
+    symbol_t* template_symbol = symbol_table_lookup(fix->ctx->global, "identity");
+    ASSERT_NEQ(nullptr, template_symbol);
+
+    vec_t type_args = VEC_INIT(nullptr);
+    vec_push(&type_args, ast_type_builtin(TYPE_I32));
+    symbol_t* instance = instantiate_template_function(fix->ctx, template_symbol, &type_args);
+    ASSERT_NEQ(nullptr, instance);
+    ASSERT_EQ(SYMBOL_TEMPLATE_FN_INST, instance->kind);
+    ASSERT_EQ(0, strcmp("identity<i32>", instance->name));
+    ASSERT_TRUE(symbol_is_function(instance));
+
+    // Parameters and return type are collected with the type arguments in place of the type parameters
+    ASSERT_EQ(1, vec_size(&instance->data.function.parameters));
+    symbol_t* param = vec_get(&instance->data.function.parameters, 0);
+    ASSERT_EQ(ast_type_builtin(TYPE_I32), param->type);
+    ASSERT_EQ(ast_type_builtin(TYPE_I32), instance->data.function.return_type);
+
+    // Instances are cached per type arguments
+    ASSERT_EQ(instance, instantiate_template_function(fix->ctx, template_symbol, &type_args));
+    vec_deinit(&type_args);
+
+    // The instance's body is analyzed with the module
+    res = semantic_analyzer_run(fix->sema, AST_NODE(root));
+    ASSERT_TRUE(res);
+    ASSERT_EQ(1, vec_size(&fix->ctx->template_instances));
+
+    ast_node_destroy(root);
+}
@@ -138,6 +138,21 @@ TEST(toml_parser_fixture_t, parse_with_comments)
     ASSERT_EQ(0, strcmp((char*)hash_table_find(package, "version"), "0.1"));
 }
 
+TEST(toml_parser_fixture_t, parse_dotted_section_name)
+{
+    const char* toml = "[profile.release]\ntarget-cpu = \"native\"\n[profile.debug]\ntarget-cpu = \"x86-64\"";
+    fix->root = toml_parse_string(toml);
+
+    ASSERT_NEQ(nullptr, fix->root);
+    ASSERT_EQ(nullptr, hash_table_find(fix->root, "profile"));
+    hash_table_t* release = hash_table_find(fix->root, "profile.release");
+    ASSERT_NEQ(nullptr, release);
+    ASSERT_EQ(0, strcmp((char*)hash_table_find(release, "target-cpu"), "native"));
+    hash_table_t* debug = hash_table_find(fix->root, "profile.debug");
+    ASSERT_NEQ(nullptr, debug);
+    ASSERT_EQ(0, strcmp((char*)hash_table_find(debug, "target-cpu"), "x86-64"));
+}
+
 TEST(toml_parser_fixture_t, parse_empty_string)
 {
     fix->root = toml_parse_string("");